@@ -1696,6 +1696,7 @@ void AppConfig::UpdateFileTags() {
                 }
             }
             mFileTags.swap();
+            ++mFileTagsVersion;
             LOG_INFO(sLogger, ("local file tags update, old config", mFileTagsJson.toStyledString()));
             mFileTagsJson = localFileTagsJson;
             LOG_INFO(sLogger, ("local file tags update, new config", mFileTagsJson.toStyledString()));
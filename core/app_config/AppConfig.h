@@ -18,6 +18,7 @@
 
 #include <json/json.h>
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -89,6 +90,8 @@ private:
     std::map<std::string, std::function<bool()>*> mCallbacks;
 
     DoubleBuffer<std::vector<sls_logs::LogTag>> mFileTags;
+    // increased each time file tags are swapped, so that consumers can cache derived data
+    std::atomic_uint32_t mFileTagsVersion{0};
     DoubleBuffer<std::map<std::string, std::string>> mAgentAttrs;
 
     Json::Value mFileTagsJson;
@@ -361,6 +364,7 @@ public:
 
     // 文件标签相关，获取从文件中来的tags
     std::vector<sls_logs::LogTag>& GetFileTags() { return mFileTags.getReadBuffer(); }
+    uint32_t GetFileTagsVersion() const { return mFileTagsVersion.load(); }
     // 更新从文件中来的tags
     void UpdateFileTags();
 
@@ -23,12 +23,14 @@
 #include "app_config/AppConfig.h"
 #include "checkpoint/CheckPointManager.h"
 #include "common/CrashBackTraceUtil.h"
+#include "common/DNSCache.h"
 #include "common/Flags.h"
 #include "common/MachineInfoUtil.h"
 #include "common/RuntimeUtil.h"
 #include "common/StringTools.h"
 #include "common/TimeUtil.h"
 #include "common/UUIDUtil.h"
+#include "common/http/Curl.h"
 #include "common/version.h"
 #include "config/ConfigDiff.h"
 #include "config/watcher/ConfigWatcher.h"
@@ -51,6 +53,7 @@
 #include "plugin/input/InputFeedbackInterfaceRegistry.h"
 #include "runner/FlusherRunner.h"
 #include "runner/ProcessorRunner.h"
+#include "runner/sink/file/FileSink.h"
 #include "runner/sink/http/HttpSink.h"
 #ifdef __ENTERPRISE__
 #include "config/provider/EnterpriseConfigProvider.h"
@@ -200,6 +203,7 @@ void Application::Start() { // GCOVR_EXCL_START
     BoundedSenderQueueInterface::SetFeedback(ProcessQueueManager::GetInstance());
 
     HttpSink::GetInstance()->Init();
+    FileSink::GetInstance()->Init();
     FlusherRunner::GetInstance()->Init();
 
     {
@@ -368,6 +372,10 @@ void Application::Exit() {
 
     FlusherRunner::GetInstance()->Stop();
     HttpSink::GetInstance()->Stop();
+    FileSink::GetInstance()->Stop();
+    // pooled handlers must be cleaned up before curl is, which static destruction does not guarantee
+    ClearSyncHttpHandlerPool();
+    DnsCache::GetInstance()->Stop();
 
     // TODO: make it common
     FlusherSLS::RecycleResourceIfNotUsed();
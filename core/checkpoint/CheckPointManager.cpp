@@ -121,6 +121,17 @@ void CheckPointManager::AddDirCheckPoint(const string& dirname) {
 }
 void CheckPointManager::LoadCheckPoint() {
     Json::Value root;
+    if (!ReadCheckPointFile(root)) {
+        return;
+    }
+    LoadDirCheckPoint(root);
+    LoadFileCheckPoint(root);
+    LOG_INFO(sLogger,
+             ("load checkpoint, version", mLoadVersion)("file check point", mDevInodeCheckPointPtrMap.size())(
+                 "dir check point", mDirNameMap.size()));
+}
+
+bool CheckPointManager::ReadCheckPointFile(Json::Value& root) {
     ParseConfResult cptRes = ParseConfig(AppConfig::GetInstance()->GetCheckPointFilePath(), root);
     // if new checkpoint file not exist, check old checkpoint file.
     if (cptRes == CONFIG_NOT_EXIST
@@ -136,19 +147,14 @@ void CheckPointManager::LoadCheckPoint() {
                        AppConfig::GetInstance()->GetCheckPointFilePath()));
             LogtailAlarm::GetInstance()->SendAlarm(CHECKPOINT_ALARM, "content of check point file is not valid json");
         }
-        return;
+        return false;
     }
     if (root.isMember("version")) {
         mLoadVersion = root["version"].asUInt();
     } else {
         mLoadVersion = NO_CHECKPOINT_VERSION;
     }
-
-    LoadDirCheckPoint(root);
-    LoadFileCheckPoint(root);
-    LOG_INFO(sLogger,
-             ("load checkpoint, version", mLoadVersion)("file check point", mDevInodeCheckPointPtrMap.size())(
-                 "dir check point", mDirNameMap.size()));
+    return true;
 }
 
 void CheckPointManager::LoadDirCheckPoint(const Json::Value& root) {
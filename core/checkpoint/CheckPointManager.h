@@ -128,6 +128,8 @@ public:
     void DeleteCheckPoint(DevInode devInode, const std::string& configName);
     void DeleteDirCheckPoint(const std::string& filename);
     void LoadCheckPoint();
+    // returns false if there is no valid checkpoint file
+    bool ReadCheckPointFile(Json::Value& root);
     void LoadDirCheckPoint(const Json::Value& root);
     void LoadFileCheckPoint(const Json::Value& root);
     bool DumpCheckPointToLocal();
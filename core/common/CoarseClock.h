@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+namespace logtail {
+
+// Cheap wall clock for hot paths where a few milliseconds of imprecision is acceptable, e.g. batch timeout checks.
+// On Linux, CLOCK_REALTIME_COARSE is served from vDSO without reading the hardware clock source.
+inline time_t GetCoarseTimeInSeconds() {
+#if defined(__linux__)
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+    return ts.tv_sec;
+#else
+    return time(nullptr);
+#endif
+}
+
+inline int64_t GetCoarseTimeInMilliSeconds() {
+#if defined(__linux__)
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+#else
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+} // namespace logtail
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include "DNSCache.h"
+
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #if defined(__linux__)
 #include <arpa/inet.h>
@@ -22,86 +25,231 @@
 #include <ws2tcpip.h>
 #endif
 
+#include "common/Flags.h"
+#include "common/StringTools.h"
+#include "logger/Logger.h"
+
+DEFINE_FLAG_INT32(dns_cache_ttl_sec, "ttl of a resolved host in dns cache, seconds", 600);
+DEFINE_FLAG_INT32(dns_cache_refresh_ahead_sec, "resolved host is refreshed in background before expiry, seconds", 60);
+DEFINE_FLAG_INT32(dns_cache_min_retry_interval_sec, "min interval to resolve a host again after failure, seconds", 3);
+DEFINE_FLAG_INT32(dns_cache_max_retry_interval_sec, "max interval to resolve a host again after failure, seconds", 300);
+DEFINE_FLAG_INT32(dns_cache_max_stale_sec, "max time to serve addresses after the last successful resolution", 1800);
+DEFINE_FLAG_INT32(dns_cache_first_resolve_timeout_ms, "max time to wait for a host seen for the first time, ms", 200);
+
+using namespace std;
+
 namespace logtail {
-    // ParseHost only supports IPv4 now.
-    bool DnsCache::ParseHost(const char* host, std::string& ip) {
-#if defined(__linux__)
-        struct sockaddr_in addr;
-        memset(&addr, 0, sizeof(addr));
-        addr.sin_family = AF_INET;
-
-        char* buffer = NULL;
-        if (host && host[0]) {
-            if (IsRawIp(host)) {
-                if ((addr.sin_addr.s_addr = inet_addr(host)) == INADDR_NONE)
-                    return false;
-            } else {
-                int bufferLen = 2048;
-                int rc, res;
-                struct hostent* hp = NULL;
-                struct hostent h;
-                while (true) {
-                    buffer = new char[bufferLen];
-                    res = gethostbyname_r(host, &h, buffer, bufferLen, &hp, &rc);
-                    if (res == ERANGE) {
-                        if (buffer != NULL)
-                            delete[] buffer;
-                        bufferLen *= 4;
-                        if (bufferLen > 32768) // 32KB
-                            return false;
-                        continue;
-                    }
-                    if (res != 0 || hp == NULL || hp->h_addr == NULL) {
-                        if (buffer != NULL)
-                            delete[] buffer;
-                        return false;
-                    } else
-                        break;
-                }
-                addr.sin_addr.s_addr = *((in_addr_t*)(hp->h_addr));
+
+static int64_t GetSteadyTimeInMilliSeconds() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+DnsCache::DnsCache() : DnsCache(&DnsCache::ParseHost) {
+}
+
+DnsCache::DnsCache(Resolver&& resolver)
+    : mResolver(std::move(resolver)),
+      mTTLMs(INT32_FLAG(dns_cache_ttl_sec) * 1000LL),
+      mRefreshAheadMs(min(INT32_FLAG(dns_cache_refresh_ahead_sec), INT32_FLAG(dns_cache_ttl_sec) / 2) * 1000LL),
+      mMinRetryIntervalMs(INT32_FLAG(dns_cache_min_retry_interval_sec) * 1000LL),
+      mMaxRetryIntervalMs(INT32_FLAG(dns_cache_max_retry_interval_sec) * 1000LL),
+      mMaxStaleMs(max(INT32_FLAG(dns_cache_max_stale_sec), INT32_FLAG(dns_cache_ttl_sec)) * 1000LL),
+      mFirstResolveTimeoutMs(INT32_FLAG(dns_cache_first_resolve_timeout_ms)),
+      mTable(make_shared<const Table>()) {
+}
+
+bool DnsCache::GetIPFromDnsCache(const string& host, string& address) {
+    if (host.empty()) {
+        return false;
+    }
+    if (IsRawIp(host.c_str())) {
+        if (inet_addr(host.c_str()) == INADDR_NONE) {
+            return false;
+        }
+        address = host;
+        return true;
+    }
+    auto table = atomic_load(&mTable);
+    auto it = table->find(host);
+    if (it == table->end()) {
+        if (!RequestResolve(host)) {
+            return false;
+        }
+        unique_lock<mutex> lock(mTableMux);
+        mTableCV.wait_for(lock, chrono::milliseconds(mFirstResolveTimeoutMs), [&]() {
+            table = atomic_load(&mTable);
+            it = table->find(host);
+            return it != table->end();
+        });
+        if (it == table->end()) {
+            return false;
+        }
+    }
+    const auto& entry = *it->second;
+    auto now = GetSteadyTimeInMilliSeconds();
+    if (now >= entry.mNextResolveTimeMs && !entry.mIsResolving.exchange(true)) {
+        RequestResolve(host);
+    }
+    if (entry.mAddresses.empty() || now - entry.mResolvedTimeMs >= mMaxStaleMs) {
+        return false;
+    }
+    address = entry.mAddresses[entry.mNextIdx.fetch_add(1, memory_order_relaxed) % entry.mAddresses.size()];
+    return true;
+}
+
+void DnsCache::Stop() {
+    {
+        lock_guard<mutex> lock(mPendingMux);
+        if (!mIsThreadRunning) {
+            return;
+        }
+        mIsThreadRunning = false;
+    }
+    mCV.notify_one();
+    // no log here, since it may be called on exit when the logger is gone
+    mThreadRes.wait_for(chrono::seconds(1));
+}
+
+bool DnsCache::RequestResolve(const string& host) {
+    {
+        lock_guard<mutex> lock(mPendingMux);
+        if (!mIsThreadRunning) {
+            if (mThreadRes.valid()) {
+                // stopped
+                return false;
+            }
+            mIsThreadRunning = true;
+            mThreadRes = async(launch::async, &DnsCache::Run, this);
+        }
+        if (mResolvingHosts.find(host) != mResolvingHosts.end() || !mPendingHosts.insert(host).second) {
+            return true;
+        }
+    }
+    mCV.notify_one();
+    return true;
+}
+
+void DnsCache::Run() {
+    unique_lock<mutex> lock(mPendingMux);
+    while (true) {
+        mCV.wait(lock, [this]() { return !mIsThreadRunning || !mPendingHosts.empty(); });
+        if (!mIsThreadRunning) {
+            break;
+        }
+        mResolvingHosts.swap(mPendingHosts);
+        lock.unlock();
+        for (const auto& host : mResolvingHosts) {
+            Resolve(host);
+        }
+        lock.lock();
+        mResolvingHosts.clear();
+    }
+}
+
+void DnsCache::Resolve(const string& host) {
+    vector<string> addresses;
+    auto startTime = GetSteadyTimeInMilliSeconds();
+    bool succeeded = mResolver(host, addresses) && !addresses.empty();
+    auto now = GetSteadyTimeInMilliSeconds();
+    if (now - startTime >= 1000) {
+        LOG_WARNING(sLogger, ("resolve host too slow", host)("cost", ToString(now - startTime) + "ms"));
+    }
+
+    auto table = atomic_load(&mTable);
+    auto entry = make_shared<Entry>();
+    auto it = table->find(host);
+    if (succeeded) {
+        entry->mAddresses = std::move(addresses);
+        entry->mResolvedTimeMs = now;
+        entry->mNextResolveTimeMs = now + mTTLMs - mRefreshAheadMs;
+    } else {
+        if (it != table->end()) {
+            // serve stale addresses until the host can be resolved again, unless they are too old
+            if (now - it->second->mResolvedTimeMs < mMaxStaleMs) {
+                entry->mAddresses = it->second->mAddresses;
+                entry->mResolvedTimeMs = it->second->mResolvedTimeMs;
             }
+            entry->mFailCnt = it->second->mFailCnt + 1;
         } else {
-            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            entry->mFailCnt = 1;
+        }
+        int64_t interval = mMinRetryIntervalMs << min(entry->mFailCnt - 1, 20U);
+        entry->mNextResolveTimeMs = now + min(interval, mMaxRetryIntervalMs);
+        LOG_WARNING(sLogger, ("failed to resolve host", host)("fail count", entry->mFailCnt));
+    }
+    if (it != table->end()) {
+        entry->mNextIdx.store(it->second->mNextIdx.load(memory_order_relaxed), memory_order_relaxed);
+    }
+
+    // only this thread writes the table
+    auto newTable = make_shared<Table>(*table);
+    (*newTable)[host] = std::move(entry);
+    atomic_store(&mTable, shared_ptr<const Table>(std::move(newTable)));
+    {
+        lock_guard<mutex> lock(mTableMux);
+    }
+    mTableCV.notify_all();
+}
+
+bool DnsCache::ParseHost(const string& hostStr, vector<string>& ips) {
+    const char* host = hostStr.c_str();
+    ips.clear();
+    if (host[0] == '\0') {
+        return false;
+    }
+    if (IsRawIp(host)) {
+        if (inet_addr(host) == INADDR_NONE) {
+            return false;
         }
-        ip = inet_ntoa(addr.sin_addr);
-        if (buffer != NULL)
-            delete[] buffer;
+        ips.emplace_back(host);
         return true;
+    }
+#if defined(__linux__)
+    int bufferLen = 2048;
+    int rc, res;
+    struct hostent* hp = NULL;
+    struct hostent h;
+    unique_ptr<char[]> buffer;
+    while (true) {
+        buffer.reset(new char[bufferLen]);
+        res = gethostbyname_r(host, &h, buffer.get(), bufferLen, &hp, &rc);
+        if (res == ERANGE) {
+            bufferLen *= 4;
+            if (bufferLen > 32768) // 32KB
+                return false;
+            continue;
+        }
+        if (res != 0 || hp == NULL || hp->h_addr == NULL || hp->h_addrtype != AF_INET) {
+            return false;
+        }
+        break;
+    }
+    char ip[INET_ADDRSTRLEN];
+    for (char** p = hp->h_addr_list; *p != NULL; ++p) {
+        if (inet_ntop(AF_INET, *p, ip, sizeof(ip)) != NULL) {
+            ips.emplace_back(ip);
+        }
+    }
 #elif defined(_MSC_VER)
-        struct sockaddr_in addr;
-        memset(&addr, 0, sizeof(addr));
-        addr.sin_family = AF_INET;
-        if (host && host[0]) {
-            if (IsRawIp(host)) {
-                if ((addr.sin_addr.s_addr = inet_addr(host)) == INADDR_NONE)
-                    return false;
-            } else {
-                addrinfo hints;
-                struct addrinfo* result = NULL;
-                std::memset(&hints, 0, sizeof(hints));
-                auto ret = ::getaddrinfo(host, NULL, &hints, &result);
-                if (ret != 0) {
-                    return false;
-                }
-
-                bool found = false;
-                for (auto ptr = result; ptr != NULL; ptr = ptr->ai_next) {
-                    if (AF_INET == ptr->ai_family) {
-                        addr.sin_addr = ((struct sockaddr_in*)ptr->ai_addr)->sin_addr;
-                        found = true;
-                        break;
-                    }
-                }
-                freeaddrinfo(result);
-                if (!found)
-                    return false;
+    addrinfo hints;
+    struct addrinfo* result = NULL;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    auto ret = ::getaddrinfo(host, NULL, &hints, &result);
+    if (ret != 0) {
+        return false;
+    }
+    for (auto ptr = result; ptr != NULL; ptr = ptr->ai_next) {
+        if (AF_INET == ptr->ai_family) {
+            string ip = inet_ntoa(((struct sockaddr_in*)ptr->ai_addr)->sin_addr);
+            if (find(ips.begin(), ips.end(), ip) == ips.end()) {
+                ips.emplace_back(std::move(ip));
             }
-        } else {
-            addr.sin_addr.s_addr = htonl(INADDR_ANY);
         }
-        ip = inet_ntoa(addr.sin_addr);
-        return true;
-#endif
     }
+    freeaddrinfo(result);
+#endif
+    return !ips.empty();
+}
 
-} // namespace logtail
\ No newline at end of file
+} // namespace logtail
@@ -15,70 +15,57 @@
  */
 
 #pragma once
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
-#include <ctime>
-#include <map>
+#include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace logtail {
 
+// Resolution never happens on the caller thread. A host seen for the first time is resolved in background, and the
+// caller waits for it no longer than dns_cache_first_resolve_timeout_ms before falling back to the host name. Resolved
+// hosts are refreshed in background before expiry, and the stale addresses keep being served if the refresh fails, but
+// no longer than dns_cache_max_stale_sec after the last successful resolution. Failed hosts are retried with
+// exponential backoff.
+//
+// Readers only load an immutable snapshot of the cache, which is replaced as a whole by the resolving thread.
 class DnsCache {
-    int32_t mUpdateTime;
-    int32_t mDnsTTL;
-    std::mutex mDnsCacheLock;
-    std::map<std::string, std::pair<std::string, int32_t>> mDnsCacheData;
-
 public:
+    using Resolver = std::function<bool(const std::string& host, std::vector<std::string>& addresses)>;
+
     static DnsCache* GetInstance() {
         static DnsCache singleton;
         return &singleton;
     }
 
-    bool UpdateHostInDnsCache(const std::string& host, std::string& address) {
-        int32_t currentTime = time(NULL);
-        bool status = false;
-        std::lock_guard<std::mutex> lock(mDnsCacheLock);
-
-        auto itr = mDnsCacheData.find(host);
-        if (itr == mDnsCacheData.end() || currentTime - (itr->second).second >= 3) {
-            if (ParseHost(host.c_str(), address)) {
-                status = true;
-                mDnsCacheData[host] = std::make_pair(address, currentTime);
-            } else {
-                if (itr == mDnsCacheData.end()) {
-                    mDnsCacheData[host] = std::make_pair(host, currentTime);
-                } else {
-                    mDnsCacheData[host] = std::make_pair((itr->second).first, currentTime);
-                }
-            }
-        }
-
-        return status;
-    }
-
-    bool GetIPFromDnsCache(const std::string& host, std::string& address) {
-        bool found = false;
-        {
-            std::lock_guard<std::mutex> lock(mDnsCacheLock);
-            if (!RemoveTimeOutDnsCache()) // not time out
-            {
-                auto itr = mDnsCacheData.find(host);
-                if (itr != mDnsCacheData.end()) {
-                    address = (itr->second).first;
-                    found = true;
-                }
-            }
-        }
-        if (!found) // time out or not found
-            return UpdateHostInDnsCache(host, address);
-        return found;
-    }
+    // addresses of a host are returned in turn, and a raw ip is returned as is
+    bool GetIPFromDnsCache(const std::string& host, std::string& address);
+    void Stop();
 
 private:
-    DnsCache(const int32_t ttlSeconds = 60 * 10) : mUpdateTime(time(NULL)), mDnsTTL(ttlSeconds) {}
-    ~DnsCache() = default;
+    struct Entry {
+        // empty if the host has never been resolved successfully
+        std::vector<std::string> mAddresses;
+        int64_t mResolvedTimeMs = 0;
+        int64_t mNextResolveTimeMs = 0;
+        uint32_t mFailCnt = 0;
+        mutable std::atomic_uint32_t mNextIdx = 0;
+        mutable std::atomic_bool mIsResolving = false;
+    };
+    using Table = std::unordered_map<std::string, std::shared_ptr<const Entry>>;
+
+    DnsCache();
+    explicit DnsCache(Resolver&& resolver);
+    ~DnsCache() { Stop(); }
 
-    bool IsRawIp(const char* host) {
+    static bool IsRawIp(const char* host) {
         unsigned char c, *p;
         p = (unsigned char*)host;
         while ((c = (*p++)) != '\0') {
@@ -88,18 +75,39 @@ private:
         return true;
     }
 
-    bool ParseHost(const char* host, std::string& ip);
+    // ParseHost only supports IPv4 now.
+    static bool ParseHost(const std::string& host, std::vector<std::string>& ips);
 
-    bool RemoveTimeOutDnsCache() {
-        int32_t currentTime = time(NULL);
-        bool isTimeOut = false;
-        if (currentTime - mUpdateTime >= mDnsTTL) {
-            isTimeOut = true;
-            mDnsCacheData.clear();
-            mUpdateTime = currentTime;
-        }
-        return isTimeOut;
-    }
+    // return false if the cache has been stopped
+    bool RequestResolve(const std::string& host);
+    void Run();
+    void Resolve(const std::string& host);
+
+    Resolver mResolver;
+    int64_t mTTLMs = 0;
+    int64_t mRefreshAheadMs = 0;
+    int64_t mMinRetryIntervalMs = 0;
+    int64_t mMaxRetryIntervalMs = 0;
+    int64_t mMaxStaleMs = 0;
+    int64_t mFirstResolveTimeoutMs = 0;
+
+    // accessed by std::atomic_load/atomic_store
+    std::shared_ptr<const Table> mTable;
+    // notified each time the table is replaced
+    std::mutex mTableMux;
+    std::condition_variable mTableCV;
+
+    std::mutex mPendingMux;
+    std::unordered_set<std::string> mPendingHosts;
+    // hosts being resolved, only modified by the resolving thread with mPendingMux held
+    std::unordered_set<std::string> mResolvingHosts;
+    std::condition_variable mCV;
+    bool mIsThreadRunning = false;
+    std::future<void> mThreadRes;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class DnsCacheUnittest;
+#endif
 };
 
 } // namespace logtail
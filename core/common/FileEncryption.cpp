@@ -15,6 +15,9 @@
 #include "FileEncryption.h"
 #include <time.h>
 #include <stdlib.h>
+#include <memory>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include "StringTools.h"
 #include "FileSystemUtil.h"
 #include "logger/Logger.h"
@@ -34,9 +37,12 @@ namespace logtail {
   set all key-version pair here:
   version: incremental integer, [1, 2^32)
   key: consists of several chars, default is a md5 string
+  cipher: XOR for version 1, AES_256_GCM for later versions
 */
 const int32_t FileEncryption::FIRST_KEY_VERSION = 1;
 const string FileEncryption::FIRST_KEY_VALUE = "b394d709b96949bb3ca6f7b2f2d9a493";
+const int32_t FileEncryption::SECOND_KEY_VERSION = 2;
+const string FileEncryption::SECOND_KEY_VALUE = "5f0d3a9e8c41b27d6e93a1c4f8b2e07d";
 
 bool FileEncryption::CheckHeader(const std::string& filename, std::unordered_map<std::string, std::string>& kvMap) {
     FILE* pFile = FileReadOnlyOpen(filename.c_str(), "r");
@@ -77,6 +83,8 @@ void FileEncryption::LoadKeyInfo() {
     // add new (version, key) pair here
     KeyInfo* keyV1 = new KeyInfo(FIRST_KEY_VALUE, FIRST_KEY_VERSION);
     mKeyMap.insert(pair<int32_t, KeyInfo*>(keyV1->mVersion, keyV1));
+    KeyInfo* keyV2 = new KeyInfo(SECOND_KEY_VALUE, SECOND_KEY_VERSION, CipherType::AES_256_GCM);
+    mKeyMap.insert(pair<int32_t, KeyInfo*>(keyV2->mVersion, keyV2));
 }
 
 void FileEncryption::SetDefaultKey() {
@@ -110,21 +118,12 @@ bool FileEncryption::Encrypt(const char* src, int32_t srcLength, char*& des, int
     desLength = 0;
     if (srcLength == 0)
         return false;
-    int32_t blockCount = srcLength / encryptKey->mBlockBytes;
-    if ((srcLength % encryptKey->mBlockBytes) != 0) {
-        blockCount += 1;
+    switch (encryptKey->mCipher) {
+        case CipherType::AES_256_GCM:
+            return EncryptAesGcm(*encryptKey, src, srcLength, des, desLength);
+        default:
+            return EncryptXor(*encryptKey, src, srcLength, des, desLength);
     }
-    desLength = blockCount * encryptKey->mBlockBytes;
-    des = new char[desLength];
-    for (int32_t pos = 0; pos < desLength; ++pos) {
-        int32_t byteIdx = pos % encryptKey->mBlockBytes;
-        if (pos < srcLength) {
-            des[pos] = src[pos] ^ encryptKey->mKey[byteIdx];
-        } else {
-            des[pos] = char((rand() % 94) + 33) ^ encryptKey->mKey[byteIdx];
-        }
-    }
-    return true;
 }
 
 bool FileEncryption::Decrypt(const char* src, int32_t srcLength, char* des, int32_t desLength, int32_t version) {
@@ -140,13 +139,120 @@ bool FileEncryption::Decrypt(const char* src, int32_t srcLength, char* des, int3
         LOG_ERROR(sLogger, ("decrypt error, srcLength:", srcLength)("desLength", desLength));
         return false;
     }
-    if (srcLength % decryptKey->mBlockBytes != 0) {
-        LOG_ERROR(sLogger, ("decrypt error, key_version:", decryptKey->mVersion));
+    switch (decryptKey->mCipher) {
+        case CipherType::AES_256_GCM:
+            return DecryptAesGcm(*decryptKey, src, srcLength, des, desLength);
+        default:
+            return DecryptXor(*decryptKey, src, srcLength, des, desLength);
+    }
+}
+
+bool FileEncryption::EncryptXor(const KeyInfo& key,
+                                const char* src,
+                                int32_t srcLength,
+                                char*& des,
+                                int32_t& desLength) {
+    int32_t blockCount = srcLength / key.mBlockBytes;
+    if ((srcLength % key.mBlockBytes) != 0) {
+        blockCount += 1;
+    }
+    desLength = blockCount * key.mBlockBytes;
+    des = new char[desLength];
+    for (int32_t pos = 0; pos < desLength; ++pos) {
+        int32_t byteIdx = pos % key.mBlockBytes;
+        if (pos < srcLength) {
+            des[pos] = src[pos] ^ key.mKey[byteIdx];
+        } else {
+            des[pos] = char((rand() % 94) + 33) ^ key.mKey[byteIdx];
+        }
+    }
+    return true;
+}
+
+bool FileEncryption::DecryptXor(const KeyInfo& key, const char* src, int32_t srcLength, char* des, int32_t desLength) {
+    if (srcLength % key.mBlockBytes != 0) {
+        LOG_ERROR(sLogger, ("decrypt error, key_version:", key.mVersion));
         return false;
     }
     for (int32_t pos = 0; pos < desLength; ++pos) {
-        int32_t byteIdx = pos % decryptKey->mBlockBytes;
-        des[pos] = src[pos] ^ decryptKey->mKey[byteIdx];
+        int32_t byteIdx = pos % key.mBlockBytes;
+        des[pos] = src[pos] ^ key.mKey[byteIdx];
+    }
+    return true;
+}
+
+// OpenSSL picks AES-NI or ARMv8 crypto extensions at runtime when they are available.
+bool FileEncryption::EncryptAesGcm(const KeyInfo& key,
+                                   const char* src,
+                                   int32_t srcLength,
+                                   char*& des,
+                                   int32_t& desLength) {
+    if (key.mKey.size() != 32) {
+        LOG_ERROR(sLogger, ("encrypt error, invalid key size of key_version", key.mVersion));
+        return false;
+    }
+    int64_t length = int64_t(AES_GCM_IV_SIZE) + srcLength + AES_GCM_TAG_SIZE;
+    if (length > INT32_MAX) {
+        LOG_ERROR(sLogger, ("encrypt error, srcLength", srcLength));
+        return false;
+    }
+    desLength = static_cast<int32_t>(length);
+    des = new char[desLength];
+    auto iv = reinterpret_cast<unsigned char*>(des);
+    auto out = iv + AES_GCM_IV_SIZE;
+    int outLength = 0, finalLength = 0;
+    unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+    // iv is random, since the key is shared by all buffer files
+    if (RAND_bytes(iv, AES_GCM_IV_SIZE) != 1 || !ctx
+        || EVP_EncryptInit_ex(
+               ctx.get(), EVP_aes_256_gcm(), NULL, reinterpret_cast<const unsigned char*>(key.mKey.data()), iv)
+            != 1
+        || EVP_EncryptUpdate(ctx.get(), out, &outLength, reinterpret_cast<const unsigned char*>(src), srcLength) != 1
+        || EVP_EncryptFinal_ex(ctx.get(), out + outLength, &finalLength) != 1
+        || EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_GET_TAG, AES_GCM_TAG_SIZE, out + srcLength) != 1) {
+        LOG_ERROR(sLogger, ("encrypt error, key_version", key.mVersion)("srcLength", srcLength));
+        delete[] des;
+        des = NULL;
+        desLength = 0;
+        return false;
+    }
+    return true;
+}
+
+bool FileEncryption::DecryptAesGcm(const KeyInfo& key,
+                                   const char* src,
+                                   int32_t srcLength,
+                                   char* des,
+                                   int32_t desLength) {
+    if (key.mKey.size() != 32) {
+        LOG_ERROR(sLogger, ("decrypt error, invalid key size of key_version", key.mVersion));
+        return false;
+    }
+    if (srcLength - AES_GCM_IV_SIZE - AES_GCM_TAG_SIZE != desLength) {
+        LOG_ERROR(sLogger,
+                  ("decrypt error, srcLength:", srcLength)("desLength", desLength)("key_version", key.mVersion));
+        return false;
+    }
+    auto iv = reinterpret_cast<const unsigned char*>(src);
+    auto in = iv + AES_GCM_IV_SIZE;
+    auto out = reinterpret_cast<unsigned char*>(des);
+    int outLength = 0, finalLength = 0;
+    unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+    if (!ctx
+        || EVP_DecryptInit_ex(
+               ctx.get(), EVP_aes_256_gcm(), NULL, reinterpret_cast<const unsigned char*>(key.mKey.data()), iv)
+            != 1
+        || EVP_DecryptUpdate(ctx.get(), out, &outLength, in, desLength) != 1
+        || EVP_CIPHER_CTX_ctrl(
+               ctx.get(), EVP_CTRL_GCM_SET_TAG, AES_GCM_TAG_SIZE, const_cast<unsigned char*>(in + desLength))
+            != 1) {
+        LOG_ERROR(sLogger, ("decrypt error, key_version", key.mVersion)("desLength", desLength));
+        return false;
+    }
+    // the tag is verified here
+    if (EVP_DecryptFinal_ex(ctx.get(), out + outLength, &finalLength) != 1) {
+        LOG_ERROR(sLogger, ("decrypt error, data is corrupted, key_version", key.mVersion)("desLength", desLength));
+        return false;
     }
     return true;
 }
@@ -34,6 +34,13 @@ public:
     bool Decrypt(const char* src, int32_t srcLength, char* des, int32_t desLength, int32_t version);
     int32_t GetDefaultKeyVersion() { return mDefaultKey->mVersion; }
 
+    enum class CipherType {
+        // legacy, only kept for reading buffer files written by old versions
+        XOR,
+        // iv | cipher text | tag, the key must be 32 bytes
+        AES_256_GCM
+    };
+
 private:
     FileEncryption();
     ~FileEncryption();
@@ -42,10 +49,11 @@ private:
 
 public:
     struct KeyInfo {
-        KeyInfo(std::string key, int32_t version) {
+        KeyInfo(std::string key, int32_t version, CipherType cipher = CipherType::XOR) {
             mBlockBytes = (int32_t)key.size();
             mVersion = version;
             mKey = key;
+            mCipher = cipher;
         }
 
         void Reset() {
@@ -57,17 +65,29 @@ public:
         std::string mKey;
         int32_t mBlockBytes; // equal to mKey.size()
         int32_t mVersion;
+        CipherType mCipher;
     };
 
 private:
+    static bool EncryptXor(const KeyInfo& key, const char* src, int32_t srcLength, char*& des, int32_t& desLength);
+    static bool DecryptXor(const KeyInfo& key, const char* src, int32_t srcLength, char* des, int32_t desLength);
+    static bool EncryptAesGcm(const KeyInfo& key, const char* src, int32_t srcLength, char*& des, int32_t& desLength);
+    static bool DecryptAesGcm(const KeyInfo& key, const char* src, int32_t srcLength, char* des, int32_t desLength);
+
     std::map<int32_t, KeyInfo*> mKeyMap; // version and its key
     KeyInfo* mDefaultKey; // the latest version key
 
     static const int32_t FIRST_KEY_VERSION;
     static const std::string FIRST_KEY_VALUE;
+    static const int32_t SECOND_KEY_VERSION;
+    static const std::string SECOND_KEY_VALUE;
+
+    static const int32_t AES_GCM_IV_SIZE = 12;
+    static const int32_t AES_GCM_TAG_SIZE = 16;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class SenderUnittest;
+    friend class FileEncryptionUnittest;
 #endif
 };
 } // namespace logtail
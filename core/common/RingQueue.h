@@ -0,0 +1,232 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace logtail {
+
+// Lock-free bounded MPMC queue based on a ring of sequenced slots. Producers and consumers claim slots with a single
+// CAS on the tail or head position, and a batch of consecutive slots can be claimed by one CAS as well.
+//
+// Waiting is optional: a waiting thread first retries for spinCnt rounds, then parks on a condition variable. Threads
+// on the other side only take the lock and notify when someone is parked, and a single item wakes a single waiter.
+template <typename T>
+class RingQueue {
+public:
+    // capacity is rounded up to the power of 2
+    explicit RingQueue(size_t capacity, uint32_t spinCnt = 0) : mSpinCnt(spinCnt) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mMask = size - 1;
+        mCells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            mCells[i].mSeq.store(i, std::memory_order_relaxed);
+        }
+    }
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    bool TryPush(T&& data) { return TryPushBatch(&data, 1) == 1; }
+
+    // items pushed are moved from, and the number of them is returned
+    size_t TryPushBatch(T* items, size_t cnt) {
+        size_t pos = mTail.load(std::memory_order_relaxed);
+        size_t n = 0;
+        while (true) {
+            n = CountReady(pos, cnt, 0);
+            if (n == 0) {
+                auto diff = static_cast<intptr_t>(mCells[pos & mMask].mSeq.load(std::memory_order_acquire))
+                    - static_cast<intptr_t>(pos);
+                if (diff < 0) {
+                    // full
+                    return 0;
+                }
+                pos = mTail.load(std::memory_order_relaxed);
+            } else if (mTail.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            auto& cell = mCells[(pos + i) & mMask];
+            cell.mData = std::move(items[i]);
+            cell.mSeq.store(pos + i + 1, std::memory_order_release);
+        }
+        Notify(mWaitingConsumerCnt, mNotEmptyCV, n);
+        return n;
+    }
+
+    // wait at most ms milliseconds for space
+    bool Push(T&& data, int64_t ms) {
+        return Wait(mWaitingProducerCnt, mNotFullCV, ms, [&]() { return TryPush(std::move(data)); }, [this]() {
+            return IsReady(mTail.load(std::memory_order_relaxed), 0);
+        });
+    }
+
+    bool TryPop(T& value) {
+        return Pop(1, [&value](T& data) { value = std::move(data); }) == 1;
+    }
+
+    // items popped are appended to values, and the number of them is returned
+    size_t TryPopBatch(std::vector<T>& values, size_t maxCnt) {
+        return Pop(maxCnt, [&values](T& data) { values.emplace_back(std::move(data)); });
+    }
+
+    bool WaitAndPop(T& value, int64_t ms) {
+        return Wait(mWaitingConsumerCnt, mNotEmptyCV, ms, [&]() { return TryPop(value); }, [this]() {
+            return IsReady(mHead.load(std::memory_order_relaxed), 1);
+        });
+    }
+
+    size_t WaitAndPopBatch(std::vector<T>& values, size_t maxCnt, int64_t ms) {
+        size_t n = 0;
+        Wait(
+            mWaitingConsumerCnt,
+            mNotEmptyCV,
+            ms,
+            [&]() { return (n = TryPopBatch(values, maxCnt)) > 0; },
+            [this]() { return IsReady(mHead.load(std::memory_order_relaxed), 1); });
+        return n;
+    }
+
+    // approximate if accessed concurrently
+    size_t Size() const {
+        size_t head = mHead.load(std::memory_order_relaxed);
+        size_t tail = mTail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+    size_t Capacity() const { return mMask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> mSeq;
+        T mData;
+    };
+
+    // a slot at pos is ready for producers if its seq is pos, and for consumers if its seq is pos + 1
+    bool IsReady(size_t pos, size_t offset) const {
+        return mCells[pos & mMask].mSeq.load(std::memory_order_acquire) == pos + offset;
+    }
+
+    size_t CountReady(size_t pos, size_t maxCnt, size_t offset) const {
+        size_t n = 0;
+        while (n < maxCnt && n <= mMask && IsReady(pos + n, offset)) {
+            ++n;
+        }
+        return n;
+    }
+
+    template <typename Consume>
+    size_t Pop(size_t maxCnt, const Consume& consume) {
+        size_t pos = mHead.load(std::memory_order_relaxed);
+        size_t n = 0;
+        while (true) {
+            n = CountReady(pos, maxCnt, 1);
+            if (n == 0) {
+                auto diff = static_cast<intptr_t>(mCells[pos & mMask].mSeq.load(std::memory_order_acquire))
+                    - static_cast<intptr_t>(pos + 1);
+                if (diff < 0) {
+                    // empty
+                    return 0;
+                }
+                pos = mHead.load(std::memory_order_relaxed);
+            } else if (mHead.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            auto& cell = mCells[(pos + i) & mMask];
+            consume(cell.mData);
+            cell.mSeq.store(pos + i + mMask + 1, std::memory_order_release);
+        }
+        Notify(mWaitingProducerCnt, mNotFullCV, n);
+        return n;
+    }
+
+    void Notify(std::atomic_uint32_t& waitingCnt, std::condition_variable& cv, size_t cnt) {
+        // pairs with the fence in Wait, so that either the waiter sees the slots or the waiter is seen here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waitingCnt.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMux);
+        if (cnt == 1) {
+            cv.notify_one();
+        } else {
+            cv.notify_all();
+        }
+    }
+
+    template <typename Try, typename Ready>
+    bool Wait(std::atomic_uint32_t& waitingCnt,
+              std::condition_variable& cv,
+              int64_t ms,
+              const Try& tryOnce,
+              const Ready& isReady) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+        while (true) {
+            for (uint32_t i = 0; i <= mSpinCnt; ++i) {
+                if (tryOnce()) {
+                    return true;
+                }
+                if (i < mSpinCnt) {
+                    std::this_thread::yield();
+                }
+            }
+            std::unique_lock<std::mutex> lock(mMux);
+            waitingCnt.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool ready = cv.wait_until(lock, deadline, isReady);
+            waitingCnt.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+            if (!ready) {
+                // one last try, since the slot may be taken just after the deadline
+                return tryOnce();
+            }
+        }
+    }
+
+    alignas(64) std::atomic<size_t> mHead = 0;
+    alignas(64) std::atomic<size_t> mTail = 0;
+    alignas(64) std::unique_ptr<Cell[]> mCells;
+    size_t mMask = 0;
+    uint32_t mSpinCnt = 0;
+
+    std::mutex mMux;
+    std::condition_variable mNotEmptyCV;
+    std::condition_variable mNotFullCV;
+    std::atomic_uint32_t mWaitingConsumerCnt = 0;
+    std::atomic_uint32_t mWaitingProducerCnt = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class RingQueueUnittest;
+#endif
+};
+
+} // namespace logtail
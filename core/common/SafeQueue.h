@@ -22,14 +22,16 @@
 
 namespace logtail {
 
-// lock-based unbounded queue, suitable for common use (except for process queue and sender queue)
+// lock-based unbounded queue, suitable for common use (except for process queue and sender queue). Use RingQueue
+// instead if the queue can be bounded and is contended by many threads.
 template <typename T>
 class SafeQueue {
 public:
     void Push(T&& data) {
         std::lock_guard<std::mutex> lock(mMux);
         mQueue.push(std::move(data));
-        mCond.notify_all();
+        // a single item can only be taken by a single waiter
+        mCond.notify_one();
     }
 
     bool WaitAndPop(T& value, int64_t ms) {
@@ -0,0 +1,11 @@
+#include "version.h"
+
+const char* const ILOGTAIL_VERSION = "0.0.1";
+const char* const ILOGTAIL_GIT_HASH = "7aa1f26932d057849d17d092a8922c0bf93825b8";
+const char* const ILOGTAIL_BUILD_DATE = "20261017";
+
+#if defined(__linux__)
+const char* const ILOGTAIL_UPDATE_SUFFIX = "";
+#elif defined(_MSC_VER)
+const char* const ILOGTAIL_UPDATE_SUFFIX = ".update";
+#endif
@@ -21,7 +21,8 @@ namespace logtail {
 enum class CompressType {
     NONE,
     LZ4,
-    ZSTD
+    ZSTD,
+    SNAPPY
 #ifdef APSARA_UNIT_TEST_MAIN
     ,
     MOCK
@@ -17,6 +17,7 @@
 #include "common/ParamExtractor.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "common/compression/LZ4Compressor.h"
+#include "common/compression/SnappyCompressor.h"
 #include "common/compression/ZstdCompressor.h"
 
 using namespace std;
@@ -74,6 +75,8 @@ unique_ptr<Compressor> CompressorFactory::Create(CompressType type) {
             return make_unique<LZ4Compressor>(type);
         case CompressType::ZSTD:
             return make_unique<ZstdCompressor>(type);
+        case CompressType::SNAPPY:
+            return make_unique<SnappyCompressor>(type);
         default:
             return nullptr;
     }
@@ -87,6 +90,9 @@ const string& CompressTypeToString(CompressType type) {
         case CompressType::ZSTD:
             static string zstd = "zstd";
             return zstd;
+        case CompressType::SNAPPY:
+            static string snappy = "snappy";
+            return snappy;
         case CompressType::NONE:
             static string none = "none";
             return none;
@@ -0,0 +1,236 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/compression/SnappyCompressor.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace logtail {
+
+namespace {
+
+constexpr uint8_t kLiteral = 0;
+constexpr uint8_t kCopy1ByteOffset = 1;
+constexpr uint8_t kCopy2ByteOffset = 2;
+constexpr uint8_t kCopy4ByteOffset = 3;
+
+constexpr int kHashBits = 14;
+constexpr size_t kMinMatch = 4;
+// copies with 2-byte offsets are the only ones emitted, so matches must be found within this distance
+constexpr size_t kMaxOffset = 65535;
+
+inline uint32_t Load32(const char* p) {
+    uint32_t v = 0;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t Hash(uint32_t v) {
+    return (v * 0x1E35A7BDU) >> (32 - kHashBits);
+}
+
+void PutVarint(string& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+void EmitLiteral(string& out, const char* p, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    size_t n = len - 1;
+    if (n < 60) {
+        out.push_back(static_cast<char>(kLiteral | (n << 2)));
+    } else {
+        char tmp[4];
+        int cnt = 0;
+        while (n > 0) {
+            tmp[cnt++] = static_cast<char>(n & 0xFF);
+            n >>= 8;
+        }
+        out.push_back(static_cast<char>(kLiteral | ((59 + cnt) << 2)));
+        out.append(tmp, cnt);
+    }
+    out.append(p, len);
+}
+
+void EmitCopyAtMost64(string& out, size_t offset, size_t len) {
+    if (len < 12 && offset < 2048) {
+        out.push_back(static_cast<char>(kCopy1ByteOffset | ((len - 4) << 2) | ((offset >> 8) << 5)));
+        out.push_back(static_cast<char>(offset & 0xFF));
+    } else {
+        out.push_back(static_cast<char>(kCopy2ByteOffset | ((len - 1) << 2)));
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>((offset >> 8) & 0xFF));
+    }
+}
+
+void EmitCopy(string& out, size_t offset, size_t len) {
+    // a single element covers at most 64 bytes, and the tail is kept no shorter than the minimum match
+    while (len >= 68) {
+        EmitCopyAtMost64(out, offset, 64);
+        len -= 64;
+    }
+    if (len > 64) {
+        EmitCopyAtMost64(out, offset, 60);
+        len -= 60;
+    }
+    EmitCopyAtMost64(out, offset, len);
+}
+
+} // namespace
+
+bool SnappyCompressor::Compress(const string& input, string& output, string& errorMsg) {
+    if (input.size() > UINT32_MAX) {
+        errorMsg = "input size is incorrect";
+        return false;
+    }
+    output.clear();
+    // worst case of the reference implementation
+    output.reserve(32 + input.size() + input.size() / 6);
+    PutVarint(output, input.size());
+
+    const char* base = input.data();
+    size_t size = input.size();
+    size_t literalBegin = 0;
+    if (size >= kMinMatch) {
+        vector<uint32_t> table(1 << kHashBits, 0);
+        size_t pos = 1;
+        // skip faster through data that keeps failing to match, as the reference implementation does
+        uint32_t skip = 32;
+        while (pos + kMinMatch <= size) {
+            uint32_t cur = Load32(base + pos);
+            uint32_t& slot = table[Hash(cur)];
+            size_t candidate = slot;
+            slot = static_cast<uint32_t>(pos);
+            if (candidate >= pos || pos - candidate > kMaxOffset || Load32(base + candidate) != cur) {
+                pos += skip++ >> 5;
+                continue;
+            }
+            skip = 32;
+            size_t len = kMinMatch;
+            while (pos + len < size && base[candidate + len] == base[pos + len]) {
+                ++len;
+            }
+            EmitLiteral(output, base + literalBegin, pos - literalBegin);
+            EmitCopy(output, pos - candidate, len);
+            pos += len;
+            literalBegin = pos;
+            if (pos + kMinMatch <= size) {
+                // let the next search find matches starting right before the current position
+                table[Hash(Load32(base + pos - 1))] = static_cast<uint32_t>(pos - 1);
+            }
+        }
+    }
+    EmitLiteral(output, base + literalBegin, size - literalBegin);
+    return true;
+}
+
+#ifdef APSARA_UNIT_TEST_MAIN
+bool SnappyCompressor::UnCompress(const string& input, string& output, string& errorMsg) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(input.data());
+    const uint8_t* end = p + input.size();
+    uint64_t length = 0;
+    for (int shift = 0; p < end && shift < 35; shift += 7) {
+        length |= static_cast<uint64_t>(*p & 0x7F) << shift;
+        if ((*p++ & 0x80) == 0) {
+            break;
+        }
+    }
+    if (length != output.size()) {
+        errorMsg = "uncompressed length mismatch";
+        return false;
+    }
+    size_t pos = 0;
+    while (p < end) {
+        uint8_t tag = *p++;
+        size_t len = 0, offset = 0;
+        switch (tag & 0x03) {
+            case kLiteral: {
+                len = tag >> 2;
+                if (len >= 60) {
+                    size_t cnt = len - 59;
+                    if (static_cast<size_t>(end - p) < cnt) {
+                        errorMsg = "truncated literal";
+                        return false;
+                    }
+                    len = 0;
+                    for (size_t i = 0; i < cnt; ++i) {
+                        len |= static_cast<size_t>(p[i]) << (8 * i);
+                    }
+                    p += cnt;
+                }
+                ++len;
+                if (static_cast<size_t>(end - p) < len || output.size() - pos < len) {
+                    errorMsg = "literal out of range";
+                    return false;
+                }
+                memcpy(&output[pos], p, len);
+                p += len;
+                pos += len;
+                continue;
+            }
+            case kCopy1ByteOffset:
+                if (end - p < 1) {
+                    errorMsg = "truncated copy";
+                    return false;
+                }
+                len = ((tag >> 2) & 0x07) + 4;
+                offset = (static_cast<size_t>(tag >> 5) << 8) | *p++;
+                break;
+            case kCopy2ByteOffset:
+                if (end - p < 2) {
+                    errorMsg = "truncated copy";
+                    return false;
+                }
+                len = (tag >> 2) + 1;
+                offset = p[0] | (static_cast<size_t>(p[1]) << 8);
+                p += 2;
+                break;
+            case kCopy4ByteOffset:
+                if (end - p < 4) {
+                    errorMsg = "truncated copy";
+                    return false;
+                }
+                len = (tag >> 2) + 1;
+                offset = p[0] | (static_cast<size_t>(p[1]) << 8) | (static_cast<size_t>(p[2]) << 16)
+                    | (static_cast<size_t>(p[3]) << 24);
+                p += 4;
+                break;
+        }
+        if (offset == 0 || offset > pos || output.size() - pos < len) {
+            errorMsg = "copy out of range";
+            return false;
+        }
+        // byte by byte, since the source may overlap the destination
+        for (size_t i = 0; i < len; ++i, ++pos) {
+            output[pos] = output[pos - offset];
+        }
+    }
+    if (pos != output.size()) {
+        errorMsg = "uncompressed length mismatch";
+        return false;
+    }
+    return true;
+}
+#endif
+
+} // namespace logtail
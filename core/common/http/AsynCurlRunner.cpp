@@ -17,10 +17,13 @@
 #include <chrono>
 
 #include "app_config/AppConfig.h"
+#include "common/Flags.h"
 #include "common/StringTools.h"
 #include "common/http/Curl.h"
 #include "logger/Logger.h"
 
+DECLARE_FLAG_INT32(curl_max_host_connections);
+
 using namespace std;
 
 namespace logtail {
@@ -31,6 +34,7 @@ bool AsynCurlRunner::Init() {
         LOG_ERROR(sLogger, ("failed to init async curl runner", "failed to init curl client"));
         return false;
     }
+    curl_multi_setopt(mClient, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(INT32_FLAG(curl_max_host_connections)));
     mThreadRes = async(launch::async, &AsynCurlRunner::Run, this);
     return true;
 }
@@ -71,6 +75,7 @@ void AsynCurlRunner::Run() {
     if (mc != CURLM_OK) {
         LOG_ERROR(sLogger, ("failed to cleanup curl multi handle", "exit anyway")("errMsg", curl_multi_strerror(mc)));
     }
+    mHandlerPool.Clear();
 }
 
 bool AsynCurlRunner::AddRequestToClient(unique_ptr<AsynHttpRequest>&& request) {
@@ -87,7 +92,8 @@ bool AsynCurlRunner::AddRequestToClient(unique_ptr<AsynHttpRequest>&& request) {
                                    headers,
                                    request->mTimeout,
                                    AppConfig::GetInstance()->IsHostIPReplacePolicyEnabled(),
-                                   AppConfig::GetInstance()->GetBindInterface());
+                                   AppConfig::GetInstance()->GetBindInterface(),
+                                   &mHandlerPool);
     if (curl == nullptr) {
         LOG_ERROR(sLogger, ("failed to send request", "failed to init curl handler")("request address", request.get()));
         request->OnSendDone(request->mResponse);
@@ -103,7 +109,7 @@ bool AsynCurlRunner::AddRequestToClient(unique_ptr<AsynHttpRequest>&& request) {
                   ("failed to send request", "failed to add the easy curl handle to multi_handle")(
                       "errMsg", curl_multi_strerror(res))("request address", request.get()));
         request->OnSendDone(request->mResponse);
-        curl_easy_cleanup(curl);
+        mHandlerPool.Release(request->mHTTPSFlag, request->mHost, request->mPort, curl, false);
         return false;
     }
     // let runner destruct the request
@@ -181,6 +187,10 @@ void AsynCurlRunner::HandleCompletedRequests() {
             CURL* handler = msg->easy_handle;
             AsynHttpRequest* request = nullptr;
             curl_easy_getinfo(handler, CURLINFO_PRIVATE, &request);
+            // the request may be gone after retry
+            bool httpsFlag = request->mHTTPSFlag;
+            string host = request->mHost;
+            int32_t port = request->mPort;
             LOG_DEBUG(sLogger,
                       ("send http request completed, request address",
                        request)("response time",ToString(chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now()- request->mLastSendTime).count()) + "ms")
@@ -199,6 +209,7 @@ void AsynCurlRunner::HandleCompletedRequests() {
                         LOG_WARNING(sLogger,
                                     ("failed to send request", "retry immediately")("retryCnt", request->mTryCnt++)(
                                         "errMsg", curl_easy_strerror(msg->data.result)));
+                        request->mResponse.ResetBody();
                         // free first，becase mPrivateData will be reset in AddRequestToClient
                         if (request->mPrivateData) {
                             curl_slist_free_all((curl_slist*)request->mPrivateData);
@@ -213,7 +224,7 @@ void AsynCurlRunner::HandleCompletedRequests() {
             }
 
             curl_multi_remove_handle(mClient, handler);
-            curl_easy_cleanup(handler);
+            mHandlerPool.Release(httpsFlag, host, port, handler);
             if (!requestReused) {
                 if (request->mPrivateData) {
                     curl_slist_free_all((curl_slist*)request->mPrivateData);
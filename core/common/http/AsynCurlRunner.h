@@ -25,6 +25,7 @@
 #include <mutex>
 
 #include "common/SafeQueue.h"
+#include "common/http/CurlHandlerPool.h"
 #include "common/http/HttpRequest.h"
 
 namespace logtail {
@@ -53,6 +54,8 @@ private:
     void HandleCompletedRequests();
 
     CURLM* mClient = nullptr;
+    // only accessed by the running thread
+    CurlHandlerPool mHandlerPool;
     SafeQueue<std::unique_ptr<AsynHttpRequest>> mQueue;
 
     std::future<void> mThreadRes;
@@ -14,27 +14,43 @@
 
 #include "common/http/Curl.h"
 
+#include <boost/algorithm/string/join.hpp>
+
+#include <algorithm>
+#include <cctype>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "common/DNSCache.h"
 #include "app_config/AppConfig.h"
+#include "common/Flags.h"
+#include "common/StringTools.h"
 #include "logger/Logger.h"
 #include "common/http/HttpResponse.h"
 
+DEFINE_FLAG_INT32(curl_max_host_connections, "max connections to a host in a curl multi handle, 0 means unlimited", 0);
+DEFINE_FLAG_INT32(curl_tcp_keepalive_idle_sec, "idle time before tcp keepalive probes are sent, seconds", 60);
+DEFINE_FLAG_INT32(curl_tcp_keepalive_interval_sec, "interval between tcp keepalive probes, seconds", 60);
+
 using namespace std;
 
 namespace logtail {
 
-static size_t data_write_callback(char* buffer, size_t size, size_t nmemb, string* write_buf) {
+static size_t data_write_callback(char* buffer, size_t size, size_t nmemb, HttpResponse* response) {
     unsigned long sizes = size * nmemb;
 
     if (buffer == NULL) {
         return 0;
     }
 
-    write_buf->append(buffer, sizes);
+    if (response->mBodySink) {
+        response->mBodySink->Write(buffer, sizes);
+    } else {
+        response->mBody.append(buffer, sizes);
+    }
     return sizes;
 }
 
@@ -80,10 +96,11 @@ CURL* CreateCurlHandler(const std::string& method,
                         curl_slist*& headers,
                         uint32_t timeout,
                         bool replaceHostWithIp,
-                        const std::string& intf) {
+                        const std::string& intf,
+                        CurlHandlerPool* pool) {
     static DnsCache* dnsCache = DnsCache::GetInstance();
 
-    CURL* curl = curl_easy_init();
+    CURL* curl = pool ? pool->Acquire(httpsFlag, host, port) : curl_easy_init();
     if (curl == nullptr) {
         return nullptr;
     }
@@ -101,6 +118,11 @@ CURL* CreateCurlHandler(const std::string& method,
     }
     curl_easy_setopt(curl, CURLOPT_URL, totalUrl.c_str());
     for (const auto& iter : header) {
+        // let curl negotiate the encoding, so that the body is decoded on the fly before being written
+        if (StringCaseInsensitiveCmp(iter.first, "Accept-Encoding") == 0) {
+            curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, iter.second.c_str());
+            continue;
+        }
         headers = curl_slist_append(headers, (iter.first + ":" + iter.second).c_str());
     }
     if (headers != NULL) {
@@ -123,7 +145,7 @@ CURL* CreateCurlHandler(const std::string& method,
         curl_easy_setopt(curl, CURLOPT_INTERFACE, intf.c_str());
     }
 
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &(response.mBody));
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, data_write_callback);
     curl_easy_setopt(curl, CURLOPT_HEADERDATA, &(response.mHeader));
     curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_write_callback);
@@ -132,11 +154,34 @@ CURL* CreateCurlHandler(const std::string& method,
     curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 1);
     curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1);
     curl_easy_setopt(curl, CURLOPT_NETRC, CURL_NETRC_IGNORED);
+    // keep pooled connections alive across idle periods
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, static_cast<long>(INT32_FLAG(curl_tcp_keepalive_idle_sec)));
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, static_cast<long>(INT32_FLAG(curl_tcp_keepalive_interval_sec)));
 
     return curl;
 }
 
+const string& GetSupportedContentEncodings() {
+    static const string sEncodings = []() {
+        vector<string> encodings;
+        const auto* info = curl_version_info(CURLVERSION_NOW);
+#ifdef CURL_VERSION_ZSTD
+        if (info->features & CURL_VERSION_ZSTD) {
+            encodings.emplace_back("zstd");
+        }
+#endif
+        if (info->features & CURL_VERSION_LIBZ) {
+            encodings.emplace_back("gzip");
+        }
+        return encodings.empty() ? string("identity") : boost::algorithm::join(encodings, ", ");
+    }();
+    return sEncodings;
+}
+
 bool SendHttpRequest(std::unique_ptr<HttpRequest>&& request, HttpResponse& response) {
+    static CurlHandlerPool* pool = GetSyncHttpHandlerPool();
+
     curl_slist* headers = NULL;
     CURL* curl = CreateCurlHandler(request->mMethod,
                                 request->mHTTPSFlag,
@@ -150,14 +195,18 @@ bool SendHttpRequest(std::unique_ptr<HttpRequest>&& request, HttpResponse& respo
                                 headers,
                                 request->mTimeout,
                                 AppConfig::GetInstance()->IsHostIPReplacePolicyEnabled(),
-                                AppConfig::GetInstance()->GetBindInterface());
+                                AppConfig::GetInstance()->GetBindInterface(),
+                                pool);
     if (curl == NULL) {
         LOG_ERROR(sLogger, ("failed to init curl handler", "failed to init curl client")("request address", request.get()));
         return false;
     }
     bool success = false;
     while (request->mTryCnt <= request->mMaxTryCnt) {
+        request->mLastSendTime = chrono::system_clock::now();
         CURLcode res = curl_easy_perform(curl);
+        response.mResponseTimeMs = static_cast<uint32_t>(
+            chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now() - request->mLastSendTime).count());
         if (res == CURLE_OK) {
             long http_code = 0;
             curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
@@ -171,8 +220,53 @@ bool SendHttpRequest(std::unique_ptr<HttpRequest>&& request, HttpResponse& respo
     if (headers != NULL) {
         curl_slist_free_all(headers);
     }
-    curl_easy_cleanup(curl);
+    pool->Release(request->mHTTPSFlag, request->mHost, request->mPort, curl);
     return success;
 }
 
+CurlHandlerPool* GetSyncHttpHandlerPool() {
+    static CurlHandlerPool* pool = new CurlHandlerPool();
+    return pool;
+}
+
+void ClearSyncHttpHandlerPool() {
+    GetSyncHttpHandlerPool()->Clear();
+}
+
+bool ParseHttpEndpoint(const string& endpoint, bool& httpsFlag, string& host, int32_t& port, string& path) {
+    string rest = endpoint;
+    httpsFlag = false;
+    port = 80;
+    if (StartWith(rest, "https://")) {
+        httpsFlag = true;
+        port = 443;
+        rest = rest.substr(strlen("https://"));
+    } else if (StartWith(rest, "http://")) {
+        rest = rest.substr(strlen("http://"));
+    } else if (rest.find("://") != string::npos) {
+        return false;
+    }
+    size_t slash = rest.find('/');
+    string hostPort = rest.substr(0, slash);
+    path = slash == string::npos ? "" : rest.substr(slash);
+    while (!path.empty() && path.back() == '/') {
+        path.pop_back();
+    }
+    size_t colon = hostPort.rfind(':');
+    if (colon != string::npos) {
+        string portStr = hostPort.substr(colon + 1);
+        if (portStr.empty() || portStr.size() > 5
+            || !all_of(portStr.begin(), portStr.end(), [](char c) { return isdigit(c); })) {
+            return false;
+        }
+        port = stoi(portStr);
+        if (port == 0 || port > 65535) {
+            return false;
+        }
+        hostPort.resize(colon);
+    }
+    host = hostPort;
+    return !host.empty();
+}
+
 } // namespace logtail
@@ -23,6 +23,7 @@
 #include <string>
 #include <memory>
 
+#include "common/http/CurlHandlerPool.h"
 #include "common/http/HttpRequest.h"
 #include "common/http/HttpResponse.h"
 
@@ -40,8 +41,22 @@ CURL* CreateCurlHandler(const std::string& method,
                         curl_slist*& headers,
                         uint32_t timeout,
                         bool replaceHostWithIp = true,
-                        const std::string& intf = "");
+                        const std::string& intf = "",
+                        CurlHandlerPool* pool = nullptr);
+
+// value of Accept-Encoding header listing the encodings curl can decode, e.g. "zstd, gzip"
+const std::string& GetSupportedContentEncodings();
 
 bool SendHttpRequest(std::unique_ptr<HttpRequest>&& request, HttpResponse& response);
 
+// Handlers pooled by SendHttpRequest. The pool is never destructed, since static destruction may take place after curl
+// global cleanup. Its handlers should be cleaned up by ClearSyncHttpHandlerPool on exit instead.
+CurlHandlerPool* GetSyncHttpHandlerPool();
+void ClearSyncHttpHandlerPool();
+
+// Splits an http(s) url into the parts taken by HttpRequest. Port defaults to that of the scheme, and trailing slashes
+// are stripped from path. Schemes other than http and https are rejected.
+bool ParseHttpEndpoint(
+    const std::string& endpoint, bool& httpsFlag, std::string& host, int32_t& port, std::string& path);
+
 } // namespace logtail
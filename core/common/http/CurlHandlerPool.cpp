@@ -0,0 +1,114 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/http/CurlHandlerPool.h"
+
+#include "common/CoarseClock.h"
+#include "common/Flags.h"
+#include "common/StringTools.h"
+
+DEFINE_FLAG_INT32(curl_handler_pool_max_idle_per_host, "max idle curl handlers kept for an endpoint", 8);
+DEFINE_FLAG_INT32(curl_handler_pool_idle_timeout_sec, "idle curl handlers are cleaned up after, seconds", 60);
+
+using namespace std;
+
+namespace logtail {
+
+CURL* CurlHandlerPool::Acquire(bool httpsFlag, const string& host, int32_t port) {
+    {
+        lock_guard<mutex> lock(mMux);
+        EvictIdleHandlers(GetCoarseTimeInMilliSeconds());
+        auto it = mIdleHandlers.find(GetKey(httpsFlag, host, port));
+        if (it != mIdleHandlers.end() && !it->second.empty()) {
+            CURL* curl = it->second.back().mHandler;
+            it->second.pop_back();
+            mReusedHandlerCnt.fetch_add(1, memory_order_relaxed);
+            return curl;
+        }
+    }
+    return curl_easy_init();
+}
+
+void CurlHandlerPool::Release(bool httpsFlag, const string& host, int32_t port, CURL* curl, bool transferred) {
+    if (curl == nullptr) {
+        return;
+    }
+    if (transferred) {
+        if (GetNewConnectionCnt(curl) > 0) {
+            mNewConnectionCnt.fetch_add(1, memory_order_relaxed);
+        } else {
+            mReusedConnectionCnt.fetch_add(1, memory_order_relaxed);
+        }
+    }
+    // live connections, dns cache and tls session cache are kept by reset
+    curl_easy_reset(curl);
+
+    CURL* evicted = nullptr;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto now = GetCoarseTimeInMilliSeconds();
+        EvictIdleHandlers(now);
+        auto& handlers = mIdleHandlers[GetKey(httpsFlag, host, port)];
+        handlers.push_back({curl, now});
+        if (handlers.size() > static_cast<size_t>(max(0, INT32_FLAG(curl_handler_pool_max_idle_per_host)))) {
+            evicted = handlers.front().mHandler;
+            handlers.pop_front();
+        }
+    }
+    if (evicted != nullptr) {
+        curl_easy_cleanup(evicted);
+    }
+}
+
+void CurlHandlerPool::Clear() {
+    lock_guard<mutex> lock(mMux);
+    for (auto& item : mIdleHandlers) {
+        for (auto& handler : item.second) {
+            curl_easy_cleanup(handler.mHandler);
+        }
+    }
+    mIdleHandlers.clear();
+}
+
+long CurlHandlerPool::GetNewConnectionCnt(CURL* curl) {
+    long cnt = 0;
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &cnt);
+    return cnt;
+}
+
+string CurlHandlerPool::GetKey(bool httpsFlag, const string& host, int32_t port) {
+    return (httpsFlag ? "https://" : "http://") + host + ":" + ToString(port);
+}
+
+void CurlHandlerPool::EvictIdleHandlers(int64_t now) {
+    if (now - mLastEvictTimeMs < 1000) {
+        return;
+    }
+    mLastEvictTimeMs = now;
+    int64_t timeoutMs = INT32_FLAG(curl_handler_pool_idle_timeout_sec) * 1000LL;
+    for (auto it = mIdleHandlers.begin(); it != mIdleHandlers.end();) {
+        auto& handlers = it->second;
+        while (!handlers.empty() && now - handlers.front().mIdleSinceMs >= timeoutMs) {
+            curl_easy_cleanup(handlers.front().mHandler);
+            handlers.pop_front();
+        }
+        if (handlers.empty()) {
+            it = mIdleHandlers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace logtail
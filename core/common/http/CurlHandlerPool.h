@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <curl/curl.h>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace logtail {
+
+// Easy handlers are kept per endpoint after use instead of being cleaned up. A reused handler keeps its live
+// connections and TLS session cache, so subsequent requests to the same endpoint skip TCP and TLS handshakes. Note
+// that handlers added to a multi handle share the connection cache of the multi handle instead.
+//
+// At most curl_handler_pool_max_idle_per_host handlers are kept for an endpoint, and handlers idle for more than
+// curl_handler_pool_idle_timeout_sec are cleaned up together with their connections.
+class CurlHandlerPool {
+public:
+    CurlHandlerPool() = default;
+    CurlHandlerPool(const CurlHandlerPool&) = delete;
+    CurlHandlerPool& operator=(const CurlHandlerPool&) = delete;
+    ~CurlHandlerPool() { Clear(); }
+
+    // the handler returned is either new or reset, options should be set again
+    CURL* Acquire(bool httpsFlag, const std::string& host, int32_t port);
+    // @transferred should be false if the handler has not been performed, so that connection stats are not updated
+    void Release(bool httpsFlag, const std::string& host, int32_t port, CURL* curl, bool transferred = true);
+    void Clear();
+
+    uint64_t GetNewConnectionCnt() const { return mNewConnectionCnt.load(std::memory_order_relaxed); }
+    uint64_t GetReusedConnectionCnt() const { return mReusedConnectionCnt.load(std::memory_order_relaxed); }
+    uint64_t GetReusedHandlerCnt() const { return mReusedHandlerCnt.load(std::memory_order_relaxed); }
+
+    // number of connections established by the last transfer of the handler, i.e. 0 if the connection is reused
+    static long GetNewConnectionCnt(CURL* curl);
+
+private:
+    struct IdleHandler {
+        CURL* mHandler = nullptr;
+        int64_t mIdleSinceMs = 0;
+    };
+
+    static std::string GetKey(bool httpsFlag, const std::string& host, int32_t port);
+    void EvictIdleHandlers(int64_t now);
+
+    std::mutex mMux;
+    // handlers are pushed to and popped from the back, so the front is the oldest one
+    std::unordered_map<std::string, std::deque<IdleHandler>> mIdleHandlers;
+    int64_t mLastEvictTimeMs = 0;
+
+    std::atomic_uint64_t mNewConnectionCnt = 0;
+    std::atomic_uint64_t mReusedConnectionCnt = 0;
+    std::atomic_uint64_t mReusedHandlerCnt = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class CurlHandlerPoolUnittest;
+#endif
+};
+
+} // namespace logtail
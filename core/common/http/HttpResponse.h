@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace logtail {
@@ -26,12 +27,34 @@ bool caseInsensitiveComp(const char lhs, const char rhs);
 
 bool compareHeader(const std::string& lhs, const std::string& rhs);
 
+// Receives the (decoded) response body chunk by chunk while it is being received, so that large bodies can be consumed
+// on the fly instead of being buffered as a whole.
+class HttpResponseBodySink {
+public:
+    virtual ~HttpResponseBodySink() = default;
+
+    virtual void Write(const char* data, size_t len) = 0;
+    // drops the partial body received by a failed try
+    virtual void Reset() = 0;
+};
+
 struct HttpResponse {
     int32_t mStatusCode = 0; // 0 means no response from server
     std::map<std::string, std::string, decltype(compareHeader)*> mHeader;
+    // empty if mBodySink is set
     std::string mBody;
+    std::shared_ptr<HttpResponseBodySink> mBodySink;
+    // from sending the last try to completion
+    uint32_t mResponseTimeMs = 0;
 
     HttpResponse(): mHeader(compareHeader) {}
+
+    void ResetBody() {
+        mBody.clear();
+        if (mBodySink) {
+            mBodySink->Reset();
+        }
+    }
 };
 
 } // namespace logtail
@@ -18,6 +18,7 @@
 
 #include <list>
 #include <memory>
+#include <vector>
 
 #include "models/StringView.h"
 
@@ -152,6 +153,10 @@ private:
 // only movable
 class SourceBuffer {
 public:
+    SourceBuffer() = default;
+    // the first chunk holds @firstChunkSize bytes, so that a buffer whose size is known ahead is allocated only once
+    explicit SourceBuffer(uint32_t firstChunkSize) : mAllocator(firstChunkSize) {}
+
     StringBuffer AllocateStringBuffer(size_t size) {
         char* data = static_cast<char*>(mAllocator.Allocate(size + 1));
         data[size] = '\0';
@@ -16,6 +16,7 @@
 #include <map>
 #include <string>
 #include <algorithm>
+#include <chrono>
 #include <gflags/gflags.h>
 
 #include "app_config/AppConfig.h"
@@ -136,6 +137,8 @@ bool eBPFServer::IsSupportedEnv(nami::PluginType type) {
 }
 
 void eBPFServer::Init() {
+    // may be called by several pipelines being built concurrently
+    std::lock_guard<std::mutex> initLock(mInitMux);
     if (mInited) {
         return;
     }
@@ -161,11 +164,25 @@ void eBPFServer::Init() {
     mNetworkSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
     mProcessSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
     mFileSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mFlushThreadMux);
+        mIsFlushThreadRunning = true;
+    }
+    mFlushThreadRes = std::async(std::launch::async, &eBPFServer::FlushThread, this);
 }
 
 void eBPFServer::Stop() {
     if (!mInited) return;
     mInited = false;
+    {
+        std::lock_guard<std::mutex> lock(mFlushThreadMux);
+        mIsFlushThreadRunning = false;
+    }
+    mStopCV.notify_all();
+    if (mFlushThreadRes.valid()) {
+        mFlushThreadRes.get();
+    }
     LOG_INFO(sLogger, ("begin to stop all plugins", ""));
     mSourceManager->StopAll();
     // destroy source manager 
@@ -174,7 +191,7 @@ void eBPFServer::Stop() {
         UpdatePipelineName(static_cast<nami::PluginType>(i), "");
     }
     
-    // UpdateContext must after than StopPlugin
+    // UpdateContext must after than StopPlugin, which also pushes observations pending
     if (mEventCB) mEventCB->UpdateContext(nullptr, -1, -1);
     if (mMeterCB) mMeterCB->UpdateContext(nullptr, -1, -1);
     if (mSpanCB) mSpanCB->UpdateContext(nullptr,-1, -1);
@@ -183,6 +200,22 @@ void eBPFServer::Stop() {
     if (mFileSecureCB) mFileSecureCB->UpdateContext(nullptr, -1, -1);
 }
 
+void eBPFServer::FlushThread() {
+    LOG_INFO(sLogger, ("ebpf observer flush thread", "started"));
+    std::unique_lock<std::mutex> lock(mFlushThreadMux);
+    while (mIsFlushThreadRunning) {
+        if (mStopCV.wait_for(lock, std::chrono::milliseconds(100), [this]() { return !mIsFlushThreadRunning; })) {
+            break;
+        }
+        lock.unlock();
+        mEventCB->FlushTimeout();
+        mMeterCB->FlushTimeout();
+        mSpanCB->FlushTimeout();
+        lock.lock();
+    }
+    LOG_INFO(sLogger, ("ebpf observer flush thread", "stopped"));
+}
+
 bool eBPFServer::StartPluginInternal(const std::string& pipeline_name, uint32_t plugin_index,
                         nami::PluginType type, 
                         const logtail::PipelineContext* ctx, 
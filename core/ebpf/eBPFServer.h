@@ -18,6 +18,8 @@
 #include <atomic>
 #include <map>
 #include <array>
+#include <condition_variable>
+#include <future>
 #include <memory>
 #include <mutex>
 
@@ -89,6 +91,8 @@ private:
     ~eBPFServer() = default;
 
     void UpdateCBContext(nami::PluginType type, const logtail::PipelineContext* ctx, logtail::QueueKey key, int idx);
+    // pushes observations pending for coalescing for too long
+    void FlushThread();
 
     std::unique_ptr<SourceManager> mSourceManager;
     // source manager
@@ -103,10 +107,16 @@ private:
     std::array<std::string, (int)nami::PluginType::MAX> mLoadedPipeline = {};
 
     eBPFAdminConfig mAdminConfig;
+    std::mutex mInitMux;
     volatile bool mInited = false;
 
     EnvManager mEnvMgr;
 
+    std::future<void> mFlushThreadRes;
+    std::mutex mFlushThreadMux;
+    std::condition_variable mStopCV;
+    bool mIsFlushThreadRunning = false;
+
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class eBPFServerUnittest;
 #endif
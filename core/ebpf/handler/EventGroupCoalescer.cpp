@@ -0,0 +1,127 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ebpf/handler/EventGroupCoalescer.h"
+
+#include <chrono>
+#include <vector>
+
+#include "common/Flags.h"
+
+DEFINE_FLAG_INT32(ebpf_observer_coalesce_max_event_cnt, "max events in a coalesced event group of ebpf observer", 1024);
+DEFINE_FLAG_INT32(ebpf_observer_coalesce_max_bytes,
+                  "max bytes of a coalesced event group of ebpf observer",
+                  512 * 1024);
+DEFINE_FLAG_INT32(ebpf_observer_coalesce_max_latency_ms,
+                  "max time events of ebpf observer are held for coalescing, 0 to disable coalescing",
+                  1000);
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+static int64_t GetSteadyTimeInMilliSeconds() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+CoalescedGroup::CoalescedGroup(int64_t createTimeMs)
+    : mGroup(make_shared<SourceBuffer>()), mCreateTimeMs(createTimeMs) {
+}
+
+StringView CoalescedGroup::Intern(const string& s) {
+    auto iter = mInterned.find(string_view(s));
+    if (iter != mInterned.end()) {
+        return StringView(iter->data(), iter->size());
+    }
+    auto buffer = mGroup.GetSourceBuffer()->CopyString(s);
+    if (mInterned.size() < sMaxInternedCnt) {
+        mInterned.emplace(buffer.data, buffer.size);
+    }
+    return StringView(buffer.data, buffer.size);
+}
+
+EventGroupCoalescer::EventGroupCoalescer(PushFunc&& push)
+    : EventGroupCoalescer(std::move(push),
+                          INT32_FLAG(ebpf_observer_coalesce_max_event_cnt),
+                          INT32_FLAG(ebpf_observer_coalesce_max_bytes),
+                          INT32_FLAG(ebpf_observer_coalesce_max_latency_ms)) {
+}
+
+EventGroupCoalescer::EventGroupCoalescer(PushFunc&& push, size_t maxEventCnt, size_t maxBytes, int64_t maxLatencyMs)
+    : mPush(std::move(push)), mMaxEventCnt(maxEventCnt), mMaxBytes(maxBytes), mMaxLatencyMs(maxLatencyMs) {
+}
+
+void EventGroupCoalescer::Append(const string& key, const FillFunc& init, const FillFunc& fill) {
+    vector<PipelineEventGroup> groups;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto iter = mGroups.find(key);
+        if (iter == mGroups.end()) {
+            iter = mGroups.emplace(key, CoalescedGroup(GetSteadyTimeInMilliSeconds())).first;
+            init(iter->second);
+        }
+        auto& group = iter->second;
+        fill(group);
+        const auto& events = group.mGroup.GetEvents();
+        for (; group.mCountedEventCnt < events.size(); ++group.mCountedEventCnt) {
+            group.mDataSize += events[group.mCountedEventCnt]->DataSize();
+        }
+        if (mMaxLatencyMs <= 0 || events.size() >= mMaxEventCnt || group.mDataSize >= mMaxBytes) {
+            groups.emplace_back(std::move(group.mGroup));
+            mGroups.erase(iter);
+        }
+    }
+    Push(groups);
+}
+
+void EventGroupCoalescer::FlushTimeout() {
+    vector<PipelineEventGroup> groups;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto now = GetSteadyTimeInMilliSeconds();
+        for (auto iter = mGroups.begin(); iter != mGroups.end();) {
+            if (now - iter->second.mCreateTimeMs >= mMaxLatencyMs) {
+                groups.emplace_back(std::move(iter->second.mGroup));
+                iter = mGroups.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+    Push(groups);
+}
+
+void EventGroupCoalescer::FlushAll() {
+    vector<PipelineEventGroup> groups;
+    {
+        lock_guard<mutex> lock(mMux);
+        for (auto& item : mGroups) {
+            groups.emplace_back(std::move(item.second.mGroup));
+        }
+        mGroups.clear();
+    }
+    Push(groups);
+}
+
+void EventGroupCoalescer::Push(vector<PipelineEventGroup>& groups) {
+    for (auto& group : groups) {
+        if (!group.GetEvents().empty()) {
+            mPush(std::move(group));
+        }
+    }
+}
+
+} // namespace ebpf
+} // namespace logtail
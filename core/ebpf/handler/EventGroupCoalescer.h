@@ -0,0 +1,90 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "models/PipelineEventGroup.h"
+
+namespace logtail {
+namespace ebpf {
+
+// An event group being coalesced. Strings shared by events, such as tag keys and dimension values, are copied into
+// the group only once.
+class CoalescedGroup {
+public:
+    explicit CoalescedGroup(int64_t createTimeMs);
+
+    PipelineEventGroup& GetGroup() { return mGroup; }
+    StringView Intern(const std::string& s);
+
+private:
+    static constexpr size_t sMaxInternedCnt = 4096;
+
+    PipelineEventGroup mGroup;
+    std::unordered_set<std::string_view> mInterned;
+    int64_t mCreateTimeMs = 0;
+    size_t mDataSize = 0;
+    size_t mCountedEventCnt = 0;
+
+    friend class EventGroupCoalescer;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class EventGroupCoalescerUnittest;
+#endif
+};
+
+// Merges events of the same kind and group tags into larger groups before they are pushed into the process queue,
+// instead of pushing a tiny group for every batch reported by the eBPF layer. A group is pushed once it has too many
+// events or bytes, or has been pending for too long. Pending groups are only pushed when events are appended or
+// FlushTimeout is called, so FlushTimeout should be called periodically.
+class EventGroupCoalescer {
+public:
+    using PushFunc = std::function<void(PipelineEventGroup&&)>;
+    using FillFunc = std::function<void(CoalescedGroup&)>;
+
+    explicit EventGroupCoalescer(PushFunc&& push);
+    EventGroupCoalescer(PushFunc&& push, size_t maxEventCnt, size_t maxBytes, int64_t maxLatencyMs);
+
+    // @key identifies the kind and the group tags of the events added by @fill, and @init sets the group tags when the
+    // group of @key is created.
+    void Append(const std::string& key, const FillFunc& init, const FillFunc& fill);
+    void FlushTimeout();
+    void FlushAll();
+
+private:
+    void Push(std::vector<PipelineEventGroup>& groups);
+
+    PushFunc mPush;
+    size_t mMaxEventCnt = 0;
+    size_t mMaxBytes = 0;
+    // coalescing is disabled if not positive
+    int64_t mMaxLatencyMs = 0;
+
+    std::mutex mMux;
+    std::unordered_map<std::string, CoalescedGroup> mGroups;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class EventGroupCoalescerUnittest;
+#endif
+};
+
+} // namespace ebpf
+} // namespace logtail
@@ -32,87 +32,129 @@ namespace ebpf {
 
 #define ADD_STATUS_METRICS(METRIC_NAME, FIELD_NAME, VALUE) \
     {if (!inner->FIELD_NAME) return; \
-    auto event = group.AddMetricEvent(); \
+    auto event = group.GetGroup().AddMetricEvent(); \
     for (auto& tag : measure->tags_) { \
-        event->SetTag(tag.first, tag.second); \
+        event->SetTagNoCopy(group.Intern(tag.first), group.Intern(tag.second)); \
     } \
-    event->SetTag(std::string("status_code"), std::string(VALUE)); \
-    event->SetName(METRIC_NAME); \
+    event->SetTagNoCopy(group.Intern(status_code_key), group.Intern(VALUE)); \
+    event->SetNameNoCopy(group.Intern(METRIC_NAME)); \
     event->SetTimestamp(ts); \
     event->SetValue(UntypedSingleValue{(double)inner->FIELD_NAME});} \
 
 #define GENERATE_METRICS(FUNC_NAME, MEASURE_TYPE, INNER_TYPE, METRIC_NAME, FIELD_NAME) \
-void FUNC_NAME(PipelineEventGroup& group, std::unique_ptr<Measure>& measure, uint64_t ts) { \
+void FUNC_NAME(CoalescedGroup& group, std::unique_ptr<Measure>& measure, uint64_t ts) { \
     if (measure->type_ != MEASURE_TYPE) return; \
     auto inner = static_cast<INNER_TYPE*>(measure->inner_measure_.get()); \
     if (!inner->FIELD_NAME) return; \
-    auto event = group.AddMetricEvent(); \
+    auto event = group.GetGroup().AddMetricEvent(); \
     for (auto& tag : measure->tags_) { \
-        event->SetTag(tag.first, tag.second); \
+        event->SetTagNoCopy(group.Intern(tag.first), group.Intern(tag.second)); \
     } \
-    event->SetName(METRIC_NAME); \
+    event->SetNameNoCopy(group.Intern(METRIC_NAME)); \
     event->SetTimestamp(ts); \
     event->SetValue(UntypedSingleValue{(double)inner->FIELD_NAME}); \
 }
 
+// events without group tags are coalesced under the same key
+const static std::string no_group_tag_key = "";
+const static std::string service_requests_total = "service_requests_total";
+
+ObserveHandler::ObserveHandler(const logtail::PipelineContext* ctx,
+                               QueueKey key,
+                               uint32_t idx,
+                               const std::string& name)
+    : AbstractHandler(ctx, key, idx),
+      mCoalescer([this](PipelineEventGroup&& group) { PushQueue(std::move(group)); }),
+      mName(name) {
+}
+
+void ObserveHandler::UpdateContext(const logtail::PipelineContext* ctx, logtail::QueueKey key, uint32_t index) {
+    std::lock_guard<std::mutex> lock(mMux);
+    // events pending are pushed to the old pipeline
+    mCoalescer.FlushAll();
+    AbstractHandler::UpdateContext(ctx, key, index);
+}
+
+void ObserveHandler::FlushTimeout() {
+    std::lock_guard<std::mutex> lock(mMux);
+    mCoalescer.FlushTimeout();
+}
+
+void ObserveHandler::FlushAll() {
+    std::lock_guard<std::mutex> lock(mMux);
+    mCoalescer.FlushAll();
+}
+
+void ObserveHandler::Append(const std::string& key,
+                            const EventGroupCoalescer::FillFunc& init,
+                            const EventGroupCoalescer::FillFunc& fill) {
+    std::lock_guard<std::mutex> lock(mMux);
+    mCoalescer.Append(key, init, fill);
+}
+
+void ObserveHandler::PushQueue(PipelineEventGroup&& group) {
+#ifdef APSARA_UNIT_TEST_MAIN
+    return;
+#endif
+    if (mCtx == nullptr) {
+        return;
+    }
+    std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(group), mPluginIdx);
+    if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
+        LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[" + mName + "] push queue failed!", ""));
+    }
+}
+
 void OtelMeterHandler::handle(std::vector<std::unique_ptr<ApplicationBatchMeasure>>&& measures, uint64_t timestamp) {
     if (measures.empty()) return;
 
     for (auto& appBatchMeasures : measures) {
-        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
-        for (auto& measure : appBatchMeasures->measures_) {
-            auto type = measure->type_;
-            if (type == MeasureType::MEASURE_TYPE_APP) {
-                auto inner = static_cast<AppSingleMeasure*>(measure->inner_measure_.get());
-                auto event = eventGroup.AddMetricEvent();
-                for (auto& tag : measure->tags_) {
-                    event->SetTag(tag.first, tag.second);
+        Append(no_group_tag_key, [](CoalescedGroup&) {}, [&](CoalescedGroup& group) {
+            for (auto& measure : appBatchMeasures->measures_) {
+                auto type = measure->type_;
+                if (type == MeasureType::MEASURE_TYPE_APP) {
+                    auto inner = static_cast<AppSingleMeasure*>(measure->inner_measure_.get());
+                    auto event = group.GetGroup().AddMetricEvent();
+                    for (auto& tag : measure->tags_) {
+                        event->SetTagNoCopy(group.Intern(tag.first), group.Intern(tag.second));
+                    }
+                    event->SetNameNoCopy(group.Intern(service_requests_total));
+                    event->SetTimestamp(timestamp);
+                    event->SetValue(UntypedSingleValue{(double)inner->request_total_});
                 }
-                event->SetName("service_requests_total");
-                event->SetTimestamp(timestamp);
-                event->SetValue(UntypedSingleValue{(double)inner->request_total_});
+                mProcessTotalCnt++;
             }
-            mProcessTotalCnt++;
-        }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
-            LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[Otel Metrics] push queue failed!", ""));
-        }
-        
+        });
     }
     return;
 }
 
+// only tag keys and span names are interned, since tag values such as urls are rarely shared among spans
+static void AddSpanEvents(CoalescedGroup& group, std::vector<std::unique_ptr<SingleSpan>>& spans) {
+    auto& sourceBuffer = group.GetGroup().GetSourceBuffer();
+    for (auto& x : spans) {
+        auto spanEvent = group.GetGroup().AddSpanEvent();
+        for (auto& tag : x->tags_) {
+            auto value = sourceBuffer->CopyString(tag.second);
+            spanEvent->SetTagNoCopy(group.Intern(tag.first), StringView(value.data, value.size));
+        }
+        spanEvent->SetNameNoCopy(group.Intern(x->span_name_));
+        spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
+        spanEvent->SetStartTimeNs(x->start_timestamp_);
+        spanEvent->SetEndTimeNs(x->end_timestamp_);
+        spanEvent->SetTraceId(x->trace_id_);
+        spanEvent->SetSpanId(x->span_id_);
+    }
+}
+
 void OtelSpanHandler::handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>&& spans) {
     if (spans.empty()) return;
 
     for (auto& span : spans) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
-        for (auto& x : span->single_spans_) {
-            auto spanEvent = eventGroup.AddSpanEvent();
-            for (auto& tag : x->tags_) {
-                spanEvent->SetTag(tag.first, tag.second);
-            }
-            spanEvent->SetName(x->span_name_);
-            spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
-            spanEvent->SetStartTimeNs(x->start_timestamp_);
-            spanEvent->SetEndTimeNs(x->end_timestamp_);
-            spanEvent->SetTraceId(x->trace_id_);
-            spanEvent->SetSpanId(x->span_id_);
-            mProcessTotalCnt++;
-        }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
-            LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[Span] push queue failed!", ""));
-        }
-        
+        Append(no_group_tag_key, [](CoalescedGroup&) {}, [&](CoalescedGroup& group) {
+            AddSpanEvents(group, span->single_spans_);
+        });
+        mProcessTotalCnt += span->single_spans_.size();
     }
 
     return;
@@ -121,30 +163,33 @@ void OtelSpanHandler::handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>&
 void EventHandler::handle(std::vector<std::unique_ptr<ApplicationBatchEvent>>&& events) {
     if (events.empty()) return;
 
+    std::string key;
     for (auto& appEvents : events) {
         if (!appEvents || appEvents->events_.empty()) continue;
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
-        for (auto& event : appEvents->events_) {
-            if (!event || event->GetAllTags().empty()) continue;
-            auto logEvent = eventGroup.AddLogEvent();
-            for (auto& tag : event->GetAllTags()) {
-                logEvent->SetContent(tag.first, tag.second);
+        key.clear();
+        for (auto& tag : appEvents->tags_) {
+            key.append(tag.first).append(1, '\0').append(tag.second).append(1, '\0');
+        }
+        auto init = [&](CoalescedGroup& group) {
+            for (auto& tag : appEvents->tags_) {
+                group.GetGroup().SetTag(tag.first, tag.second);
+            }
+        };
+        Append(key, init, [&](CoalescedGroup& group) {
+            auto& sourceBuffer = group.GetGroup().GetSourceBuffer();
+            for (auto& event : appEvents->events_) {
+                if (!event || event->GetAllTags().empty()) continue;
+                auto logEvent = group.GetGroup().AddLogEvent();
+                logEvent->ReserveContents(event->GetAllTags().size());
+                for (auto& tag : event->GetAllTags()) {
+                    auto value = sourceBuffer->CopyString(tag.second);
+                    logEvent->SetContentNoCopy(group.Intern(tag.first), StringView(value.data, value.size));
+                }
                 auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(event->GetTimestamp()));
                 logEvent->SetTimestamp(seconds.count(), event->GetTimestamp() - seconds.count() * 1e9);
+                mProcessTotalCnt ++;
             }
-            mProcessTotalCnt ++;
-        }
-        for (auto& tag : appEvents->tags_) {
-            eventGroup.SetTag(tag.first, tag.second);
-        }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
-            LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[Event] push queue failed!", ""));
-        }
+        });
     }
 }
 
@@ -162,6 +207,7 @@ static const std::string status_2xx_key = "2xx";
 static const std::string status_3xx_key = "2xx";
 static const std::string status_4xx_key = "2xx";
 static const std::string status_5xx_key = "2xx";
+static const std::string status_code_key = "status_code";
 
 // FOR APP METRICS
 GENERATE_METRICS(GenerateRequestsTotalMetrics, MeasureType::MEASURE_TYPE_APP, AppSingleMeasure, rpc_request_total_count, request_total_)
@@ -169,7 +215,7 @@ GENERATE_METRICS(GenerateRequestsSlowMetrics, MeasureType::MEASURE_TYPE_APP, App
 GENERATE_METRICS(GenerateRequestsErrorMetrics, MeasureType::MEASURE_TYPE_APP, AppSingleMeasure, rpc_request_err_count, error_total_)
 GENERATE_METRICS(GenerateRequestsDurationSumMetrics, MeasureType::MEASURE_TYPE_APP, AppSingleMeasure, rpc_request_status_count, duration_ms_sum_)
 
-void GenerateRequestsStatusMetrics(PipelineEventGroup& group, std::unique_ptr<Measure>& measure, uint64_t ts) {
+void GenerateRequestsStatusMetrics(CoalescedGroup& group, std::unique_ptr<Measure>& measure, uint64_t ts) {
     if (measure->type_ != MeasureType::MEASURE_TYPE_APP) return;
     auto inner = static_cast<AppSingleMeasure*>(measure->inner_measure_.get());
     ADD_STATUS_METRICS(rpc_request_status_count, status_2xx_count_, status_2xx_key);
@@ -199,29 +245,11 @@ void ArmsSpanHandler::handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>&
     if (spans.empty()) return;
 
     for (auto& span : spans) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
-        eventGroup.SetTag(app_id_key, span->app_id_);
-        for (auto& x : span->single_spans_) {
-            auto spanEvent = eventGroup.AddSpanEvent();
-            for (auto& tag : x->tags_) {
-                spanEvent->SetTag(tag.first, tag.second);
-            }
-            spanEvent->SetName(x->span_name_);
-            spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
-            spanEvent->SetStartTimeNs(x->start_timestamp_);
-            spanEvent->SetEndTimeNs(x->end_timestamp_);
-            spanEvent->SetTraceId(x->trace_id_);
-            spanEvent->SetSpanId(x->span_id_);
-            mProcessTotalCnt++;
-        }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
-            LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[Span] push queue failed!", ""));
-        }
+        auto init = [&](CoalescedGroup& group) { group.GetGroup().SetTag(app_id_key, span->app_id_); };
+        Append(span->app_id_, init, [&](CoalescedGroup& group) {
+            AddSpanEvents(group, span->single_spans_);
+        });
+        mProcessTotalCnt += span->single_spans_.size();
     }
 
     return;
@@ -231,41 +259,33 @@ void ArmsMeterHandler::handle(std::vector<std::unique_ptr<ApplicationBatchMeasur
     if (measures.empty()) return;
 
     for (auto& appBatchMeasures : measures) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();;
-        PipelineEventGroup eventGroup(sourceBuffer);
-        
-        // source_ip
-        eventGroup.SetTag(std::string(app_id_key), appBatchMeasures->app_id_);
-        eventGroup.SetTag(std::string(ip_key), appBatchMeasures->ip_);
-        for (auto& measure : appBatchMeasures->measures_) {
-            auto type = measure->type_;
-            if (type == MeasureType::MEASURE_TYPE_APP) {
-                GenerateRequestsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsSlowMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsErrorMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsDurationSumMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsStatusMetrics(eventGroup, measure, timestamp);
-                
-            } else if (type == MeasureType::MEASURE_TYPE_NET) {
-                GenerateTcpDropTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRetransTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpConnectionTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRecvPktsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRecvBytesTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpSendPktsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpSendBytesTotalMetrics(eventGroup, measure, timestamp);
-            }
-            mProcessTotalCnt++;
-        }
-        
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item))) {
-            LOG_WARNING(sLogger, ("configName", mCtx->GetConfigName())("pluginIdx",mPluginIdx)("[Metrics] push queue failed!", ""));
-        }
+        auto init = [&](CoalescedGroup& group) {
+            // source_ip
+            group.GetGroup().SetTag(std::string(app_id_key), appBatchMeasures->app_id_);
+            group.GetGroup().SetTag(std::string(ip_key), appBatchMeasures->ip_);
+        };
+        Append(appBatchMeasures->app_id_ + '\0' + appBatchMeasures->ip_, init, [&](CoalescedGroup& group) {
+            for (auto& measure : appBatchMeasures->measures_) {
+                auto type = measure->type_;
+                if (type == MeasureType::MEASURE_TYPE_APP) {
+                    GenerateRequestsTotalMetrics(group, measure, timestamp);
+                    GenerateRequestsSlowMetrics(group, measure, timestamp);
+                    GenerateRequestsErrorMetrics(group, measure, timestamp);
+                    GenerateRequestsDurationSumMetrics(group, measure, timestamp);
+                    GenerateRequestsStatusMetrics(group, measure, timestamp);
 
+                } else if (type == MeasureType::MEASURE_TYPE_NET) {
+                    GenerateTcpDropTotalMetrics(group, measure, timestamp);
+                    GenerateTcpRetransTotalMetrics(group, measure, timestamp);
+                    GenerateTcpConnectionTotalMetrics(group, measure, timestamp);
+                    GenerateTcpRecvPktsTotalMetrics(group, measure, timestamp);
+                    GenerateTcpRecvBytesTotalMetrics(group, measure, timestamp);
+                    GenerateTcpSendPktsTotalMetrics(group, measure, timestamp);
+                    GenerateTcpSendBytesTotalMetrics(group, measure, timestamp);
+                }
+                mProcessTotalCnt++;
+            }
+        });
     }
     return;
 }
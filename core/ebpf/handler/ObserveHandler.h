@@ -14,17 +14,47 @@
 
 #pragma once
 
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "ebpf/handler/AbstractHandler.h"
+#include "ebpf/handler/EventGroupCoalescer.h"
 #include "ebpf/include/export.h"
 
 namespace logtail {
 namespace ebpf {
 
-class MeterHandler : public AbstractHandler {
+// Observations are coalesced into larger event groups before being pushed, so FlushTimeout should be called
+// periodically to push the groups pending for too long.
+class ObserveHandler : public AbstractHandler {
 public:
-    MeterHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx) : AbstractHandler(ctx, key, idx) {}
+    ObserveHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx, const std::string& name);
+
+    void UpdateContext(const logtail::PipelineContext* ctx, logtail::QueueKey key, uint32_t index) override;
+    void FlushTimeout();
+    void FlushAll();
+
+protected:
+    void Append(const std::string& key,
+                const EventGroupCoalescer::FillFunc& init,
+                const EventGroupCoalescer::FillFunc& fill);
+
+private:
+    // should be called with mMux held
+    void PushQueue(PipelineEventGroup&& group);
+
+    // guards both the context fields and the coalescer, so that groups are always pushed to the context they are
+    // coalesced for, even if the context is switched concurrently
+    std::mutex mMux;
+    EventGroupCoalescer mCoalescer;
+    std::string mName;
+};
+
+class MeterHandler : public ObserveHandler {
+public:
+    MeterHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx)
+        : ObserveHandler(ctx, key, idx, "Metrics") {}
 
     virtual void handle(std::vector<std::unique_ptr<ApplicationBatchMeasure>>&&, uint64_t) = 0;
 };
@@ -35,9 +65,10 @@ public:
     void handle(std::vector<std::unique_ptr<ApplicationBatchMeasure>>&& measures, uint64_t timestamp) override;
 };
 
-class SpanHandler : public AbstractHandler {
+class SpanHandler : public ObserveHandler {
 public:
-    SpanHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx) : AbstractHandler(ctx, key, idx) {}
+    SpanHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx)
+        : ObserveHandler(ctx, key, idx, "Span") {}
     virtual void handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>&&) = 0;
 };
 
@@ -47,9 +78,10 @@ public:
     void handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>&&) override;
 };
 
-class EventHandler : public AbstractHandler {
+class EventHandler : public ObserveHandler {
 public:
-    EventHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx) : AbstractHandler(ctx, key, idx) {}
+    EventHandler(const logtail::PipelineContext* ctx, QueueKey key, uint32_t idx)
+        : ObserveHandler(ctx, key, idx, "Event") {}
     void handle(std::vector<std::unique_ptr<ApplicationBatchEvent>>&&);
 };
 
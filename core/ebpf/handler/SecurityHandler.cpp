@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include "ebpf/handler/SecurityHandler.h"
+
+#include <algorithm>
+#include <cstdint>
+
 #include "logger/Logger.h"
 #include "pipeline/PipelineContext.h"
 #include "common/RuntimeUtil.h"
@@ -29,33 +33,69 @@ namespace logtail {
 namespace ebpf {
 
 SecurityHandler::SecurityHandler(const logtail::PipelineContext* ctx, logtail::QueueKey key, uint32_t idx) 
-    : AbstractHandler(ctx, key, idx) {
-    mHostName = GetHostName();
-    mHostIp = GetHostIp();
+    : AbstractHandler(ctx, key, idx), mKeyBuffer(std::make_shared<SourceBuffer>()) {
+    auto hostName = mKeyBuffer->CopyString(GetHostName());
+    mHostName = StringView(hostName.data, hostName.size);
+    auto hostIp = mKeyBuffer->CopyString(GetHostIp());
+    mHostIp = StringView(hostIp.data, hostIp.size);
 }
 
-void SecurityHandler::handle(std::vector<std::unique_ptr<AbstractSecurityEvent>>&& events) {
-    if (events.empty()) {
-        return ;
+StringView SecurityHandler::InternKey(const std::string& key) {
+    auto iter = mKeys.find(key);
+    if (iter != mKeys.end()) {
+        return iter->second;
+    }
+    if (mKeys.size() >= sMaxKeyCnt) {
+        return StringView();
     }
+    auto buffer = mKeyBuffer->CopyString(key);
+    return mKeys.emplace(key, StringView(buffer.data, buffer.size)).first->second;
+}
 
-    std::shared_ptr<SourceBuffer> source_buffer = std::make_shared<SourceBuffer>();;
-    PipelineEventGroup event_group(source_buffer);
+PipelineEventGroup SecurityHandler::BuildEventGroup(const std::vector<std::unique_ptr<AbstractSecurityEvent>>& events) {
+    // values are copied into a source buffer allocated at once
+    size_t size = 0;
+    for (const auto& x : events) {
+        for (const auto& tag : x->GetAllTags()) {
+            size += (tag.second.size() + sizeof(void*)) & ~(sizeof(void*) - 1);
+        }
+    }
+    size = std::min(std::max(size, size_t(4096)), size_t(UINT32_MAX));
+    PipelineEventGroup event_group(std::make_shared<SourceBuffer>(static_cast<uint32_t>(size)));
+    auto& sourceBuffer = event_group.GetSourceBuffer();
+    event_group.RetainSourceBuffer(mKeyBuffer);
     // aggregate to pipeline event group
     // set host ips
     // TODO 后续这两个 key 需要移到 group 的 metadata 里，在 processortagnative 中转成tag
     const static std::string host_ip_key = "host.ip";
     const static std::string host_name_key = "host.name";
-    event_group.SetTag(host_ip_key, mHostIp);
-    event_group.SetTag(host_name_key, mHostName);
-    for (auto& x : events) {
+    event_group.SetTagNoCopy(host_ip_key, mHostIp);
+    event_group.SetTagNoCopy(host_name_key, mHostName);
+    event_group.MutableEvents().reserve(events.size());
+    for (const auto& x : events) {
         auto event = event_group.AddLogEvent();
-        for (auto& tag : x->GetAllTags()) {
-            event->SetContent(tag.first, tag.second);
+        event->ReserveContents(x->GetAllTags().size());
+        for (const auto& tag : x->GetAllTags()) {
+            auto value = sourceBuffer->CopyString(tag.second);
+            StringView key = InternKey(tag.first);
+            if (key.empty()) {
+                auto keyBuffer = sourceBuffer->CopyString(tag.first);
+                key = StringView(keyBuffer.data, keyBuffer.size);
+            }
+            event->SetContentNoCopy(key, StringView(value.data, value.size));
         }
         auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(x->GetTimestamp()));
         event->SetTimestamp(seconds.count(), x->GetTimestamp());
     }
+    return event_group;
+}
+
+void SecurityHandler::handle(std::vector<std::unique_ptr<AbstractSecurityEvent>>&& events) {
+    if (events.empty()) {
+        return ;
+    }
+
+    PipelineEventGroup event_group = BuildEventGroup(events);
     mProcessTotalCnt+= events.size();
 #ifdef APSARA_UNIT_TEST_MAIN
     return;
@@ -14,11 +14,15 @@
 
 #pragma once
 
-#include <vector>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "common/memory/SourceBuffer.h"
 #include "ebpf/handler/AbstractHandler.h"
 #include "ebpf/include/export.h"
+#include "models/PipelineEventGroup.h"
 
 namespace logtail {
 namespace ebpf {
@@ -27,10 +31,27 @@ class SecurityHandler : public AbstractHandler {
 public:
     SecurityHandler(const logtail::PipelineContext* ctx, logtail::QueueKey key, uint32_t idx);
     void handle(std::vector<std::unique_ptr<AbstractSecurityEvent>>&& events);
+
 private:
+    PipelineEventGroup BuildEventGroup(const std::vector<std::unique_ptr<AbstractSecurityEvent>>& events);
+    // return empty if too many keys have been interned
+    StringView InternKey(const std::string& key);
+
+    // Keys of security events come from a small fixed set. They are stored once in mKeyBuffer, which is retained by
+    // every event group, so that only values are copied into the group. mKeyBuffer is only written by handle(), which
+    // is called by a single thread, and the bytes written never move.
+    std::shared_ptr<SourceBuffer> mKeyBuffer;
+    std::unordered_map<std::string, StringView> mKeys;
     // TODO 后续这两个 key 需要移到 group 的 metadata 里，在 processortagnative 中转成tag
-    std::string mHostIp;
-    std::string mHostName;
+    StringView mHostIp;
+    StringView mHostName;
+
+    static constexpr size_t sMaxKeyCnt = 1024;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class SecurityHandlerUnittest;
+    friend class SecurityHandlerBenchmark;
+#endif
 };
 
 }
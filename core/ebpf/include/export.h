@@ -23,7 +23,7 @@ public:
   AbstractSecurityEvent(std::vector<std::pair<std::string, std::string>>&& tags, SecureEventType type, uint64_t ts)
     : tags_(tags), type_(type), timestamp_(ts) {}
   SecureEventType GetEventType() {return type_;}
-  std::vector<std::pair<std::string, std::string>> GetAllTags() { return tags_; }
+  const std::vector<std::pair<std::string, std::string>>& GetAllTags() const { return tags_; }
   uint64_t GetTimestamp() { return timestamp_; }
   void SetEventType(SecureEventType type) { type_ = type; }
   void SetTimestamp(uint64_t ts) { timestamp_ = ts; }
@@ -131,7 +131,7 @@ public:
   explicit __attribute__((visibility("default"))) SingleEvent(){}
   explicit __attribute__((visibility("default"))) SingleEvent(std::vector<std::pair<std::string, std::string>>&& tags, uint64_t ts)
     : tags_(tags), timestamp_(ts) {}
-  std::vector<std::pair<std::string, std::string>> GetAllTags() { return tags_; }
+  const std::vector<std::pair<std::string, std::string>>& GetAllTags() const { return tags_; }
   uint64_t GetTimestamp() { return timestamp_; }
   void SetTimestamp(uint64_t ts) { timestamp_ = ts; }
   void AppendTags(std::pair<std::string, std::string>&& tag) {
@@ -94,6 +94,10 @@ using namespace std;
 DEFINE_FLAG_INT32(wildcard_max_sub_dir_count, "", 1000);
 DEFINE_FLAG_INT32(config_match_max_cache_size, "", 1000000);
 DEFINE_FLAG_INT32(multi_config_alarm_interval, "second", 600);
+DEFINE_FLAG_INT32(startup_cold_dir_threshold_sec,
+                  "sub dirs not modified within this period are registered after reading starts on startup, 0 means "
+                  "all dirs are registered before reading starts",
+                  0);
 
 DEFINE_FLAG_STRING(ilogtail_docker_path_version, "ilogtail docker path config file", "0.1.0");
 DEFINE_FLAG_INT32(max_docker_config_update_times, "max times docker config update in 3 minutes", 10);
@@ -393,6 +397,27 @@ void ConfigManager::RegisterWildcardPath(const FileDiscoveryConfig& config, cons
     }
 }
 
+bool ConfigManager::RegisterHandlersOnStartup() {
+    mDeferredDirCnt = 0;
+    if (INT32_FLAG(startup_cold_dir_threshold_sec) > 0) {
+        mColdDirDeadline = time(NULL) - INT32_FLAG(startup_cold_dir_threshold_sec);
+    }
+    bool result = RegisterHandlers();
+    mColdDirDeadline = 0;
+    if (mDeferredDirCnt > 0) {
+        LOG_INFO(sLogger, ("cold dirs are left to be registered after startup, count", mDeferredDirCnt));
+    }
+    return result;
+}
+
+bool ConfigManager::IsColdDir(const string& path) const {
+    if (mColdDirDeadline <= 0) {
+        return false;
+    }
+    fsutil::PathStat buf;
+    return fsutil::PathStat::stat(path, buf) && buf.GetMtime() < mColdDirDeadline;
+}
+
 // this functions should only be called when register base dir
 bool ConfigManager::RegisterHandlers(const string& basePath, const FileDiscoveryConfig& config) {
     bool result = true;
@@ -521,6 +546,10 @@ bool ConfigManager::RegisterDescendants(const string& path, const FileDiscoveryC
     while ((ent = dir.ReadNext())) {
         string item = PathJoin(path, ent.Name());
         if (ent.IsDir() && !config.first->IsDirectoryInBlacklist(item)) {
+            if (IsColdDir(item)) {
+                ++mDeferredDirCnt;
+                continue;
+            }
             result = EventDispatcher::GetInstance()->RegisterEventHandler(item.c_str(), config, mSharedHandler);
             if (result)
                 RegisterDescendants(item, config, withinDepth - 1);
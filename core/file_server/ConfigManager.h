@@ -75,6 +75,9 @@ protected:
     // std::unordered_map<std::string, Config*> mNameConfigMap;
 
     EventHandler* mSharedHandler;
+    // dirs last modified before this time are not registered during RegisterHandlersOnStartup, 0 means no deferral
+    int32_t mColdDirDeadline = 0;
+    uint32_t mDeferredDirCnt = 0;
     // one modify handler corresponds to one "leaf" directory
     std::unordered_map<std::string, EventHandler*> mDirEventHandlerMap;
     // ThreadPtr mUUIDthreadPtr;
@@ -259,6 +262,10 @@ public:
     void RegisterWildcardPath(const FileDiscoveryConfig& config, const std::string& path, int32_t depth);
     bool RegisterHandlers(const std::string& basePath, const FileDiscoveryConfig& config);
     bool RegisterHandlers();
+    // only used on startup: sub dirs not modified within startup_cold_dir_threshold_sec are skipped, and left to the
+    // periodic registration in LogInput, so that reading can be resumed sooner
+    bool RegisterHandlersOnStartup();
+    uint32_t GetDeferredDirCnt() const { return mDeferredDirCnt; }
     bool RegisterHandlersRecursively(const std::string& dir, const FileDiscoveryConfig& config, bool checkTimeout);
     // 废弃，蚂蚁
     // /**
@@ -512,6 +519,7 @@ private:
      */
     bool RegisterHandlersWithinDepth(const std::string& path, const FileDiscoveryConfig& config, int depth);
     bool RegisterDescendants(const std::string& path, const FileDiscoveryConfig& config, int withinDepth);
+    bool IsColdDir(const std::string& path) const;
     // bool CheckLogType(const std::string& logTypeStr, LogType& logType);
     // 废弃
     // std::vector<std::string> GetStringVector(const Json::Value& value);
@@ -14,6 +14,8 @@
 
 #include "file_server/FileServer.h"
 
+#include <future>
+
 #include "checkpoint/CheckPointManager.h"
 #include "common/Flags.h"
 #include "common/StringTools.h"
@@ -23,6 +25,7 @@
 #include "file_server/event_handler/LogInput.h"
 #include "file_server/polling/PollingDirFile.h"
 #include "file_server/polling/PollingModify.h"
+#include "monitor/Monitor.h"
 #include "plugin/input/InputFile.h"
 
 DEFINE_FLAG_BOOL(enable_polling_discovery, "", true);
@@ -38,10 +41,34 @@ FileServer::FileServer() {
 
 // 启动文件服务，包括加载配置、处理检查点、注册事件等
 void FileServer::Start() {
+    auto startTime = GetCurrentTimeInMilliSeconds();
     ConfigManager::GetInstance()->LoadDockerConfig();
-    CheckPointManager::Instance()->LoadCheckPoint();
-    ConfigManager::GetInstance()->RegisterHandlers();
-    LOG_INFO(sLogger, ("watch dirs", "succeeded"));
+
+    // dir checkpoints are required by dir registration, while file checkpoints are not used until dirs are registered,
+    // so the latter are loaded concurrently with dir registration
+    auto checkPointStartTime = GetCurrentTimeInMilliSeconds();
+    Json::Value checkPointRoot;
+    future<uint64_t> fileCheckPointRes;
+    if (CheckPointManager::Instance()->ReadCheckPointFile(checkPointRoot)) {
+        CheckPointManager::Instance()->LoadDirCheckPoint(checkPointRoot);
+        fileCheckPointRes = async(launch::async, [&checkPointRoot, checkPointStartTime]() {
+            CheckPointManager::Instance()->LoadFileCheckPoint(checkPointRoot);
+            return GetCurrentTimeInMilliSeconds() - checkPointStartTime;
+        });
+    }
+    auto registerStartTime = GetCurrentTimeInMilliSeconds();
+    ConfigManager::GetInstance()->RegisterHandlersOnStartup();
+    auto registerCost = GetCurrentTimeInMilliSeconds() - registerStartTime;
+    LOG_INFO(sLogger, ("watch dirs", "succeeded")("cost", ToString(registerCost) + "ms"));
+    uint64_t checkPointCost = registerStartTime - checkPointStartTime;
+    if (fileCheckPointRes.valid()) {
+        checkPointCost = fileCheckPointRes.get();
+        LOG_INFO(sLogger,
+                 ("load checkpoint", "succeeded")("file check point",
+                                                  CheckPointManager::Instance()->GetAllFileCheckPoint().size())(
+                     "cost", ToString(checkPointCost) + "ms"));
+    }
+
     EventDispatcher::GetInstance()->AddExistedCheckPointFileEvents();
     // the dump time must be reset after dir registration, since it may take long on NFS.
     CheckPointManager::Instance()->ResetLastDumpTime();
@@ -50,7 +77,19 @@ void FileServer::Start() {
         PollingDirFile::GetInstance()->Start();
     }
     LogInput::GetInstance()->Start();
-    LOG_INFO(sLogger, ("file server", "started"));
+    auto totalCost = GetCurrentTimeInMilliSeconds() - startTime;
+    LOG_INFO(sLogger, ("file server", "started")("cost", ToString(totalCost) + "ms"));
+
+    for (const auto& item : {make_pair(METRIC_AGENT_STARTUP_CHECKPOINT_LOAD_MS, checkPointCost),
+                             make_pair(METRIC_AGENT_STARTUP_DIR_REGISTER_MS, registerCost),
+                             make_pair(METRIC_AGENT_STARTUP_DEFERRED_DIRS_TOTAL,
+                                       static_cast<uint64_t>(ConfigManager::GetInstance()->GetDeferredDirCnt())),
+                             make_pair(METRIC_AGENT_STARTUP_FILE_SERVER_MS, totalCost)}) {
+        auto gauge = LoongCollectorMonitor::GetInstance()->GetIntGauge(item.first);
+        if (gauge) {
+            gauge->Set(item.second);
+        }
+    }
 }
 
 // 暂停文件服务，根据配置更新标志来决定是否要执行相关的清理和保存操作
@@ -54,27 +54,53 @@ void BlockedEventManager::UpdateBlockEvent(QueueKey logstoreKey,
               ("Add block event ", pEvent->GetSource())(pEvent->GetObject(),
                                                         pEvent->GetInode())(pEvent->GetConfigName(), hashKey));
     ScopedSpinLock lock(mLock);
-    mBlockEventMap[hashKey].Update(logstoreKey, pEvent, curTime);
+    auto& blockedEvent = mBlockEventMap[hashKey];
+    if (blockedEvent.mEvent != NULL) {
+        RemoveFromIndex(hashKey, blockedEvent);
+    }
+    if (!blockedEvent.Update(logstoreKey, pEvent, curTime)) {
+        delete pEvent;
+    }
+    AddToIndex(hashKey, blockedEvent);
 }
 
 void BlockedEventManager::GetTimeoutEvent(std::vector<Event*>& eventVec, int32_t curTime) {
+    std::vector<int64_t> invalidAgainKeys;
+    // queue state is checked once per call
+    std::unordered_map<QueueKey, bool> isValidToPush;
     ScopedSpinLock lock(mLock);
-    for (std::unordered_map<int64_t, BlockedEvent>::iterator iter = mBlockEventMap.begin();
-         iter != mBlockEventMap.end();) {
+    while (!mDeadlineIndex.empty() && mDeadlineIndex.begin()->first <= curTime) {
+        auto [deadline, hashKey] = *mDeadlineIndex.begin();
+        mDeadlineIndex.erase(mDeadlineIndex.begin());
+        auto iter = mBlockEventMap.find(hashKey);
+        if (iter == mBlockEventMap.end() || iter->second.mEvent == NULL || iter->second.GetDeadline() != deadline) {
+            // stale index
+            continue;
+        }
         BlockedEvent& blockedEvent = iter->second;
-        if (blockedEvent.mEvent != NULL && blockedEvent.mInvalidTime + blockedEvent.mTimeout <= curTime) {
-            if (ProcessQueueManager::GetInstance()->IsValidToPush(blockedEvent.mQueueKey)) {
-                eventVec.push_back(blockedEvent.mEvent);
-                // LOG_DEBUG(sLogger, ("Get timeout block event  ",
-                // blockedEvent.mEvent->GetSource())(blockedEvent.mEvent->GetObject(),
-                // blockedEvent.mEvent->GetConfigName()));
-                iter = mBlockEventMap.erase(iter);
-                continue;
-            } else {
-                blockedEvent.SetInvalidAgain(curTime);
-            }
+        auto validIter = isValidToPush.find(blockedEvent.mQueueKey);
+        if (validIter == isValidToPush.end()) {
+            validIter = isValidToPush
+                            .emplace(blockedEvent.mQueueKey,
+                                     ProcessQueueManager::GetInstance()->IsValidToPush(blockedEvent.mQueueKey))
+                            .first;
+        }
+        if (validIter->second) {
+            eventVec.push_back(blockedEvent.mEvent);
+            // LOG_DEBUG(sLogger, ("Get timeout block event  ",
+            // blockedEvent.mEvent->GetSource())(blockedEvent.mEvent->GetObject(),
+            // blockedEvent.mEvent->GetConfigName()));
+            RemoveFromIndex(hashKey, blockedEvent);
+            mBlockEventMap.erase(iter);
+        } else {
+            // put back after the scan, since the new deadline may still be due
+            invalidAgainKeys.push_back(hashKey);
         }
-        ++iter;
+    }
+    for (auto hashKey : invalidAgainKeys) {
+        auto& blockedEvent = mBlockEventMap[hashKey];
+        blockedEvent.SetInvalidAgain(curTime);
+        mDeadlineIndex.emplace(blockedEvent.GetDeadline(), hashKey);
     }
 }
 
@@ -83,19 +109,25 @@ void BlockedEventManager::Feedback(int64_t key) {
     std::vector<Event*> eventVec;
     {
         ScopedSpinLock lock(mLock);
-        for (std::unordered_map<int64_t, BlockedEvent>::iterator iter = mBlockEventMap.begin();
-             iter != mBlockEventMap.end();) {
-            BlockedEvent& blockedEvent = iter->second;
-            if (blockedEvent.mEvent != NULL && blockedEvent.mQueueKey == key) {
-                eventVec.push_back(blockedEvent.mEvent);
-                // LOG_DEBUG(sLogger, ("Get feedback block event  ",
-                // blockedEvent.mEvent->GetSource())(blockedEvent.mEvent->GetObject(),
-                // blockedEvent.mEvent->GetConfigName()));
-                iter = mBlockEventMap.erase(iter);
-            } else {
-                ++iter;
+        auto indexIter = mQueueIndex.find(key);
+        if (indexIter == mQueueIndex.end()) {
+            return;
+        }
+        for (auto hashKey : indexIter->second) {
+            auto iter = mBlockEventMap.find(hashKey);
+            if (iter == mBlockEventMap.end() || iter->second.mEvent == NULL || iter->second.mQueueKey != key) {
+                // stale index
+                continue;
             }
+            BlockedEvent& blockedEvent = iter->second;
+            eventVec.push_back(blockedEvent.mEvent);
+            // LOG_DEBUG(sLogger, ("Get feedback block event  ",
+            // blockedEvent.mEvent->GetSource())(blockedEvent.mEvent->GetObject(),
+            // blockedEvent.mEvent->GetConfigName()));
+            mDeadlineIndex.erase({blockedEvent.GetDeadline(), hashKey});
+            mBlockEventMap.erase(iter);
         }
+        mQueueIndex.erase(indexIter);
     }
     if (eventVec.size() > 0) {
         // use polling event queue, it is thread safe
@@ -103,6 +135,22 @@ void BlockedEventManager::Feedback(int64_t key) {
     }
 }
 
+void BlockedEventManager::AddToIndex(int64_t hashKey, const BlockedEvent& blockedEvent) {
+    mQueueIndex[blockedEvent.mQueueKey].insert(hashKey);
+    mDeadlineIndex.emplace(blockedEvent.GetDeadline(), hashKey);
+}
+
+void BlockedEventManager::RemoveFromIndex(int64_t hashKey, const BlockedEvent& blockedEvent) {
+    auto iter = mQueueIndex.find(blockedEvent.mQueueKey);
+    if (iter != mQueueIndex.end()) {
+        iter->second.erase(hashKey);
+        if (iter->second.empty()) {
+            mQueueIndex.erase(iter);
+        }
+    }
+    mDeadlineIndex.erase({blockedEvent.GetDeadline(), hashKey});
+}
+
 BlockedEventManager::BlockedEventManager() {
 }
 
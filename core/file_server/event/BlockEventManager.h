@@ -15,8 +15,12 @@
  */
 
 #pragma once
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "file_server/event/Event.h"
 #include "common/FeedbackInterface.h"
@@ -46,7 +50,8 @@ public:
 protected:
     struct BlockedEvent {
         BlockedEvent() : mInvalidTime(time(NULL)) {}
-        void Update(QueueKey key, Event* pEvent, int32_t curTime) {
+        // return false if @pEvent is not taken
+        bool Update(QueueKey key, Event* pEvent, int32_t curTime) {
             if (mEvent != NULL) {
                 // There are only two situations where event coverage is possible
                 // 1. the new event is not timeout event
@@ -54,7 +59,7 @@ protected:
                 if (!pEvent->IsReaderFlushTimeout() || mEvent->IsReaderFlushTimeout()) {
                     delete mEvent;
                 } else {
-                    return;
+                    return false;
                 }
             }
             mEvent = pEvent;
@@ -68,6 +73,7 @@ protected:
                     mTimeout = INT32_FLAG(max_block_event_timeout);
                 }
             }
+            return true;
         }
         void SetInvalidAgain(int32_t curTime) {
             mTimeout *= 2;
@@ -76,6 +82,8 @@ protected:
             }
         }
 
+        int32_t GetDeadline() const { return mInvalidTime + mTimeout; }
+
         QueueKey mQueueKey = -1;
         Event* mEvent = nullptr;
         int32_t mInvalidTime;
@@ -85,12 +93,21 @@ protected:
     BlockedEventManager();
     virtual ~BlockedEventManager();
 
+    void AddToIndex(int64_t hashKey, const BlockedEvent& blockedEvent);
+    void RemoveFromIndex(int64_t hashKey, const BlockedEvent& blockedEvent);
+
     std::unordered_map<int64_t, BlockedEvent> mBlockEventMap;
+    // Indexes of mBlockEventMap, so that feedback and timeout release only touch the events involved. An index entry
+    // may be stale if mBlockEventMap is modified directly, and should always be checked against mBlockEventMap.
+    std::unordered_map<QueueKey, std::unordered_set<int64_t>> mQueueIndex;
+    // (deadline, hash key)
+    std::set<std::pair<int32_t, int64_t>> mDeadlineIndex;
     SpinLock mLock;
 
 private:
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ForceReadUnittest;
+    friend class BlockedEventManagerUnittest;
 #endif
 };
 
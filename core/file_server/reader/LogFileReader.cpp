@@ -48,6 +48,7 @@
 #include "logger/Logger.h"
 #include "monitor/LogFileProfiler.h"
 #include "monitor/LogtailAlarm.h"
+#include "monitor/ResourceGovernor.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "pipeline/queue/ExactlyOnceQueueManager.h"
 #include "pipeline/queue/ProcessQueueManager.h"
@@ -912,7 +913,7 @@ bool LogFileReader::ReadLog(LogBuffer& logBuffer, const Event* event) {
         }
         return false;
     }
-    if (AppConfig::GetInstance()->IsInputFlowControl())
+    if (AppConfig::GetInstance()->IsInputFlowControl() || ResourceGovernor::GetInstance()->IsInputThrottled())
         LogInput::GetInstance()->FlowControl();
 
     if ((event == nullptr || !event->IsReaderFlushTimeout()) && mFirstWatched && (mLastFilePos == 0))
@@ -1372,9 +1373,9 @@ bool LogFileReader::ParseLogTime(const char* buffer,
             memset(&t, 0, sizeof(t));
             int nanosecondLength;
             if (strptime_ns(timeStr.c_str(), timeFormat.c_str(), &t, &logTime.tv_nsec, &nanosecondLength) == NULL) {
-                LOG_ERROR(sLogger,
-                          ("convert time failed, time str", timeStr)("time format", timeFormat)("project", project)(
-                              "logstore", logStore)("file", logPath));
+                LOG_ERROR_RATE_LIMITED(sLogger,
+                                       ("convert time failed, time str", timeStr)("time format", timeFormat)(
+                                           "project", project)("logstore", logStore)("file", logPath));
                 return false;
             }
 
@@ -1657,10 +1658,10 @@ void LogFileReader::ReadUTF8(LogBuffer& logBuffer, int64_t end, bool& moreData,
                     int32_t rollbackLineFeedCount;
                     nbytes = RemoveLastIncompleteLog(stringBuffer, nbytes, rollbackLineFeedCount, false);
                 }
-                LOG_WARNING(sLogger,
-                            ("Log is too long and forced to be split at offset: ",
-                             mLastFilePos + nbytes)("file: ", mHostLogPath)("inode: ", mDevInode.inode)(
-                                "first 1024B log: ", logBuffer.rawBuffer.substr(0, 1024)));
+                LOG_WARNING_RATE_LIMITED(sLogger,
+                                         ("Log is too long and forced to be split at offset: ",
+                                          mLastFilePos + nbytes)("file: ", mHostLogPath)("inode: ", mDevInode.inode)(
+                                             "first 1024B log: ", logBuffer.rawBuffer.substr(0, 1024)));
                 std::ostringstream oss;
                 oss << "Log is too long and forced to be split at offset: " << ToString(mLastFilePos + nbytes)
                     << " file: " << mHostLogPath << " inode: " << ToString(mDevInode.inode)
@@ -1863,9 +1864,10 @@ void LogFileReader::ReadGBK(LogBuffer& logBuffer, int64_t end, bool& moreData, b
     setExactlyOnceCheckpointAfterRead(readCharCount);
     mLastFilePos += readCharCount;
     if (logTooLongSplitFlag) {
-        LOG_WARNING(sLogger,
-                    ("Log is too long and forced to be split at offset: ", mLastFilePos)("file: ", mHostLogPath)(
-                        "inode: ", mDevInode.inode)("first 1024B log: ", logBuffer.rawBuffer.substr(0, 1024)));
+        LOG_WARNING_RATE_LIMITED(sLogger,
+                                 ("Log is too long and forced to be split at offset: ", mLastFilePos)(
+                                     "file: ", mHostLogPath)("inode: ", mDevInode.inode)(
+                                     "first 1024B log: ", logBuffer.rawBuffer.substr(0, 1024)));
         std::ostringstream oss;
         oss << "Log is too long and forced to be split at offset: " << ToString(mLastFilePos)
             << " file: " << mHostLogPath << " inode: " << ToString(mDevInode.inode)
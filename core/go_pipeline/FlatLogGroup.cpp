@@ -0,0 +1,201 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "go_pipeline/FlatLogGroup.h"
+
+#include <cstring>
+
+#include "common/Constants.h"
+#include "common/Flags.h"
+#include "common/StringTools.h"
+
+DECLARE_FLAG_INT32(max_send_log_group_size);
+
+using namespace std;
+
+namespace logtail {
+
+static inline void PutUInt32(char*& p, uint32_t v) {
+    p[0] = static_cast<char>(v & 0xFF);
+    p[1] = static_cast<char>((v >> 8) & 0xFF);
+    p[2] = static_cast<char>((v >> 16) & 0xFF);
+    p[3] = static_cast<char>((v >> 24) & 0xFF);
+    p += 4;
+}
+
+static inline uint32_t GetUInt32(const char* p) {
+    const auto* u = reinterpret_cast<const unsigned char*>(p);
+    return static_cast<uint32_t>(u[0]) | (static_cast<uint32_t>(u[1]) << 8) | (static_cast<uint32_t>(u[2]) << 16)
+        | (static_cast<uint32_t>(u[3]) << 24);
+}
+
+static inline void PutString(char*& lenCol, char*& arena, StringView s) {
+    PutUInt32(lenCol, static_cast<uint32_t>(s.size()));
+    memcpy(arena, s.data(), s.size());
+    arena += s.size();
+}
+
+bool FlatLogGroup::Serialize(const PipelineEventGroup& group,
+                             bool enableNanosecond,
+                             const string& logstore,
+                             string& res,
+                             string& errorMsg) {
+    // first pass: compute the exact size so that the buffer is allocated only once
+    uint32_t logCnt = 0, tagCnt = 0, contentCnt = 0;
+    size_t arenaSize = logstore.size();
+    for (const auto& e : group.GetEvents()) {
+        if (!e.Is<LogEvent>()) {
+            errorMsg = "unsupported event type in event group";
+            return false;
+        }
+        ++logCnt;
+        for (const auto& kv : e.Cast<LogEvent>()) {
+            ++contentCnt;
+            arenaSize += kv.first.size() + kv.second.size();
+        }
+    }
+    StringView topic;
+    for (const auto& tag : group.GetTags()) {
+        if (tag.first == LOG_RESERVED_KEY_TOPIC) {
+            topic = tag.second;
+        } else {
+            ++tagCnt;
+            arenaSize += tag.first.size() + tag.second.size();
+        }
+    }
+    arenaSize += topic.size();
+
+    size_t timeColCnt = enableNanosecond ? 3 : 2;
+    size_t strCnt = 2 + 2 * static_cast<size_t>(tagCnt) + 2 * static_cast<size_t>(contentCnt);
+    size_t size = sHeaderSize + 4 * (timeColCnt * logCnt + strCnt) + arenaSize;
+    if (size > static_cast<size_t>(INT32_FLAG(max_send_log_group_size))) {
+        errorMsg = "log group exceeds size limit\tgroup size: " + ToString(size)
+            + "\tsize limit: " + ToString(INT32_FLAG(max_send_log_group_size));
+        return false;
+    }
+
+    res.resize(size);
+    char* header = res.data();
+    memcpy(header, sMagic, sizeof(sMagic));
+    header += sizeof(sMagic);
+    PutUInt32(header, sVersion);
+    PutUInt32(header, logCnt);
+    PutUInt32(header, tagCnt);
+    PutUInt32(header, contentCnt);
+    PutUInt32(header, enableNanosecond ? sFlagTimeNs : 0);
+
+    char* timeCol = header;
+    char* timeNsCol = timeCol + 4 * logCnt;
+    char* contentCntCol = enableNanosecond ? timeNsCol + 4 * logCnt : timeNsCol;
+    char* lenCol = contentCntCol + 4 * logCnt;
+    char* arena = lenCol + 4 * strCnt;
+
+    PutString(lenCol, arena, topic);
+    PutString(lenCol, arena, StringView(logstore));
+    for (const auto& tag : group.GetTags()) {
+        if (tag.first != LOG_RESERVED_KEY_TOPIC) {
+            PutString(lenCol, arena, tag.first);
+            PutString(lenCol, arena, tag.second);
+        }
+    }
+    for (const auto& e : group.GetEvents()) {
+        const auto& logEvent = e.Cast<LogEvent>();
+        uint32_t cnt = 0;
+        for (const auto& kv : logEvent) {
+            PutString(lenCol, arena, kv.first);
+            PutString(lenCol, arena, kv.second);
+            ++cnt;
+        }
+        PutUInt32(timeCol, static_cast<uint32_t>(logEvent.GetTimestamp()));
+        if (enableNanosecond) {
+            auto ns = logEvent.GetTimestampNanosecond();
+            PutUInt32(timeNsCol, ns ? ns.value() : sNoTimeNs);
+        }
+        PutUInt32(contentCntCol, cnt);
+    }
+    return true;
+}
+
+bool FlatLogGroup::Parse(const char* data, size_t size, sls_logs::LogGroup& logGroup, string& errorMsg) {
+    if (size < sHeaderSize || memcmp(data, sMagic, sizeof(sMagic)) != 0) {
+        errorMsg = "invalid flat log group header";
+        return false;
+    }
+    if (GetUInt32(data + 4) != sVersion) {
+        errorMsg = "unsupported flat log group version: " + ToString(GetUInt32(data + 4));
+        return false;
+    }
+    size_t logCnt = GetUInt32(data + 8);
+    size_t tagCnt = GetUInt32(data + 12);
+    size_t contentCnt = GetUInt32(data + 16);
+    bool hasTimeNs = (GetUInt32(data + 20) & sFlagTimeNs) != 0;
+    size_t strCnt = 2 + 2 * tagCnt + 2 * contentCnt;
+    size_t columnsSize = 4 * ((hasTimeNs ? 3 : 2) * logCnt + strCnt);
+    if (size - sHeaderSize < columnsSize) {
+        errorMsg = "flat log group is truncated";
+        return false;
+    }
+
+    const char* timeCol = data + sHeaderSize;
+    const char* timeNsCol = timeCol + 4 * logCnt;
+    const char* contentCntCol = hasTimeNs ? timeNsCol + 4 * logCnt : timeNsCol;
+    const char* lenCol = contentCntCol + 4 * logCnt;
+    const char* arena = lenCol + 4 * strCnt;
+    const char* end = data + size;
+    auto nextString = [&](string& s) {
+        size_t len = GetUInt32(lenCol);
+        lenCol += 4;
+        if (static_cast<size_t>(end - arena) < len) {
+            return false;
+        }
+        s.assign(arena, len);
+        arena += len;
+        return true;
+    };
+
+    string topic;
+    bool ok = nextString(topic) && nextString(*logGroup.mutable_category());
+    if (!topic.empty()) {
+        logGroup.set_topic(topic);
+    }
+    for (size_t i = 0; ok && i < tagCnt; ++i) {
+        auto tag = logGroup.add_logtags();
+        ok = nextString(*tag->mutable_key()) && nextString(*tag->mutable_value());
+    }
+    size_t parsedContentCnt = 0;
+    for (size_t i = 0; ok && i < logCnt; ++i) {
+        auto log = logGroup.add_logs();
+        log->set_time(GetUInt32(timeCol + 4 * i));
+        if (hasTimeNs && GetUInt32(timeNsCol + 4 * i) != sNoTimeNs) {
+            log->set_time_ns(GetUInt32(timeNsCol + 4 * i));
+        }
+        size_t cnt = GetUInt32(contentCntCol + 4 * i);
+        if (parsedContentCnt + cnt > contentCnt) {
+            ok = false;
+            break;
+        }
+        parsedContentCnt += cnt;
+        for (size_t j = 0; ok && j < cnt; ++j) {
+            auto content = log->add_contents();
+            ok = nextString(*content->mutable_key()) && nextString(*content->mutable_value());
+        }
+    }
+    if (!ok || parsedContentCnt != contentCnt || arena != end) {
+        errorMsg = "flat log group is corrupted";
+        return false;
+    }
+    return true;
+}
+
+} // namespace logtail
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "models/PipelineEventGroup.h"
+#include "protobuf/sls/sls_logs.pb.h"
+
+namespace logtail {
+
+// Flat log group is the wire format used to hand log event groups over to the Go pipeline. Unlike protobuf, all
+// lengths are stored in fixed-width columns ahead of the string bytes, so the Go side can locate every string with a
+// running offset and alias it into the buffer instead of decoding field by field. The decoder lives in
+// pkg/protocol/flat_log_group.go and must be kept in sync with this file.
+//
+// All integers are little-endian uint32.
+//   header:     magic "LFLG" | version | log cnt | tag cnt | content cnt (of all logs) | flags
+//   columns:    time[log cnt] | time_ns[log cnt] (only if sFlagTimeNs) | content cnt[log cnt]
+//               | string len[2 + 2 * tag cnt + 2 * content cnt]
+//   string arena: topic | category | tag key, tag value ... | content key, content value ...
+//
+// time_ns of a log without nanosecond timestamp is sNoTimeNs.
+class FlatLogGroup {
+public:
+    static constexpr char sMagic[4] = {'L', 'F', 'L', 'G'};
+    static constexpr uint32_t sVersion = 1;
+    static constexpr uint32_t sHeaderSize = 24;
+    static constexpr uint32_t sFlagTimeNs = 1;
+    static constexpr uint32_t sNoTimeNs = 0xFFFFFFFF;
+
+    static bool Serialize(const PipelineEventGroup& group,
+                          bool enableNanosecond,
+                          const std::string& logstore,
+                          std::string& res,
+                          std::string& errorMsg);
+
+    // reference decoder, the production decoder is in Go
+    static bool Parse(const char* data, size_t size, sls_logs::LogGroup& logGroup, std::string& errorMsg);
+};
+
+} // namespace logtail
@@ -21,6 +21,7 @@
 #include "common/HashUtil.h"
 #include "common/JsonUtil.h"
 #include "common/LogtailCommonFlags.h"
+#include "common/StringTools.h"
 #include "common/TimeUtil.h"
 #include "common/compression/CompressorFactory.h"
 #include "container_manager/ConfigContainerInfoUpdateCmd.h"
@@ -42,7 +43,12 @@ using namespace logtail;
 
 LogtailPlugin* LogtailPlugin::s_instance = NULL;
 
-LogtailPlugin::LogtailPlugin() {
+LogtailPlugin::LogtailPlugin()
+    : mProcessLogStaging([this](const std::string& configName,
+                                std::vector<sls_logs::Log>& logs,
+                                const std::string& packId,
+                                const std::string& topic,
+                                const std::string& tags) { ProcessLogBatch(configName, logs, packId, topic, tags); }) {
     mPluginAdapterPtr = NULL;
     mPluginBasePtr = NULL;
     mLoadPipelineFun = NULL;
@@ -51,6 +57,8 @@ LogtailPlugin::LogtailPlugin() {
     mStopFun = NULL;
     mStartFun = NULL;
     mLoadGlobalConfigFun = NULL;
+    mProcessFlatLogGroupFun = NULL;
+    mProcessLogBatchFun = NULL;
     mPluginValid = false;
     mPluginAlarmConfig.mLogstore = "logtail_alarm";
     mPluginAlarmConfig.mAliuid = STRING_FLAG(logtail_profile_aliuid);
@@ -73,6 +81,7 @@ LogtailPlugin::LogtailPlugin() {
 }
 
 LogtailPlugin::~LogtailPlugin() {
+    mProcessLogStaging.Stop();
     DynamicLibLoader::CloseLib(mPluginBasePtr);
     DynamicLibLoader::CloseLib(mPluginAdapterPtr);
 }
@@ -128,6 +137,9 @@ bool LogtailPlugin::UnloadPipeline(const std::string& pipelineName) {
 }
 
 void LogtailPlugin::StopAllPipelines(bool withInputFlag) {
+    if (!withInputFlag) {
+        mProcessLogStaging.FlushAll();
+    }
     if (mPluginValid && mStopAllPipelinesFun != NULL) {
         LOG_INFO(sLogger, ("Go pipelines stop all", "starts"));
         auto stopAllStart = GetCurrentTimeInMilliSeconds();
@@ -142,6 +154,10 @@ void LogtailPlugin::StopAllPipelines(bool withInputFlag) {
 }
 
 void LogtailPlugin::Stop(const std::string& configName, bool removedFlag) {
+    // staged logs are passed to the go pipeline without input, whose name is suffixed by /2
+    if (EndWith(configName, "/2")) {
+        mProcessLogStaging.Flush(configName.substr(0, configName.size() - 2));
+    }
     if (mPluginValid && mStopFun != NULL) {
         LOG_INFO(sLogger, ("Go pipelines stop", "starts")("config", configName));
         auto stopStart = GetCurrentTimeInMilliSeconds();
@@ -426,12 +442,26 @@ bool LogtailPlugin::LoadPluginBase() {
             LOG_ERROR(sLogger, ("load ProcessLogs error, Message", error));
             return mPluginValid;
         }
+        // C++批量传递单条日志到golang插件，旧版本插件没有该方法时逐条调用ProcessLog
+        mProcessLogBatchFun = (ProcessLogBatchFun)loader.LoadMethod("ProcessLogBatch", error);
+        if (!error.empty()) {
+            LOG_INFO(sLogger, ("ProcessLogBatch not found in plugin base", "use ProcessLog instead"));
+            mProcessLogBatchFun = NULL;
+            error.clear();
+        }
         // C++传递数据到golang插件
         mProcessLogGroupFun = (ProcessLogGroupFun)loader.LoadMethod("ProcessLogGroup", error);
         if (!error.empty()) {
             LOG_ERROR(sLogger, ("load ProcessLogGroup error, Message", error));
             return mPluginValid;
         }
+        // C++以flat格式传递数据到golang插件，旧版本插件没有该方法时使用ProcessLogGroup
+        mProcessFlatLogGroupFun = (ProcessFlatLogGroupFun)loader.LoadMethod("ProcessFlatLogGroup", error);
+        if (!error.empty()) {
+            LOG_INFO(sLogger, ("ProcessFlatLogGroup not found in plugin base", "use ProcessLogGroup instead"));
+            mProcessFlatLogGroupFun = NULL;
+            error.clear();
+        }
         // 获取golang部分指标信息
         mGetGoMetricsFun = (GetGoMetricsFun)loader.LoadMethod("GetGoMetrics", error);
         if (!error.empty()) {
@@ -497,6 +527,60 @@ void LogtailPlugin::ProcessLog(const std::string& configName,
     }
 }
 
+void LogtailPlugin::ProcessLogBatch(const std::string& configName,
+                                    std::vector<sls_logs::Log>& logs,
+                                    const std::string& packId,
+                                    const std::string& topic,
+                                    const std::string& tags) {
+    if (logs.empty() || !(mPluginValid && mProcessLogsFun != NULL)) {
+        logs.clear();
+        return;
+    }
+    if (mProcessLogBatchFun == NULL) {
+        for (auto& log : logs) {
+            ProcessLog(configName, log, packId, topic, tags);
+        }
+        logs.clear();
+        return;
+    }
+
+    // only logs of the log group are used
+    sls_logs::LogGroup logGroup;
+    logGroup.mutable_logs()->Reserve(logs.size());
+    for (auto& log : logs) {
+        if (log.has_time()) {
+            logGroup.add_logs()->Swap(&log);
+        }
+    }
+    logs.clear();
+    if (logGroup.logs_size() == 0) {
+        return;
+    }
+
+    std::string packIdPrefix = ToHexString(HashString(packId));
+    std::string realConfigName = configName + "/2";
+    GoString goConfigName;
+    GoSlice goLogs;
+    GoString goPackId;
+    GoString goTopic;
+    GoSlice goTags;
+    goConfigName.n = realConfigName.size();
+    goConfigName.p = realConfigName.c_str();
+    goPackId.n = packIdPrefix.size();
+    goPackId.p = packIdPrefix.c_str();
+    goTopic.n = topic.size();
+    goTopic.p = topic.c_str();
+    goTags.data = (void*)tags.c_str();
+    goTags.len = goTags.cap = tags.length();
+    std::string sLogs = logGroup.SerializeAsString();
+    goLogs.len = goLogs.cap = sLogs.length();
+    goLogs.data = (void*)sLogs.c_str();
+    GoInt rst = mProcessLogBatchFun(goConfigName, goLogs, goPackId, goTopic, goTags);
+    if (rst != (GoInt)0) {
+        LOG_WARNING(sLogger, ("process log batch error", configName)("result", rst));
+    }
+}
+
 void LogtailPlugin::ProcessLogGroup(const std::string& configName,
                                     const std::string& logGroup,
                                     const std::string& packId) {
@@ -520,6 +604,29 @@ void LogtailPlugin::ProcessLogGroup(const std::string& configName,
     }
 }
 
+void LogtailPlugin::ProcessFlatLogGroup(const std::string& configName,
+                                        const std::string& logGroup,
+                                        const std::string& packId) {
+    if (logGroup.empty() || !(mPluginValid && mProcessFlatLogGroupFun != NULL)) {
+        return;
+    }
+    std::string realConfigName = configName + "/2";
+    std::string packIdPrefix = ToHexString(HashString(packId));
+    GoString goConfigName;
+    GoSlice goLog;
+    GoString goPackId;
+    goConfigName.n = realConfigName.size();
+    goConfigName.p = realConfigName.c_str();
+    goPackId.n = packIdPrefix.size();
+    goPackId.p = packIdPrefix.c_str();
+    goLog.len = goLog.cap = logGroup.length();
+    goLog.data = (void*)logGroup.c_str();
+    GoInt rst = mProcessFlatLogGroupFun(goConfigName, goLog, goPackId);
+    if (rst != (GoInt)0) {
+        LOG_WARNING(sLogger, ("process flat loggroup error", configName)("result", rst));
+    }
+}
+
 void LogtailPlugin::GetGoMetrics(std::vector<std::map<std::string, std::string>>& metircsList,
                                  const string& metricType) {
     if (mGetGoMetricsFun != nullptr) {
@@ -28,6 +28,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "go_pipeline/ProcessLogStaging.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
 #include "protobuf/sls/sls_logs.pb.h"
 
@@ -141,7 +142,9 @@ typedef void (*StartFun)(GoString);
 typedef GoInt (*InitPluginBaseFun)();
 typedef GoInt (*InitPluginBaseV2Fun)(GoString cfg);
 typedef GoInt (*ProcessLogsFun)(GoString c, GoSlice l, GoString p, GoString t, GoSlice tags);
+typedef GoInt (*ProcessLogBatchFun)(GoString c, GoSlice l, GoString p, GoString t, GoSlice tags);
 typedef GoInt (*ProcessLogGroupFun)(GoString c, GoSlice l, GoString p);
+typedef GoInt (*ProcessFlatLogGroupFun)(GoString c, GoSlice l, GoString p);
 typedef struct innerContainerMeta* (*GetContainerMetaFun)(GoString containerID);
 typedef InnerPluginMetrics* (*GetGoMetricsFun)(GoString metricType);
 
@@ -227,8 +230,28 @@ public:
                     const std::string& topic,
                     const std::string& tags);
 
+    // pass logs sharing the same pack id, topic and tags to go in one cgo call, logs are moved out
+    void ProcessLogBatch(const std::string& configName,
+                         std::vector<sls_logs::Log>& logs,
+                         const std::string& packId,
+                         const std::string& topic,
+                         const std::string& tags);
+    // for producers generating logs one by one, logs are staged and passed to go by ProcessLogBatch when the batch is
+    // full or timeout, logs are moved out
+    void StageLogs(const std::string& configName,
+                   std::vector<sls_logs::Log>& logs,
+                   const std::string& packId,
+                   const std::string& topic,
+                   const std::string& tags) {
+        mProcessLogStaging.Add(configName, logs, packId, topic, tags);
+    }
+
     void ProcessLogGroup(const std::string& configName, const std::string& logGroup, const std::string& packId);
 
+    // flat log group is only available when the loaded plugin base exports ProcessFlatLogGroup
+    bool IsFlatLogGroupSupported() const { return mProcessFlatLogGroupFun != NULL; }
+    void ProcessFlatLogGroup(const std::string& configName, const std::string& logGroup, const std::string& packId);
+
     static int IsValidToSend(long long logstoreKey);
 
     static int SendPb(const char* configName,
@@ -273,13 +296,17 @@ private:
     logtail::FlusherSLS mPluginProfileConfig;
     logtail::FlusherSLS mPluginContainerConfig;
     ProcessLogsFun mProcessLogsFun;
+    ProcessLogBatchFun mProcessLogBatchFun;
     ProcessLogGroupFun mProcessLogGroupFun;
+    ProcessFlatLogGroupFun mProcessFlatLogGroupFun;
     GetContainerMetaFun mGetContainerMetaFun;
     GetGoMetricsFun mGetGoMetricsFun;
 
     // Configuration for plugin system in JSON format.
     Json::Value mPluginCfg;
 
+    logtail::ProcessLogStaging mProcessLogStaging;
+
 private:
     static LogtailPlugin* s_instance;
 };
@@ -0,0 +1,173 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "go_pipeline/ProcessLogStaging.h"
+
+#include "common/Flags.h"
+#include "logger/Logger.h"
+
+DEFINE_FLAG_INT32(go_process_log_batch_size, "max logs staged for one cgo call", 1024);
+DEFINE_FLAG_INT32(go_process_log_batch_bytes, "max bytes staged for one cgo call", 512 * 1024);
+DEFINE_FLAG_INT32(go_process_log_batch_timeout_ms, "max time a log can be staged before it is passed to go", 200);
+
+using namespace std;
+
+namespace logtail {
+
+void ProcessLogStaging::Add(const string& configName,
+                            vector<sls_logs::Log>& logs,
+                            const string& packId,
+                            const string& topic,
+                            const string& tags) {
+    if (logs.empty()) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(mThreadRunningMux);
+        if (!mIsThreadRunning) {
+            mIsThreadRunning = true;
+            mThreadRes = async(launch::async, &ProcessLogStaging::Run, this);
+        }
+    }
+
+    string key;
+    key.reserve(configName.size() + packId.size() + topic.size() + tags.size() + 3);
+    key.append(configName).append(1, '\0').append(packId).append(1, '\0').append(topic).append(1, '\0').append(tags);
+    bool isFull = false;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto it = mBatches.find(key);
+        if (it == mBatches.end()) {
+            it = mBatches.emplace(key, Batch()).first;
+            auto& batch = it->second;
+            batch.mConfigName = configName;
+            batch.mPackId = packId;
+            batch.mTopic = topic;
+            batch.mTags = tags;
+            batch.mCreateTime = chrono::steady_clock::now();
+        }
+        auto& batch = it->second;
+        batch.mLogs.reserve(batch.mLogs.size() + logs.size());
+        for (auto& log : logs) {
+            batch.mBytes += log.ByteSizeLong();
+            batch.mLogs.emplace_back(std::move(log));
+        }
+        isFull = batch.mLogs.size() >= static_cast<size_t>(INT32_FLAG(go_process_log_batch_size))
+            || batch.mBytes >= static_cast<size_t>(INT32_FLAG(go_process_log_batch_bytes));
+    }
+    logs.clear();
+    if (!isFull) {
+        return;
+    }
+
+    lock_guard<mutex> submitLock(mSubmitMux);
+    vector<Batch> batches;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto it = mBatches.find(key);
+        // the batch may have been taken out by others
+        if (it == mBatches.end()) {
+            return;
+        }
+        batches.emplace_back(std::move(it->second));
+        mBatches.erase(it);
+    }
+    Submit(batches);
+}
+
+void ProcessLogStaging::Flush(const string& configName) {
+    lock_guard<mutex> submitLock(mSubmitMux);
+    vector<Batch> batches;
+    {
+        lock_guard<mutex> lock(mMux);
+        for (auto it = mBatches.begin(); it != mBatches.end();) {
+            if (it->second.mConfigName == configName) {
+                batches.emplace_back(std::move(it->second));
+                it = mBatches.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    Submit(batches);
+}
+
+void ProcessLogStaging::FlushAll() {
+    lock_guard<mutex> submitLock(mSubmitMux);
+    vector<Batch> batches;
+    {
+        lock_guard<mutex> lock(mMux);
+        for (auto& item : mBatches) {
+            batches.emplace_back(std::move(item.second));
+        }
+        mBatches.clear();
+    }
+    Submit(batches);
+}
+
+void ProcessLogStaging::Stop() {
+    {
+        lock_guard<mutex> lock(mThreadRunningMux);
+        if (!mIsThreadRunning) {
+            return;
+        }
+        mIsThreadRunning = false;
+    }
+    mStopCV.notify_one();
+    future_status s = mThreadRes.wait_for(chrono::seconds(1));
+    if (s == future_status::ready) {
+        LOG_INFO(sLogger, ("process log staging", "stopped successfully"));
+    } else {
+        LOG_WARNING(sLogger, ("process log staging", "forced to stopped"));
+    }
+    FlushAll();
+}
+
+void ProcessLogStaging::Run() {
+    unique_lock<mutex> lock(mThreadRunningMux);
+    while (mIsThreadRunning) {
+        auto timeout = chrono::milliseconds(INT32_FLAG(go_process_log_batch_timeout_ms));
+        // check twice per timeout, so that a log is never staged for more than 1.5 timeout
+        if (mStopCV.wait_for(lock, timeout / 2, [this]() { return !mIsThreadRunning; })) {
+            break;
+        }
+        lock.unlock();
+        {
+            lock_guard<mutex> submitLock(mSubmitMux);
+            vector<Batch> batches;
+            {
+                auto deadline = chrono::steady_clock::now() - timeout;
+                lock_guard<mutex> batchLock(mMux);
+                for (auto it = mBatches.begin(); it != mBatches.end();) {
+                    if (it->second.mCreateTime <= deadline) {
+                        batches.emplace_back(std::move(it->second));
+                        it = mBatches.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+            Submit(batches);
+        }
+        lock.lock();
+    }
+}
+
+void ProcessLogStaging::Submit(vector<Batch>& batches) {
+    for (auto& batch : batches) {
+        mSubmit(batch.mConfigName, batch.mLogs, batch.mPackId, batch.mTopic, batch.mTags);
+    }
+}
+
+} // namespace logtail
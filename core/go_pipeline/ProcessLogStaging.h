@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "protobuf/sls/sls_logs.pb.h"
+
+namespace logtail {
+
+// Staging buffer in front of the per log cgo entry. Logs handed over by producers one by one are coalesced by config
+// name (and pack id, topic and tags, which are shared by all logs of one cgo call), and submitted in one call when the
+// batch is full or has been staged for too long.
+class ProcessLogStaging {
+public:
+    using SubmitFunc = std::function<void(const std::string& configName,
+                                          std::vector<sls_logs::Log>& logs,
+                                          const std::string& packId,
+                                          const std::string& topic,
+                                          const std::string& tags)>;
+
+    explicit ProcessLogStaging(SubmitFunc&& submit) : mSubmit(std::move(submit)) {}
+    ~ProcessLogStaging() { Stop(); }
+
+    ProcessLogStaging(const ProcessLogStaging&) = delete;
+    ProcessLogStaging& operator=(const ProcessLogStaging&) = delete;
+
+    // logs are moved out
+    void Add(const std::string& configName,
+             std::vector<sls_logs::Log>& logs,
+             const std::string& packId,
+             const std::string& topic,
+             const std::string& tags);
+    void Flush(const std::string& configName);
+    void FlushAll();
+    // flush everything and stop the timeout thread, which is started on the first Add
+    void Stop();
+
+private:
+    struct Batch {
+        std::string mConfigName;
+        std::string mPackId;
+        std::string mTopic;
+        std::string mTags;
+        std::vector<sls_logs::Log> mLogs;
+        size_t mBytes = 0;
+        std::chrono::steady_clock::time_point mCreateTime;
+    };
+
+    void Run();
+    // submit batches in the order they are taken out, mSubmitMux must be held
+    void Submit(std::vector<Batch>& batches);
+
+    SubmitFunc mSubmit;
+
+    std::mutex mMux;
+    // key: config name + pack id + topic + tags
+    std::map<std::string, Batch> mBatches;
+    std::mutex mSubmitMux;
+
+    std::future<void> mThreadRes;
+    std::mutex mThreadRunningMux;
+    bool mIsThreadRunning = false;
+    std::condition_variable mStopCV;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class ProcessLogStagingUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -0,0 +1,53 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "logger/LogRateLimiter.h"
+
+#include <algorithm>
+
+#include "common/CoarseClock.h"
+#include "common/Flags.h"
+
+DEFINE_FLAG_INT32(log_rate_limit_burst, "max messages logged at once by a rate limited log call site", 10);
+DEFINE_FLAG_INT32(log_rate_limit_per_sec, "messages logged per second by a rate limited log call site", 1);
+
+using namespace std;
+
+namespace logtail {
+
+bool LogRateLimiter::TryAcquire(uint32_t& suppressedCnt) {
+    const int64_t capacity = max(1, INT32_FLAG(log_rate_limit_burst)) * 1000LL;
+    int64_t now = GetCoarseTimeInMilliSeconds();
+    int64_t last = mLastRefillTimeMs.load(memory_order_relaxed);
+    // only the thread moving the refill time forward refills the bucket
+    if (now > last && mLastRefillTimeMs.compare_exchange_strong(last, now, memory_order_relaxed)) {
+        int64_t refill = last == 0 ? capacity : (now - last) * INT32_FLAG(log_rate_limit_per_sec);
+        int64_t tokens = mTokens.load(memory_order_relaxed);
+        while (!mTokens.compare_exchange_weak(
+            tokens, min(max(tokens, int64_t(0)) + refill, capacity), memory_order_relaxed)) {
+        }
+    }
+
+    int64_t tokens = mTokens.load(memory_order_relaxed);
+    while (tokens >= 1000) {
+        if (mTokens.compare_exchange_weak(tokens, tokens - 1000, memory_order_relaxed)) {
+            suppressedCnt = mSuppressedCnt.exchange(0, memory_order_relaxed);
+            return true;
+        }
+    }
+    mSuppressedCnt.fetch_add(1, memory_order_relaxed);
+    return false;
+}
+
+} // namespace logtail
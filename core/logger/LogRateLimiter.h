@@ -0,0 +1,43 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace logtail {
+
+// Token bucket guarding one log call site, see LOG_X_RATE_LIMITED. The bucket holds at most log_rate_limit_burst
+// tokens and is refilled with log_rate_limit_per_sec tokens per second. Lock free, so that processing threads hitting
+// the same call site never wait for each other.
+class LogRateLimiter {
+public:
+    // On success, @suppressedCnt is the number of messages rejected since the last admitted one.
+    bool TryAcquire(uint32_t& suppressedCnt);
+
+private:
+    // in 1/1000 token
+    std::atomic_int64_t mTokens = -1;
+    std::atomic_int64_t mLastRefillTimeMs = 0;
+    std::atomic_uint32_t mSuppressedCnt = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class LogRateLimiterUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -20,6 +20,8 @@
 #include <map>
 #include <spdlog/spdlog.h>
 
+#include "logger/LogRateLimiter.h"
+
 namespace logtail {
 
 class Logger {
@@ -118,6 +120,25 @@ public:
         } \
     } while (0)
 
+// For per event paths, e.g. parse failures. Each call site logs at most log_rate_limit_burst messages at once and
+// log_rate_limit_per_sec messages per second afterwards. The fields are not evaluated for suppressed messages, and the
+// number of suppressed messages is attached to the next admitted one.
+#define LOG_X_RATE_LIMITED(logger, fields, level) \
+    do { \
+        if (logger->should_log(level)) { \
+            static logtail::LogRateLimiter sLogRateLimiter; \
+            uint32_t suppressedCnt = 0; \
+            if (sLogRateLimiter.TryAcquire(suppressedCnt)) { \
+                LogMaker maker; \
+                (void)maker fields; \
+                if (suppressedCnt > 0) { \
+                    maker("suppressed messages", suppressedCnt); \
+                } \
+                logger->log(level, "{}:{}\t{}", __FILE__, __LINE__, maker.GetContent()); \
+            } \
+        } \
+    } while (0)
+
 #ifndef LOG_INFO
 #define LOG_TRACE(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::trace)
 #define LOG_DEBUG(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::debug)
@@ -126,6 +147,9 @@ public:
 #define LOG_ERROR(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::err)
 #define LOG_FATAL(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::info)
 #endif
+#define LOG_INFO_RATE_LIMITED(logger, fields) LOG_X_RATE_LIMITED(logger, fields, spdlog::level::info)
+#define LOG_WARNING_RATE_LIMITED(logger, fields) LOG_X_RATE_LIMITED(logger, fields, spdlog::level::warn)
+#define LOG_ERROR_RATE_LIMITED(logger, fields) LOG_X_RATE_LIMITED(logger, fields, spdlog::level::err)
 // For compatibility with syslog.
 #define APSARA_LOG_DEBUG(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::debug)
 #define APSARA_LOG_INFO(logger, fields) LOG_X_IF(logger, true, fields, spdlog::level::info)
@@ -80,6 +80,8 @@ public:
     void SetContentNoCopy(const StringBuffer& key, const StringBuffer& val);
     void SetContentNoCopy(StringView key, StringView val);
     void DelContent(StringView key);
+    // reserve space for @n contents, when the number of contents to be set is known ahead
+    void ReserveContents(size_t n) { mContents.reserve(n); }
 
     void SetPosition(uint32_t offset, uint32_t size) {
         mFileOffset = offset;
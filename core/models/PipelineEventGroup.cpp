@@ -18,7 +18,7 @@
 
 #include <sstream>
 
-#include "common/HashUtil.h"
+#include "common/xxhash/xxhash.h"
 #include "logger/Logger.h"
 #include "plugin/processor/inner/ProcessorParseContainerLogNative.h"
 
@@ -29,8 +29,10 @@ namespace logtail {
 PipelineEventGroup::PipelineEventGroup(PipelineEventGroup&& rhs) noexcept
     : mMetadata(std::move(rhs.mMetadata)),
       mTags(std::move(rhs.mTags)),
+      mTagsHash(rhs.mTagsHash),
       mEvents(std::move(rhs.mEvents)),
-      mSourceBuffer(std::move(rhs.mSourceBuffer)) {
+      mSourceBuffer(std::move(rhs.mSourceBuffer)),
+      mRetainedSourceBuffers(std::move(rhs.mRetainedSourceBuffers)) {
     for (auto& item : mEvents) {
         item->ResetPipelineEventGroup(this);
     }
@@ -40,8 +42,10 @@ PipelineEventGroup& PipelineEventGroup::operator=(PipelineEventGroup&& rhs) noex
     if (this != &rhs) {
         mMetadata = std::move(rhs.mMetadata);
         mTags = std::move(rhs.mTags);
+        mTagsHash = rhs.mTagsHash;
         mEvents = std::move(rhs.mEvents);
         mSourceBuffer = std::move(rhs.mSourceBuffer);
+        mRetainedSourceBuffers = std::move(rhs.mRetainedSourceBuffers);
         for (auto& item : mEvents) {
             item->ResetPipelineEventGroup(this);
         }
@@ -53,6 +57,8 @@ PipelineEventGroup PipelineEventGroup::Copy() const {
     PipelineEventGroup res(mSourceBuffer);
     res.mMetadata = mMetadata;
     res.mTags = mTags;
+    res.mTagsHash = mTagsHash;
+    res.mRetainedSourceBuffers = mRetainedSourceBuffers;
     res.mExactlyOnceCheckpoint = mExactlyOnceCheckpoint;
     for (auto& event : mEvents) {
         res.mEvents.emplace_back(event.Copy());
@@ -94,6 +100,18 @@ SpanEvent* PipelineEventGroup::AddSpanEvent() {
     return e;
 }
 
+void PipelineEventGroup::RetainSourceBuffer(const shared_ptr<SourceBuffer>& sourceBuffer) {
+    if (sourceBuffer == mSourceBuffer) {
+        return;
+    }
+    for (const auto& item : mRetainedSourceBuffers) {
+        if (item == sourceBuffer) {
+            return;
+        }
+    }
+    mRetainedSourceBuffers.emplace_back(sourceBuffer);
+}
+
 void PipelineEventGroup::SetMetadata(EventGroupMetaKey key, StringView val) {
     SetMetadataNoCopy(key, mSourceBuffer->CopyString(val));
 }
@@ -110,6 +128,9 @@ bool PipelineEventGroup::HasMetadata(EventGroupMetaKey key) const {
     return mMetadata.find(key) != mMetadata.end();
 }
 void PipelineEventGroup::SetMetadataNoCopy(EventGroupMetaKey key, StringView val) {
+    if (key == EventGroupMetaKey::SOURCE_ID) {
+        mTagsHash.reset();
+    }
     mMetadata[key] = val;
 }
 
@@ -122,6 +143,9 @@ StringView PipelineEventGroup::GetMetadata(EventGroupMetaKey key) const {
 }
 
 void PipelineEventGroup::DelMetadata(EventGroupMetaKey key) {
+    if (key == EventGroupMetaKey::SOURCE_ID) {
+        mTagsHash.reset();
+    }
     mMetadata.erase(key);
 }
 
@@ -146,6 +170,7 @@ bool PipelineEventGroup::HasTag(StringView key) const {
 }
 
 void PipelineEventGroup::SetTagNoCopy(StringView key, StringView val) {
+    mTagsHash.reset();
     mTags.Insert(key, val);
 }
 
@@ -158,17 +183,24 @@ StringView PipelineEventGroup::GetTag(StringView key) const {
 }
 
 void PipelineEventGroup::DelTag(StringView key) {
+    mTagsHash.reset();
     mTags.Erase(key);
 }
 
 size_t PipelineEventGroup::GetTagsHash() const {
-    size_t seed = 0;
+    if (mTagsHash) {
+        return *mTagsHash;
+    }
+    // each field is chained as the seed of the next one, so that field boundaries are also reflected in the hash
+    uint64_t seed = 0;
     for (const auto& item : mTags.mInner) {
-        HashCombine(seed, hash<string>{}(item.first.to_string()));
-        HashCombine(seed, hash<string>{}(item.second.to_string()));
+        seed = XXH64(item.first.data(), item.first.size(), seed);
+        seed = XXH64(item.second.data(), item.second.size(), seed);
     }
-    HashCombine(seed, hash<string>{}(GetMetadata(EventGroupMetaKey::SOURCE_ID).to_string()));
-    return seed;
+    StringView sourceId = GetMetadata(EventGroupMetaKey::SOURCE_ID);
+    seed = XXH64(sourceId.data(), sourceId.size(), seed);
+    mTagsHash = static_cast<size_t>(seed);
+    return *mTagsHash;
 }
 
 size_t PipelineEventGroup::DataSize() const {
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "checkpoint/RangeCheckpoint.h"
 #include "common/Constants.h"
@@ -87,6 +89,11 @@ public:
     SpanEvent* AddSpanEvent();
     void SwapEvents(EventsContainer& other) { mEvents.swap(other); }
     std::shared_ptr<SourceBuffer>& GetSourceBuffer() { return mSourceBuffer; }
+    // Keep another source buffer alive as long as the group, so that fields can be set without copy from it.
+    void RetainSourceBuffer(const std::shared_ptr<SourceBuffer>& sourceBuffer);
+    const std::vector<std::shared_ptr<SourceBuffer>>& GetRetainedSourceBuffers() const {
+        return mRetainedSourceBuffers;
+    }
 
     void SetMetadata(EventGroupMetaKey key, StringView val);
     void SetMetadata(EventGroupMetaKey key, const std::string& val);
@@ -96,7 +103,10 @@ public:
     bool HasMetadata(EventGroupMetaKey key) const;
     void SetMetadataNoCopy(EventGroupMetaKey key, StringView val);
     void DelMetadata(EventGroupMetaKey key);
-    void SetAllMetadata(const GroupMetadata& other) { mMetadata = other; }
+    void SetAllMetadata(const GroupMetadata& other) {
+        mTagsHash.reset();
+        mMetadata = other;
+    }
 
     void SetTag(StringView key, StringView val);
     void SetTag(const std::string& key, const std::string& val);
@@ -104,11 +114,17 @@ public:
     void SetTagNoCopy(const StringBuffer& key, const StringBuffer& val);
     StringView GetTag(StringView key) const;
     const GroupTags& GetTags() const { return mTags.mInner; };
-    SizedMap& GetSizedTags() { return mTags; };
+    SizedMap& GetSizedTags() {
+        // tags may be modified through the returned reference
+        mTagsHash.reset();
+        return mTags;
+    };
     bool HasTag(StringView key) const;
     void SetTagNoCopy(StringView key, StringView val);
     void DelTag(StringView key);
 
+    // Hash of tags and source id, which is computed over raw bytes with a fixed seed and thus stable across processes.
+    // The value is cached until tags or source id are modified.
     size_t GetTagsHash() const;
 
     void SetExactlyOnceCheckpoint(const RangeCheckpointPtr& checkpoint) { mExactlyOnceCheckpoint = checkpoint; }
@@ -128,9 +144,15 @@ public:
 private:
     GroupMetadata mMetadata; // Used to generate tag/log. Will not output.
     SizedMap mTags; // custom tags to output
+    mutable std::optional<size_t> mTagsHash;
     EventsContainer mEvents;
     std::shared_ptr<SourceBuffer> mSourceBuffer;
+    std::vector<std::shared_ptr<SourceBuffer>> mRetainedSourceBuffers;
     RangeCheckpointPtr mExactlyOnceCheckpoint;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class PipelineEventGroupUnittest;
+#endif
 };
 
 } // namespace logtail
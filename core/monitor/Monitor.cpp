@@ -38,6 +38,8 @@
 #include "monitor/LogFileProfiler.h"
 #include "monitor/LogtailAlarm.h"
 #include "monitor/MetricExportor.h"
+#include "monitor/ResourceGovernor.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
 #include "protobuf/sls/sls_logs.pb.h"
 #include "runner/FlusherRunner.h"
@@ -58,6 +60,7 @@ using namespace sls_logs;
 DEFINE_FLAG_BOOL(logtail_dump_monitor_info, "enable to dump Logtail monitor info (CPU, mem)", false);
 DECLARE_FLAG_BOOL(send_prefer_real_ip);
 DECLARE_FLAG_BOOL(check_profile_region);
+DECLARE_FLAG_BOOL(enable_resource_governor);
 
 namespace logtail {
 
@@ -116,6 +119,8 @@ bool LogtailMonitor::Init() {
     // init metrics
     mAgentCpuGauge = LoongCollectorMonitor::GetInstance()->GetDoubleGauge(METRIC_AGENT_CPU);
     mAgentMemoryGauge = LoongCollectorMonitor::GetInstance()->GetIntGauge(METRIC_AGENT_MEMORY);
+    mAgentMemoryAccountedGauge = LoongCollectorMonitor::GetInstance()->GetIntGauge(METRIC_AGENT_MEMORY_ACCOUNTED_BYTES);
+    ResourceGovernor::GetInstance()->InitMetrics();
 
     // Initialize monitor thread.
     mThreadRes = async(launch::async, &LogtailMonitor::Monitor, this);
@@ -149,7 +154,8 @@ void LogtailMonitor::Monitor() {
             GetCpuStat(curCpuStat);
 
             // Update mRealtimeCpuStat for InputFlowControl.
-            if (AppConfig::GetInstance()->IsInputFlowControl()) {
+            if (AppConfig::GetInstance()->IsInputFlowControl()
+                || ResourceGovernor::GetInstance()->IsInputThrottled()) {
                 CalCpuStat(curCpuStat, mRealtimeCpuStat);
             }
 
@@ -202,7 +208,9 @@ void LogtailMonitor::Monitor() {
                 // Returning true means too much violations, so we have to prepare to restart
                 // logtail to release resource.
                 // Mainly for controlling memory because we have no idea to descrease memory usage.
-                if (CheckSoftCpuLimit() || CheckSoftMemLimit()) {
+                // When resource governor is enabled, it degrades step by step and restart is only the last resort.
+                if (BOOL_FLAG(enable_resource_governor) ? CheckResourceGovernor()
+                                                        : (CheckSoftCpuLimit() || CheckSoftMemLimit())) {
                     LOG_ERROR(sLogger,
                               ("Resource used by program exceeds upper limit for some time",
                                "prepare restart Logtail")("cpu_usage", mCpuStat.mCpuUsage)("mem_rss", mMemStat.mRss));
@@ -274,6 +282,8 @@ bool LogtailMonitor::SendStatusProfile(bool suicide) {
     // Memory usage of Logtail process.
     AddLogContent(logPtr, "mem", mMemStat.mRss);
     mAgentMemoryGauge->Set(mMemStat.mRss);
+    // Memory held by queues, charged by their owners.
+    mAgentMemoryAccountedGauge->Set(MemoryAccountant::GetInstance()->GetUsedBytes());
     // The version, uuid of Logtail.
     AddLogContent(logPtr, "version", ILOGTAIL_VERSION);
     AddLogContent(logPtr, "uuid", Application::GetInstance()->GetUUID());
@@ -467,6 +477,21 @@ bool LogtailMonitor::CheckSoftMemLimit() {
     return false;
 }
 
+bool LogtailMonitor::CheckResourceGovernor() {
+    float cpuUsageLimit = AppConfig::GetInstance()->IsResourceAutoScale()
+        ? AppConfig::GetInstance()->GetScaledCpuUsageUpLimit()
+        : AppConfig::GetInstance()->GetCpuUsageUpLimit();
+    ResourceGovernor* governor = ResourceGovernor::GetInstance();
+    ResourceGovernorLevel lastLevel = governor->GetLevel();
+    bool needRestart = governor->Update(
+        mCpuStat.mCpuUsage, cpuUsageLimit, mMemStat.mRss, AppConfig::GetInstance()->GetMemUsageUpLimit());
+    if (governor->GetLevel() > lastLevel) {
+        // Each escalation drops the timeout objects held by readers first.
+        LogInput::GetInstance()->SetForceClearFlag(true);
+    }
+    return needRestart;
+}
+
 bool LogtailMonitor::CheckHardMemLimit() {
     return mMemStat.mRss > 5 * AppConfig::GetInstance()->GetMemUsageUpLimit();
 }
@@ -724,12 +749,26 @@ void LoongCollectorMonitor::Init() {
     mDoubleGauges[METRIC_AGENT_CPU] = mMetricsRecordRef.CreateDoubleGauge(METRIC_AGENT_CPU);
     mIntGauges[METRIC_AGENT_MEMORY] = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_MEMORY);
     mIntGauges[METRIC_AGENT_MEMORY_GO] = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_MEMORY_GO);
+    mIntGauges[METRIC_AGENT_MEMORY_ACCOUNTED_BYTES]
+        = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_MEMORY_ACCOUNTED_BYTES);
     mIntGauges[METRIC_AGENT_GO_ROUTINES_TOTAL] = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_GO_ROUTINES_TOTAL);
     mIntGauges[METRIC_AGENT_OPEN_FD_TOTAL] = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_OPEN_FD_TOTAL);
     // mIntGauges[METRIC_AGENT_INSTANCE_CONFIG_TOTAL] =
     // mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_INSTANCE_CONFIG_TOTAL);
     mIntGauges[METRIC_AGENT_PIPELINE_CONFIG_TOTAL]
         = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_PIPELINE_CONFIG_TOTAL);
+    mIntGauges[METRIC_AGENT_RESOURCE_GOVERNOR_LEVEL]
+        = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_RESOURCE_GOVERNOR_LEVEL);
+    mCounters[METRIC_AGENT_RESOURCE_GOVERNOR_ESCALATIONS_TOTAL]
+        = mMetricsRecordRef.CreateCounter(METRIC_AGENT_RESOURCE_GOVERNOR_ESCALATIONS_TOTAL);
+    // startup phases, set only once
+    for (const auto& key : {METRIC_AGENT_STARTUP_PIPELINE_BUILD_MS,
+                            METRIC_AGENT_STARTUP_CHECKPOINT_LOAD_MS,
+                            METRIC_AGENT_STARTUP_DIR_REGISTER_MS,
+                            METRIC_AGENT_STARTUP_DEFERRED_DIRS_TOTAL,
+                            METRIC_AGENT_STARTUP_FILE_SERVER_MS}) {
+        mIntGauges[key] = mMetricsRecordRef.CreateIntGauge(key);
+    }
     LOG_INFO(sLogger, ("LoongCollectorMonitor", "started"));
 }
 
@@ -117,6 +117,8 @@ private:
     bool CheckSoftMemLimit();
 
     bool CheckHardMemLimit();
+    // CheckResourceGovernor feeds current usage to ResourceGovernor, returns true if restart is still needed.
+    bool CheckResourceGovernor();
 
     // SendStatusProfile collects status profile and send them to server.
     // @suicide indicates if the target LogStore is logtail_suicide_profile.
@@ -166,6 +168,7 @@ private:
     // Memory usage statistics.
     MemStat mMemStat;
     IntGaugePtr mAgentMemoryGauge;
+    IntGaugePtr mAgentMemoryAccountedGauge;
 
     // Current scale up level, updated by CheckScaledCpuUsageUpLimit.
     float mScaledCpuUsageUpLimit;
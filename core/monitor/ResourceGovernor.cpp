@@ -0,0 +1,117 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "monitor/ResourceGovernor.h"
+
+#include <algorithm>
+
+#include "common/Flags.h"
+#include "logger/Logger.h"
+#include "monitor/Monitor.h"
+#include "monitor/metric_constants/MetricConstants.h"
+
+DEFINE_FLAG_BOOL(enable_resource_governor,
+                 "degrade gracefully when resource usage exceeds soft limit instead of restarting directly",
+                 true);
+DEFINE_FLAG_INT32(resource_governor_escalate_num, "continuous violations before escalating one level", 2);
+DEFINE_FLAG_INT32(resource_governor_recover_num, "continuous healthy checks before recovering one level", 3);
+DEFINE_FLAG_INT32(resource_governor_restart_num, "continuous violations at the highest level before restart", 5);
+DEFINE_FLAG_DOUBLE(resource_governor_recover_ratio,
+                   "usage must be below limit * ratio to be regarded as healthy, avoiding oscillation",
+                   0.8);
+
+using namespace std;
+
+namespace logtail {
+
+static const char* LevelToString(ResourceGovernorLevel level) {
+    switch (level) {
+        case ResourceGovernorLevel::NORMAL:
+            return "normal";
+        case ResourceGovernorLevel::THROTTLE_INPUT:
+            return "throttle_input";
+        case ResourceGovernorLevel::REDUCE_PROCESS_THREAD:
+            return "reduce_process_thread";
+        case ResourceGovernorLevel::PAUSE_LOW_PRIORITY:
+            return "pause_low_priority";
+    }
+    return "unknown";
+}
+
+void ResourceGovernor::InitMetrics() {
+    mLevelGauge = LoongCollectorMonitor::GetInstance()->GetIntGauge(METRIC_AGENT_RESOURCE_GOVERNOR_LEVEL);
+    mEscalationsCnt = LoongCollectorMonitor::GetInstance()->GetCounter(METRIC_AGENT_RESOURCE_GOVERNOR_ESCALATIONS_TOTAL);
+}
+
+bool ResourceGovernor::Update(double cpuUsage, double cpuLimit, int64_t memUsage, int64_t memLimit) {
+    bool violated = cpuUsage > cpuLimit || memUsage > memLimit;
+    if (violated) {
+        mHealthyNum = 0;
+        if (++mViolateNum < static_cast<uint32_t>(INT32_FLAG(resource_governor_escalate_num))) {
+            return false;
+        }
+        mViolateNum = 0;
+        ResourceGovernorLevel level = GetLevel();
+        if (level < ResourceGovernorLevel::PAUSE_LOW_PRIORITY) {
+            SetLevel(static_cast<ResourceGovernorLevel>(static_cast<uint32_t>(level) + 1));
+            if (mEscalationsCnt) {
+                mEscalationsCnt->Add(1);
+            }
+            LOG_WARNING(sLogger,
+                        ("resource usage exceeds limit", "escalate resource governor level")(
+                            "level", LevelToString(GetLevel()))("cpu", cpuUsage)("cpu limit", cpuLimit)(
+                            "mem", memUsage)("mem limit", memLimit));
+            return false;
+        }
+        return ++mMaxLevelViolateNum >= static_cast<uint32_t>(INT32_FLAG(resource_governor_restart_num));
+    }
+
+    mViolateNum = 0;
+    mMaxLevelViolateNum = 0;
+    double ratio = DOUBLE_FLAG(resource_governor_recover_ratio);
+    bool healthy = cpuUsage <= cpuLimit * ratio && memUsage <= memLimit * ratio;
+    if (!healthy || GetLevel() == ResourceGovernorLevel::NORMAL) {
+        mHealthyNum = 0;
+        return false;
+    }
+    if (++mHealthyNum >= static_cast<uint32_t>(INT32_FLAG(resource_governor_recover_num))) {
+        mHealthyNum = 0;
+        SetLevel(static_cast<ResourceGovernorLevel>(static_cast<uint32_t>(GetLevel()) - 1));
+        LOG_INFO(sLogger,
+                 ("resource usage is back to normal", "recover resource governor level")(
+                     "level", LevelToString(GetLevel()))("cpu", cpuUsage)("mem", memUsage));
+    }
+    return false;
+}
+
+uint32_t ResourceGovernor::GetActiveProcessThreadCount(uint32_t totalThreadCount) const {
+    switch (GetLevel()) {
+        case ResourceGovernorLevel::NORMAL:
+        case ResourceGovernorLevel::THROTTLE_INPUT:
+            return totalThreadCount;
+        case ResourceGovernorLevel::REDUCE_PROCESS_THREAD:
+            return max(1U, totalThreadCount / 2);
+        default:
+            return 1;
+    }
+}
+
+void ResourceGovernor::SetLevel(ResourceGovernorLevel level) {
+    mLevel.store(level, memory_order_relaxed);
+    if (mLevelGauge) {
+        mLevelGauge->Set(static_cast<uint64_t>(level));
+    }
+}
+
+} // namespace logtail
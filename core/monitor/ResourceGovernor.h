@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "monitor/LoongCollectorMetricTypes.h"
+
+namespace logtail {
+
+// Degradation levels, ordered by how much they hurt throughput. Each level keeps the actions of the lower ones.
+enum class ResourceGovernorLevel : uint32_t {
+    NORMAL = 0,
+    // caches are shed and file reading is throttled
+    THROTTLE_INPUT = 1,
+    // only part of the processor threads are allowed to pop from process queues
+    REDUCE_PROCESS_THREAD = 2,
+    // process queues explicitly configured with the lowest ProcessPriority are not popped, so their inputs are blocked
+    // by back pressure
+    PAUSE_LOW_PRIORITY = 3,
+};
+
+// Closed-loop controller driven by LogtailMonitor. When the soft cpu or memory limit is violated continuously, the
+// governor escalates one level at a time; after the usage stays below the limit for a while, it steps back down.
+// Restart is only requested when the limit is still violated at the highest level.
+class ResourceGovernor {
+public:
+    ResourceGovernor(const ResourceGovernor&) = delete;
+    ResourceGovernor& operator=(const ResourceGovernor&) = delete;
+
+    static ResourceGovernor* GetInstance() {
+        static ResourceGovernor instance;
+        return &instance;
+    }
+
+    void InitMetrics();
+
+    // return true if the process should be restarted
+    bool Update(double cpuUsage, double cpuLimit, int64_t memUsage, int64_t memLimit);
+
+    ResourceGovernorLevel GetLevel() const { return mLevel.load(std::memory_order_relaxed); }
+    bool IsInputThrottled() const { return GetLevel() >= ResourceGovernorLevel::THROTTLE_INPUT; }
+    bool IsLowPriorityPaused() const { return GetLevel() >= ResourceGovernorLevel::PAUSE_LOW_PRIORITY; }
+    uint32_t GetActiveProcessThreadCount(uint32_t totalThreadCount) const;
+    bool IsProcessThreadActive(uint32_t threadNo, uint32_t totalThreadCount) const {
+        return threadNo < GetActiveProcessThreadCount(totalThreadCount);
+    }
+
+private:
+    ResourceGovernor() = default;
+    ~ResourceGovernor() = default;
+
+    void SetLevel(ResourceGovernorLevel level);
+
+    std::atomic<ResourceGovernorLevel> mLevel = ResourceGovernorLevel::NORMAL;
+    // only accessed by the monitor thread
+    uint32_t mViolateNum = 0;
+    uint32_t mHealthyNum = 0;
+    uint32_t mMaxLevelViolateNum = 0;
+
+    IntGaugePtr mLevelGauge;
+    CounterPtr mEscalationsCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    void Reset() {
+        mLevel = ResourceGovernorLevel::NORMAL;
+        mViolateNum = 0;
+        mHealthyNum = 0;
+        mMaxLevelViolateNum = 0;
+    }
+
+    friend class ResourceGovernorUnittest;
+    friend class ProcessQueueManagerUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -35,7 +35,15 @@ const string METRIC_AGENT_GO_ROUTINES_TOTAL = "agent_go_routines_total";
 const string METRIC_AGENT_INSTANCE_CONFIG_TOTAL = "agent_instance_config_total"; // Not Implemented
 const string METRIC_AGENT_MEMORY = "agent_memory_used_mb";
 const string METRIC_AGENT_MEMORY_GO = "agent_go_memory_used_mb";
+const string METRIC_AGENT_MEMORY_ACCOUNTED_BYTES = "agent_memory_accounted_bytes";
 const string METRIC_AGENT_OPEN_FD_TOTAL = "agent_open_fd_total";
 const string METRIC_AGENT_PIPELINE_CONFIG_TOTAL = "agent_pipeline_config_total";
+const string METRIC_AGENT_RESOURCE_GOVERNOR_LEVEL = "agent_resource_governor_level";
+const string METRIC_AGENT_RESOURCE_GOVERNOR_ESCALATIONS_TOTAL = "agent_resource_governor_escalations_total";
+const string METRIC_AGENT_STARTUP_PIPELINE_BUILD_MS = "agent_startup_pipeline_build_ms";
+const string METRIC_AGENT_STARTUP_CHECKPOINT_LOAD_MS = "agent_startup_checkpoint_load_ms";
+const string METRIC_AGENT_STARTUP_DIR_REGISTER_MS = "agent_startup_dir_register_ms";
+const string METRIC_AGENT_STARTUP_DEFERRED_DIRS_TOTAL = "agent_startup_deferred_dirs_total";
+const string METRIC_AGENT_STARTUP_FILE_SERVER_MS = "agent_startup_file_server_ms";
 
 } // namespace logtail
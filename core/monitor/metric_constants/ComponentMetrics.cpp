@@ -68,6 +68,7 @@ const string METRIC_COMPONENT_FETCHED_ITEMS_TOTAL = "componet_fetched_items_tota
 const string METRIC_COMPONENT_FETCH_REJECTED_BY_REGION_LIMITER_TIMES_TOTAL = "component_fetch_rejected_by_region_limiter_times_total";
 const string METRIC_COMPONENT_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL = "component_fetch_rejected_by_project_limiter_times_total";
 const string METRIC_COMPONENT_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL = "component_fetch_rejected_by_logstore_limiter_times_total";
+const string METRIC_COMPONENT_FETCH_REJECTED_BY_SHARD_LIMITER_TIMES_TOTAL = "component_fetch_rejected_by_shard_limiter_times_total";
 
 const string METRIC_COMPONENT_FETCH_REJECTED_BY_RATE_LIMITER_TIMES_TOTAL = "component_fetch_rejected_by_rate_limiter_times_total";
 
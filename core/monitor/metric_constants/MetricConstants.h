@@ -40,8 +40,16 @@ extern const std::string METRIC_AGENT_GO_ROUTINES_TOTAL;
 extern const std::string METRIC_AGENT_INSTANCE_CONFIG_TOTAL;
 extern const std::string METRIC_AGENT_MEMORY;
 extern const std::string METRIC_AGENT_MEMORY_GO;
+extern const std::string METRIC_AGENT_MEMORY_ACCOUNTED_BYTES;
 extern const std::string METRIC_AGENT_OPEN_FD_TOTAL;
 extern const std::string METRIC_AGENT_PIPELINE_CONFIG_TOTAL;
+extern const std::string METRIC_AGENT_RESOURCE_GOVERNOR_LEVEL;
+extern const std::string METRIC_AGENT_RESOURCE_GOVERNOR_ESCALATIONS_TOTAL;
+extern const std::string METRIC_AGENT_STARTUP_PIPELINE_BUILD_MS;
+extern const std::string METRIC_AGENT_STARTUP_CHECKPOINT_LOAD_MS;
+extern const std::string METRIC_AGENT_STARTUP_DIR_REGISTER_MS;
+extern const std::string METRIC_AGENT_STARTUP_DEFERRED_DIRS_TOTAL;
+extern const std::string METRIC_AGENT_STARTUP_FILE_SERVER_MS;
 
 //////////////////////////////////////////////////////////////////////////
 // pipeline
@@ -214,6 +222,7 @@ extern const std::string METRIC_COMPONENT_FETCHED_ITEMS_TOTAL;
 extern const std::string METRIC_COMPONENT_FETCH_REJECTED_BY_REGION_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL;
+extern const std::string METRIC_COMPONENT_FETCH_REJECTED_BY_SHARD_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_FETCH_REJECTED_BY_RATE_LIMITER_TIMES_TOTAL;
 
 
@@ -226,6 +235,7 @@ extern const std::string METRIC_LABEL_KEY_RUNNER_NAME;
 
 // label values
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_FILE_SERVER;
+extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_FILE_SINK;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_FLUSHER;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_PROCESSOR;
@@ -243,6 +253,8 @@ extern const std::string METRIC_RUNNER_SINK_OUT_SUCCESSFUL_ITEMS_TOTAL;
 extern const std::string METRIC_RUNNER_SINK_OUT_FAILED_ITEMS_TOTAL;
 extern const std::string METRIC_RUNNER_SINK_SENDING_ITEMS_TOTAL;
 extern const std::string METRIC_RUNNER_SINK_SEND_CONCURRENCY;
+extern const std::string METRIC_RUNNER_SINK_NEW_CONNECTIONS_TOTAL;
+extern const std::string METRIC_RUNNER_SINK_REUSED_CONNECTIONS_TOTAL;
 extern const std::string METRIC_RUNNER_CLIENT_REGISTER_STATE;
 extern const std::string METRIC_RUNNER_CLIENT_REGISTER_RETRY_TOTAL;
 extern const std::string METRIC_RUNNER_JOB_NUM;
@@ -23,6 +23,7 @@ const string METRIC_LABEL_KEY_RUNNER_NAME = "runner_name";
 
 // label values
 const string METRIC_LABEL_VALUE_RUNNER_NAME_FILE_SERVER = "file_server";
+const string METRIC_LABEL_VALUE_RUNNER_NAME_FILE_SINK = "file_sink";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_FLUSHER = "flusher_runner";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK = "http_sink";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_PROCESSOR = "processor_runner";
@@ -40,6 +41,8 @@ const string METRIC_RUNNER_SINK_OUT_SUCCESSFUL_ITEMS_TOTAL = "runner_out_success
 const string METRIC_RUNNER_SINK_OUT_FAILED_ITEMS_TOTAL = "runner_out_failed_items_total";
 const string METRIC_RUNNER_SINK_SENDING_ITEMS_TOTAL = "runner_sending_items_total";
 const string METRIC_RUNNER_SINK_SEND_CONCURRENCY = "runner_send_concurrency";
+const string METRIC_RUNNER_SINK_NEW_CONNECTIONS_TOTAL = "runner_new_connections_total";
+const string METRIC_RUNNER_SINK_REUSED_CONNECTIONS_TOTAL = "runner_reused_connections_total";
 const string METRIC_RUNNER_CLIENT_REGISTER_STATE = "runner_client_register_state";
 const string METRIC_RUNNER_CLIENT_REGISTER_RETRY_TOTAL = "runner_client_register_retry_total";
 const string METRIC_RUNNER_JOB_NUM = "runner_job_num";
@@ -461,12 +461,13 @@ void NetworkObserver::EventLoop() {
             mLastL4FlushTimeNs = nowTimeNs;
             std::vector<sls_logs::Log> allLogs;
             FlushOutStatistics(allLogs);
-            if (mSenderFunc) {
-                mSenderFunc(allLogs, mConfig->mLastApplyedConfig);
-            }
+            // logs may be moved out by sender
             mNetworkStatistic->mOutputEvents += allLogs.size();
             for (const auto& item : allLogs) {
-                mNetworkStatistic->mOutputBytes += item.GetCachedSize();
+                mNetworkStatistic->mOutputBytes += item.ByteSizeLong();
+            }
+            if (mSenderFunc) {
+                mSenderFunc(allLogs, mConfig->mLastApplyedConfig);
             }
         }
 
@@ -475,12 +476,13 @@ void NetworkObserver::EventLoop() {
             mLastL7FlushTimeNs = nowTimeNs;
             std::vector<sls_logs::Log> allLogs;
             FlushOutMetrics(allLogs);
-            if (mSenderFunc) {
-                mSenderFunc(allLogs, mConfig->mLastApplyedConfig);
-            }
+            // logs may be moved out by sender
             mNetworkStatistic->mOutputEvents += allLogs.size();
             for (const auto& item : allLogs) {
-                mNetworkStatistic->mOutputBytes += item.GetCachedSize();
+                mNetworkStatistic->mOutputBytes += item.ByteSizeLong();
+            }
+            if (mSenderFunc) {
+                mSenderFunc(allLogs, mConfig->mLastApplyedConfig);
             }
         }
         // flush profile metrics
@@ -526,11 +528,11 @@ int NetworkObserver::OutputPluginProcess(std::vector<sls_logs::Log>& logs, const
     for (auto& item : logs) {
         // nanosecond of observer will not be discard after processors, so here is default to no nanosecond
         SetLogTime(&item, now.tv_sec);
-        if (config->GetContext().GetGlobalConfig().mTopicType == GlobalConfig::TopicType::MACHINE_GROUP_TOPIC) {
-            sPlugin->ProcessLog(config->Name(), item, "", config->GetContext().GetGlobalConfig().mTopicFormat, "");
-        } else {
-            sPlugin->ProcessLog(config->Name(), item, "", "", "");
-        }
+    }
+    if (config->GetContext().GetGlobalConfig().mTopicType == GlobalConfig::TopicType::MACHINE_GROUP_TOPIC) {
+        sPlugin->StageLogs(config->Name(), logs, "", config->GetContext().GetGlobalConfig().mTopicFormat, "");
+    } else {
+        sPlugin->StageLogs(config->Name(), logs, "", "", "");
     }
     return 0;
 }
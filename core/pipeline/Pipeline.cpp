@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <mutex>
 #include <utility>
 
 #include "common/Flags.h"
@@ -311,7 +312,9 @@ bool Pipeline::Init(PipelineConfig&& config) {
 
         vector<BoundedSenderQueueInterface*> senderQueues;
         for (const auto& flusher : mFlushers) {
-            senderQueues.push_back(SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
+            for (auto key : flusher->GetQueueKeys()) {
+                senderQueues.push_back(SenderQueueManager::GetInstance()->GetQueue(key));
+            }
         }
         ProcessQueueManager::GetInstance()->SetDownStreamQueues(mContext.GetProcessQueueKey(), std::move(senderQueues));
     }
@@ -374,6 +377,22 @@ void Pipeline::Process(vector<PipelineEventGroup>& logGroupList, size_t inputInd
 
 bool Pipeline::Send(vector<PipelineEventGroup>&& groupList) {
     bool allSucceeded = true;
+    if (mRouter.HasEventLevelCondition()) {
+        vector<pair<size_t, PipelineEventGroup>> routedGroups;
+        for (auto& group : groupList) {
+            mRouter.Route(std::move(group), routedGroups);
+        }
+        for (auto& item : routedGroups) {
+            if (item.first >= mFlushers.size()) {
+                LOG_ERROR(sLogger,
+                          ("unexpected error", "invalid flusher index")("flusher index", item.first)("config", mName));
+                allSucceeded = false;
+                continue;
+            }
+            allSucceeded = mFlushers[item.first]->Send(std::move(item.second)) && allSucceeded;
+        }
+        return allSucceeded;
+    }
     for (auto& group : groupList) {
         auto flusherIdx = mRouter.Route(group);
         for (size_t i = 0; i < flusherIdx.size(); ++i) {
@@ -438,6 +457,63 @@ void Pipeline::RemoveProcessQueue() const {
     ProcessQueueManager::GetInstance()->DeleteQueue(mContext.GetProcessQueueKey());
 }
 
+bool Pipeline::IsOnlyProcessorsChanged(const PipelineConfig& config) const {
+    if (!mConfig || config.mName != mName || HasGoPipelineWithInput() || HasGoPipelineWithoutInput()
+        || config.mHasGoProcessor) {
+        return false;
+    }
+    // these flags are consumed by inputs on init
+    if (config.mIsFirstProcessorJson != mContext.IsFirstProcessorJson()) {
+        return false;
+    }
+    bool isFirstProcessorApsara = !config.mProcessors.empty()
+        && (*config.mProcessors[0])["Type"].asString() == ProcessorParseApsaraNative::sName;
+    if (isFirstProcessorApsara != mContext.IsFirstProcessorApsara()) {
+        return false;
+    }
+    Json::Value oldDetail = *mConfig, newDetail = *config.mDetail;
+    oldDetail.removeMember("processors");
+    newDetail.removeMember("processors");
+    return oldDetail == newDetail;
+}
+
+bool Pipeline::UpdateProcessors(PipelineConfig&& config) {
+    // new processors are built before pausing, so that the pause only covers the swap itself
+    vector<unique_ptr<ProcessorInstance>> processorLine;
+    unordered_map<string, uint32_t> processorCnt;
+    for (size_t i = 0; i < config.mProcessors.size(); ++i) {
+        const Json::Value& detail = *config.mProcessors[i];
+        string pluginType = detail["Type"].asString();
+        unique_ptr<ProcessorInstance> processor
+            = PluginRegistry::GetInstance()->CreateProcessor(pluginType, GenNextPluginMeta(false));
+        if (!processor || !processor->Init(detail, mContext)) {
+            return false;
+        }
+        processorLine.emplace_back(std::move(processor));
+        ++processorCnt[pluginType];
+    }
+
+    // swap at group boundary: inputs keep pushing to the process queue, while no group is popped until all popped
+    // ones have gone through the old processor line
+    auto startTime = GetCurrentTimeInMilliSeconds();
+    ProcessQueueManager::GetInstance()->DisablePop(mName, false);
+    while (mInProcessCnt.load() != 0) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    mProcessorLine.swap(processorLine);
+    ProcessQueueManager::GetInstance()->EnablePop(mName);
+    auto pauseTime = GetCurrentTimeInMilliSeconds() - startTime;
+
+    if (processorCnt.empty()) {
+        mPluginCntMap.erase("processors");
+    } else {
+        mPluginCntMap["processors"] = std::move(processorCnt);
+    }
+    mConfig = std::move(config.mDetail);
+    LOG_INFO(sLogger, ("pipeline processors update", "succeeded")("config", mName)("pause time ms", pauseTime));
+    return true;
+}
+
 void Pipeline::MergeGoPipeline(const Json::Value& src, Json::Value& dst) {
     for (auto itr = src.begin(); itr != src.end(); ++itr) {
         if (itr->isArray()) {
@@ -479,6 +555,9 @@ void Pipeline::CopyNativeGlobalParamToGoPipeline(Json::Value& pipeline) {
 }
 
 bool Pipeline::LoadGoPipelines() const {
+    // the Go plugin loader is not reentrant, while pipelines may be built concurrently
+    static mutex sLoadMux;
+    lock_guard<mutex> lock(sLoadMux);
     if (!mGoPipelineWithoutInput.isNull()) {
         string content = mGoPipelineWithoutInput.toStyledString();
         if (!LogtailPlugin::GetInstance()->LoadPipeline(GetConfigNameOfGoPipelineWithoutInput(),
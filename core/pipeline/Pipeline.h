@@ -46,6 +46,10 @@ public:
     bool Send(std::vector<PipelineEventGroup>&& groupList);
     bool FlushBatch();
     void RemoveProcessQueue() const;
+    // true if the config differs from the running one only in native processors, in which case the processor line can
+    // be replaced by UpdateProcessors without restarting inputs and flushers
+    bool IsOnlyProcessorsChanged(const PipelineConfig& config) const;
+    bool UpdateProcessors(PipelineConfig&& config);
     // Should add before or when item pop from ProcessorQueue, must be called in the lock of ProcessorQueue
     void AddInProcessCnt() { mInProcessCnt.fetch_add(1); }
     // Should sub when or after item push to SenderQueue
@@ -113,6 +117,7 @@ private:
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class PipelineMock;
     friend class PipelineUnittest;
+    friend class PipelineManagerUnittest;
     friend class InputContainerStdioUnittest;
     friend class InputFileUnittest;
     friend class InputPrometheusUnittest;
@@ -16,6 +16,9 @@
 
 #include "pipeline/PipelineManager.h"
 
+#include <atomic>
+#include <future>
+
 #include "file_server/ConfigManager.h"
 #include "file_server/FileServer.h"
 #include "go_pipeline/LogtailPlugin.h"
@@ -28,10 +31,14 @@
 #include "app_config/AppConfig.h"
 #include "shennong/ShennongManager.h"
 #endif
+#include "common/TimeUtil.h"
 #include "config/feedbacker/ConfigFeedbackReceiver.h"
+#include "monitor/Monitor.h"
 #include "pipeline/queue/ProcessQueueManager.h"
 #include "pipeline/queue/QueueKeyManager.h"
 
+DEFINE_FLAG_INT32(pipeline_build_thread_num, "max number of threads to build new pipelines concurrently", 4);
+
 using namespace std;
 
 namespace logtail {
@@ -49,16 +56,7 @@ void logtail::PipelineManager::UpdatePipelines(PipelineConfigDiff& diff) {
 #ifndef APSARA_UNIT_TEST_MAIN
     // 过渡使用
     static bool isFileServerStarted = false;
-    bool isFileServerInputChanged = false;
-    for (const auto& name : diff.mRemoved) {
-        isFileServerInputChanged = CheckIfFileServerUpdated(mPipelineNameEntityMap[name]->GetConfig()["inputs"][0]);
-    }
-    for (const auto& config : diff.mModified) {
-        isFileServerInputChanged = CheckIfFileServerUpdated(*config.mInputs[0]);
-    }
-    for (const auto& config : diff.mAdded) {
-        isFileServerInputChanged = CheckIfFileServerUpdated(*config.mInputs[0]);
-    }
+    bool isFileServerInputChanged = IsFileServerInputChanged(diff);
 
 #if defined(__ENTERPRISE__) && defined(__linux__) && !defined(__ANDROID__)
     if (AppConfig::GetInstance()->ShennongSocketEnabled()) {
@@ -79,6 +77,33 @@ void logtail::PipelineManager::UpdatePipelines(PipelineConfigDiff& diff) {
         ConfigFeedbackReceiver::GetInstance().FeedbackPipelineConfigStatus(name, ConfigFeedbackStatus::DELETED);
     }
     for (auto& config : diff.mModified) {
+        if (IsOnlyProcessorsChanged(config)) {
+            auto& old = mPipelineNameEntityMap[config.mName];
+            auto statistics = old->GetPluginStatistics();
+            if (!old->UpdateProcessors(std::move(config))) {
+                LOG_WARNING(sLogger,
+                            ("failed to update processors for existing config",
+                             "keep current pipeline running")("config", config.mName));
+                LogtailAlarm::GetInstance()->SendAlarm(CATEGORY_CONFIG_ALARM,
+                                                       "failed to update processors for existing config: keep current "
+                                                       "pipeline running, config: "
+                                                           + config.mName,
+                                                       config.mProject,
+                                                       config.mLogstore,
+                                                       config.mRegion);
+                ConfigFeedbackReceiver::GetInstance().FeedbackPipelineConfigStatus(config.mName,
+                                                                                   ConfigFeedbackStatus::FAILED);
+                continue;
+            }
+            LOG_INFO(sLogger,
+                     ("only processors changed for existing config",
+                      "processors replaced with inputs and flushers kept running")("config", config.mName));
+            DecreasePluginUsageCnt(statistics);
+            IncreasePluginUsageCnt(old->GetPluginStatistics());
+            ConfigFeedbackReceiver::GetInstance().FeedbackPipelineConfigStatus(config.mName,
+                                                                               ConfigFeedbackStatus::APPLIED);
+            continue;
+        }
         auto p = BuildPipeline(std::move(config)); // auto reuse old pipeline's process queue and sender queue
         if (!p) {
             LOG_WARNING(sLogger,
@@ -106,8 +131,19 @@ void logtail::PipelineManager::UpdatePipelines(PipelineConfigDiff& diff) {
         p->Start();
         ConfigFeedbackReceiver::GetInstance().FeedbackPipelineConfigStatus(config.mName, ConfigFeedbackStatus::APPLIED);
     }
-    for (auto& config : diff.mAdded) {
-        auto p = BuildPipeline(std::move(config));
+    // new pipelines are independent of each other, so they are built concurrently, while started in order
+    auto buildStartTime = GetCurrentTimeInMilliSeconds();
+    auto addedPipelines = BuildPipelines(diff.mAdded);
+    if (mIsFirstUpdate) {
+        auto gauge = LoongCollectorMonitor::GetInstance()->GetIntGauge(METRIC_AGENT_STARTUP_PIPELINE_BUILD_MS);
+        if (gauge) {
+            gauge->Set(GetCurrentTimeInMilliSeconds() - buildStartTime);
+        }
+        mIsFirstUpdate = false;
+    }
+    for (size_t i = 0; i < diff.mAdded.size(); ++i) {
+        auto& config = diff.mAdded[i];
+        auto& p = addedPipelines[i];
         if (!p) {
             LOG_WARNING(sLogger,
                         ("failed to build pipeline for new config", "skip current object")("config", config.mName));
@@ -156,6 +192,11 @@ void logtail::PipelineManager::UpdatePipelines(PipelineConfigDiff& diff) {
     }
 }
 
+bool PipelineManager::IsOnlyProcessorsChanged(const PipelineConfig& config) const {
+    auto iter = mPipelineNameEntityMap.find(config.mName);
+    return iter != mPipelineNameEntityMap.end() && iter->second->IsOnlyProcessorsChanged(config);
+}
+
 shared_ptr<Pipeline> PipelineManager::FindConfigByName(const string& configName) const {
     auto it = mPipelineNameEntityMap.find(configName);
     if (it != mPipelineNameEntityMap.end()) {
@@ -205,6 +246,26 @@ void PipelineManager::StopAllPipelines() {
     LOG_INFO(sLogger, ("stop all pipelines", "succeeded"));
 }
 
+vector<shared_ptr<Pipeline>> PipelineManager::BuildPipelines(vector<PipelineConfig>& configs) {
+    vector<shared_ptr<Pipeline>> res(configs.size());
+    atomic_size_t nextIdx = 0;
+    auto build = [&]() {
+        for (size_t i = nextIdx++; i < configs.size(); i = nextIdx++) {
+            res[i] = BuildPipeline(std::move(configs[i]));
+        }
+    };
+    size_t threadCnt = min(configs.size(), static_cast<size_t>(max(INT32_FLAG(pipeline_build_thread_num), 1)));
+    vector<future<void>> workers;
+    for (size_t i = 1; i < threadCnt; ++i) {
+        workers.emplace_back(async(launch::async, build));
+    }
+    build();
+    for (auto& worker : workers) {
+        worker.get();
+    }
+    return res;
+}
+
 shared_ptr<Pipeline> PipelineManager::BuildPipeline(PipelineConfig&& config) {
     shared_ptr<Pipeline> p = make_shared<Pipeline>();
     // only config.mDetail is removed, other members can be safely used later
@@ -236,6 +297,24 @@ void PipelineManager::DecreasePluginUsageCnt(const unordered_map<string, unorder
     }
 }
 
+bool PipelineManager::IsFileServerInputChanged(const PipelineConfigDiff& diff) {
+    bool isFileServerInputChanged = false;
+    for (const auto& name : diff.mRemoved) {
+        isFileServerInputChanged = CheckIfFileServerUpdated(mPipelineNameEntityMap[name]->GetConfig()["inputs"][0]);
+    }
+    for (const auto& config : diff.mModified) {
+        if (IsOnlyProcessorsChanged(config)) {
+            // inputs are kept running
+            continue;
+        }
+        isFileServerInputChanged = CheckIfFileServerUpdated(*config.mInputs[0]);
+    }
+    for (const auto& config : diff.mAdded) {
+        isFileServerInputChanged = CheckIfFileServerUpdated(*config.mInputs[0]);
+    }
+    return isFileServerInputChanged;
+}
+
 bool PipelineManager::CheckIfFileServerUpdated(const Json::Value& config) {
     string inputType = config["Type"].asString();
     return inputType == "input_file" || inputType == "input_container_stdio";
@@ -52,13 +52,17 @@ private:
     PipelineManager();
     ~PipelineManager() = default;
 
+    // only config.mDetail of each config is removed
+    std::vector<std::shared_ptr<Pipeline>> BuildPipelines(std::vector<PipelineConfig>& configs);
     virtual std::shared_ptr<Pipeline> BuildPipeline(PipelineConfig&& config); // virtual for ut
+    bool IsOnlyProcessorsChanged(const PipelineConfig& config) const;
     void IncreasePluginUsageCnt(
         const std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>>& statistics);
     void DecreasePluginUsageCnt(
         const std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>>& statistics);
     void FlushAllBatch();
     // TODO: 长期过渡使用
+    bool IsFileServerInputChanged(const PipelineConfigDiff& diff);
     bool CheckIfFileServerUpdated(const Json::Value& config);
 
     std::unordered_map<std::string, std::shared_ptr<Pipeline>> mPipelineNameEntityMap;
@@ -66,6 +70,7 @@ private:
     std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>> mPluginCntMap;
 
     std::vector<InputRunner*> mInputRunners;
+    bool mIsFirstUpdate = true;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class PipelineManagerMock;
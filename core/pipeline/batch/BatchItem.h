@@ -20,6 +20,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "common/CoarseClock.h"
 #include "models/PipelineEventGroup.h"
 #include "models/StringView.h"
 #include "pipeline/batch/BatchStatus.h"
@@ -94,9 +95,7 @@ public:
     void Add(PipelineEventPtr&& e) {
         mBatch.mEvents.emplace_back(std::move(e));
         mStatus.Update(mBatch.mEvents.back());
-        mTotalEnqueTimeMs += std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now())
-                                 .time_since_epoch()
-                                 .count();
+        mTotalEnqueTimeMs += GetCoarseTimeInMilliSeconds();
     }
 
     void Flush(GroupBatchItem& res) {
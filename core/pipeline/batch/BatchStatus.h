@@ -19,8 +19,9 @@
 #include <cstdint>
 #include <ctime>
 
-#include "pipeline/batch/BatchedEvents.h"
+#include "common/CoarseClock.h"
 #include "models/PipelineEventPtr.h"
+#include "pipeline/batch/BatchedEvents.h"
 
 namespace logtail {
 
@@ -36,7 +37,7 @@ public:
 
     virtual void Update(const PipelineEventPtr& e) {
         if (mCreateTime == 0) {
-            mCreateTime = time(nullptr);
+            mCreateTime = GetCoarseTimeInSeconds();
         }
         mSizeBytes += e->DataSize();
         ++mCnt;
@@ -65,7 +66,7 @@ public:
 
     void Update(const BatchedEvents& g) {
         if (mCreateTime == 0) {
-            mCreateTime = time(nullptr);
+            mCreateTime = GetCoarseTimeInSeconds();
         }
         mSizeBytes += g.mSizeBytes;
     }
@@ -91,7 +92,7 @@ public:
 
     void Update(const PipelineEventPtr& e) override {
         if (mCreateTime == 0) {
-            mCreateTime = time(nullptr);
+            mCreateTime = GetCoarseTimeInSeconds();
             mCreateTimeMinute = e->GetTimestamp() / 60;
         }
         mSizeBytes += e->DataSize();
@@ -18,12 +18,14 @@
 
 #include <json/json.h>
 
+#include <array>
 #include <cstdint>
-#include <map>
 #include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
+#include "common/CoarseClock.h"
 #include "common/Flags.h"
 #include "common/ParamExtractor.h"
 #include "models/PipelineEventGroup.h"
@@ -124,12 +126,16 @@ public:
 
     // when group level batch is disabled, there should be only 1 element in BatchedEventsList
     void Add(PipelineEventGroup&& g, std::vector<BatchedEventsList>& res) {
-        std::lock_guard<std::mutex> lock(mMux);
         size_t key = g.GetTagsHash();
-        EventBatchItem<T>& item = mEventQueueMap[key];
+        EventQueueShard& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mMux);
+        auto [iter, inserted] = shard.mEventQueueMap.try_emplace(key);
+        EventBatchItem<T>& item = iter->second;
         mInEventsTotal->Add(g.GetEvents().size());
         mInGroupDataSizeBytes->Add(g.DataSize());
-        mEventBatchItemsTotal->Set(mEventQueueMap.size());
+        if (inserted) {
+            mEventBatchItemsTotal->Add(1);
+        }
 
         size_t eventsSize = g.GetEvents().size();
         for (size_t i = 0; i < eventsSize; ++i) {
@@ -139,12 +145,14 @@ public:
                     UpdateMetricsOnFlushingEventQueue(item);
                     item.Flush(res);
                 } else {
+                    std::lock_guard<std::mutex> groupLock(mGroupMux);
                     if (!mGroupQueue->IsEmpty() && mGroupFlushStrategy->NeedFlushByTime(mGroupQueue->GetStatus())) {
                         UpdateMetricsOnFlushingGroupQueue();
                         mGroupQueue->Flush(res);
                     }
                     if (mGroupQueue->IsEmpty()) {
-                        TimeoutFlushManager::GetInstance()->UpdateRecord(mFlusher->GetContext().GetConfigName(),
+                        TimeoutFlushManager::GetInstance()->UpdateRecord(mGroupTimeoutRecord,
+                                                                         mFlusher->GetContext().GetConfigName(),
                                                                          0,
                                                                          0,
                                                                          mGroupFlushStrategy->GetTimeoutSecs(),
@@ -162,12 +170,22 @@ public:
                            g.GetSourceBuffer(),
                            g.GetExactlyOnceCheckpoint(),
                            g.GetMetadata(EventGroupMetaKey::SOURCE_ID));
-                TimeoutFlushManager::GetInstance()->UpdateRecord(
-                    mFlusher->GetContext().GetConfigName(), 0, key, mEventFlushStrategy.GetTimeoutSecs(), mFlusher);
+                for (const auto& buffer : g.GetRetainedSourceBuffers()) {
+                    item.AddSourceBuffer(buffer);
+                }
+                TimeoutFlushManager::GetInstance()->UpdateRecord(shard.mTimeoutRecords[key],
+                                                                 mFlusher->GetContext().GetConfigName(),
+                                                                 0,
+                                                                 key,
+                                                                 mEventFlushStrategy.GetTimeoutSecs(),
+                                                                 mFlusher);
                 mBufferedGroupsTotal->Add(1);
                 mBufferedDataSizeByte->Add(item.DataSize());
             } else if (i == 0) {
                 item.AddSourceBuffer(g.GetSourceBuffer());
+                for (const auto& buffer : g.GetRetainedSourceBuffers()) {
+                    item.AddSourceBuffer(buffer);
+                }
             }
             mBufferedEventsTotal->Add(1);
             mBufferedDataSizeByte->Add(e->DataSize());
@@ -183,39 +201,48 @@ public:
     // key != 0: event level queue
     // key = 0: group level queue
     void FlushQueue(size_t key, BatchedEventsList& res) {
-        std::lock_guard<std::mutex> lock(mMux);
         if (key == 0) {
             if (!mGroupQueue) {
                 return;
             }
+            std::lock_guard<std::mutex> groupLock(mGroupMux);
             UpdateMetricsOnFlushingGroupQueue();
             return mGroupQueue->Flush(res);
         }
 
-        auto iter = mEventQueueMap.find(key);
-        if (iter == mEventQueueMap.end()) {
+        EventQueueShard& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mMux);
+        auto iter = shard.mEventQueueMap.find(key);
+        if (iter == shard.mEventQueueMap.end()) {
             return;
         }
 
         if (!mGroupQueue) {
             UpdateMetricsOnFlushingEventQueue(iter->second);
             iter->second.Flush(res);
-            mEventQueueMap.erase(iter);
-            mEventBatchItemsTotal->Set(mEventQueueMap.size());
+            shard.mEventQueueMap.erase(iter);
+            shard.mTimeoutRecords.erase(key);
+            mEventBatchItemsTotal->Sub(1);
             return;
         }
 
+        std::lock_guard<std::mutex> groupLock(mGroupMux);
         if (!mGroupQueue->IsEmpty() && mGroupFlushStrategy->NeedFlushByTime(mGroupQueue->GetStatus())) {
             UpdateMetricsOnFlushingGroupQueue();
             mGroupQueue->Flush(res);
         }
         if (mGroupQueue->IsEmpty()) {
-            TimeoutFlushManager::GetInstance()->UpdateRecord(
-                mFlusher->GetContext().GetConfigName(), 0, 0, mGroupFlushStrategy->GetTimeoutSecs(), mFlusher);
+            TimeoutFlushManager::GetInstance()->UpdateRecord(mGroupTimeoutRecord,
+                                                             mFlusher->GetContext().GetConfigName(),
+                                                             0,
+                                                             0,
+                                                             mGroupFlushStrategy->GetTimeoutSecs(),
+                                                             mFlusher);
         }
         iter->second.Flush(mGroupQueue.value());
-        mEventQueueMap.erase(iter);
-        mEventBatchItemsTotal->Set(mEventQueueMap.size());
+        shard.mEventQueueMap.erase(iter);
+        shard.mTimeoutRecords.erase(key);
+        mEventBatchItemsTotal->Sub(1);
         if (mGroupFlushStrategy->NeedFlushBySize(mGroupQueue->GetStatus())) {
             UpdateMetricsOnFlushingGroupQueue();
             mGroupQueue->Flush(res);
@@ -223,29 +250,34 @@ public:
     }
 
     void FlushAll(std::vector<BatchedEventsList>& res) {
-        std::lock_guard<std::mutex> lock(mMux);
-        for (auto& item : mEventQueueMap) {
-            if (!mGroupQueue) {
-                UpdateMetricsOnFlushingEventQueue(item.second);
-                item.second.Flush(res);
-            } else {
-                if (!mGroupQueue->IsEmpty() && mGroupFlushStrategy->NeedFlushByTime(mGroupQueue->GetStatus())) {
-                    UpdateMetricsOnFlushingGroupQueue();
-                    mGroupQueue->Flush(res);
-                }
-                item.second.Flush(mGroupQueue.value());
-                if (mGroupFlushStrategy->NeedFlushBySize(mGroupQueue->GetStatus())) {
-                    UpdateMetricsOnFlushingGroupQueue();
-                    mGroupQueue->Flush(res);
+        for (auto& shard : mShards) {
+            std::lock_guard<std::mutex> lock(shard.mMux);
+            for (auto& item : shard.mEventQueueMap) {
+                if (!mGroupQueue) {
+                    UpdateMetricsOnFlushingEventQueue(item.second);
+                    item.second.Flush(res);
+                } else {
+                    std::lock_guard<std::mutex> groupLock(mGroupMux);
+                    if (!mGroupQueue->IsEmpty() && mGroupFlushStrategy->NeedFlushByTime(mGroupQueue->GetStatus())) {
+                        UpdateMetricsOnFlushingGroupQueue();
+                        mGroupQueue->Flush(res);
+                    }
+                    item.second.Flush(mGroupQueue.value());
+                    if (mGroupFlushStrategy->NeedFlushBySize(mGroupQueue->GetStatus())) {
+                        UpdateMetricsOnFlushingGroupQueue();
+                        mGroupQueue->Flush(res);
+                    }
                 }
             }
+            mEventBatchItemsTotal->Sub(shard.mEventQueueMap.size());
+            shard.mEventQueueMap.clear();
+            shard.mTimeoutRecords.clear();
         }
         if (mGroupQueue) {
+            std::lock_guard<std::mutex> groupLock(mGroupMux);
             UpdateMetricsOnFlushingGroupQueue();
             mGroupQueue->Flush(res);
         }
-        mEventBatchItemsTotal->Set(0);
-        mEventQueueMap.clear();
     }
 
 #ifdef APSARA_UNIT_TEST_MAIN
@@ -254,14 +286,33 @@ public:
 #endif
 
 private:
+    // Event queues are striped over several shards by tags hash, so that processing threads routing groups with
+    // different tags into the same flusher do not contend on a single lock. The group queue, if enabled, is shared by
+    // all shards and guarded by its own lock, which must always be acquired after the shard lock.
+    static constexpr size_t sShardCnt = 16;
+
+    struct EventQueueShard {
+        std::mutex mMux;
+        std::unordered_map<size_t, EventBatchItem<T>> mEventQueueMap;
+        std::unordered_map<size_t, TimeoutRecordHandle> mTimeoutRecords;
+    };
+
+    EventQueueShard& GetShard(size_t key) { return mShards[(key ^ (key >> 16)) % sShardCnt]; }
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    size_t GetEventQueueCnt() {
+        size_t cnt = 0;
+        for (auto& shard : mShards) {
+            cnt += shard.mEventQueueMap.size();
+        }
+        return cnt;
+    }
+    EventBatchItem<T>& GetEventQueue(size_t key) { return GetShard(key).mEventQueueMap[key]; }
+#endif
+
     void UpdateMetricsOnFlushingEventQueue(const EventBatchItem<T>& item) {
         mOutEventsTotal->Add(item.EventSize());
-        mTotalDelayMs->Add(
-            item.EventSize()
-                * std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now())
-                      .time_since_epoch()
-                      .count()
-            - item.TotalEnqueTimeMs());
+        mTotalDelayMs->Add(item.EventSize() * GetCoarseTimeInMilliSeconds() - item.TotalEnqueTimeMs());
         mBufferedGroupsTotal->Sub(1);
         mBufferedEventsTotal->Sub(item.EventSize());
         mBufferedDataSizeByte->Sub(item.DataSize());
@@ -269,22 +320,18 @@ private:
 
     void UpdateMetricsOnFlushingGroupQueue() {
         mOutEventsTotal->Add(mGroupQueue->EventSize());
-        mTotalDelayMs->Add(
-            mGroupQueue->EventSize()
-                * std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now())
-                      .time_since_epoch()
-                      .count()
-            - mGroupQueue->TotalEnqueTimeMs());
+        mTotalDelayMs->Add(mGroupQueue->EventSize() * GetCoarseTimeInMilliSeconds() - mGroupQueue->TotalEnqueTimeMs());
         mBufferedGroupsTotal->Sub(mGroupQueue->GroupSize());
         mBufferedEventsTotal->Sub(mGroupQueue->EventSize());
         mBufferedDataSizeByte->Sub(mGroupQueue->DataSize());
     }
 
-    std::mutex mMux;
-    std::map<size_t, EventBatchItem<T>> mEventQueueMap;
+    std::array<EventQueueShard, sShardCnt> mShards;
     EventFlushStrategy<T> mEventFlushStrategy;
 
+    std::mutex mGroupMux;
     std::optional<GroupBatchItem> mGroupQueue;
+    TimeoutRecordHandle mGroupTimeoutRecord;
     std::optional<GroupFlushStrategy> mGroupFlushStrategy;
 
     Flusher* mFlusher = nullptr;
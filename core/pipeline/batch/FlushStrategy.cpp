@@ -21,7 +21,7 @@ namespace logtail {
 template <>
 bool EventFlushStrategy<SLSEventBatchStatus>::NeedFlushByTime(const SLSEventBatchStatus& status,
                                                                      const PipelineEventPtr& e) {
-    return time(nullptr) - status.GetCreateTime() > mTimeoutSecs
+    return GetCoarseTimeInSeconds() - status.GetCreateTime() > mTimeoutSecs
         || status.GetCreateTimeMinute() != e->GetTimestamp() / 60;
 }
 
@@ -21,8 +21,9 @@
 #include <cstdint>
 #include <ctime>
 
-#include "pipeline/batch/BatchStatus.h"
+#include "common/CoarseClock.h"
 #include "models/PipelineEventPtr.h"
+#include "pipeline/batch/BatchStatus.h"
 
 namespace logtail {
 
@@ -47,7 +48,7 @@ public:
     bool NeedFlushByCnt(const T& status) { return status.GetCnt() == mMaxCnt; }
     // should be called before event is added
     bool NeedFlushByTime(const T& status, const PipelineEventPtr& e) {
-        return time(nullptr) - status.GetCreateTime() >= mTimeoutSecs;
+        return GetCoarseTimeInSeconds() - status.GetCreateTime() >= mTimeoutSecs;
     }
 
 private:
@@ -69,7 +70,7 @@ public:
     bool NeedFlushBySize(const GroupBatchStatus& status) { return status.GetSize() >= mMaxSizeBytes; }
     // should be called before event is added
     bool NeedFlushByTime(const GroupBatchStatus& status) {
-        return time(nullptr) - status.GetCreateTime() >= mTimeoutSecs;
+        return GetCoarseTimeInSeconds() - status.GetCreateTime() >= mTimeoutSecs;
     }
 
 private:
@@ -20,30 +20,59 @@ namespace logtail {
 
 void TimeoutFlushManager::UpdateRecord(
     const string& config, size_t index, size_t key, uint32_t timeoutSecs, Flusher* f) {
+    TimeoutRecordHandle handle;
+    UpdateRecord(handle, config, index, key, timeoutSecs, f);
+}
+
+void TimeoutFlushManager::UpdateRecord(
+    TimeoutRecordHandle& handle, const string& config, size_t index, size_t key, uint32_t timeoutSecs, Flusher* f) {
+    if (handle && handle->mRegistered.load(memory_order_acquire)) {
+        handle->Update();
+        return;
+    }
     lock_guard<mutex> lock(mMux);
     auto& item = mTimeoutRecords[config];
     auto it = item.find({index, key});
     if (it == item.end()) {
-        item.try_emplace({index, key}, f, key, timeoutSecs);
+        it = item.try_emplace({index, key}, make_shared<TimeoutRecord>(f, key, timeoutSecs)).first;
+        mDeadlineBuckets[it->second->mScheduledDeadline].emplace_back(config, it->first);
     } else {
-        it->second.Update();
+        it->second->Update();
     }
+    handle = it->second;
 }
 
 void TimeoutFlushManager::FlushTimeoutBatch() {
     vector<pair<Flusher*, size_t>> records;
     {
         lock_guard<mutex> lock(mMux);
-        for (auto& item : mTimeoutRecords) {
-            for (auto it = item.second.begin(); it != item.second.end();) {
-                if (time(nullptr) - it->second.mUpdateTime >= it->second.mTimeoutSecs) {
-                    // cannot flush here, since flush may also update record, which will lead to both deadlock and map
-                    // iterator invalidation problems
-                    records.emplace_back(it->second.mFlusher, it->second.mKey);
-                    it = item.second.erase(it);
-                } else {
-                    ++it;
+        time_t now = GetCoarseTimeInSeconds();
+        while (!mDeadlineBuckets.empty() && mDeadlineBuckets.begin()->first <= now) {
+            auto bucket = mDeadlineBuckets.begin();
+            time_t deadline = bucket->first;
+            vector<TimerEntry> entries = std::move(bucket->second);
+            mDeadlineBuckets.erase(bucket);
+            for (auto& entry : entries) {
+                auto configIt = mTimeoutRecords.find(entry.mConfig);
+                if (configIt == mTimeoutRecords.end()) {
+                    continue;
                 }
+                auto it = configIt->second.find(entry.mKey);
+                if (it == configIt->second.end() || it->second->mScheduledDeadline != deadline) {
+                    continue;
+                }
+                TimeoutRecord& record = *it->second;
+                if (record.GetDeadline() > now) {
+                    // record has been updated since it was bucketed
+                    record.mScheduledDeadline = record.GetDeadline();
+                    mDeadlineBuckets[record.mScheduledDeadline].emplace_back(std::move(entry));
+                    continue;
+                }
+                // cannot flush here, since flush may also update record, which will lead to both deadlock and map
+                // iterator invalidation problems
+                records.emplace_back(record.mFlusher, record.mKey);
+                record.mRegistered.store(false, memory_order_release);
+                configIt->second.erase(it);
             }
         }
     }
@@ -54,7 +83,14 @@ void TimeoutFlushManager::FlushTimeoutBatch() {
 
 void TimeoutFlushManager::ClearRecords(const string& config) {
     lock_guard<mutex> lock(mMux);
-    mTimeoutRecords.erase(config);
+    auto it = mTimeoutRecords.find(config);
+    if (it == mTimeoutRecords.end()) {
+        return;
+    }
+    for (auto& item : it->second) {
+        item.second->mRegistered.store(false, memory_order_release);
+    }
+    mTimeoutRecords.erase(it);
 }
 
 } // namespace logtail
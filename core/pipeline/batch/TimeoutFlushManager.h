@@ -16,13 +16,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "common/CoarseClock.h"
 #include "pipeline/plugin/interface/Flusher.h"
 
 namespace logtail {
@@ -30,15 +35,29 @@ namespace logtail {
 struct TimeoutRecord {
     Flusher* mFlusher = nullptr;
     size_t mKey;
-    time_t mUpdateTime = 0;
+    std::atomic<time_t> mUpdateTime = 0;
     uint32_t mTimeoutSecs = 0;
+    // deadline of the bucket currently holding this record
+    time_t mScheduledDeadline = 0;
+    // cleared once the record is flushed or removed, after which a handle to it can no longer be used for update
+    std::atomic_bool mRegistered = true;
 
     TimeoutRecord(Flusher* flusher, size_t key, uint32_t timeoutSecs)
-        : mFlusher(flusher), mKey(key), mUpdateTime(time(nullptr)), mTimeoutSecs(timeoutSecs) {}
+        : mFlusher(flusher),
+          mKey(key),
+          mUpdateTime(GetCoarseTimeInSeconds()),
+          mTimeoutSecs(timeoutSecs),
+          mScheduledDeadline(GetDeadline()) {}
 
-    void Update() { mUpdateTime = time(nullptr); }
+    void Update() { mUpdateTime.store(GetCoarseTimeInSeconds(), std::memory_order_relaxed); }
+    time_t GetDeadline() const { return mUpdateTime.load(std::memory_order_relaxed) + mTimeoutSecs; }
 };
 
+// Kept by the owner of a batch, so that refreshing a registered record only costs an atomic store. The owner must
+// update the record and flush the batch under the same lock, so that a record unregistered by a concurrent timeout
+// flush never leaves data behind.
+using TimeoutRecordHandle = std::shared_ptr<TimeoutRecord>;
+
 class TimeoutFlushManager {
 public:
     TimeoutFlushManager(const TimeoutFlushManager&) = delete;
@@ -50,15 +69,37 @@ public:
     }
 
     void UpdateRecord(const std::string& config, size_t index, size_t key, uint32_t timeoutSecs, Flusher* f);
+    void UpdateRecord(TimeoutRecordHandle& handle,
+                      const std::string& config,
+                      size_t index,
+                      size_t key,
+                      uint32_t timeoutSecs,
+                      Flusher* f);
     void FlushTimeoutBatch();
     void ClearRecords(const std::string& config);
 
 private:
+    using RecordKey = std::pair<size_t, size_t>;
+
+    struct RecordKeyHash {
+        size_t operator()(const RecordKey& key) const { return key.first * 31 + key.second; }
+    };
+
+    struct TimerEntry {
+        std::string mConfig;
+        RecordKey mKey;
+        TimerEntry(const std::string& config, const RecordKey& key) : mConfig(config), mKey(key) {}
+    };
+
     TimeoutFlushManager() = default;
     ~TimeoutFlushManager() = default;
 
     std::mutex mMux;
-    std::map<std::string, std::map<std::pair<size_t, size_t>, TimeoutRecord>> mTimeoutRecords;
+    std::map<std::string, std::unordered_map<RecordKey, TimeoutRecordHandle, RecordKeyHash>> mTimeoutRecords;
+    // Records are bucketed by deadline, so that each flush only visits the buckets already expired instead of all
+    // records. Updating an existing record only refreshes its update time, and the record is moved to its new bucket
+    // lazily when the old bucket expires. Entries whose record has been cleared or moved are simply dropped.
+    std::map<time_t, std::vector<TimerEntry>> mDeadlineBuckets;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class PipelineUnittest;
@@ -48,6 +48,8 @@ public:
             return  METRIC_COMPONENT_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL;
         } else if (limiter == "logstore") {
             return  METRIC_COMPONENT_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL;
+        } else if (limiter == "shard") {
+            return  METRIC_COMPONENT_FETCH_REJECTED_BY_SHARD_LIMITER_TIMES_TOTAL;
         } 
         return limiter;
     }
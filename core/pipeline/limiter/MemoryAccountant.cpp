@@ -0,0 +1,157 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipeline/limiter/MemoryAccountant.h"
+
+#include <algorithm>
+
+#include "app_config/AppConfig.h"
+#include "common/Flags.h"
+
+DEFINE_FLAG_INT64(memory_budget_mb,
+                  "memory budget for data held in queues, MB. if not positive, it is derived from the memory limit",
+                  0);
+DEFINE_FLAG_DOUBLE(memory_budget_ratio, "ratio of memory limit used as memory budget for data held in queues", 0.5);
+DEFINE_FLAG_DOUBLE(memory_budget_borrow_ratio,
+                   "an account may exceed its share only when global usage is below budget * ratio",
+                   0.8);
+
+using namespace std;
+
+namespace logtail {
+
+MemoryAccount::MemoryAccount(const string& name) : mName(name) {
+    MemoryAccountant::GetInstance()->mAccountCnt.fetch_add(1, memory_order_relaxed);
+}
+
+MemoryAccount::~MemoryAccount() {
+    auto accountant = MemoryAccountant::GetInstance();
+    accountant->mUsedBytes.fetch_sub(mUsedBytes.load(memory_order_relaxed), memory_order_relaxed);
+    accountant->mAccountCnt.fetch_sub(1, memory_order_relaxed);
+}
+
+void MemoryAccount::Charge(size_t bytes) {
+    mUsedBytes.fetch_add(bytes, memory_order_relaxed);
+    MemoryAccountant::GetInstance()->mUsedBytes.fetch_add(bytes, memory_order_relaxed);
+}
+
+void MemoryAccount::Release(size_t bytes) {
+    mUsedBytes.fetch_sub(bytes, memory_order_relaxed);
+    auto accountant = MemoryAccountant::GetInstance();
+    // paired with the fence in AddRejectedFeedbacks, so that either the release sees the rejected queue or the queue
+    // sees the release when checking again
+    accountant->mUsedBytes.fetch_sub(bytes, memory_order_seq_cst);
+    if (accountant->mHasRejectedQueues.load(memory_order_seq_cst)) {
+        accountant->mFeedbackPending.store(true, memory_order_release);
+    }
+}
+
+bool MemoryAccount::IsValidToCharge() const {
+    return MemoryAccountant::GetInstance()->IsValidToCharge(*this);
+}
+
+shared_ptr<MemoryAccount> MemoryAccountant::GetAccount(const string& name) {
+    lock_guard<mutex> lock(mAccountsMux);
+    auto& account = mAccounts[name];
+    auto res = account.lock();
+    if (!res) {
+        res = make_shared<MemoryAccount>(name);
+        account = res;
+    }
+    // clean accounts of removed pipelines occasionally
+    if (mAccounts.size() > 2 * static_cast<size_t>(GetAccountCnt()) + 16) {
+        for (auto it = mAccounts.begin(); it != mAccounts.end();) {
+            if (it->second.expired()) {
+                it = mAccounts.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    return res;
+}
+
+bool MemoryAccountant::IsValidToCharge(const MemoryAccount& account) const {
+    int64_t accountUsed = account.GetUsedBytes();
+    if (accountUsed <= 0) {
+        return true;
+    }
+    int64_t budget = GetBudget();
+    int64_t used = GetUsedBytes();
+    if (used >= budget) {
+        return false;
+    }
+    return accountUsed < GetShare() || used < budget * DOUBLE_FLAG(memory_budget_borrow_ratio);
+}
+
+void MemoryAccountant::AddRejectedFeedbacks(int64_t key,
+                                            const shared_ptr<MemoryAccount>& account,
+                                            const vector<FeedbackInterface*>& feedbacks) {
+    {
+        lock_guard<mutex> lock(mRejectedQueuesMux);
+        auto& item = mRejectedQueues[key];
+        item.mAccount = account;
+        item.mFeedbacks = feedbacks;
+        mHasRejectedQueues.store(true, memory_order_seq_cst);
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+void MemoryAccountant::RemoveRejectedFeedbacks(int64_t key) {
+    lock_guard<mutex> lock(mRejectedQueuesMux);
+    mRejectedQueues.erase(key);
+    mHasRejectedQueues.store(!mRejectedQueues.empty(), memory_order_seq_cst);
+}
+
+void MemoryAccountant::GiveFeedbackIfAdmitted() {
+    if (!mFeedbackPending.load(memory_order_acquire) || !mFeedbackPending.exchange(false, memory_order_acq_rel)) {
+        return;
+    }
+    vector<pair<int64_t, vector<FeedbackInterface*>>> admitted;
+    {
+        lock_guard<mutex> lock(mRejectedQueuesMux);
+        for (auto it = mRejectedQueues.begin(); it != mRejectedQueues.end();) {
+            auto account = it->second.mAccount.lock();
+            if (!account) {
+                it = mRejectedQueues.erase(it);
+            } else if (IsValidToCharge(*account)) {
+                admitted.emplace_back(it->first, std::move(it->second.mFeedbacks));
+                it = mRejectedQueues.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        mHasRejectedQueues.store(!mRejectedQueues.empty(), memory_order_seq_cst);
+    }
+    // given outside the lock, since upstreams may check the queue again in feedback
+    for (auto& item : admitted) {
+        for (auto feedback : item.second) {
+            feedback->Feedback(item.first);
+        }
+    }
+}
+
+int64_t MemoryAccountant::GetShare() const {
+    return GetBudget() / max(1U, GetAccountCnt());
+}
+
+int64_t MemoryAccountant::GetBudget() const {
+    if (INT64_FLAG(memory_budget_mb) > 0) {
+        return INT64_FLAG(memory_budget_mb) * 1024 * 1024;
+    }
+    return static_cast<int64_t>(AppConfig::GetInstance()->GetMemUsageUpLimit() * DOUBLE_FLAG(memory_budget_ratio))
+        * 1024 * 1024;
+}
+
+} // namespace logtail
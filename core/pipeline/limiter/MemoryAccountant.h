@@ -0,0 +1,128 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/FeedbackInterface.h"
+
+namespace logtail {
+
+class MemoryAccountant;
+
+// Bytes held by the queues of one pipeline. Each queue charges bytes when it takes data and releases them when the data
+// leaves, so that the usage is known without walking the queues. Data held outside the queues, e.g. reader caches,
+// batcher buffers and requests being sent, is not accounted.
+class MemoryAccount {
+public:
+    explicit MemoryAccount(const std::string& name);
+    ~MemoryAccount();
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    void Charge(size_t bytes);
+    void Release(size_t bytes);
+    // whether more data can be admitted, see MemoryAccountant::IsValidToCharge
+    bool IsValidToCharge() const;
+
+    const std::string& GetName() const { return mName; }
+    int64_t GetUsedBytes() const { return mUsedBytes.load(std::memory_order_relaxed); }
+
+private:
+    std::string mName;
+    std::atomic_int64_t mUsedBytes = 0;
+};
+
+class MemoryAccountant {
+public:
+    MemoryAccountant(const MemoryAccountant&) = delete;
+    MemoryAccountant& operator=(const MemoryAccountant&) = delete;
+
+    static MemoryAccountant* GetInstance() {
+        static MemoryAccountant instance;
+        return &instance;
+    }
+
+    // accounts with the same name are shared, e.g. by the process queue and sender queues of one pipeline
+    std::shared_ptr<MemoryAccount> GetAccount(const std::string& name);
+
+    // An account is always admitted when it holds nothing, so that a single large item can never be starved.
+    // Otherwise, it is rejected when the global budget is exhausted, or when it exceeds its share (budget divided
+    // evenly among accounts) while the global usage is above the borrow watermark.
+    bool IsValidToCharge(const MemoryAccount& account) const;
+
+    // Upstreams of a queue rejected for memory are notified once it is admitted again. Since a release by any account
+    // may readmit it, this is checked after every release rather than only when the queue itself is popped.
+    void AddRejectedFeedbacks(int64_t key,
+                              const std::shared_ptr<MemoryAccount>& account,
+                              const std::vector<FeedbackInterface*>& feedbacks);
+    void RemoveRejectedFeedbacks(int64_t key);
+    // Releases happen under the locks of queue managers, so they only mark the check as pending. It is done here, which
+    // must be called without any queue lock held, see MemoryFeedbackGuard.
+    void GiveFeedbackIfAdmitted();
+
+    int64_t GetBudget() const;
+    // budget divided evenly among accounts
+    int64_t GetShare() const;
+    int64_t GetUsedBytes() const { return mUsedBytes.load(std::memory_order_relaxed); }
+    uint32_t GetAccountCnt() const { return mAccountCnt.load(std::memory_order_relaxed); }
+
+private:
+    MemoryAccountant() = default;
+    ~MemoryAccountant() = default;
+
+    std::atomic_int64_t mUsedBytes = 0;
+    std::atomic_uint32_t mAccountCnt = 0;
+
+    std::mutex mAccountsMux;
+    std::unordered_map<std::string, std::weak_ptr<MemoryAccount>> mAccounts;
+
+    struct RejectedQueue {
+        std::weak_ptr<MemoryAccount> mAccount;
+        std::vector<FeedbackInterface*> mFeedbacks;
+    };
+    std::atomic_bool mHasRejectedQueues = false;
+    std::atomic_bool mFeedbackPending = false;
+    std::mutex mRejectedQueuesMux;
+    std::unordered_map<int64_t, RejectedQueue> mRejectedQueues;
+
+    friend class MemoryAccount;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class MemoryAccountantUnittest;
+    friend class BoundedProcessQueueUnittest;
+#endif
+};
+
+// Gives the feedbacks pending on memory release when destructed. Declared before the lock guard of a queue manager, so
+// that feedbacks are given after the lock is released.
+class MemoryFeedbackGuard {
+public:
+    MemoryFeedbackGuard() = default;
+    ~MemoryFeedbackGuard() { MemoryAccountant::GetInstance()->GiveFeedbackIfAdmitted(); }
+
+    MemoryFeedbackGuard(const MemoryFeedbackGuard&) = delete;
+    MemoryFeedbackGuard& operator=(const MemoryFeedbackGuard&) = delete;
+};
+
+} // namespace logtail
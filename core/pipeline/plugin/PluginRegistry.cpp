@@ -26,6 +26,9 @@
 #include "app_config/AppConfig.h"
 #include "common/Flags.h"
 #include "plugin/flusher/blackhole/FlusherBlackHole.h"
+#include "plugin/flusher/file/FlusherFile.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "plugin/flusher/prometheus/FlusherPrometheus.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
 #include "plugin/input/InputContainerStdio.h"
 #include "plugin/input/InputFile.h"
@@ -158,6 +161,9 @@ void PluginRegistry::LoadStaticPlugins() {
 
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherSLS>());
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherBlackHole>());
+    RegisterFlusherCreator(new StaticFlusherCreator<FlusherOTLP>());
+    RegisterFlusherCreator(new StaticFlusherCreator<FlusherPrometheus>());
+    RegisterFlusherCreator(new StaticFlusherCreator<FlusherFile>());
 }
 
 void PluginRegistry::LoadDynamicPlugins(const set<string>& plugins) {
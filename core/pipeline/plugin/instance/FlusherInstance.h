@@ -42,6 +42,7 @@ public:
     bool Send(PipelineEventGroup&& g);
     bool FlushAll() { return mPlugin->FlushAll(); }
     QueueKey GetQueueKey() const { return mPlugin->GetQueueKey(); }
+    std::vector<QueueKey> GetQueueKeys() const { return mPlugin->GetQueueKeys(); }
 
 private:
     std::unique_ptr<Flusher> mPlugin;
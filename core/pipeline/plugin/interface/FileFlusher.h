@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "pipeline/plugin/interface/Flusher.h"
+#include "pipeline/queue/SenderQueueItem.h"
+#include "runner/sink/file/FileSinkRequest.h"
+
+namespace logtail {
+
+class FileFlusher : public Flusher {
+public:
+    virtual ~FileFlusher() = default;
+
+    virtual std::unique_ptr<FileSinkRequest> BuildRequest(SenderQueueItem* item) const = 0;
+    // called by the file sink once the data of the item is durable on disk, or failed to be so
+    virtual void OnWriteDone(bool success, const std::string& errorMsg, SenderQueueItem* item) = 0;
+
+    virtual SinkType GetSinkType() override { return SinkType::FILE; }
+};
+
+} // namespace logtail
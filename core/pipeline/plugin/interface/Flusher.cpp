@@ -24,14 +24,18 @@ using namespace std;
 namespace logtail {
 
 bool Flusher::Start() {
-    SenderQueueManager::GetInstance()->ReuseQueue(mQueueKey);
+    for (auto key : GetQueueKeys()) {
+        SenderQueueManager::GetInstance()->ReuseQueue(key);
+    }
     return true;
 }
 
 bool Flusher::Stop(bool isPipelineRemoving) {
     // TODO: temporarily used here
     SetPipelineForItemsWhenStop();
-    SenderQueueManager::GetInstance()->DeleteQueue(mQueueKey);
+    for (auto key : GetQueueKeys()) {
+        SenderQueueManager::GetInstance()->DeleteQueue(key);
+    }
     return true;
 }
 
@@ -42,7 +46,9 @@ void Flusher::SetPipelineForItemsWhenStop() {
             LOG_ERROR(sLogger, ("failed to get pipeline context", "context not found")("action", "not set pipeline"));
             return;
         }
-        SenderQueueManager::GetInstance()->SetPipelineForItems(mQueueKey, pipeline);
+        for (auto key : GetQueueKeys()) {
+            SenderQueueManager::GetInstance()->SetPipelineForItems(key, pipeline);
+        }
     }
 }
 
@@ -88,6 +94,7 @@ void Flusher::DealSenderQueueItemAfterSend(SenderQueueItem* item, bool keep) {
     if (keep) {
         item->mStatus.Set(SendingStatus::IDLE);
         ++item->mTryCnt;
+        SenderQueueManager::GetInstance()->MarkQueueReady(item->mQueueKey);
     } else {
         // TODO: because current profile has a dummy flusher, we have to use item->mQueueKey here
         SenderQueueManager::GetInstance()->RemoveItem(item->mQueueKey, item);
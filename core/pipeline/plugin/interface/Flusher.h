@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "models/PipelineEventGroup.h"
 #include "pipeline/plugin/interface/Plugin.h"
@@ -43,6 +44,8 @@ public:
     virtual SinkType GetSinkType() { return SinkType::NONE; }
 
     QueueKey GetQueueKey() const { return mQueueKey; }
+    // all sender queues owned by the flusher, to be overridden by flushers with more than one queue
+    virtual std::vector<QueueKey> GetQueueKeys() const { return {mQueueKey}; }
     void SetPluginID(const std::string& pluginID) { mPluginID = pluginID; }
     const std::string& GetPluginID() const { return mPluginID; }
 
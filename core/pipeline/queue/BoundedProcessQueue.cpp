@@ -31,14 +31,32 @@ BoundedProcessQueue::BoundedProcessQueue(
     WriteMetrics::GetInstance()->CommitMetricsRecordRef(mMetricsRecordRef);
 }
 
+BoundedProcessQueue::~BoundedProcessQueue() {
+    MemoryAccountant::GetInstance()->RemoveRejectedFeedbacks(mKey);
+}
+
+bool BoundedProcessQueue::IsValidToPush() const {
+    return BoundedQueueInterface::IsValidToPush() && mMemoryAccount->IsValidToCharge();
+}
+
+void BoundedProcessQueue::OnPushRejected() {
+    // when rejected for item count, upstreams are notified on pop as usual
+    if (BoundedQueueInterface::IsValidToPush() && !mMemoryAccount->IsValidToCharge()) {
+        // upstreams are notified by the accountant once memory is released, whichever queue releases it
+        MemoryAccountant::GetInstance()->AddRejectedFeedbacks(mKey, mMemoryAccount, mUpStreamFeedbacks);
+    }
+}
+
 bool BoundedProcessQueue::Push(unique_ptr<ProcessQueueItem>&& item) {
     if (!IsValidToPush()) {
+        OnPushRejected();
         return false;
     }
     item->mEnqueTime = chrono::system_clock::now();
     auto size = item->mEventGroup.DataSize();
     mQueue.push_back(std::move(item));
     ChangeStateIfNeededAfterPush();
+    ChargeMemory(size);
 
     mInItemsTotal->Add(1);
     mInItemDataSizeBytes->Add(size);
@@ -55,6 +73,8 @@ bool BoundedProcessQueue::Pop(unique_ptr<ProcessQueueItem>& item) {
     item = std::move(mQueue.front());
     mQueue.pop_front();
     item->AddPipelineInProcessCnt(GetConfigName());
+    auto size = item->mEventGroup.DataSize();
+    ReleaseMemory(size);
     if (ChangeStateIfNeededAfterPop()) {
         GiveFeedback();
     }
@@ -63,7 +83,7 @@ bool BoundedProcessQueue::Pop(unique_ptr<ProcessQueueItem>& item) {
     mTotalDelayMs->Add(
         chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now() - item->mEnqueTime).count());
     mQueueSizeTotal->Set(Size());
-    mQueueDataSizeByte->Sub(item->mEventGroup.DataSize());
+    mQueueDataSizeByte->Sub(size);
     mValidToPushFlag->Set(IsValidToPush());
     return true;
 }
@@ -33,7 +33,14 @@ class BoundedProcessQueue : public BoundedQueueInterface<std::unique_ptr<Process
 public:
     BoundedProcessQueue(
         size_t cap, size_t low, size_t high, int64_t key, uint32_t priority, const PipelineContext& ctx);
+    ~BoundedProcessQueue() override;
 
+    // besides item count, admission also depends on the memory budget of the pipeline
+    bool IsValidToPush() const override;
+    // Should be called when an upstream is told not to push. If the queue is rejected for memory, the upstreams are
+    // registered with the memory accountant, and the caller should check again since memory may have been released
+    // meanwhile.
+    void OnPushRejected();
     bool Push(std::unique_ptr<ProcessQueueItem>&& item) override;
     bool Pop(std::unique_ptr<ProcessQueueItem>& item) override;
     void SetPipelineForItems(const std::shared_ptr<Pipeline>& p) const override;
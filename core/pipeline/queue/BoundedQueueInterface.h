@@ -33,7 +33,7 @@ public:
     BoundedQueueInterface(const BoundedQueueInterface& que) = delete;
     BoundedQueueInterface& operator=(const BoundedQueueInterface&) = delete;
 
-    bool IsValidToPush() const { return mValidToPush; }
+    virtual bool IsValidToPush() const { return mValidToPush; }
 
 protected:
     bool Full() const { return this->Size() == this->mCapacity; }
@@ -31,11 +31,15 @@ CircularProcessQueue::CircularProcessQueue(size_t cap, int64_t key, uint32_t pri
 
 bool CircularProcessQueue::Push(unique_ptr<ProcessQueueItem>&& item) {
     size_t newCnt = item->mEventGroup.GetEvents().size();
-    while (!mQueue.empty() && mEventCnt + newCnt > mCapacity) {
+    // Old data is discarded either when the queue is full or when the pipeline holds more than its share of the memory
+    // budget. Pressure caused by other pipelines never discards data of this one.
+    int64_t share = MemoryAccountant::GetInstance()->GetShare();
+    while (!mQueue.empty() && (mEventCnt + newCnt > mCapacity || mMemoryAccount->GetUsedBytes() >= share)) {
         auto cnt = mQueue.front()->mEventGroup.GetEvents().size();
         auto size = mQueue.front()->mEventGroup.DataSize();
         mEventCnt -= cnt;
         mQueue.pop_front();
+        ReleaseMemory(size);
         mQueueSizeTotal->Set(Size());
         mQueueDataSizeByte->Sub(size);
         mDiscardedEventsTotal->Add(cnt);
@@ -47,6 +51,7 @@ bool CircularProcessQueue::Push(unique_ptr<ProcessQueueItem>&& item) {
     auto size = item->mEventGroup.DataSize();
     mQueue.push_back(std::move(item));
     mEventCnt += newCnt;
+    ChargeMemory(size);
 
     mInItemsTotal->Add(1);
     mInItemDataSizeBytes->Add(size);
@@ -63,13 +68,15 @@ bool CircularProcessQueue::Pop(unique_ptr<ProcessQueueItem>& item) {
     item->AddPipelineInProcessCnt(GetConfigName());
     mQueue.pop_front();
     mEventCnt -= item->mEventGroup.GetEvents().size();
+    auto size = item->mEventGroup.DataSize();
+    ReleaseMemory(size);
 
     mOutItemsTotal->Add(1);
     mTotalDelayMs->Add(
         std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - item->mEnqueTime)
             .count());
     mQueueSizeTotal->Set(Size());
-    mQueueDataSizeByte->Sub(item->mEventGroup.DataSize());
+    mQueueDataSizeByte->Sub(size);
     return true;
 }
 
@@ -87,6 +94,7 @@ void CircularProcessQueue::Reset(size_t cap) {
     uint32_t cnt = 0;
     while (!mQueue.empty() && mEventCnt > cap) {
         mEventCnt -= mQueue.front()->mEventGroup.GetEvents().size();
+        ReleaseMemory(mQueue.front()->mEventGroup.DataSize());
         mQueue.pop_front();
         ++cnt;
     }
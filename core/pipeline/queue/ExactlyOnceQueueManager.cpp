@@ -17,6 +17,7 @@
 #include "common/Flags.h"
 #include "common/TimeUtil.h"
 #include "logger/Logger.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "pipeline/queue/ProcessQueueManager.h"
 #include "pipeline/queue/QueueKeyManager.h"
 #include "plugin/input/InputFeedbackInterfaceRegistry.h"
@@ -123,6 +124,11 @@ bool ExactlyOnceQueueManager::IsValidToPushProcessQueue(QueueKey key) const {
     if (iter == mProcessQueues.end()) {
         return false;
     }
+    if (iter->second->IsValidToPush()) {
+        return true;
+    }
+    // the upstream stops pushing until notified
+    iter->second->OnPushRejected();
     return iter->second->IsValidToPush();
 }
 
@@ -213,6 +219,7 @@ bool ExactlyOnceQueueManager::IsAllSenderQueueEmpty() const {
 void ExactlyOnceQueueManager::ClearTimeoutQueues() {
     auto const curTime = time(nullptr);
     const auto startTimeMs = GetCurrentTimeInMilliSeconds();
+    MemoryFeedbackGuard feedbackGuard;
     lock_guard<mutex> lock(mGCMux);
     auto iter = mQueueDeletionTimeMap.begin();
     while (iter != mQueueDeletionTimeMap.end()) {
@@ -59,6 +59,7 @@ bool ExactlyOnceSenderQueue::Push(unique_ptr<SenderQueueItem>&& item) {
             // should not happen
             return false;
         }
+        ChargeMemory(item->mData.size());
         item->mEnqueTime = chrono::system_clock::now();
         mQueue[eo->index] = std::move(item);
     } else {
@@ -68,6 +69,7 @@ bool ExactlyOnceSenderQueue::Push(unique_ptr<SenderQueueItem>&& item) {
                 continue;
             }
             item->mEnqueTime = chrono::system_clock::now();
+            ChargeMemory(item->mData.size());
             mQueue[index] = std::move(item);
             auto& newCpt = mRangeCheckpoints[index];
             newCpt->data.set_read_offset(eo->data.read_offset());
@@ -79,6 +81,7 @@ bool ExactlyOnceSenderQueue::Push(unique_ptr<SenderQueueItem>&& item) {
         }
         if (!eo->IsComplete()) {
             item->mEnqueTime = chrono::system_clock::now();
+            ChargeMemory(item->mData.size());
             mExtraBuffer.push_back(std::move(item));
             return true;
         }
@@ -98,10 +101,13 @@ bool ExactlyOnceSenderQueue::Remove(SenderQueueItem* item) {
         // should not happen
         return false;
     }
+    ReleaseMemory(item->mData.size());
     mQueue[eo->index].reset();
     --mSize;
 
     if (!mExtraBuffer.empty()) {
+        // charged again in Push
+        ReleaseMemory(mExtraBuffer.front()->mData.size());
         Push(std::move(mExtraBuffer.front()));
         mExtraBuffer.pop_front();
         return true;
@@ -15,6 +15,8 @@
 #include "pipeline/queue/ProcessQueueManager.h"
 
 #include "common/Flags.h"
+#include "monitor/ResourceGovernor.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "pipeline/queue/BoundedProcessQueue.h"
 #include "pipeline/queue/CircularProcessQueue.h"
 #include "pipeline/queue/ExactlyOnceQueueManager.h"
@@ -85,6 +87,7 @@ bool ProcessQueueManager::CreateOrUpdateCircularQueue(QueueKey key,
 }
 
 bool ProcessQueueManager::DeleteQueue(QueueKey key) {
+    MemoryFeedbackGuard feedbackGuard;
     lock_guard<mutex> lock(mQueueMux);
     auto iter = mQueues.find(key);
     if (iter == mQueues.end()) {
@@ -101,7 +104,13 @@ bool ProcessQueueManager::IsValidToPush(QueueKey key) const {
     auto iter = mQueues.find(key);
     if (iter != mQueues.end()) {
         if (iter->second.second == QueueType::BOUNDED) {
-            return static_cast<BoundedProcessQueue*>(iter->second.first->get())->IsValidToPush();
+            auto queue = static_cast<BoundedProcessQueue*>(iter->second.first->get());
+            if (queue->IsValidToPush()) {
+                return true;
+            }
+            // the upstream stops pushing until notified
+            queue->OnPushRejected();
+            return queue->IsValidToPush();
         } else {
             return true;
         }
@@ -111,6 +120,8 @@ bool ProcessQueueManager::IsValidToPush(QueueKey key) const {
 
 int ProcessQueueManager::PushQueue(QueueKey key, unique_ptr<ProcessQueueItem>&& item) {
     {
+        // circular queues may discard old items on push
+        MemoryFeedbackGuard feedbackGuard;
         lock_guard<mutex> lock(mQueueMux);
         auto iter = mQueues.find(key);
         if (iter != mQueues.end()) {
@@ -130,8 +141,14 @@ int ProcessQueueManager::PushQueue(QueueKey key, unique_ptr<ProcessQueueItem>&&
 
 bool ProcessQueueManager::PopItem(int64_t threadNo, unique_ptr<ProcessQueueItem>& item, string& configName) {
     configName.clear();
+    // queues explicitly configured as low priority are left untouched when resource governor asks to pause them
+    bool lowPriorityPaused = ResourceGovernor::GetInstance()->IsLowPriorityPaused();
+    MemoryFeedbackGuard feedbackGuard;
     lock_guard<mutex> lock(mQueueMux);
     for (size_t i = 0; i <= sMaxPriority; ++i) {
+        if (lowPriorityPaused && i == sLowPriority) {
+            continue;
+        }
         ProcessQueueIterator iter;
         if (mCurrentQueueIndex.first == i) {
             for (iter = mCurrentQueueIndex.second; iter != mPriorityQueue[i].end(); ++iter) {
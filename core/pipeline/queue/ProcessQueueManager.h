@@ -41,6 +41,9 @@ public:
     enum class QueueType { BOUNDED, CIRCULAR };
 
     static constexpr uint32_t sMaxPriority = 3;
+    // Priority of queues explicitly configured with the lowest ProcessPriority, which are paused under resource
+    // pressure. Queues without ProcessPriority are at sMaxPriority and are never paused, since they are the majority.
+    static constexpr uint32_t sLowPriority = sMaxPriority - 1;
 
     ProcessQueueManager(const ProcessQueueManager&) = delete;
     ProcessQueueManager& operator=(const ProcessQueueManager&) = delete;
@@ -97,6 +100,7 @@ private:
     void Clear();
     friend class ProcessQueueManagerUnittest;
     friend class PipelineUnittest;
+    friend class BlockedEventManagerUnittest;
 #endif
 };
 
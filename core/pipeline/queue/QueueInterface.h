@@ -19,6 +19,7 @@
 #include "monitor/LogtailMetric.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "pipeline/PipelineContext.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "pipeline/queue/QueueKey.h"
 
 namespace logtail {
@@ -26,7 +27,8 @@ namespace logtail {
 template <typename T>
 class QueueInterface {
 public:
-    QueueInterface(QueueKey key, size_t cap, const PipelineContext& ctx) : mKey(key), mCapacity(cap) {
+    QueueInterface(QueueKey key, size_t cap, const PipelineContext& ctx)
+        : mKey(key), mCapacity(cap), mMemoryAccount(MemoryAccountant::GetInstance()->GetAccount(ctx.GetConfigName())) {
         WriteMetrics::GetInstance()->CreateMetricsRecordRef(mMetricsRecordRef,
                                                             {
                                                                 {METRIC_LABEL_KEY_PROJECT, ctx.GetProjectName()},
@@ -40,7 +42,7 @@ public:
         mQueueSizeTotal = mMetricsRecordRef.CreateIntGauge(METRIC_COMPONENT_QUEUE_SIZE);
         mQueueDataSizeByte = mMetricsRecordRef.CreateIntGauge(METRIC_COMPONENT_QUEUE_SIZE_BYTES);
     }
-    virtual ~QueueInterface() = default;
+    virtual ~QueueInterface() { mMemoryAccount->Release(mChargedBytes); }
 
     QueueInterface(const QueueInterface& que) = delete;
     QueueInterface& operator=(const QueueInterface&) = delete;
@@ -55,9 +57,23 @@ public:
     void Reset(size_t cap) { mCapacity = cap; }
 
 protected:
+    void ChargeMemory(size_t size) {
+        mMemoryAccount->Charge(size);
+        mChargedBytes += size;
+    }
+
+    void ReleaseMemory(size_t size) {
+        mMemoryAccount->Release(size);
+        mChargedBytes -= size;
+    }
+
     const QueueKey mKey;
     size_t mCapacity = 0;
 
+    // shared by all queues of the same pipeline
+    std::shared_ptr<MemoryAccount> mMemoryAccount;
+    size_t mChargedBytes = 0;
+
     mutable MetricsRecordRef mMetricsRecordRef;
     CounterPtr mInItemsTotal;
     CounterPtr mInItemDataSizeBytes;
@@ -32,6 +32,7 @@ SenderQueue::SenderQueue(
 bool SenderQueue::Push(unique_ptr<SenderQueueItem>&& item) {
     item->mEnqueTime = chrono::system_clock::now();
     auto size = item->mData.size();
+    ChargeMemory(size);
 
     mInItemsTotal->Add(1);
     mInItemDataSizeBytes->Add(size);
@@ -86,6 +87,7 @@ bool SenderQueue::Remove(SenderQueueItem* item) {
         ++mRead;
     }
     --mSize;
+    ReleaseMemory(size);
 
     mOutItemsTotal->Add(1);
     mTotalDelayMs->Add(chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now() - enQueuTime).count());
@@ -93,6 +95,8 @@ bool SenderQueue::Remove(SenderQueueItem* item) {
 
     if (!mExtraBuffer.empty()) {
         auto newSize = mExtraBuffer.front()->mData.size();
+        // charged again in Push
+        ReleaseMemory(newSize);
         Push(std::move(mExtraBuffer.front()));
         mExtraBuffer.pop_front();
 
@@ -112,6 +116,7 @@ bool SenderQueue::Remove(SenderQueueItem* item) {
 
 void SenderQueue::GetAvailableItems(vector<SenderQueueItem*>& items, int32_t limit) {
     mFetchedTimesCnt->Add(1);
+    mIsBlockedByLimiter = false;
     if (Empty()) {
         return;
     }
@@ -139,11 +144,13 @@ void SenderQueue::GetAvailableItems(vector<SenderQueueItem*>& items, int32_t lim
         }
         if (mRateLimiter && !mRateLimiter->IsValidToPop()) {
             mRejectedByRateLimiterCnt->Add(1);
+            mIsBlockedByLimiter = true;
             return;
         }
         for (auto& limiter : mConcurrencyLimiters) {
             if (!limiter.first->IsValidToPop()) {
                 limiter.second->Add(1);
+                mIsBlockedByLimiter = true;
                 return;
             }
         }
@@ -164,6 +171,16 @@ void SenderQueue::GetAvailableItems(vector<SenderQueueItem*>& items, int32_t lim
     }
 }
 
+bool SenderQueue::HasIdleItem() const {
+    for (auto index = mRead; index < mWrite; ++index) {
+        const auto& item = mQueue[index % mCapacity];
+        if (item != nullptr && item->mStatus.Get() == SendingStatus::IDLE) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void SenderQueue::SetPipelineForItems(const std::shared_ptr<Pipeline>& p) const {
     if (Empty()) {
         return;
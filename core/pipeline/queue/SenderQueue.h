@@ -38,6 +38,10 @@ public:
     void GetAvailableItems(std::vector<SenderQueueItem*>& items, int32_t limit) override;
     void SetPipelineForItems(const std::shared_ptr<Pipeline>& p) const override;
 
+    bool HasIdleItem() const;
+    // whether the last call to GetAvailableItems is stopped by limiters
+    bool IsBlockedByLimiter() const { return mIsBlockedByLimiter; }
+
 private:
     size_t Size() const override { return mSize; }
 
@@ -45,6 +49,7 @@ private:
     size_t mWrite = 0;
     size_t mRead = 0;
     size_t mSize = 0;
+    bool mIsBlockedByLimiter = false;
 
     CounterPtr mFetchedTimesCnt;
     CounterPtr mFetchedItemsCnt;
@@ -15,6 +15,7 @@
 #include "pipeline/queue/SenderQueueManager.h"
 
 #include "common/Flags.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "pipeline/queue/ExactlyOnceQueueManager.h"
 #include "pipeline/queue/QueueKeyManager.h"
 
@@ -95,6 +96,7 @@ int SenderQueueManager::PushQueue(QueueKey key, unique_ptr<SenderQueueItem>&& it
             if (!iter->second.Push(std::move(item))) {
                 return 1;
             }
+            MarkQueueReadyWithoutLock(key);
         } else {
             int res = ExactlyOnceQueueManager::GetInstance()->PushSenderQueue(key, std::move(item));
             if (res != 0) {
@@ -113,22 +115,38 @@ void SenderQueueManager::GetAvailableItems(vector<SenderQueueItem*>& items, int3
             return;
         }
         if (itemsCntLimit == -1) {
-            for (auto iter = mQueues.begin(); iter != mQueues.end(); ++iter) {         
+            for (auto iter = mQueues.begin(); iter != mQueues.end(); ++iter) {
                 iter->second.GetAvailableItems(items, -1);
             }
         } else {
-            int cntLimitPerQueue = std::max((int)(mQueueParam.GetCapacity() * 0.3), (int)(itemsCntLimit/mQueues.size()));
-            // must check index before moving iterator
-            mSenderQueueBeginIndex = mSenderQueueBeginIndex % mQueues.size();
-            // here we set sender queue begin index, let the sender order be different each time
-            auto beginIter = mQueues.begin();
-            std::advance(beginIter, mSenderQueueBeginIndex++);
-
-            for (auto iter = beginIter; iter != mQueues.end(); ++iter) {
-                iter->second.GetAvailableItems(items, cntLimitPerQueue);
+            if (!mBlockedQueueKeys.empty() && (mIsLimiterReleased || time(nullptr) != mLastUnblockTime)) {
+                UnblockQueuesWithoutLock();
             }
-            for (auto iter = mQueues.begin(); iter != beginIter; ++iter) {        
-                iter->second.GetAvailableItems(items, cntLimitPerQueue);
+            if (!mReadyQueueKeys.empty()) {
+                int cntLimitPerQueue = std::max((int)(mQueueParam.GetCapacity() * 0.3),
+                                                (int)(itemsCntLimit / mReadyQueueKeys.size()));
+                // each ready queue is visited once, and queues still having items to send are put at the back
+                for (size_t cnt = mReadyQueues.size(); cnt > 0; --cnt) {
+                    auto key = mReadyQueues.front();
+                    mReadyQueues.pop_front();
+                    if (mReadyQueueKeys.erase(key) == 0) {
+                        // stale
+                        continue;
+                    }
+                    auto iter = mQueues.find(key);
+                    if (iter == mQueues.end()) {
+                        continue;
+                    }
+                    iter->second.GetAvailableItems(items, cntLimitPerQueue);
+                    if (!iter->second.HasIdleItem()) {
+                        continue;
+                    }
+                    if (iter->second.IsBlockedByLimiter()) {
+                        mBlockedQueueKeys.insert(key);
+                    } else {
+                        MarkQueueReadyWithoutLock(key);
+                    }
+                }
             }
         }
     }
@@ -136,21 +154,56 @@ void SenderQueueManager::GetAvailableItems(vector<SenderQueueItem*>& items, int3
 }
 
 bool SenderQueueManager::RemoveItem(QueueKey key, SenderQueueItem* item) {
+    // feedbacks of process queues waiting for the released memory are given after all queue locks are released
+    MemoryFeedbackGuard feedbackGuard;
     {
         lock_guard<mutex> lock(mQueueMux);
         auto iter = mQueues.find(key);
         if (iter != mQueues.end()) {
-            return iter->second.Remove(item);
+            if (!iter->second.Remove(item)) {
+                return false;
+            }
+            // items in extra buffer may be moved into the queue
+            MarkQueueReadyWithoutLock(key);
+            mIsLimiterReleased = true;
+            return true;
         }
     }
     return ExactlyOnceQueueManager::GetInstance()->RemoveSenderQueueItem(key, item);
 }
 
+void SenderQueueManager::MarkQueueReady(QueueKey key) {
+    lock_guard<mutex> lock(mQueueMux);
+    if (mQueues.find(key) != mQueues.end()) {
+        MarkQueueReadyWithoutLock(key);
+    }
+}
+
+void SenderQueueManager::MarkQueueReadyWithoutLock(QueueKey key) {
+    if (!mReadyQueueKeys.insert(key).second) {
+        return;
+    }
+    mBlockedQueueKeys.erase(key);
+    mReadyQueues.push_back(key);
+}
+
+void SenderQueueManager::UnblockQueuesWithoutLock() {
+    for (auto key : mBlockedQueueKeys) {
+        if (mReadyQueueKeys.insert(key).second) {
+            mReadyQueues.push_back(key);
+        }
+    }
+    mBlockedQueueKeys.clear();
+    mIsLimiterReleased = false;
+    mLastUnblockTime = time(nullptr);
+}
+
 void SenderQueueManager::DecreaseConcurrencyLimiterInSendingCnt(QueueKey key) {
     lock_guard<mutex> lock(mQueueMux);
     auto iter = mQueues.find(key);
     if (iter != mQueues.end()) {
         iter->second.DecreaseSendingCnt();
+        mIsLimiterReleased = true;
     }
 }
 
@@ -168,6 +221,7 @@ bool SenderQueueManager::IsAllQueueEmpty() const {
 
 void SenderQueueManager::ClearUnusedQueues() {
     auto const curTime = time(nullptr);
+    MemoryFeedbackGuard feedbackGuard;
     lock_guard<mutex> lock(mGCMux);
     auto iter = mQueueDeletionTimeMap.begin();
     while (iter != mQueueDeletionTimeMap.end()) {
@@ -187,6 +241,8 @@ void SenderQueueManager::ClearUnusedQueues() {
                 continue;
             }
             mQueues.erase(itr);
+            mReadyQueueKeys.erase(iter->first);
+            mBlockedQueueKeys.erase(iter->first);
         }
         QueueKeyManager::GetInstance()->RemoveKey(iter->first);
         iter = mQueueDeletionTimeMap.erase(iter);
@@ -238,6 +294,10 @@ void SenderQueueManager::Clear() {
     lock_guard<mutex> lock(mQueueMux);
     mQueues.clear();
     mQueueDeletionTimeMap.clear();
+    mReadyQueues.clear();
+    mReadyQueueKeys.clear();
+    mBlockedQueueKeys.clear();
+    mIsLimiterReleased = false;
 }
 
 bool SenderQueueManager::IsQueueMarkedDeleted(QueueKey key) {
@@ -17,10 +17,12 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/FeedbackInterface.h"
@@ -59,6 +61,8 @@ public:
     int PushQueue(QueueKey key, std::unique_ptr<SenderQueueItem>&& item);
     void GetAvailableItems(std::vector<SenderQueueItem*>& items, int32_t itemsCntLimit);
     bool RemoveItem(QueueKey key, SenderQueueItem* item);
+    // should be called when an item is put back for retry
+    void MarkQueueReady(QueueKey key);
     void DecreaseConcurrencyLimiterInSendingCnt(QueueKey key);
     bool IsAllQueueEmpty() const;
     void ClearUnusedQueues();
@@ -80,10 +84,22 @@ private:
     SenderQueueManager();
     ~SenderQueueManager() = default;
 
+    void MarkQueueReadyWithoutLock(QueueKey key);
+    void UnblockQueuesWithoutLock();
+
     BoundedQueueParam mQueueParam;
 
     mutable std::mutex mQueueMux;
     std::unordered_map<QueueKey, SenderQueue> mQueues;
+    // Only queues which may have items to send are visited when fetching items, in the order they become ready for
+    // fairness. A queue becomes ready when an item is pushed or put back for retry. A queue rejected by its limiters is
+    // blocked until some item is sent, since limiters are shared among queues, or until the next second, since
+    // limiters also recover over time.
+    std::deque<QueueKey> mReadyQueues;
+    std::unordered_set<QueueKey> mReadyQueueKeys;
+    std::unordered_set<QueueKey> mBlockedQueueKeys;
+    bool mIsLimiterReleased = false;
+    time_t mLastUnblockTime = 0;
 
     mutable std::mutex mGCMux;
     std::unordered_map<QueueKey, time_t> mQueueDeletionTimeMap;
@@ -93,7 +109,6 @@ private:
     mutable std::mutex mStateMux;
     mutable std::condition_variable mCond;
     bool mValidToPop = false;
-    size_t mSenderQueueBeginIndex = 0;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class SenderQueueManagerUnittest;
@@ -15,6 +15,7 @@
 #include "pipeline/route/Condition.h"
 
 #include "common/ParamExtractor.h"
+#include "models/LogEvent.h"
 
 using namespace std;
 
@@ -93,6 +94,116 @@ bool TagCondition::Check(const PipelineEventGroup& g) const {
     return g.GetTag(mKey) == mValue;
 }
 
+bool EventFieldCondition::Init(const Json::Value& config, const PipelineContext& ctx) {
+    string errorMsg;
+
+    // Key
+    if (!GetMandatoryStringParam(config, "Match.Key", mKey, errorMsg)) {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           errorMsg,
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+
+    // Value
+    if (!GetMandatoryStringParam(config, "Match.Value", mValue, errorMsg)) {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           errorMsg,
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+
+    // Operator
+    string op = "equal";
+    if (!GetOptionalStringParam(config, "Match.Operator", op, errorMsg)) {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           errorMsg,
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+    if (op == "equal") {
+        mOperator = Operator::EQUAL;
+    } else if (op == "prefix") {
+        mOperator = Operator::PREFIX;
+    } else if (op == "regex") {
+        if (!IsRegexValid(mValue)) {
+            PARAM_ERROR_RETURN(ctx.GetLogger(),
+                               ctx.GetAlarm(),
+                               "string param Match.Value is not a valid regex",
+                               noModule,
+                               ctx.GetConfigName(),
+                               ctx.GetProjectName(),
+                               ctx.GetLogstoreName(),
+                               ctx.GetRegion());
+        }
+        mOperator = Operator::REGEX;
+        mRegex = boost::regex(mValue);
+    } else {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           "string param Match.Operator is not valid",
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+
+    // Negate
+    if (!GetOptionalBoolParam(config, "Match.Negate", mNegate, errorMsg)) {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           errorMsg,
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+
+    return true;
+}
+
+bool EventFieldCondition::Check(const PipelineEventPtr& e) const {
+    const auto* logEvent = e.Get<LogEvent>();
+    if (logEvent == nullptr) {
+        return false;
+    }
+    if (!logEvent->HasContent(mKey)) {
+        return mNegate;
+    }
+    auto content = logEvent->GetContent(mKey);
+    bool matched = false;
+    switch (mOperator) {
+        case Operator::EQUAL:
+            matched = content == mValue;
+            break;
+        case Operator::PREFIX:
+            matched = content.starts_with(mValue);
+            break;
+        case Operator::REGEX: {
+            string exception;
+            matched = BoostRegexMatch(content.data(), content.size(), mRegex, exception);
+            break;
+        }
+        default:
+            break;
+    }
+    return matched != mNegate;
+}
+
 bool Condition::Init(const Json::Value& config, const PipelineContext& ctx) {
     string errorMsg;
 
@@ -122,6 +233,8 @@ bool Condition::Init(const Json::Value& config, const PipelineContext& ctx) {
         mType = Type::EVENT_TYPE;
     } else if (type == "tag") {
         mType = Type::TAG;
+    } else if (type == "event_field") {
+        mType = Type::EVENT_FIELD;
     } else {
         PARAM_ERROR_RETURN(ctx.GetLogger(),
                            ctx.GetAlarm(),
@@ -144,6 +257,11 @@ bool Condition::Init(const Json::Value& config, const PipelineContext& ctx) {
                 return false;
             }
             break;
+        case Type::EVENT_FIELD:
+            if (!mDetail.emplace<EventFieldCondition>().Init(config, ctx)) {
+                return false;
+            }
+            break;
         default:
             return false;
     }
@@ -158,8 +276,16 @@ bool Condition::Check(const PipelineEventGroup& g) const {
         case Type::TAG:
             return get_if<TagCondition>(&mDetail)->Check(g);
         default:
+            // event level conditions never match a group as a whole
             return false;
     }
 }
 
+bool Condition::Check(const PipelineEventPtr& e) const {
+    if (mType != Type::EVENT_FIELD) {
+        return false;
+    }
+    return get_if<EventFieldCondition>(&mDetail)->Check(e);
+}
+
 } // namespace logtail
@@ -18,6 +18,7 @@
 
 #include <json/json.h>
 
+#include <boost/regex.hpp>
 #include <variant>
 
 #include "models/PipelineEventGroup.h"
@@ -53,16 +54,45 @@ private:
 #endif
 };
 
+// checked against each log event rather than the whole group
+class EventFieldCondition {
+public:
+    enum class Operator { EQUAL, PREFIX, REGEX };
+
+    bool Init(const Json::Value& config, const PipelineContext& ctx);
+    bool Check(const PipelineEventPtr& e) const;
+
+    const std::string& GetKey() const { return mKey; }
+    const std::string& GetValue() const { return mValue; }
+    Operator GetOperator() const { return mOperator; }
+    bool IsNegated() const { return mNegate; }
+
+private:
+    std::string mKey;
+    std::string mValue;
+    Operator mOperator = Operator::EQUAL;
+    // matches events without the key as well
+    bool mNegate = false;
+    boost::regex mRegex;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class EventFieldConditionUnittest;
+#endif
+};
+
 class Condition {
 public:
     bool Init(const Json::Value& config, const PipelineContext& ctx);
     bool Check(const PipelineEventGroup& g) const;
+    bool Check(const PipelineEventPtr& e) const;
+    bool IsEventLevel() const { return mType == Type::EVENT_FIELD; }
+    const EventFieldCondition* GetEventFieldCondition() const { return std::get_if<EventFieldCondition>(&mDetail); }
 
 private:
-    enum class Type { EVENT_TYPE, TAG };
+    enum class Type { EVENT_TYPE, TAG, EVENT_FIELD };
 
     Type mType;
-    std::variant<EventTypeCondition, TagCondition> mDetail;
+    std::variant<EventTypeCondition, TagCondition, EventFieldCondition> mDetail;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ConditionUnittest;
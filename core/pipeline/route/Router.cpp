@@ -14,7 +14,10 @@
 
 #include "pipeline/route/Router.h"
 
+#include <algorithm>
+
 #include "common/ParamExtractor.h"
+#include "models/LogEvent.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "pipeline/Pipeline.h"
 #include "pipeline/plugin/interface/Flusher.h"
@@ -26,14 +29,46 @@ namespace logtail {
 bool Router::Init(std::vector<pair<size_t, const Json::Value*>> configs, const PipelineContext& ctx) {
     for (auto& item : configs) {
         if (item.second != nullptr) {
-            mConditions.emplace_back(item.first, Condition());
-            if (!mConditions.back().second.Init(*item.second, ctx)) {
+            Condition cond;
+            if (!cond.Init(*item.second, ctx)) {
                 return false;
             }
+            if (cond.IsEventLevel()) {
+                mEventConditions.emplace_back(item.first, std::move(cond));
+            } else {
+                mConditions.emplace_back(item.first, std::move(cond));
+            }
         } else {
             mAlwaysMatchedFlusherIdx.push_back(item.first);
         }
     }
+    // the exactly once checkpoint of a group covers all its events, so the group cannot be split
+    if (!mEventConditions.empty() && ctx.IsExactlyOnceEnabled()) {
+        PARAM_ERROR_RETURN(ctx.GetLogger(),
+                           ctx.GetAlarm(),
+                           "event_field condition is not supported when exactly once is enabled",
+                           noModule,
+                           ctx.GetConfigName(),
+                           ctx.GetProjectName(),
+                           ctx.GetLogstoreName(),
+                           ctx.GetRegion());
+    }
+    for (size_t i = 0; i < mEventConditions.size(); ++i) {
+        const auto* cond = mEventConditions[i].second.GetEventFieldCondition();
+        if (cond->GetOperator() != EventFieldCondition::Operator::EQUAL || cond->IsNegated()) {
+            mScannedEventConditionIdx.push_back(i);
+            continue;
+        }
+        auto it = find_if(mEqualityIndexes.begin(), mEqualityIndexes.end(), [cond](const EqualityIndex& index) {
+            return index.mKey == cond->GetKey();
+        });
+        if (it == mEqualityIndexes.end()) {
+            mEqualityIndexes.emplace_back();
+            it = prev(mEqualityIndexes.end());
+            it->mKey = cond->GetKey();
+        }
+        it->mValueToConditionIdx[cond->GetValue()].push_back(i);
+    }
 
     WriteMetrics::GetInstance()->PrepareMetricsRecordRef(mMetricsRecordRef,
                                                          {{METRIC_LABEL_KEY_PROJECT, ctx.GetProjectName()},
@@ -51,10 +86,90 @@ vector<size_t> Router::Route(const PipelineEventGroup& g) const {
     vector<size_t> res(mAlwaysMatchedFlusherIdx);
     for (size_t i = 0; i < mConditions.size(); ++i) {
         if (mConditions[i].second.Check(g)) {
-            res.push_back(i);
+            res.push_back(mConditions[i].first);
         }
     }
     return res;
 }
 
+void Router::Route(PipelineEventGroup&& g, vector<pair<size_t, PipelineEventGroup>>& res) const {
+    auto groupFlusherIdx = Route(g);
+
+    vector<EventsContainer> matchedEvents(mEventConditions.size());
+    vector<size_t> matchedIdx;
+    auto& events = g.MutableEvents();
+    size_t unmatchedCnt = 0;
+    for (size_t j = 0; j < events.size(); ++j) {
+        auto& e = events[j];
+        matchedIdx.clear();
+        MatchEventLevelConditions(e, matchedIdx);
+        if (matchedIdx.empty()) {
+            if (unmatchedCnt != j) {
+                events[unmatchedCnt] = std::move(e);
+            }
+            ++unmatchedCnt;
+            continue;
+        }
+        // the event is moved only if no one else needs it
+        size_t copyCnt = groupFlusherIdx.empty() ? matchedIdx.size() - 1 : matchedIdx.size();
+        for (size_t i = 0; i < copyCnt; ++i) {
+            matchedEvents[matchedIdx[i]].emplace_back(e.Copy());
+        }
+        if (groupFlusherIdx.empty()) {
+            matchedEvents[matchedIdx.back()].emplace_back(std::move(e));
+        } else {
+            if (unmatchedCnt != j) {
+                events[unmatchedCnt] = std::move(e);
+            }
+            ++unmatchedCnt;
+        }
+    }
+    events.resize(unmatchedCnt);
+
+    for (size_t i = 0; i < matchedEvents.size(); ++i) {
+        if (matchedEvents[i].empty()) {
+            continue;
+        }
+        PipelineEventGroup subGroup(g.GetSourceBuffer());
+        subGroup.SetAllMetadata(g.GetAllMetadata());
+        subGroup.GetSizedTags() = g.GetSizedTags();
+        for (const auto& buffer : g.GetRetainedSourceBuffers()) {
+            subGroup.RetainSourceBuffer(buffer);
+        }
+        subGroup.SwapEvents(matchedEvents[i]);
+        for (auto& e : subGroup.MutableEvents()) {
+            e->ResetPipelineEventGroup(&subGroup);
+        }
+        res.emplace_back(mEventConditions[i].first, std::move(subGroup));
+    }
+    for (size_t i = 0; i < groupFlusherIdx.size(); ++i) {
+        if (i + 1 != groupFlusherIdx.size()) {
+            res.emplace_back(groupFlusherIdx[i], g.Copy());
+        } else {
+            res.emplace_back(groupFlusherIdx[i], std::move(g));
+        }
+    }
+}
+
+void Router::MatchEventLevelConditions(const PipelineEventPtr& e, vector<size_t>& res) const {
+    const auto* logEvent = e.Get<LogEvent>();
+    if (logEvent == nullptr) {
+        return;
+    }
+    for (const auto& index : mEqualityIndexes) {
+        if (!logEvent->HasContent(index.mKey)) {
+            continue;
+        }
+        auto it = index.mValueToConditionIdx.find(logEvent->GetContent(index.mKey));
+        if (it != index.mValueToConditionIdx.end()) {
+            res.insert(res.end(), it->second.begin(), it->second.end());
+        }
+    }
+    for (auto idx : mScannedEventConditionIdx) {
+        if (mEventConditions[idx].second.Check(e)) {
+            res.push_back(idx);
+        }
+    }
+}
+
 } // namespace logtail
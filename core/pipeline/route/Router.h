@@ -18,7 +18,10 @@
 
 #include <json/json.h>
 
+#include <functional>
+#include <map>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "models/PipelineEventGroup.h"
@@ -32,11 +35,30 @@ class Flusher;
 class Router {
 public:
     bool Init(std::vector<std::pair<size_t, const Json::Value*>> config, const PipelineContext& ctx);
+    // only conditions on the group as a whole are considered
     std::vector<size_t> Route(const PipelineEventGroup& g) const;
 
+    bool HasEventLevelCondition() const { return !mEventConditions.empty(); }
+    // Events matching an event level condition are moved into a sub group of the group, which shares the source
+    // buffer with the original one. Events only get copied when they are needed by more than one flusher, and even so,
+    // the fields still refer to the source buffer. Flushers matched by the whole group get the rest of it.
+    void Route(PipelineEventGroup&& g, std::vector<std::pair<size_t, PipelineEventGroup>>& res) const;
+
 private:
+    // equality conditions on the same key are checked by one lookup of the field value
+    struct EqualityIndex {
+        std::string mKey;
+        std::map<std::string, std::vector<size_t>, std::less<>> mValueToConditionIdx;
+    };
+
+    void MatchEventLevelConditions(const PipelineEventPtr& e, std::vector<size_t>& res) const;
+
     std::vector<std::pair<size_t, Condition>> mConditions;
     std::vector<size_t> mAlwaysMatchedFlusherIdx;
+    std::vector<std::pair<size_t, Condition>> mEventConditions;
+    std::vector<EqualityIndex> mEqualityIndexes;
+    // idx of event level conditions not covered by mEqualityIndexes
+    std::vector<size_t> mScannedEventConditionIdx;
 
     mutable MetricsRecordRef mMetricsRecordRef;
     CounterPtr mInEventsTotal;
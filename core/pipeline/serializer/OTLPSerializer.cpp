@@ -0,0 +1,350 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipeline/serializer/OTLPSerializer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/Flags.h"
+#include "common/StringTools.h"
+#include "models/LogEvent.h"
+#include "models/MetricEvent.h"
+#include "models/SpanEvent.h"
+#include "pipeline/serializer/ProtobufWriter.h"
+
+DECLARE_FLAG_INT32(max_send_log_group_size);
+
+using namespace std;
+
+namespace logtail {
+
+namespace {
+
+// field numbers are taken from opentelemetry/proto v1
+namespace field {
+// Export*ServiceRequest.resource_*, Resource*.resource/scope_*, Scope*.scope/records
+constexpr uint32_t kResourceData = 1;
+constexpr uint32_t kResource = 1;
+constexpr uint32_t kScopeData = 2;
+constexpr uint32_t kScope = 1;
+constexpr uint32_t kRecord = 2;
+// Resource.attributes
+constexpr uint32_t kResourceAttributes = 1;
+// InstrumentationScope
+constexpr uint32_t kScopeName = 1;
+constexpr uint32_t kScopeVersion = 2;
+constexpr uint32_t kScopeAttributes = 3;
+// KeyValue and AnyValue
+constexpr uint32_t kKey = 1;
+constexpr uint32_t kValue = 2;
+constexpr uint32_t kStringValue = 1;
+// LogRecord
+constexpr uint32_t kLogTime = 1;
+constexpr uint32_t kLogBody = 5;
+constexpr uint32_t kLogAttributes = 6;
+constexpr uint32_t kLogObservedTime = 11;
+// Metric, Gauge and NumberDataPoint
+constexpr uint32_t kMetricName = 1;
+constexpr uint32_t kMetricGauge = 5;
+constexpr uint32_t kGaugeDataPoint = 1;
+constexpr uint32_t kPointTime = 3;
+constexpr uint32_t kPointDouble = 4;
+constexpr uint32_t kPointAttributes = 7;
+// Span
+constexpr uint32_t kSpanTraceId = 1;
+constexpr uint32_t kSpanSpanId = 2;
+constexpr uint32_t kSpanTraceState = 3;
+constexpr uint32_t kSpanParentSpanId = 4;
+constexpr uint32_t kSpanName = 5;
+constexpr uint32_t kSpanKind = 6;
+constexpr uint32_t kSpanStartTime = 7;
+constexpr uint32_t kSpanEndTime = 8;
+constexpr uint32_t kSpanAttributes = 9;
+constexpr uint32_t kSpanEvent = 11;
+constexpr uint32_t kSpanLink = 13;
+constexpr uint32_t kSpanStatus = 15;
+// Span.Event
+constexpr uint32_t kEventTime = 1;
+constexpr uint32_t kEventName = 2;
+constexpr uint32_t kEventAttributes = 3;
+// Span.Link
+constexpr uint32_t kLinkTraceId = 1;
+constexpr uint32_t kLinkSpanId = 2;
+constexpr uint32_t kLinkTraceState = 3;
+constexpr uint32_t kLinkAttributes = 4;
+// Status
+constexpr uint32_t kStatusCode = 3;
+} // namespace field
+
+// OTLP specific helpers on top of the plain protobuf wire format
+class OTLPProtobufWriter : public ProtobufWriter {
+public:
+    explicit OTLPProtobufWriter(string& buf) : ProtobufWriter(buf) {}
+
+    void WriteAttribute(uint32_t field, StringView key, StringView value) {
+        auto kv = BeginMessage(field);
+        WriteBytes(field::kKey, key);
+        auto anyValue = BeginMessage(field::kValue);
+        WriteBytes(field::kStringValue, value);
+        EndMessage(anyValue);
+        EndMessage(kv);
+    }
+
+    template <typename Iterator>
+    void WriteAttributes(uint32_t field, Iterator begin, Iterator end) {
+        for (auto it = begin; it != end; ++it) {
+            WriteAttribute(field, it->first, it->second);
+        }
+    }
+
+    // trace and span ids are kept as hex strings in events, while OTLP expects raw bytes
+    void WriteId(uint32_t field, StringView id) {
+        if (id.empty()) {
+            return;
+        }
+        if (id.size() % 2 != 0
+            || !all_of(id.begin(), id.end(), [](char c) { return isxdigit(static_cast<unsigned char>(c)); })) {
+            WriteBytes(field, id);
+            return;
+        }
+        WriteTag(field, LENGTH_DELIMITED);
+        PutVarint(id.size() / 2);
+        for (size_t i = 0; i < id.size(); i += 2) {
+            mBuf.push_back(static_cast<char>((HexValue(id[i]) << 4) | HexValue(id[i + 1])));
+        }
+    }
+
+private:
+    static uint8_t HexValue(char c) {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        return (c | 0x20) - 'a' + 10;
+    }
+};
+
+uint64_t GetTimeUnixNano(const PipelineEvent& e) {
+    auto ns = e.GetTimestampNanosecond();
+    return static_cast<uint64_t>(e.GetTimestamp()) * 1000000000ULL + (ns ? ns.value() : 0);
+}
+
+void WriteLogRecord(OTLPProtobufWriter& writer, const LogEvent& e) {
+    static const StringView sBodyKey = "content";
+
+    auto record = writer.BeginMessage(field::kRecord);
+    uint64_t time = GetTimeUnixNano(e);
+    writer.WriteFixed64(field::kLogTime, time);
+    writer.WriteFixed64(field::kLogObservedTime, time);
+    for (const auto& kv : e) {
+        if (kv.first == sBodyKey) {
+            auto body = writer.BeginMessage(field::kLogBody);
+            writer.WriteBytes(field::kStringValue, kv.second);
+            writer.EndMessage(body);
+        } else {
+            writer.WriteAttribute(field::kLogAttributes, kv.first, kv.second);
+        }
+    }
+    writer.EndMessage(record);
+}
+
+void WriteMetric(OTLPProtobufWriter& writer, const MetricEvent& e) {
+    auto metric = writer.BeginMessage(field::kRecord);
+    writer.WriteString(field::kMetricName, e.GetName());
+    auto gauge = writer.BeginMessage(field::kMetricGauge);
+    auto point = writer.BeginMessage(field::kGaugeDataPoint);
+    writer.WriteFixed64(field::kPointTime, GetTimeUnixNano(e));
+    writer.WriteDouble(field::kPointDouble, e.GetValue<UntypedSingleValue>()->mValue);
+    writer.WriteAttributes(field::kPointAttributes, e.TagsBegin(), e.TagsEnd());
+    writer.EndMessage(point);
+    writer.EndMessage(gauge);
+    writer.EndMessage(metric);
+}
+
+void WriteSpan(OTLPProtobufWriter& writer, const SpanEvent& e) {
+    auto span = writer.BeginMessage(field::kRecord);
+    writer.WriteId(field::kSpanTraceId, e.GetTraceId());
+    writer.WriteId(field::kSpanSpanId, e.GetSpanId());
+    writer.WriteString(field::kSpanTraceState, e.GetTraceState());
+    writer.WriteId(field::kSpanParentSpanId, e.GetParentSpanId());
+    writer.WriteString(field::kSpanName, e.GetName());
+    if (e.GetKind() != SpanEvent::Kind::Unspecified) {
+        // SpanEvent::Kind has the same order as OTLP SpanKind
+        writer.WriteVarint(field::kSpanKind, static_cast<uint64_t>(e.GetKind()));
+    }
+    writer.WriteFixed64(field::kSpanStartTime, e.GetStartTimeNs());
+    writer.WriteFixed64(field::kSpanEndTime, e.GetEndTimeNs());
+    writer.WriteAttributes(field::kSpanAttributes, e.TagsBegin(), e.TagsEnd());
+    for (const auto& inner : e.GetEvents()) {
+        auto event = writer.BeginMessage(field::kSpanEvent);
+        writer.WriteFixed64(field::kEventTime, inner.GetTimestampNs());
+        writer.WriteString(field::kEventName, inner.GetName());
+        writer.WriteAttributes(field::kEventAttributes, inner.TagsBegin(), inner.TagsEnd());
+        writer.EndMessage(event);
+    }
+    for (const auto& l : e.GetLinks()) {
+        auto link = writer.BeginMessage(field::kSpanLink);
+        writer.WriteId(field::kLinkTraceId, l.GetTraceId());
+        writer.WriteId(field::kLinkSpanId, l.GetSpanId());
+        writer.WriteString(field::kLinkTraceState, l.GetTraceState());
+        writer.WriteAttributes(field::kLinkAttributes, l.TagsBegin(), l.TagsEnd());
+        writer.EndMessage(link);
+    }
+    if (e.GetStatus() != SpanEvent::StatusCode::Unset) {
+        // SpanEvent::StatusCode has the same order as OTLP Status.StatusCode
+        auto status = writer.BeginMessage(field::kSpanStatus);
+        writer.WriteVarint(field::kStatusCode, static_cast<uint64_t>(e.GetStatus()));
+        writer.EndMessage(status);
+    }
+    writer.EndMessage(span);
+}
+
+void WriteScope(OTLPProtobufWriter& writer, const SpanEvent& e) {
+    if (e.ScopeTagsSize() == 0) {
+        return;
+    }
+    auto scope = writer.BeginMessage(field::kScope);
+    for (auto it = e.ScopeTagsBegin(); it != e.ScopeTagsEnd(); ++it) {
+        if (it->first == SpanEvent::OTLP_SCOPE_NAME) {
+            writer.WriteString(field::kScopeName, it->second);
+        } else if (it->first == SpanEvent::OTLP_SCOPE_VERSION) {
+            writer.WriteString(field::kScopeVersion, it->second);
+        } else {
+            writer.WriteAttribute(field::kScopeAttributes, it->first, it->second);
+        }
+    }
+    writer.EndMessage(scope);
+}
+
+bool IsSameScope(const SpanEvent& a, const SpanEvent& b) {
+    return a.ScopeTagsSize() == b.ScopeTagsSize() && equal(a.ScopeTagsBegin(), a.ScopeTagsEnd(), b.ScopeTagsBegin());
+}
+
+} // namespace
+
+OTLPSignal GetOTLPSignal(const BatchedEvents& batch) {
+    if (batch.mEvents.empty()) {
+        return OTLPSignal::UNKNOWN;
+    }
+    const auto& e = batch.mEvents[0];
+    if (e.Is<LogEvent>()) {
+        return OTLPSignal::LOGS;
+    }
+    if (e.Is<MetricEvent>()) {
+        return OTLPSignal::METRICS;
+    }
+    if (e.Is<SpanEvent>()) {
+        return OTLPSignal::TRACES;
+    }
+    return OTLPSignal::UNKNOWN;
+}
+
+void SplitBySignal(BatchedEvents&& batch, vector<BatchedEvents>& res) {
+    const auto& events = batch.mEvents;
+    if (all_of(events.begin(), events.end(), [&events](const PipelineEventPtr& e) {
+            return e->GetType() == events[0]->GetType();
+        })) {
+        res.emplace_back(std::move(batch));
+        return;
+    }
+    size_t begin = res.size();
+    for (auto& e : batch.mEvents) {
+        auto it = find_if(res.begin() + begin, res.end(), [&e](const BatchedEvents& item) {
+            return item.mEvents[0]->GetType() == e->GetType();
+        });
+        if (it == res.end()) {
+            res.emplace_back();
+            it = prev(res.end());
+            it->mTags = batch.mTags;
+            it->mSourceBuffers = batch.mSourceBuffers;
+            it->mSizeBytes = sizeof(decltype(it->mEvents)) + it->mTags.DataSize();
+        }
+        it->mSizeBytes += e->DataSize();
+        it->mEvents.emplace_back(std::move(e));
+    }
+}
+
+bool OTLPEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, string& errorMsg) {
+    auto signal = GetOTLPSignal(group);
+    if (signal == OTLPSignal::UNKNOWN) {
+        errorMsg = group.mEvents.empty() ? "empty event group" : "unsupported event type in event group";
+        return false;
+    }
+    for (const auto& e : group.mEvents) {
+        if (e->GetType() != group.mEvents[0]->GetType()) {
+            errorMsg = "mixed event types in event group";
+            return false;
+        }
+    }
+
+    res.clear();
+    res.reserve(group.mSizeBytes + group.mSizeBytes / 4);
+    OTLPProtobufWriter writer(res);
+    auto resourceData = writer.BeginMessage(field::kResourceData);
+    if (!group.mTags.mInner.empty()) {
+        auto resource = writer.BeginMessage(field::kResource);
+        writer.WriteAttributes(field::kResourceAttributes, group.mTags.mInner.begin(), group.mTags.mInner.end());
+        writer.EndMessage(resource);
+    }
+    switch (signal) {
+        case OTLPSignal::LOGS: {
+            auto scopeData = writer.BeginMessage(field::kScopeData);
+            for (const auto& e : group.mEvents) {
+                WriteLogRecord(writer, e.Cast<LogEvent>());
+            }
+            writer.EndMessage(scopeData);
+            break;
+        }
+        case OTLPSignal::METRICS: {
+            auto scopeData = writer.BeginMessage(field::kScopeData);
+            for (const auto& e : group.mEvents) {
+                const auto& metricEvent = e.Cast<MetricEvent>();
+                if (metricEvent.Is<UntypedSingleValue>()) {
+                    WriteMetric(writer, metricEvent);
+                }
+            }
+            writer.EndMessage(scopeData);
+            break;
+        }
+        default: {
+            // spans of the same scope are usually adjacent, so a new ScopeSpans is started only when the scope changes
+            const SpanEvent* last = nullptr;
+            size_t scopeData = 0;
+            for (const auto& e : group.mEvents) {
+                const auto& spanEvent = e.Cast<SpanEvent>();
+                if (last == nullptr || !IsSameScope(*last, spanEvent)) {
+                    if (last != nullptr) {
+                        writer.EndMessage(scopeData);
+                    }
+                    scopeData = writer.BeginMessage(field::kScopeData);
+                    WriteScope(writer, spanEvent);
+                }
+                WriteSpan(writer, spanEvent);
+                last = &spanEvent;
+            }
+            writer.EndMessage(scopeData);
+            break;
+        }
+    }
+    writer.EndMessage(resourceData);
+
+    if (res.size() > static_cast<size_t>(INT32_FLAG(max_send_log_group_size))) {
+        errorMsg = "event group exceeds size limit\tgroup size: " + ToString(res.size())
+            + "\tsize limit: " + ToString(INT32_FLAG(max_send_log_group_size));
+        return false;
+    }
+    return true;
+}
+
+} // namespace logtail
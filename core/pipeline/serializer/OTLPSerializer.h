@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "pipeline/serializer/Serializer.h"
+
+namespace logtail {
+
+enum class OTLPSignal { UNKNOWN, LOGS, METRICS, TRACES };
+
+// the signal of a batch is decided by its first event, since each OTLP request carries only one signal
+OTLPSignal GetOTLPSignal(const BatchedEvents& batch);
+
+// An OTLP request carries only one signal, so a batch with events of different types is split into one batch per type.
+// The batches split share the tags and source buffers of the original one.
+void SplitBySignal(BatchedEvents&& batch, std::vector<BatchedEvents>& res);
+
+// Serializes a batch into ExportLogsServiceRequest, ExportMetricsServiceRequest or ExportTraceServiceRequest in
+// protobuf wire format. Fields are written directly from the events, without building the generated OTLP messages
+// first.
+//
+// Mapping:
+// 1. group tags are written as resource attributes
+// 2. log contents are written as attributes, except that the content with key "content" is written as the body
+// 3. metrics with untyped single value are written as gauges, and metrics with no value are skipped
+// 4. span scope tags are written as instrumentation scope, and hex trace/span ids are written as raw bytes
+class OTLPEventGroupSerializer : public Serializer<BatchedEvents> {
+public:
+    OTLPEventGroupSerializer(Flusher* f) : Serializer<BatchedEvents>(f) {}
+
+private:
+    bool Serialize(BatchedEvents&& p, std::string& res, std::string& errorMsg) override;
+};
+
+} // namespace logtail
@@ -0,0 +1,203 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipeline/serializer/PrometheusSerializer.h"
+
+#include <algorithm>
+
+#include "common/xxhash/xxhash.h"
+#include "pipeline/serializer/ProtobufWriter.h"
+
+using namespace std;
+
+namespace logtail {
+
+namespace {
+
+// field numbers are taken from prometheus/prompb
+namespace field {
+// WriteRequest
+constexpr uint32_t kTimeseries = 1;
+// TimeSeries
+constexpr uint32_t kLabels = 1;
+constexpr uint32_t kSamples = 2;
+// Label
+constexpr uint32_t kLabelName = 1;
+constexpr uint32_t kLabelValue = 2;
+// Sample
+constexpr uint32_t kSampleValue = 1;
+constexpr uint32_t kSampleTimestamp = 2;
+} // namespace field
+
+const StringView kNameLabel = "__name__";
+
+} // namespace
+
+void GetSeriesLabels(const MetricEvent& e, const GroupTags& groupTags, SeriesLabels& labels) {
+    labels.clear();
+    // both tag maps are sorted by name, so they can be merged in one pass
+    auto it = e.TagsBegin();
+    auto groupIt = groupTags.begin();
+    while (it != e.TagsEnd() || groupIt != groupTags.end()) {
+        if (groupIt == groupTags.end() || (it != e.TagsEnd() && it->first <= groupIt->first)) {
+            if (groupIt != groupTags.end() && it->first == groupIt->first) {
+                ++groupIt;
+            }
+            if (!it->second.empty()) {
+                labels.emplace_back(it->first, it->second);
+            }
+            ++it;
+        } else {
+            if (!groupIt->second.empty()) {
+                labels.emplace_back(groupIt->first, groupIt->second);
+            }
+            ++groupIt;
+        }
+    }
+    auto pos = lower_bound(labels.begin(), labels.end(), kNameLabel, [](const auto& label, StringView name) {
+        return label.first < name;
+    });
+    if ((pos == labels.end() || pos->first != kNameLabel) && !e.GetName().empty()) {
+        labels.emplace(pos, kNameLabel, e.GetName());
+    }
+}
+
+uint64_t GetSeriesHash(const SeriesLabels& labels) {
+    // each field is chained as the seed of the next one, so that field boundaries are also reflected in the hash
+    uint64_t seed = 0;
+    for (const auto& label : labels) {
+        seed = XXH64(label.first.data(), label.first.size(), seed);
+        seed = XXH64(label.second.data(), label.second.size(), seed);
+    }
+    return seed;
+}
+
+RemoteWriteBatch::Series& RemoteWriteBatch::GetSeries(uint64_t seriesHash, const string& labels, bool& inserted) {
+    auto range = mSeriesIndex.equal_range(seriesHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (mSeries[it->second].mLabels == labels) {
+            inserted = false;
+            return mSeries[it->second];
+        }
+    }
+    inserted = true;
+    mSeriesIndex.emplace(seriesHash, mSeries.size());
+    mSeries.emplace_back();
+    mSeries.back().mHash = seriesHash;
+    return mSeries.back();
+}
+
+void RemoteWriteBatch::AddSample(uint64_t seriesHash, const SeriesLabels& labels, double value, int64_t timestampMs) {
+    mLabelsBuffer.clear();
+    ProtobufWriter writer(mLabelsBuffer);
+    for (const auto& label : labels) {
+        auto begin = writer.BeginMessage(field::kLabels);
+        writer.WriteBytes(field::kLabelName, label.first);
+        writer.WriteBytes(field::kLabelValue, label.second);
+        writer.EndMessage(begin);
+    }
+    bool inserted = false;
+    Series& series = GetSeries(seriesHash, mLabelsBuffer, inserted);
+    if (inserted) {
+        series.mLabels = mLabelsBuffer;
+        mDataSize += series.mLabels.size();
+    }
+    series.mSamples.emplace_back(value, timestampMs);
+    mDataSize += sizeof(series.mSamples[0]);
+    ++mSampleCnt;
+}
+
+void RemoteWriteBatch::Merge(RemoteWriteBatch&& other) {
+    if (Empty()) {
+        *this = std::move(other);
+        other.Clear();
+        return;
+    }
+    for (auto& item : other.mSeries) {
+        bool inserted = false;
+        Series& series = GetSeries(item.mHash, item.mLabels, inserted);
+        mDataSize += item.mSamples.size() * sizeof(item.mSamples[0]);
+        if (inserted) {
+            mDataSize += item.mLabels.size();
+            series.mLabels = std::move(item.mLabels);
+            series.mSamples = std::move(item.mSamples);
+        } else {
+            // labels of an existing series are not counted again
+            series.mSamples.insert(series.mSamples.end(), item.mSamples.begin(), item.mSamples.end());
+        }
+    }
+    mSampleCnt += other.mSampleCnt;
+    other.Clear();
+}
+
+void RemoteWriteBatch::Split(size_t maxSampleCnt, vector<RemoteWriteBatch>& res) {
+    if (maxSampleCnt == 0 || mSampleCnt <= maxSampleCnt) {
+        res.emplace_back(std::move(*this));
+        Clear();
+        return;
+    }
+    RemoteWriteBatch chunk;
+    for (auto& series : mSeries) {
+        size_t pos = 0;
+        while (pos < series.mSamples.size()) {
+            size_t cnt = min(series.mSamples.size() - pos, maxSampleCnt - chunk.mSampleCnt);
+            bool inserted = false;
+            Series& target = chunk.GetSeries(series.mHash, series.mLabels, inserted);
+            target.mLabels = series.mLabels;
+            target.mSamples.assign(series.mSamples.begin() + pos, series.mSamples.begin() + pos + cnt);
+            chunk.mDataSize += target.mLabels.size() + cnt * sizeof(series.mSamples[0]);
+            chunk.mSampleCnt += cnt;
+            pos += cnt;
+            if (chunk.mSampleCnt == maxSampleCnt) {
+                res.emplace_back(std::move(chunk));
+                chunk.Clear();
+            }
+        }
+    }
+    if (!chunk.Empty()) {
+        res.emplace_back(std::move(chunk));
+    }
+    Clear();
+}
+
+void RemoteWriteBatch::Clear() {
+    mSeries.clear();
+    mSeriesIndex.clear();
+    mSampleCnt = 0;
+    mDataSize = 0;
+}
+
+bool RemoteWriteSerializer::Serialize(RemoteWriteBatch&& p, string& res, string& errorMsg) {
+    if (p.Empty()) {
+        errorMsg = "empty batch";
+        return false;
+    }
+    res.clear();
+    res.reserve(p.DataSize() + p.SeriesCnt() * 8 + p.SampleCnt() * 4);
+    ProtobufWriter writer(res);
+    for (const auto& series : p.mSeries) {
+        auto ts = writer.BeginMessage(field::kTimeseries);
+        writer.WriteRaw(series.mLabels);
+        for (const auto& sample : series.mSamples) {
+            auto begin = writer.BeginMessage(field::kSamples);
+            writer.WriteDouble(field::kSampleValue, sample.first);
+            writer.WriteVarint(field::kSampleTimestamp, static_cast<uint64_t>(sample.second));
+            writer.EndMessage(begin);
+        }
+        writer.EndMessage(ts);
+    }
+    return true;
+}
+
+} // namespace logtail
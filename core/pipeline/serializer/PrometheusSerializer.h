@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "models/MetricEvent.h"
+#include "pipeline/serializer/Serializer.h"
+
+namespace logtail {
+
+using SeriesLabels = std::vector<std::pair<StringView, StringView>>;
+
+// Collects the labels of the series that the metric belongs to, sorted by name as remote write requires. Group tags
+// are included unless overridden by event tags, __name__ is taken from the metric name if not set as a tag, and labels
+// with empty value are dropped.
+void GetSeriesLabels(const MetricEvent& e, const GroupTags& groupTags, SeriesLabels& labels);
+
+// identifies a series, labels must be sorted by name
+uint64_t GetSeriesHash(const SeriesLabels& labels);
+
+// Samples grouped by series, with the labels of each series encoded once when the series is first seen. Series are
+// looked up by their label hash, and told apart by their encoded labels when hashes collide.
+class RemoteWriteBatch {
+public:
+    void AddSample(uint64_t seriesHash, const SeriesLabels& labels, double value, int64_t timestampMs);
+    void Merge(RemoteWriteBatch&& other);
+    // Moves the samples into batches of at most maxSampleCnt samples each, appended to res. A series may be split
+    // across batches, in which case its labels are copied to each of them.
+    void Split(size_t maxSampleCnt, std::vector<RemoteWriteBatch>& res);
+    void Clear();
+
+    bool Empty() const { return mSampleCnt == 0; }
+    size_t SampleCnt() const { return mSampleCnt; }
+    size_t SeriesCnt() const { return mSeries.size(); }
+    size_t DataSize() const { return mDataSize; }
+
+private:
+    struct Series {
+        uint64_t mHash = 0;
+        // encoded TimeSeries.labels fields
+        std::string mLabels;
+        std::vector<std::pair<double, int64_t>> mSamples;
+    };
+
+    // labels of a new series are left to the caller
+    Series& GetSeries(uint64_t seriesHash, const std::string& labels, bool& inserted);
+
+    std::vector<Series> mSeries;
+    std::unordered_multimap<uint64_t, size_t> mSeriesIndex;
+    // labels of the sample being added, encoded before lookup
+    std::string mLabelsBuffer;
+    size_t mSampleCnt = 0;
+    size_t mDataSize = 0;
+
+    friend class RemoteWriteSerializer;
+};
+
+inline size_t GetInputSize(const RemoteWriteBatch& p) {
+    return p.DataSize();
+}
+
+// Serializes a batch into prometheus remote write WriteRequest (v1) in protobuf wire format, with one TimeSeries per
+// series. Compression is left to the caller, since remote write requires snappy block format.
+class RemoteWriteSerializer : public Serializer<RemoteWriteBatch> {
+public:
+    RemoteWriteSerializer(Flusher* f) : Serializer<RemoteWriteBatch>(f) {}
+
+private:
+    bool Serialize(RemoteWriteBatch&& p, std::string& res, std::string& errorMsg) override;
+};
+
+} // namespace logtail
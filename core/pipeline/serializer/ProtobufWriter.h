@@ -0,0 +1,108 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "models/StringView.h"
+
+namespace logtail {
+
+// Appends protobuf wire format to a string. A nested message reserves one byte for its length, which is widened in
+// place when the message is closed, so that messages need not be sized beforehand.
+class ProtobufWriter {
+public:
+    explicit ProtobufWriter(std::string& buf) : mBuf(buf) {}
+
+    void WriteVarint(uint32_t field, uint64_t v) {
+        WriteTag(field, VARINT);
+        PutVarint(v);
+    }
+
+    void WriteFixed64(uint32_t field, uint64_t v) {
+        WriteTag(field, FIXED64);
+        for (int i = 0; i < 8; ++i) {
+            mBuf.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void WriteDouble(uint32_t field, double v) {
+        uint64_t bits = 0;
+        memcpy(&bits, &v, sizeof(bits));
+        WriteFixed64(field, bits);
+    }
+
+    void WriteBytes(uint32_t field, StringView s) {
+        WriteTag(field, LENGTH_DELIMITED);
+        PutVarint(s.size());
+        mBuf.append(s.data(), s.size());
+    }
+
+    // empty strings are default values in proto3, so they are omitted
+    void WriteString(uint32_t field, StringView s) {
+        if (!s.empty()) {
+            WriteBytes(field, s);
+        }
+    }
+
+    // returns the position where the message body begins, which should be passed to EndMessage
+    size_t BeginMessage(uint32_t field) {
+        WriteTag(field, LENGTH_DELIMITED);
+        mBuf.push_back('\0');
+        return mBuf.size();
+    }
+
+    void EndMessage(size_t begin) {
+        size_t len = mBuf.size() - begin;
+        if (len < 0x80) {
+            mBuf[begin - 1] = static_cast<char>(len);
+            return;
+        }
+        char tmp[10];
+        size_t n = EncodeVarint(len, tmp);
+        mBuf.replace(begin - 1, 1, tmp, n);
+    }
+
+    // appends bytes that are already in wire format, e.g. a message encoded beforehand
+    void WriteRaw(StringView s) { mBuf.append(s.data(), s.size()); }
+
+protected:
+    enum WireType : uint32_t { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2 };
+
+    static size_t EncodeVarint(uint64_t v, char* p) {
+        size_t n = 0;
+        while (v >= 0x80) {
+            p[n++] = static_cast<char>((v & 0x7F) | 0x80);
+            v >>= 7;
+        }
+        p[n++] = static_cast<char>(v);
+        return n;
+    }
+
+    void PutVarint(uint64_t v) {
+        char tmp[10];
+        mBuf.append(tmp, EncodeVarint(v, tmp));
+    }
+
+    void WriteTag(uint32_t field, WireType type) { PutVarint((static_cast<uint64_t>(field) << 3) | type); }
+
+    std::string& mBuf;
+};
+
+} // namespace logtail
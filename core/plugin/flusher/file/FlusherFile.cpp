@@ -0,0 +1,337 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/file/FlusherFile.h"
+
+#include <cstring>
+
+#include "common/FileSystemUtil.h"
+#include "common/Flags.h"
+#include "common/ParamExtractor.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "pipeline/batch/FlushStrategy.h"
+#include "pipeline/queue/FileSenderQueueItem.h"
+#include "pipeline/queue/SenderQueueManager.h"
+#include "pipeline/serializer/OTLPSerializer.h"
+#include "pipeline/serializer/SLSSerializer.h"
+#include "runner/sink/file/FileSink.h"
+
+DECLARE_FLAG_INT32(batch_send_interval);
+DECLARE_FLAG_INT32(merge_log_count_limit);
+DECLARE_FLAG_INT32(batch_send_metric_size);
+
+using namespace std;
+
+namespace logtail {
+
+const string FlusherFile::sName = "flusher_file";
+
+static RecordDataType GetRecordDataType(OTLPSignal signal) {
+    switch (signal) {
+        case OTLPSignal::LOGS:
+            return RecordDataType::OTLP_LOGS;
+        case OTLPSignal::METRICS:
+            return RecordDataType::OTLP_METRICS;
+        case OTLPSignal::TRACES:
+            return RecordDataType::OTLP_TRACES;
+        default:
+            return RecordDataType::UNKNOWN;
+    }
+}
+
+bool FlusherFile::Init(const Json::Value& config, Json::Value& optionalGoPipeline) {
+    string errorMsg;
+
+    // Directory
+    if (!GetMandatoryStringParam(config, "Directory", mDirectory, errorMsg)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           errorMsg,
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+
+    // FilePrefix
+    if (!GetOptionalStringParam(config, "FilePrefix", mFilePrefix, errorMsg)) {
+        mFilePrefix = mContext->GetConfigName();
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mFilePrefix,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (mFilePrefix.empty()) {
+        mFilePrefix = mContext->GetConfigName();
+    } else if (mFilePrefix.find_first_of("/\\") != string::npos) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           "string param FilePrefix contains path separator",
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+
+    // MaxFileSizeMB
+    if (!GetOptionalUIntParam(config, "MaxFileSizeMB", mMaxFileSizeMB, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mMaxFileSizeMB,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (mMaxFileSizeMB == 0) {
+        mMaxFileSizeMB = 256;
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "uint param MaxFileSizeMB is 0",
+                              mMaxFileSizeMB,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+
+    // RotateIntervalSecs
+    if (!GetOptionalUIntParam(config, "RotateIntervalSecs", mRotateIntervalSecs, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mRotateIntervalSecs,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+
+    // Format
+    if (!GetOptionalStringParam(config, "Format", mFormat, errorMsg)) {
+        mFormat = "sls";
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mFormat,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (mFormat == "otlp") {
+        mGroupSerializer = make_unique<OTLPEventGroupSerializer>(this);
+    } else if (mFormat != "sls") {
+        mFormat = "sls";
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "string param Format is not valid",
+                              mFormat,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+    if (!mGroupSerializer) {
+        mGroupSerializer = make_unique<SLSEventGroupSerializer>(this);
+    }
+
+    // Batch
+    const char* key = "Batch";
+    const Json::Value* itr = config.find(key, key + strlen(key));
+    if (itr && !itr->isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "param Batch is not of type object",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        itr = nullptr;
+    }
+    DefaultFlushStrategyOptions strategy{static_cast<uint32_t>(INT32_FLAG(batch_send_metric_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(merge_log_count_limit)),
+                                         static_cast<uint32_t>(INT32_FLAG(batch_send_interval))};
+    if (!mBatcher.Init(itr ? *itr : Json::Value(), this, strategy)) {
+        return false;
+    }
+
+    // CompressType
+    string compressType;
+    if (!GetOptionalStringParam(config, "CompressType", compressType, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              "none",
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (compressType == "lz4") {
+        mCompressor = CompressorFactory::GetInstance()->Create(config, *mContext, sName, mPluginID, CompressType::LZ4);
+    } else if (compressType == "zstd") {
+        mCompressor = CompressorFactory::GetInstance()->Create(config, *mContext, sName, mPluginID, CompressType::ZSTD);
+    } else if (!compressType.empty() && compressType != "none") {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "string param CompressType is not valid",
+                              "none",
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+
+    mWriter = FileSink::GetInstance()->GetWriter(
+        mDirectory, mFilePrefix, static_cast<uint64_t>(mMaxFileSizeMB) * 1024 * 1024, mRotateIntervalSecs);
+
+    GenerateQueueKey(PathJoin(mDirectory, mFilePrefix));
+    SenderQueueManager::GetInstance()->CreateQueue(mQueueKey, mPluginID, *mContext);
+
+    mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mSendDoneCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SEND_DONE_TOTAL);
+    mSuccessCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SUCCESS_TOTAL);
+    mOtherErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OTHER_ERROR_TOTAL);
+
+    return true;
+}
+
+bool FlusherFile::Send(PipelineEventGroup&& g) {
+    vector<BatchedEventsList> res;
+    mBatcher.Add(std::move(g), res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherFile::Flush(size_t key) {
+    BatchedEventsList res;
+    mBatcher.FlushQueue(key, res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherFile::FlushAll() {
+    vector<BatchedEventsList> res;
+    mBatcher.FlushAll(res);
+    return SerializeAndPush(std::move(res));
+}
+
+unique_ptr<FileSinkRequest> FlusherFile::BuildRequest(SenderQueueItem* item) const {
+    if (mSendCnt) {
+        mSendCnt->Add(1);
+    }
+    return make_unique<FileSinkRequest>(
+        item, mWriter, GetCompressType(), static_cast<FileSenderQueueItem*>(item)->mDataType);
+}
+
+void FlusherFile::OnWriteDone(bool success, const string& errorMsg, SenderQueueItem* item) {
+    if (mSendDoneCnt) {
+        mSendDoneCnt->Add(1);
+    }
+    SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+    if (success) {
+        if (mSuccessCnt) {
+            mSuccessCnt->Add(1);
+        }
+        DealSenderQueueItemAfterSend(item, false);
+        return;
+    }
+    if (mOtherErrorCnt) {
+        mOtherErrorCnt->Add(1);
+    }
+    // local disk failures, e.g. disk full, are expected to be fixed sooner or later, so data is never discarded here
+    string configName = HasContext() ? GetContext().GetConfigName() : "";
+    LOG_WARNING(sLogger,
+                ("failed to write file", errorMsg)("action", "retry later")("try cnt", item->mTryCnt)(
+                    "config", configName)("dir", mDirectory)("prefix", mFilePrefix));
+    DealSenderQueueItemAfterSend(item, true);
+}
+
+bool FlusherFile::SerializeAndPush(BatchedEventsList&& groupList) {
+    vector<BatchedEvents> batches;
+    if (mFormat == "otlp") {
+        // each record holds one OTLP request, which carries only one signal
+        for (auto& group : groupList) {
+            SplitBySignal(std::move(group), batches);
+        }
+    } else {
+        batches = std::move(groupList);
+    }
+
+    bool allSucceeded = true;
+    string serializedData, compressedData;
+    for (auto& group : batches) {
+        auto dataType = mFormat == "otlp" ? GetRecordDataType(GetOTLPSignal(group)) : RecordDataType::SLS_LOG_GROUP;
+        string errorMsg;
+        if (!mGroupSerializer->DoSerialize(std::move(group), serializedData, errorMsg)) {
+            LOG_WARNING(mContext->GetLogger(),
+                        ("failed to serialize event group",
+                         errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+            mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                           "failed to serialize event group: " + errorMsg
+                                               + "\taction: discard data\tplugin: " + sName
+                                               + "\tconfig: " + mContext->GetConfigName(),
+                                           mContext->GetProjectName(),
+                                           mContext->GetLogstoreName(),
+                                           mContext->GetRegion());
+            allSucceeded = false;
+            continue;
+        }
+        size_t rawSize = serializedData.size();
+        if (mCompressor) {
+            if (!mCompressor->DoCompress(serializedData, compressedData, errorMsg)) {
+                LOG_WARNING(mContext->GetLogger(),
+                            ("failed to compress event group",
+                             errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+                mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                               "failed to compress event group: " + errorMsg
+                                                   + "\taction: discard data\tplugin: " + sName
+                                                   + "\tconfig: " + mContext->GetConfigName(),
+                                               mContext->GetProjectName(),
+                                               mContext->GetLogstoreName(),
+                                               mContext->GetRegion());
+                allSucceeded = false;
+                continue;
+            }
+        } else {
+            compressedData.swap(serializedData);
+        }
+        allSucceeded = PushToQueue(make_unique<FileSenderQueueItem>(
+                           std::move(compressedData), rawSize, this, mQueueKey, dataType))
+            && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+bool FlusherFile::SerializeAndPush(vector<BatchedEventsList>&& groupLists) {
+    bool allSucceeded = true;
+    for (auto& groupList : groupLists) {
+        allSucceeded = SerializeAndPush(std::move(groupList)) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+} // namespace logtail
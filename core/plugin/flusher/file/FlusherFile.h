@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/compression/Compressor.h"
+#include "pipeline/batch/Batcher.h"
+#include "pipeline/plugin/interface/FileFlusher.h"
+#include "pipeline/serializer/Serializer.h"
+#include "runner/sink/file/RecordFile.h"
+
+namespace logtail {
+
+// Archives event groups to local record files. Batches are serialized and compressed on the processing thread, and
+// written by the file sink, which seals a file when it reaches MaxFileSizeMB or has been open for RotateIntervalSecs.
+class FlusherFile : public FileFlusher {
+public:
+    static const std::string sName;
+
+    const std::string& Name() const override { return sName; }
+    bool Init(const Json::Value& config, Json::Value& optionalGoPipeline) override;
+    bool Send(PipelineEventGroup&& g) override;
+    bool Flush(size_t key) override;
+    bool FlushAll() override;
+    std::unique_ptr<FileSinkRequest> BuildRequest(SenderQueueItem* item) const override;
+    void OnWriteDone(bool success, const std::string& errorMsg, SenderQueueItem* item) override;
+
+    CompressType GetCompressType() const { return mCompressor ? mCompressor->GetCompressType() : CompressType::NONE; }
+
+    std::string mDirectory;
+    std::string mFilePrefix;
+    uint32_t mMaxFileSizeMB = 256;
+    uint32_t mRotateIntervalSecs = 3600;
+    std::string mFormat = "sls";
+
+private:
+    bool SerializeAndPush(std::vector<BatchedEventsList>&& groupLists);
+    bool SerializeAndPush(BatchedEventsList&& groupList);
+
+    Batcher<> mBatcher;
+    std::unique_ptr<EventGroupSerializer> mGroupSerializer;
+    std::unique_ptr<Compressor> mCompressor;
+    std::shared_ptr<RecordFileWriter> mWriter;
+
+    CounterPtr mSendCnt;
+    CounterPtr mSendDoneCnt;
+    CounterPtr mSuccessCnt;
+    CounterPtr mOtherErrorCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherFileUnittest;
+#endif
+};
+
+} // namespace logtail
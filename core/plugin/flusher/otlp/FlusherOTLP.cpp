@@ -0,0 +1,297 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "common/Flags.h"
+#include "common/ParamExtractor.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "common/http/Curl.h"
+#include "monitor/LogtailAlarm.h"
+#include "pipeline/batch/FlushStrategy.h"
+#include "pipeline/queue/OTLPSenderQueueItem.h"
+#include "pipeline/queue/SenderQueueManager.h"
+
+DECLARE_FLAG_INT32(batch_send_interval);
+DECLARE_FLAG_INT32(merge_log_count_limit);
+DECLARE_FLAG_INT32(batch_send_metric_size);
+
+using namespace std;
+
+namespace logtail {
+
+const string FlusherOTLP::sName = "flusher_otlp_native";
+
+static const string& GetSignalPath(OTLPSignal signal) {
+    static const string sLogsPath = "/v1/logs", sMetricsPath = "/v1/metrics", sTracesPath = "/v1/traces";
+    switch (signal) {
+        case OTLPSignal::METRICS:
+            return sMetricsPath;
+        case OTLPSignal::TRACES:
+            return sTracesPath;
+        default:
+            return sLogsPath;
+    }
+}
+
+bool FlusherOTLP::Init(const Json::Value& config, Json::Value& optionalGoPipeline) {
+    string errorMsg;
+
+    // Endpoint
+    if (!GetMandatoryStringParam(config, "Endpoint", mEndpoint, errorMsg)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           errorMsg,
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    mEndpoint = TrimString(mEndpoint);
+    if (!ParseHttpEndpoint(mEndpoint, mHTTPSFlag, mHost, mPort, mPathPrefix)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           "string param Endpoint is not valid",
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+
+    // Headers
+    unordered_map<string, string> headers;
+    if (!GetOptionalMapParam(config, "Headers", headers, errorMsg)) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             errorMsg,
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+    }
+    mHeaders.insert(headers.begin(), headers.end());
+
+    // Batch
+    const char* key = "Batch";
+    const Json::Value* itr = config.find(key, key + strlen(key));
+    if (itr && !itr->isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "param Batch is not of type object",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        itr = nullptr;
+    }
+    DefaultFlushStrategyOptions strategy{static_cast<uint32_t>(INT32_FLAG(batch_send_metric_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(merge_log_count_limit)),
+                                         static_cast<uint32_t>(INT32_FLAG(batch_send_interval))};
+    if (!mBatcher.Init(itr ? *itr : Json::Value(), this, strategy)) {
+        return false;
+    }
+
+    // CompressType
+    // lz4 used by flusher_sls is a raw block format, which OTLP receivers do not accept, so only zstd is offered here
+    string compressType;
+    if (!GetOptionalStringParam(config, "CompressType", compressType, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              "none",
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (compressType == "zstd") {
+        mCompressor = CompressorFactory::GetInstance()->Create(config, *mContext, sName, mPluginID, CompressType::ZSTD);
+    } else if (!compressType.empty() && compressType != "none") {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "string param CompressType is not valid",
+                              "none",
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+
+    mGroupSerializer = make_unique<OTLPEventGroupSerializer>(this);
+
+    GenerateQueueKey(mEndpoint);
+    SenderQueueManager::GetInstance()->CreateQueue(mQueueKey, mPluginID, *mContext);
+
+    mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mSendDoneCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SEND_DONE_TOTAL);
+    mSuccessCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SUCCESS_TOTAL);
+    mNetworkErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_NETWORK_ERROR_TOTAL);
+    mServerErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SERVER_ERROR_TOTAL);
+    mOtherErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OTHER_ERROR_TOTAL);
+
+    return true;
+}
+
+bool FlusherOTLP::Send(PipelineEventGroup&& g) {
+    vector<BatchedEventsList> res;
+    mBatcher.Add(std::move(g), res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherOTLP::Flush(size_t key) {
+    BatchedEventsList res;
+    mBatcher.FlushQueue(key, res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherOTLP::FlushAll() {
+    vector<BatchedEventsList> res;
+    mBatcher.FlushAll(res);
+    return SerializeAndPush(std::move(res));
+}
+
+unique_ptr<HttpSinkRequest> FlusherOTLP::BuildRequest(SenderQueueItem* item) const {
+    auto data = static_cast<OTLPSenderQueueItem*>(item);
+    if (mSendCnt) {
+        mSendCnt->Add(1);
+    }
+    map<string, string> header(mHeaders);
+    header["Content-Type"] = "application/x-protobuf";
+    if (GetCompressType() == CompressType::ZSTD) {
+        header["Content-Encoding"] = "zstd";
+    }
+    return make_unique<HttpSinkRequest>(
+        "POST", mHTTPSFlag, mHost, mPort, mPathPrefix + data->mPath, "", header, data->mData, item);
+}
+
+void FlusherOTLP::OnSendDone(const HttpResponse& response, SenderQueueItem* item) {
+    if (mSendDoneCnt) {
+        mSendDoneCnt->Add(1);
+    }
+    auto data = static_cast<OTLPSenderQueueItem*>(item);
+    int32_t code = response.mStatusCode;
+    SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+    if (code >= 200 && code < 300) {
+        if (mSuccessCnt) {
+            mSuccessCnt->Add(1);
+        }
+        DealSenderQueueItemAfterSend(item, false);
+        return;
+    }
+
+    // according to the OTLP/HTTP spec, only throttling and unavailable server are retryable
+    bool retry = false;
+    string failDetail;
+    if (code == 0) {
+        failDetail = "network error";
+        retry = data->mBufferOrNot;
+        if (mNetworkErrorCnt) {
+            mNetworkErrorCnt->Add(1);
+        }
+    } else if (code == 429 || code == 502 || code == 503 || code == 504) {
+        failDetail = "server busy";
+        retry = data->mBufferOrNot;
+        if (mServerErrorCnt) {
+            mServerErrorCnt->Add(1);
+        }
+    } else {
+        failDetail = "request rejected";
+        if (mOtherErrorCnt) {
+            mOtherErrorCnt->Add(1);
+        }
+    }
+    string configName = HasContext() ? GetContext().GetConfigName() : "";
+    LOG_WARNING(sLogger,
+                ("failed to send request", failDetail)("action", retry ? "retry later" : "discard data")(
+                    "status code", code)("path", mPathPrefix + data->mPath)("try cnt", data->mTryCnt)(
+                    "config", configName)("endpoint", mEndpoint));
+    if (!retry) {
+        LogtailAlarm::GetInstance()->SendAlarm(SEND_DATA_FAIL_ALARM,
+                                               "failed to send request: " + failDetail
+                                                   + "\taction: discard data\tstatusCode: " + ToString(code)
+                                                   + "\tconfig: " + configName + "\tendpoint: " + mEndpoint);
+    }
+    DealSenderQueueItemAfterSend(item, retry);
+}
+
+bool FlusherOTLP::SerializeAndPush(BatchedEventsList&& groupList) {
+    vector<BatchedEvents> batches;
+    for (auto& group : groupList) {
+        SplitBySignal(std::move(group), batches);
+    }
+
+    bool allSucceeded = true;
+    string serializedData, compressedData;
+    for (auto& group : batches) {
+        auto signal = GetOTLPSignal(group);
+        string errorMsg;
+        if (!mGroupSerializer->DoSerialize(std::move(group), serializedData, errorMsg)) {
+            LOG_WARNING(mContext->GetLogger(),
+                        ("failed to serialize event group",
+                         errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+            mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                           "failed to serialize event group: " + errorMsg
+                                               + "\taction: discard data\tplugin: " + sName
+                                               + "\tconfig: " + mContext->GetConfigName(),
+                                           mContext->GetProjectName(),
+                                           mContext->GetLogstoreName(),
+                                           mContext->GetRegion());
+            allSucceeded = false;
+            continue;
+        }
+        size_t rawSize = serializedData.size();
+        if (mCompressor) {
+            if (!mCompressor->DoCompress(serializedData, compressedData, errorMsg)) {
+                LOG_WARNING(mContext->GetLogger(),
+                            ("failed to compress event group",
+                             errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+                mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                               "failed to compress event group: " + errorMsg
+                                                   + "\taction: discard data\tplugin: " + sName
+                                                   + "\tconfig: " + mContext->GetConfigName(),
+                                               mContext->GetProjectName(),
+                                               mContext->GetLogstoreName(),
+                                               mContext->GetRegion());
+                allSucceeded = false;
+                continue;
+            }
+        } else {
+            compressedData.swap(serializedData);
+        }
+        allSucceeded = PushToQueue(make_unique<OTLPSenderQueueItem>(
+                           std::move(compressedData), rawSize, this, mQueueKey, GetSignalPath(signal)))
+            && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+bool FlusherOTLP::SerializeAndPush(vector<BatchedEventsList>&& groupLists) {
+    bool allSucceeded = true;
+    for (auto& groupList : groupLists) {
+        allSucceeded = SerializeAndPush(std::move(groupList)) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+} // namespace logtail
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/compression/Compressor.h"
+#include "pipeline/batch/Batcher.h"
+#include "pipeline/plugin/interface/HttpFlusher.h"
+#include "pipeline/serializer/OTLPSerializer.h"
+
+namespace logtail {
+
+// Sends logs, metrics and spans to an OTLP/HTTP receiver in binary protobuf encoding. Each batch becomes one request per
+// signal it contains, sent to the path of the signal under Endpoint, e.g. http://localhost:4318/v1/traces.
+class FlusherOTLP : public HttpFlusher {
+public:
+    static const std::string sName;
+
+    const std::string& Name() const override { return sName; }
+    bool Init(const Json::Value& config, Json::Value& optionalGoPipeline) override;
+    bool Send(PipelineEventGroup&& g) override;
+    bool Flush(size_t key) override;
+    bool FlushAll() override;
+    std::unique_ptr<HttpSinkRequest> BuildRequest(SenderQueueItem* item) const override;
+    void OnSendDone(const HttpResponse& response, SenderQueueItem* item) override;
+
+    CompressType GetCompressType() const { return mCompressor ? mCompressor->GetCompressType() : CompressType::NONE; }
+
+    std::string mEndpoint;
+    std::map<std::string, std::string> mHeaders;
+
+private:
+    bool SerializeAndPush(std::vector<BatchedEventsList>&& groupLists);
+    bool SerializeAndPush(BatchedEventsList&& groupList);
+
+    bool mHTTPSFlag = false;
+    std::string mHost;
+    int32_t mPort = 0;
+    std::string mPathPrefix;
+
+    Batcher<> mBatcher;
+    std::unique_ptr<EventGroupSerializer> mGroupSerializer;
+    std::unique_ptr<Compressor> mCompressor;
+
+    CounterPtr mSendCnt;
+    CounterPtr mSendDoneCnt;
+    CounterPtr mSuccessCnt;
+    CounterPtr mNetworkErrorCnt;
+    CounterPtr mServerErrorCnt;
+    CounterPtr mOtherErrorCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherOTLPUnittest;
+#endif
+};
+
+} // namespace logtail
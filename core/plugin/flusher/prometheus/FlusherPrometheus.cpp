@@ -0,0 +1,376 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/prometheus/FlusherPrometheus.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "common/Flags.h"
+#include "common/ParamExtractor.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "common/http/Curl.h"
+#include "monitor/LogtailAlarm.h"
+#include "monitor/metric_constants/MetricConstants.h"
+#include "pipeline/batch/TimeoutFlushManager.h"
+#include "pipeline/limiter/ConcurrencyLimiter.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "pipeline/queue/SenderQueueManager.h"
+
+DECLARE_FLAG_INT32(batch_send_interval);
+
+using namespace std;
+
+namespace logtail {
+
+const string FlusherPrometheus::sName = "flusher_prometheus_native";
+
+static int64_t GetTimestampMs(const MetricEvent& e) {
+    auto ns = e.GetTimestampNanosecond();
+    return static_cast<int64_t>(e.GetTimestamp()) * 1000 + (ns ? ns.value() / 1000000 : 0);
+}
+
+bool FlusherPrometheus::Init(const Json::Value& config, Json::Value& optionalGoPipeline) {
+    string errorMsg;
+
+    // Endpoint
+    if (!GetMandatoryStringParam(config, "Endpoint", mEndpoint, errorMsg)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           errorMsg,
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    mEndpoint = TrimString(mEndpoint);
+    if (!ParseHttpEndpoint(mEndpoint, mHTTPSFlag, mHost, mPort, mPath)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           "string param Endpoint is not valid",
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    if (mPath.empty()) {
+        mPath = "/";
+    }
+
+    // Headers
+    unordered_map<string, string> headers;
+    if (!GetOptionalMapParam(config, "Headers", headers, errorMsg)) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             errorMsg,
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+    }
+    mHeaders.insert(headers.begin(), headers.end());
+
+    // ShardCount
+    if (!GetOptionalUIntParam(config, "ShardCount", mShardCnt, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mShardCnt,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    } else if (mShardCnt == 0) {
+        mShardCnt = 4;
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "uint param ShardCount is 0",
+                              mShardCnt,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+    for (uint32_t i = 0; i < mShardCnt; ++i) {
+        mShards.emplace_back(make_unique<Shard>());
+    }
+
+    // Batch
+    const char* key = "Batch";
+    const Json::Value* itr = config.find(key, key + strlen(key));
+    if (itr && !itr->isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "param Batch is not of type object",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        itr = nullptr;
+    }
+    mBatchTimeoutSecs = static_cast<uint32_t>(INT32_FLAG(batch_send_interval));
+    if (itr) {
+        if (!GetOptionalUIntParam(*itr, "MaxCnt", mMaxSamplesPerSend, errorMsg)) {
+            PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                                  mContext->GetAlarm(),
+                                  errorMsg,
+                                  mMaxSamplesPerSend,
+                                  sName,
+                                  mContext->GetConfigName(),
+                                  mContext->GetProjectName(),
+                                  mContext->GetLogstoreName(),
+                                  mContext->GetRegion());
+        } else if (mMaxSamplesPerSend == 0) {
+            mMaxSamplesPerSend = 2000;
+            PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                                  mContext->GetAlarm(),
+                                  "uint param Batch.MaxCnt is 0",
+                                  mMaxSamplesPerSend,
+                                  sName,
+                                  mContext->GetConfigName(),
+                                  mContext->GetProjectName(),
+                                  mContext->GetLogstoreName(),
+                                  mContext->GetRegion());
+        }
+        if (!GetOptionalUIntParam(*itr, "TimeoutSecs", mBatchTimeoutSecs, errorMsg)) {
+            PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                                  mContext->GetAlarm(),
+                                  errorMsg,
+                                  mBatchTimeoutSecs,
+                                  sName,
+                                  mContext->GetConfigName(),
+                                  mContext->GetProjectName(),
+                                  mContext->GetLogstoreName(),
+                                  mContext->GetRegion());
+        }
+    }
+
+    // remote write mandates snappy block format, so it is not configurable
+    mCompressor = CompressorFactory::GetInstance()->Create(CompressType::SNAPPY);
+    mCompressor->SetMetricRecordRef({{METRIC_LABEL_KEY_PROJECT, mContext->GetProjectName()},
+                                     {METRIC_LABEL_KEY_PIPELINE_NAME, mContext->GetConfigName()},
+                                     {METRIC_LABEL_KEY_COMPONENT_NAME, METRIC_LABEL_VALUE_COMPONENT_NAME_COMPRESSOR},
+                                     {METRIC_LABEL_KEY_FLUSHER_PLUGIN_ID, mPluginID}});
+
+    mSerializer = make_unique<RemoteWriteSerializer>(this);
+
+    // the first shard uses the flusher's own queue
+    GenerateQueueKey(mEndpoint);
+    const string& queueName = QueueKeyManager::GetInstance()->GetName(mQueueKey);
+    for (size_t i = 0; i < mShards.size(); ++i) {
+        mShards[i]->mQueueKey
+            = i == 0 ? mQueueKey : QueueKeyManager::GetInstance()->GetKey(queueName + "#" + ToString(i));
+        SenderQueueManager::GetInstance()->CreateQueue(
+            mShards[i]->mQueueKey, mPluginID, *mContext, {{"shard", make_shared<ConcurrencyLimiter>(1)}});
+    }
+
+    mDiscardedEventCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_DISCARDED_EVENTS_TOTAL);
+    mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mSendDoneCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SEND_DONE_TOTAL);
+    mSuccessCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SUCCESS_TOTAL);
+    mNetworkErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_NETWORK_ERROR_TOTAL);
+    mServerErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SERVER_ERROR_TOTAL);
+    mOtherErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OTHER_ERROR_TOTAL);
+
+    return true;
+}
+
+bool FlusherPrometheus::Send(PipelineEventGroup&& g) {
+    // samples are first grouped per shard without locking, so that each shard is locked only once per group
+    vector<RemoteWriteBatch> batches(mShards.size());
+    SeriesLabels labels;
+    size_t discarded = 0;
+    for (const auto& e : g.GetEvents()) {
+        if (!e.Is<MetricEvent>()) {
+            ++discarded;
+            continue;
+        }
+        const auto& metric = e.Cast<MetricEvent>();
+        const auto* value = metric.GetValue<UntypedSingleValue>();
+        if (value == nullptr) {
+            ++discarded;
+            continue;
+        }
+        GetSeriesLabels(metric, g.GetTags(), labels);
+        uint64_t hash = GetSeriesHash(labels);
+        batches[hash % batches.size()].AddSample(hash, labels, value->mValue, GetTimestampMs(metric));
+    }
+    if (discarded > 0 && mDiscardedEventCnt) {
+        mDiscardedEventCnt->Add(discarded);
+    }
+
+    bool allSucceeded = true;
+    for (size_t i = 0; i < batches.size(); ++i) {
+        if (batches[i].Empty()) {
+            continue;
+        }
+        Shard& shard = *mShards[i];
+        lock_guard<mutex> lock(shard.mMux);
+        if (shard.mBatch.Empty()) {
+            TimeoutFlushManager::GetInstance()->UpdateRecord(
+                shard.mTimeoutRecord, mContext->GetConfigName(), 0, i + 1, mBatchTimeoutSecs, this);
+        }
+        shard.mBatch.Merge(std::move(batches[i]));
+        if (shard.mBatch.SampleCnt() >= mMaxSamplesPerSend) {
+            allSucceeded = SerializeAndPush(shard) && allSucceeded;
+        }
+    }
+    return allSucceeded;
+}
+
+bool FlusherPrometheus::Flush(size_t key) {
+    if (key == 0 || key > mShards.size()) {
+        return true;
+    }
+    Shard& shard = *mShards[key - 1];
+    lock_guard<mutex> lock(shard.mMux);
+    return SerializeAndPush(shard);
+}
+
+bool FlusherPrometheus::FlushAll() {
+    bool allSucceeded = true;
+    for (auto& shard : mShards) {
+        lock_guard<mutex> lock(shard->mMux);
+        allSucceeded = SerializeAndPush(*shard) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+vector<QueueKey> FlusherPrometheus::GetQueueKeys() const {
+    vector<QueueKey> keys;
+    for (const auto& shard : mShards) {
+        keys.push_back(shard->mQueueKey);
+    }
+    return keys;
+}
+
+unique_ptr<HttpSinkRequest> FlusherPrometheus::BuildRequest(SenderQueueItem* item) const {
+    if (mSendCnt) {
+        mSendCnt->Add(1);
+    }
+    map<string, string> header(mHeaders);
+    header["Content-Encoding"] = "snappy";
+    header["Content-Type"] = "application/x-protobuf";
+    header["X-Prometheus-Remote-Write-Version"] = "0.1.0";
+    return make_unique<HttpSinkRequest>("POST", mHTTPSFlag, mHost, mPort, mPath, "", header, item->mData, item);
+}
+
+void FlusherPrometheus::OnSendDone(const HttpResponse& response, SenderQueueItem* item) {
+    if (mSendDoneCnt) {
+        mSendDoneCnt->Add(1);
+    }
+    int32_t code = response.mStatusCode;
+    SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+    if (code >= 200 && code < 300) {
+        if (mSuccessCnt) {
+            mSuccessCnt->Add(1);
+        }
+        DealSenderQueueItemAfterSend(item, false);
+        return;
+    }
+
+    // according to the remote write spec, 5xx and 429 are retryable, while other 4xx must not be retried
+    bool retry = false;
+    string failDetail;
+    if (code == 0) {
+        failDetail = "network error";
+        retry = item->mBufferOrNot;
+        if (mNetworkErrorCnt) {
+            mNetworkErrorCnt->Add(1);
+        }
+    } else if (code == 429 || code >= 500) {
+        failDetail = "server busy";
+        retry = item->mBufferOrNot;
+        if (mServerErrorCnt) {
+            mServerErrorCnt->Add(1);
+        }
+    } else {
+        failDetail = "request rejected";
+        if (mOtherErrorCnt) {
+            mOtherErrorCnt->Add(1);
+        }
+    }
+    string configName = HasContext() ? GetContext().GetConfigName() : "";
+    LOG_WARNING(sLogger,
+                ("failed to send request", failDetail)("action", retry ? "retry later" : "discard data")(
+                    "status code", code)("response", response.mBody.substr(0, 256))(
+                    "try cnt", item->mTryCnt)("config", configName)("endpoint", mEndpoint));
+    if (!retry) {
+        LogtailAlarm::GetInstance()->SendAlarm(SEND_DATA_FAIL_ALARM,
+                                               "failed to send request: " + failDetail
+                                                   + "\taction: discard data\tstatusCode: " + ToString(code)
+                                                   + "\tconfig: " + configName + "\tendpoint: " + mEndpoint);
+    }
+    DealSenderQueueItemAfterSend(item, retry);
+}
+
+bool FlusherPrometheus::SerializeAndPush(Shard& shard) {
+    if (shard.mBatch.Empty()) {
+        return true;
+    }
+    // a single group may add far more samples to a shard than MaxCnt, which still bounds the size of each request
+    vector<RemoteWriteBatch> chunks;
+    shard.mBatch.Split(mMaxSamplesPerSend, chunks);
+
+    bool allSucceeded = true;
+    string serializedData, compressedData;
+    for (auto& batch : chunks) {
+        if (batch.Empty()) {
+            continue;
+        }
+        string errorMsg;
+        if (!mSerializer->DoSerialize(std::move(batch), serializedData, errorMsg)) {
+            LOG_WARNING(mContext->GetLogger(),
+                        ("failed to serialize samples",
+                         errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+            mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                           "failed to serialize samples: " + errorMsg
+                                               + "\taction: discard data\tplugin: " + sName
+                                               + "\tconfig: " + mContext->GetConfigName(),
+                                           mContext->GetProjectName(),
+                                           mContext->GetLogstoreName(),
+                                           mContext->GetRegion());
+            allSucceeded = false;
+            continue;
+        }
+        if (!mCompressor->DoCompress(serializedData, compressedData, errorMsg)) {
+            LOG_WARNING(mContext->GetLogger(),
+                        ("failed to compress samples",
+                         errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+            mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                           "failed to compress samples: " + errorMsg
+                                               + "\taction: discard data\tplugin: " + sName
+                                               + "\tconfig: " + mContext->GetConfigName(),
+                                           mContext->GetProjectName(),
+                                           mContext->GetLogstoreName(),
+                                           mContext->GetRegion());
+            allSucceeded = false;
+            continue;
+        }
+        size_t rawSize = serializedData.size();
+        allSucceeded
+            = PushToQueue(make_unique<SenderQueueItem>(std::move(compressedData), rawSize, this, shard.mQueueKey))
+            && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+} // namespace logtail
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/compression/Compressor.h"
+#include "pipeline/batch/TimeoutFlushManager.h"
+#include "pipeline/plugin/interface/HttpFlusher.h"
+#include "pipeline/serializer/PrometheusSerializer.h"
+
+namespace logtail {
+
+// Sends metrics to a prometheus remote write (v1) receiver. Samples are spread over shards by series hash, so that all
+// samples of a series are batched, and sent, by the same shard. Each shard buffers at most MaxCnt samples before its
+// batch is serialized and pushed to its own sender queue, or less if TimeoutSecs elapses first. Each shard sends at
+// most one request at a time, in the order pushed, since the receiver rejects samples older than the latest one of a
+// series.
+class FlusherPrometheus : public HttpFlusher {
+public:
+    static const std::string sName;
+
+    const std::string& Name() const override { return sName; }
+    bool Init(const Json::Value& config, Json::Value& optionalGoPipeline) override;
+    bool Send(PipelineEventGroup&& g) override;
+    // key is the shard index plus 1
+    bool Flush(size_t key) override;
+    bool FlushAll() override;
+    std::vector<QueueKey> GetQueueKeys() const override;
+    std::unique_ptr<HttpSinkRequest> BuildRequest(SenderQueueItem* item) const override;
+    void OnSendDone(const HttpResponse& response, SenderQueueItem* item) override;
+
+    std::string mEndpoint;
+    std::map<std::string, std::string> mHeaders;
+    uint32_t mShardCnt = 4;
+    uint32_t mMaxSamplesPerSend = 2000;
+    uint32_t mBatchTimeoutSecs = 0;
+
+private:
+    struct Shard {
+        std::mutex mMux;
+        RemoteWriteBatch mBatch;
+        TimeoutRecordHandle mTimeoutRecord;
+        QueueKey mQueueKey = 0;
+    };
+
+    // must be called with shard.mMux held, so that the requests of a shard are queued in the order of their samples
+    bool SerializeAndPush(Shard& shard);
+
+    bool mHTTPSFlag = false;
+    std::string mHost;
+    int32_t mPort = 0;
+    std::string mPath;
+
+    std::vector<std::unique_ptr<Shard>> mShards;
+    std::unique_ptr<RemoteWriteSerializer> mSerializer;
+    std::unique_ptr<Compressor> mCompressor;
+
+    CounterPtr mDiscardedEventCnt;
+    CounterPtr mSendCnt;
+    CounterPtr mSendDoneCnt;
+    CounterPtr mSuccessCnt;
+    CounterPtr mNetworkErrorCnt;
+    CounterPtr mServerErrorCnt;
+    CounterPtr mOtherErrorCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherPrometheusUnittest;
+#endif
+};
+
+} // namespace logtail
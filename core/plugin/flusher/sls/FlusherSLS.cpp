@@ -594,6 +594,11 @@ unique_ptr<HttpSinkRequest> FlusherSLS::BuildRequest(SenderQueueItem* item) cons
     sdk::Client* sendClient = SLSClientManager::GetInstance()->GetClient(mRegion, mAliuid);
     int32_t curTime = time(NULL);
 
+    if (!BOOL_FLAG(send_prefer_real_ip)
+        && SLSClientManager::GetInstance()->GetServerSwitchPolicy()
+            == SLSClientManager::EndpointSwitchPolicy::DESIGNATED_FIRST) {
+        SLSClientManager::GetInstance()->UpdateClientEndpointForRequest(sendClient, mRegion);
+    }
     data->mCurrentEndpoint = sendClient->GetRawSlsHost();
     if (data->mCurrentEndpoint.empty()) {
         if (curTime - lastResetEndpointTime >= 30) {
@@ -679,6 +684,16 @@ void FlusherSLS::OnSendDone(const HttpResponse& response, SenderQueueItem* item)
     bool isProfileData = GetProfileSender()->IsProfileData(mRegion, mProject, data->mLogstore);
     int32_t curTime = time(NULL);
     auto curSystemTime = chrono::system_clock::now();
+    // real ip bypasses the endpoint, so its result says nothing about the endpoint
+    if (!BOOL_FLAG(send_prefer_real_ip) || !data->mRealIpFlag) {
+        SendResult endpointResult
+            = slsResponse.mStatusCode == 200 ? SEND_OK : ConvertErrorCode(slsResponse.mErrorCode);
+        SLSClientManager::GetInstance()->UpdateEndpointSendStat(
+            mRegion,
+            data->mCurrentEndpoint,
+            endpointResult != SEND_NETWORK_ERROR && endpointResult != SEND_SERVER_ERROR,
+            response.mResponseTimeMs);
+    }
     if (slsResponse.mStatusCode == 200) {
         auto& cpt = data->mExactlyOnceCheckpoint;
         if (cpt) {
@@ -14,6 +14,8 @@
 
 #include "plugin/flusher/sls/SLSClientManager.h"
 
+#include <algorithm>
+
 #include "app_config/AppConfig.h"
 #include "common/EndpointUtil.h"
 #include "common/Flags.h"
@@ -37,6 +39,26 @@ DEFINE_FLAG_INT32(test_network_normal_interval, "if last check is normal, test n
 DEFINE_FLAG_INT32(test_unavailable_endpoint_interval, "test unavailable endpoint interval", 60);
 DEFINE_FLAG_INT32(send_switch_real_ip_interval, "seconds", 60);
 DEFINE_FLAG_BOOL(send_prefer_real_ip, "use real ip to send data", false);
+DEFINE_FLAG_DOUBLE(sls_endpoint_ewma_alpha, "weight of the latest sample in endpoint latency and error rate", 0.2);
+DEFINE_FLAG_INT32(sls_endpoint_error_penalty_ms,
+                  "latency added to the score of an endpoint when all requests to it fail",
+                  1000);
+DEFINE_FLAG_INT32(sls_endpoint_switch_margin_percent,
+                  "traffic is shifted only to an endpoint whose score is lower by at least this percentage",
+                  30);
+DEFINE_FLAG_INT32(sls_endpoint_switch_min_gap_ms,
+                  "traffic is shifted only to an endpoint whose score is lower by at least this latency",
+                  20);
+DEFINE_FLAG_INT32(sls_endpoint_shift_step_percent,
+                  "percentage of requests moved to a better endpoint at each evaluation",
+                  25);
+DEFINE_FLAG_INT32(sls_endpoint_hedge_latency_ms,
+                  "other endpoints are probed when the average send latency of the current one exceeds this",
+                  500);
+DEFINE_FLAG_INT32(sls_endpoint_hedge_error_rate_percent,
+                  "other endpoints are probed when the error rate of the current one exceeds this",
+                  10);
+DEFINE_FLAG_INT32(sls_endpoint_send_stat_expire_interval, "seconds", 300);
 
 DECLARE_FLAG_STRING(default_access_key_id);
 DECLARE_FLAG_STRING(default_access_key);
@@ -45,6 +67,61 @@ using namespace std;
 
 namespace logtail {
 
+void SLSClientManager::EndpointInfo::UpdateInfo(bool valid, std::optional<uint32_t> latency) {
+    mValid = valid;
+    mLatencyMs = latency;
+    // only probing measures latency
+    if (latency.has_value()) {
+        double alpha = DOUBLE_FLAG(sls_endpoint_ewma_alpha);
+        if (valid) {
+            if (mProbeCnt++ == 0) {
+                mProbeLatencyMs = latency.value();
+            } else {
+                mProbeLatencyMs += alpha * (latency.value() - mProbeLatencyMs);
+            }
+        }
+        mErrorRate += alpha * ((valid ? 0.0 : 1.0) - mErrorRate);
+    }
+}
+
+void SLSClientManager::EndpointInfo::UpdateSendStat(bool success, uint32_t latency, time_t curTime) {
+    double alpha = DOUBLE_FLAG(sls_endpoint_ewma_alpha);
+    if (success) {
+        // stale latency says little about the endpoint now
+        if (!HasRecentSendStat(curTime)) {
+            mSendLatencyMs = latency;
+        } else {
+            mSendLatencyMs += alpha * (latency - mSendLatencyMs);
+        }
+        ++mSendCnt;
+        mLastSendTime = curTime;
+    }
+    mErrorRate += alpha * ((success ? 0.0 : 1.0) - mErrorRate);
+}
+
+bool SLSClientManager::EndpointInfo::HasRecentSendStat(time_t curTime) const {
+    return mSendCnt > 0 && curTime - mLastSendTime <= INT32_FLAG(sls_endpoint_send_stat_expire_interval);
+}
+
+std::optional<double> SLSClientManager::EndpointInfo::GetScore(bool useSendLatency) const {
+    if (useSendLatency ? mSendCnt == 0 : mProbeCnt == 0) {
+        return std::optional<double>();
+    }
+    return (useSendLatency ? mSendLatencyMs : mProbeLatencyMs) + mErrorRate * INT32_FLAG(sls_endpoint_error_penalty_ms);
+}
+
+bool SLSClientManager::EndpointInfo::IsBetterThan(const EndpointInfo& other, time_t curTime) const {
+    // send latencies are compared only when both endpoints are carrying traffic, otherwise probe latencies are
+    bool useSendLatency = HasRecentSendStat(curTime) && other.HasRecentSendStat(curTime);
+    auto score = GetScore(useSendLatency);
+    auto otherScore = other.GetScore(useSendLatency);
+    if (!score.has_value() || !otherScore.has_value()) {
+        return false;
+    }
+    return score.value() + INT32_FLAG(sls_endpoint_switch_min_gap_ms) <= otherScore.value()
+        && score.value() <= otherScore.value() * (100 - INT32_FLAG(sls_endpoint_switch_margin_percent)) / 100;
+}
+
 bool SLSClientManager::RegionEndpointsInfo::AddDefaultEndpoint(const std::string& endpoint) {
     mDefaultEndpoint = endpoint;
     return AddEndpoint(endpoint, true, false);
@@ -77,9 +154,22 @@ void SLSClientManager::RegionEndpointsInfo::RemoveEndpoint(const std::string& en
     if (mDefaultEndpoint == endpoint) {
         mDefaultEndpoint.clear();
     }
+    if (mPreferredEndpoint == endpoint) {
+        mPreferredEndpoint.clear();
+    }
+    if (mShiftTarget == endpoint) {
+        mShiftTarget.clear();
+        mShiftPercent = 0;
+    }
 }
 
 std::string SLSClientManager::RegionEndpointsInfo::GetAvailableEndpointWithTopPriority() const {
+    if (!mPreferredEndpoint.empty()) {
+        auto iter = mEndpointInfoMap.find(mPreferredEndpoint);
+        if (iter != mEndpointInfoMap.end() && (iter->second).mValid) {
+            return mPreferredEndpoint;
+        }
+    }
     if (!mDefaultEndpoint.empty()) {
         auto iter = mEndpointInfoMap.find(mDefaultEndpoint);
         if (iter != mEndpointInfoMap.end() && (iter->second).mValid) {
@@ -108,6 +198,113 @@ std::string SLSClientManager::RegionEndpointsInfo::GetAvailableEndpointWithTopPr
     return mDefaultEndpoint;
 }
 
+std::string SLSClientManager::RegionEndpointsInfo::GetEndpointForNextRequest() {
+    std::string endpoint = GetAvailableEndpointWithTopPriority();
+    if (mShiftTarget.empty()) {
+        return endpoint;
+    }
+    auto iter = mEndpointInfoMap.find(mShiftTarget);
+    if (iter == mEndpointInfoMap.end() || !(iter->second).mValid) {
+        return endpoint;
+    }
+    // spread the requests to the target evenly instead of sending them in a burst
+    uint64_t cnt = mRequestCnt++;
+    if ((cnt + 1) * mShiftPercent / 100 > cnt * mShiftPercent / 100) {
+        return mShiftTarget;
+    }
+    return endpoint;
+}
+
+std::vector<std::string> SLSClientManager::RegionEndpointsInfo::GetEndpointsToHedge(time_t curTime) const {
+    std::vector<std::string> endpoints;
+    if (mEndpointInfoMap.size() < 2) {
+        return endpoints;
+    }
+    auto curIter = mEndpointInfoMap.find(GetAvailableEndpointWithTopPriority());
+    if (curIter == mEndpointInfoMap.end()) {
+        return endpoints;
+    }
+    const EndpointInfo& cur = curIter->second;
+    bool degraded = (cur.HasRecentSendStat(curTime) && cur.mSendLatencyMs > INT32_FLAG(sls_endpoint_hedge_latency_ms))
+        || cur.mErrorRate * 100 > INT32_FLAG(sls_endpoint_hedge_error_rate_percent);
+    if (!degraded && mShiftTarget.empty()) {
+        return endpoints;
+    }
+    // the current endpoint is probed as well, so that all endpoints are compared by the same kind of latency
+    for (const auto& item : mEndpointInfoMap) {
+        if ((item.second).mValid) {
+            endpoints.push_back(item.first);
+        }
+    }
+    return endpoints;
+}
+
+void SLSClientManager::RegionEndpointsInfo::UpdateTrafficShift(const std::string& region,
+                                                                bool probed,
+                                                                time_t curTime) {
+    if (!mPreferredEndpoint.empty()) {
+        auto iter = mEndpointInfoMap.find(mPreferredEndpoint);
+        if (iter == mEndpointInfoMap.end() || !(iter->second).mValid) {
+            LOG_INFO(sLogger,
+                     ("preferred data server endpoint is unavailable, action", "fall back to static priority")(
+                         "region", region)("endpoint", mPreferredEndpoint));
+            mPreferredEndpoint.clear();
+        }
+    }
+    std::string current = GetAvailableEndpointWithTopPriority();
+    auto curIter = mEndpointInfoMap.find(current);
+    if (curIter == mEndpointInfoMap.end() || !(curIter->second).mValid) {
+        mShiftTarget.clear();
+        mShiftPercent = 0;
+        return;
+    }
+
+    if (!mShiftTarget.empty()) {
+        auto iter = mEndpointInfoMap.find(mShiftTarget);
+        if (iter == mEndpointInfoMap.end() || !(iter->second).mValid
+            || !(iter->second).IsBetterThan(curIter->second, curTime)) {
+            LOG_INFO(sLogger,
+                     ("data server endpoint is no longer better, action", "stop shifting traffic")("region", region)(
+                         "from", current)("to", mShiftTarget)("shifted percent", mShiftPercent));
+            mShiftTarget.clear();
+            mShiftPercent = 0;
+            return;
+        }
+        mShiftPercent += INT32_FLAG(sls_endpoint_shift_step_percent);
+        if (mShiftPercent >= 100) {
+            LOG_INFO(sLogger,
+                     ("all traffic shifted to data server endpoint", mShiftTarget)("region", region)("from", current));
+            mPreferredEndpoint = mShiftTarget;
+            mShiftTarget.clear();
+            mShiftPercent = 0;
+        }
+        return;
+    }
+
+    if (!probed) {
+        return;
+    }
+    const EndpointInfo* best = &(curIter->second);
+    std::string bestEndpoint;
+    for (const auto& item : mEndpointInfoMap) {
+        if (item.first == current || !(item.second).mValid) {
+            continue;
+        }
+        if ((item.second).IsBetterThan(*best, curTime)) {
+            best = &(item.second);
+            bestEndpoint = item.first;
+        }
+    }
+    if (!bestEndpoint.empty()) {
+        mShiftTarget = bestEndpoint;
+        mShiftPercent = std::min(100, INT32_FLAG(sls_endpoint_shift_step_percent));
+        mRequestCnt = 0;
+        LOG_INFO(sLogger,
+                 ("start shifting traffic to a better data server endpoint, region", region)("from", current)(
+                     "to", bestEndpoint)("percent", mShiftPercent));
+    }
+}
+
 void SLSClientManager::Init() {
     InitEndpointSwitchPolicy();
     if (mDataServerSwitchPolicy == EndpointSwitchPolicy::DESIGNATED_FIRST) {
@@ -328,6 +525,38 @@ void SLSClientManager::UpdateEndpointStatus(const string& region,
     }
 }
 
+void SLSClientManager::UpdateEndpointSendStat(const string& region,
+                                              const string& endpoint,
+                                              bool success,
+                                              uint32_t latency) {
+    lock_guard<mutex> lock(mRegionEndpointEntryMapLock);
+    auto iter = mRegionEndpointEntryMap.find(region);
+    if (iter == mRegionEndpointEntryMap.end()) {
+        return;
+    }
+    auto epIter = (iter->second).mEndpointInfoMap.find(endpoint);
+    if (epIter != (iter->second).mEndpointInfoMap.end()) {
+        (epIter->second).UpdateSendStat(success, latency, time(nullptr));
+    }
+}
+
+void SLSClientManager::UpdateClientEndpointForRequest(sdk::Client* client, const string& region) {
+    string endpoint;
+    {
+        lock_guard<mutex> lock(mRegionEndpointEntryMapLock);
+        auto iter = mRegionEndpointEntryMap.find(region);
+        if (iter == mRegionEndpointEntryMap.end()) {
+            return;
+        }
+        endpoint = (iter->second).GetEndpointForNextRequest();
+    }
+    if (endpoint.empty() || endpoint == client->GetRawSlsHost()) {
+        return;
+    }
+    client->SetSlsHost(endpoint);
+    ResetClientPort(region, client);
+}
+
 string SLSClientManager::GetAvailableEndpointWithTopPriority(const string& region) const {
     static string emptyStr = "";
     lock_guard<mutex> lock(mRegionEndpointEntryMapLock);
@@ -405,6 +634,7 @@ void SLSClientManager::ProbeNetworkThread() {
                 }
             }
         }
+        HedgeProbeAndShiftTraffic();
         if (unavaliableEndpoints.empty()) {
             if (mStopCV.wait_for(lock, chrono::seconds(INT32_FLAG(test_network_normal_interval)), [this]() {
                     return !mIsProbeNetworkThreadRunning;
@@ -492,6 +722,35 @@ bool SLSClientManager::TestEndpoint(const string& region, const string& endpoint
     return status;
 }
 
+// Endpoints of a region are probed while its current endpoint is still alive but slow or failing, so that traffic can
+// be shifted step by step to a faster one. A shift is aborted as soon as the target is no longer better.
+void SLSClientManager::HedgeProbeAndShiftTraffic() {
+    time_t curTime = time(nullptr);
+    vector<pair<string, vector<string>>> regionEndpoints;
+    {
+        lock_guard<mutex> lock(mRegionEndpointEntryMapLock);
+        for (const auto& item : mRegionEndpointEntryMap) {
+            auto endpoints = (item.second).GetEndpointsToHedge(curTime);
+            if (!endpoints.empty()) {
+                regionEndpoints.emplace_back(item.first, std::move(endpoints));
+            }
+        }
+    }
+    for (const auto& item : regionEndpoints) {
+        for (const auto& endpoint : item.second) {
+            TestEndpoint(item.first, endpoint);
+        }
+    }
+    lock_guard<mutex> lock(mRegionEndpointEntryMapLock);
+    for (auto& item : mRegionEndpointEntryMap) {
+        bool probed = find_if(regionEndpoints.begin(),
+                              regionEndpoints.end(),
+                              [&](const pair<string, vector<string>>& region) { return region.first == item.first; })
+            != regionEndpoints.end();
+        (item.second).UpdateTrafficShift(item.first, probed, curTime);
+    }
+}
+
 void SLSClientManager::ForceUpdateRealIp(const string& region) {
     lock_guard<mutex> lock(mRegionRealIpLock);
     auto iter = mRegionRealIpMap.find(region);
@@ -21,8 +21,10 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "sdk/Client.h"
 
@@ -60,6 +62,11 @@ public:
                               const std::string& endpoint,
                               bool status,
                               std::optional<uint32_t> latency = std::optional<uint32_t>());
+    // Feeds the result of sending data to an endpoint into its latency and error rate statistics.
+    void UpdateEndpointSendStat(const std::string& region, const std::string& endpoint, bool success, uint32_t latency);
+    // Points the client at the endpoint for the next request, which differs between requests while traffic is being
+    // shifted to another endpoint.
+    void UpdateClientEndpointForRequest(sdk::Client* client, const std::string& region);
 
     void ForceUpdateRealIp(const std::string& region);
     void UpdateSendClientRealIp(sdk::Client* client, const std::string& region);
@@ -75,17 +82,34 @@ private:
         std::optional<uint32_t> mLatencyMs;
         bool mProxy = false;
 
+        // exponentially weighted moving averages, where probe and send latencies are kept apart since a probe carries
+        // no data
+        double mProbeLatencyMs = 0.0;
+        uint32_t mProbeCnt = 0;
+        double mSendLatencyMs = 0.0;
+        uint32_t mSendCnt = 0;
+        time_t mLastSendTime = 0;
+        double mErrorRate = 0.0;
+
         EndpointInfo(bool valid, bool proxy) : mValid(valid), mProxy(proxy) {}
 
-        void UpdateInfo(bool valid, std::optional<uint32_t> latency) {
-            mValid = valid;
-            mLatencyMs = latency;
-        }
+        void UpdateInfo(bool valid, std::optional<uint32_t> latency);
+        void UpdateSendStat(bool success, uint32_t latency, time_t curTime);
+        bool HasRecentSendStat(time_t curTime) const;
+        // the lower the better, or nullopt if not measured
+        std::optional<double> GetScore(bool useSendLatency) const;
+        bool IsBetterThan(const EndpointInfo& other, time_t curTime) const;
     };
 
     struct RegionEndpointsInfo {
         std::unordered_map<std::string, EndpointInfo> mEndpointInfoMap;
         std::string mDefaultEndpoint;
+        // chosen by measurement, and takes precedence over the static priority while it is valid
+        std::string mPreferredEndpoint;
+        // the endpoint traffic is being shifted to, and the percentage of requests already sent to it
+        std::string mShiftTarget;
+        uint32_t mShiftPercent = 0;
+        uint64_t mRequestCnt = 0;
 
         bool AddDefaultEndpoint(const std::string& endpoint);
         bool AddEndpoint(const std::string& endpoint, bool status, bool proxy = false);
@@ -95,6 +119,10 @@ private:
                                 bool createFlag = true);
         void RemoveEndpoint(const std::string& endpoint);
         std::string GetAvailableEndpointWithTopPriority() const;
+        std::string GetEndpointForNextRequest();
+        std::vector<std::string> GetEndpointsToHedge(time_t curTime) const;
+        // a new shift is started only if the endpoints have just been probed, since probe stats are never expired
+        void UpdateTrafficShift(const std::string& region, bool probed, time_t curTime);
     };
 
     struct RealIpInfo {
@@ -120,6 +148,7 @@ private:
 
     void ProbeNetworkThread();
     bool TestEndpoint(const std::string& region, const std::string& endpoint);
+    void HedgeProbeAndShiftTraffic();
 
     void UpdateRealIpThread();
     EndpointStatus UpdateRealIp(const std::string& region, const std::string& endpoint);
@@ -153,6 +182,7 @@ private:
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class FlusherSLSUnittest;
+    friend class SLSClientManagerUnittest;
 #endif
 };
 
@@ -260,7 +260,7 @@ bool ProcessorFilterNative::FilterExpressionRoot(LogEvent& sourceEvent, const Ba
     try {
         return node->Match(sourceEvent, GetContext());
     } catch (...) {
-        LOG_ERROR(GetContext().GetLogger(), ("filter error ", ""));
+        LOG_ERROR_RATE_LIMITED(GetContext().GetLogger(), ("filter error ", ""));
         return false;
     }
 }
@@ -278,7 +278,7 @@ bool ProcessorFilterNative::FilterFilterRule(LogEvent& sourceEvent, const LogFil
     try {
         return IsMatched(sourceEvent, *filterRule);
     } catch (...) {
-        LOG_ERROR(GetContext().GetLogger(), ("filter error ", ""));
+        LOG_ERROR_RATE_LIMITED(GetContext().GetLogger(), ("filter error ", ""));
         return false;
     }
 }
@@ -294,7 +294,7 @@ bool ProcessorFilterNative::IsMatched(const LogEvent& contents, const LogFilterR
         }
         if (!BoostRegexMatch(content->second.data(), content->second.size(), regs[i], exception)) {
             if (!exception.empty()) {
-                LOG_ERROR(GetContext().GetLogger(), ("regex_match in Filter fail", exception));
+                LOG_ERROR_RATE_LIMITED(GetContext().GetLogger(), ("regex_match in Filter fail", exception));
                 if (GetContext().GetAlarm().IsLowLevelAlarmValid()) {
                     GetContext().GetAlarm().SendAlarm(REGEX_MATCH_ALARM,
                                                       "regex_match in Filter fail:" + exception,
@@ -492,7 +492,7 @@ bool RegexFilterValueNode::Match(const LogEvent& contents, const PipelineContext
     std::string exception;
     bool result = BoostRegexMatch(content->second.data(), content->second.size(), reg, exception);
     if (!result && !exception.empty() && AppConfig::GetInstance()->IsLogParseAlarmValid()) {
-        LOG_ERROR(mContext.GetLogger(), ("regex_match in Filter fail", exception));
+        LOG_ERROR_RATE_LIMITED(mContext.GetLogger(), ("regex_match in Filter fail", exception));
         if (mContext.GetAlarm().IsLowLevelAlarmValid()) {
             mContext.GetAlarm().SendAlarm(REGEX_MATCH_ALARM,
                                           "regex_match in Filter fail:" + exception,
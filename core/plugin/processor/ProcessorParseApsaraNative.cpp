@@ -264,14 +264,14 @@ time_t ProcessorParseApsaraNative::ApsaraEasyReadLogTimeParser(StringView& buffe
         int nanosecondLength = 0;
         size_t pos = buffer.find(']', 1);
         if (pos == std::string::npos) {
-            LOG_WARNING(sLogger, ("parse apsara log time", "fail")("string", buffer));
+            LOG_WARNING_RATE_LIMITED(sLogger, ("parse apsara log time", "fail")("string", buffer));
             return 0;
         }
         // strTime is the content between '[' and ']' and ends with '\0'
         std::string strTime = buffer.substr(1, pos).to_string();
         auto strptimeResult = Strptime(strTime.c_str(), "%s", &logTime, nanosecondLength);
         if (NULL == strptimeResult || strptimeResult[0] != ']') {
-            LOG_WARNING(sLogger, ("parse apsara log time", "fail")("string", buffer)("timeformat", "%s"));
+            LOG_WARNING_RATE_LIMITED(sLogger, ("parse apsara log time", "fail")("string", buffer)("timeformat", "%s"));
             return 0;
         }
         microTime = (int64_t)logTime.tv_sec * 1000000 + logTime.tv_nsec / 1000;
@@ -281,7 +281,7 @@ time_t ProcessorParseApsaraNative::ApsaraEasyReadLogTimeParser(StringView& buffe
     {
         size_t pos = buffer.find(']', 1);
         if (pos == std::string::npos) {
-            LOG_WARNING(sLogger, ("parse apsara log time", "fail")("string", buffer));
+            LOG_WARNING_RATE_LIMITED(sLogger, ("parse apsara log time", "fail")("string", buffer));
             return 0;
         }
         // strTime is the content between '[' and ']' and ends with '\0'
@@ -292,9 +292,9 @@ time_t ProcessorParseApsaraNative::ApsaraEasyReadLogTimeParser(StringView& buffe
                 auto strptimeResult
                     = Strptime(strTime.c_str() + cachedTimeStr.size() + 1, "%f", &logTime, nanosecondLength);
                 if (NULL == strptimeResult) {
-                    LOG_WARNING(sLogger,
-                                ("parse apsara log time microsecond",
-                                 "fail")("string", buffer)("timeformat", "%Y-%m-%d %H:%M:%S.%f"));
+                    LOG_WARNING_RATE_LIMITED(sLogger,
+                                             ("parse apsara log time microsecond", "fail")("string", buffer)(
+                                                 "timeformat", "%Y-%m-%d %H:%M:%S.%f"));
                 }
             }
             microTime = (int64_t)cachedLogTime.tv_sec * 1000000 + logTime.tv_nsec / 1000;
@@ -303,17 +303,17 @@ time_t ProcessorParseApsaraNative::ApsaraEasyReadLogTimeParser(StringView& buffe
         // parse second part
         auto strptimeResult = Strptime(strTime.c_str(), "%Y-%m-%d %H:%M:%S", &logTime, nanosecondLength);
         if (NULL == strptimeResult) {
-            LOG_WARNING(sLogger,
-                        ("parse apsara log time", "fail")("string", buffer)("timeformat", "%Y-%m-%d %H:%M:%S"));
+            LOG_WARNING_RATE_LIMITED(
+                sLogger, ("parse apsara log time", "fail")("string", buffer)("timeformat", "%Y-%m-%d %H:%M:%S"));
             return 0;
         }
         // parse nanosecond part (optional)
         if (*strptimeResult != '\0') {
             strptimeResult = Strptime(strptimeResult + 1, "%f", &logTime, nanosecondLength);
             if (NULL == strptimeResult) {
-                LOG_WARNING(sLogger,
-                            ("parse apsara log time microsecond", "fail")("string", buffer)("timeformat",
-                                                                                            "%Y-%m-%d %H:%M:%S.%f"));
+                LOG_WARNING_RATE_LIMITED(sLogger,
+                                         ("parse apsara log time microsecond", "fail")("string", buffer)(
+                                             "timeformat", "%Y-%m-%d %H:%M:%S.%f"));
             }
         }
         logTime.tv_sec = logTime.tv_sec - mLogTimeZoneOffsetSecond;
@@ -284,12 +284,11 @@ bool ProcessorParseDelimiterNative::ProcessEvent(const StringView& logPath, Pipe
 
         if (parseSuccess) {
             if (parsedColCount <= 0 || (!mAllowingShortenedFields && parsedColCount < mKeys.size())) {
-                LOG_WARNING(
-                    sLogger,
-                    ("parse delimiter log fail, keys count unmatch "
-                     "columns count, parsed",
-                     parsedColCount)("required", mKeys.size())("log", buffer)("project", GetContext().GetProjectName())(
-                        "logstore", GetContext().GetLogstoreName())("file", logPath));
+                LOG_WARNING_RATE_LIMITED(sLogger,
+                                         ("parse delimiter log fail, keys count unmatch columns count, parsed",
+                                          parsedColCount)("required", mKeys.size())("log", buffer)(
+                                             "project", GetContext().GetProjectName())(
+                                             "logstore", GetContext().GetLogstoreName())("file", logPath));
                 GetContext().GetAlarm().SendAlarm(PARSE_LOG_FAIL_ALARM,
                                                   std::string("keys count unmatch columns count :")
                                                       + ToString(parsedColCount) + ", required:"
@@ -316,9 +315,10 @@ bool ProcessorParseDelimiterNative::ProcessEvent(const StringView& logPath, Pipe
                                                GetContext().GetProjectName(),
                                                GetContext().GetLogstoreName(),
                                                GetContext().GetRegion());
-        LOG_WARNING(sLogger,
-                    ("parse delimiter log fail", "no column keys defined")("project", GetContext().GetProjectName())(
-                        "logstore", GetContext().GetLogstoreName())("file", logPath));
+        LOG_WARNING_RATE_LIMITED(sLogger,
+                                 ("parse delimiter log fail", "no column keys defined")(
+                                     "project", GetContext().GetProjectName())(
+                                     "logstore", GetContext().GetLogstoreName())("file", logPath));
         ++(*mParseFailures);
         parseSuccess = false;
     }
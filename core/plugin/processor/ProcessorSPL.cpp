@@ -24,6 +24,7 @@
 #include <spl/pipeline/SplPipeline.h>
 
 #include <iostream>
+#include <mutex>
 
 #include "common/Flags.h"
 #include "common/ParamExtractor.h"
@@ -42,6 +43,9 @@ namespace logtail {
 
 const std::string ProcessorSPL::sName = "processor_spl";
 
+// the spl library is initialized globally, while pipelines may be built concurrently
+static std::mutex sSplInitMux;
+
 bool ProcessorSPL::Init(const Json::Value& config) {
     std::string errorMsg;
     if (!GetMandatoryStringParam(config, "Script", mSpl, errorMsg)) {
@@ -87,14 +91,16 @@ bool ProcessorSPL::Init(const Json::Value& config) {
     // sampling for error
     splOptions.errorSampling = true;
 
-    // this function is void and has no return
-    initSPL(&splOptions);
-
     LoggerPtr logger;
     logger = sLogger;
     Error error;
-    mSPLPipelinePtr = std::make_shared<apsara::sls::spl::SplPipeline>(
-        mSpl, error, (u_int64_t)mTimeoutMills, (int64_t)mMaxMemoryBytes, logger);
+    {
+        std::lock_guard<std::mutex> lock(sSplInitMux);
+        // this function is void and has no return
+        initSPL(&splOptions);
+        mSPLPipelinePtr = std::make_shared<apsara::sls::spl::SplPipeline>(
+            mSpl, error, (u_int64_t)mTimeoutMills, (int64_t)mMaxMemoryBytes, logger);
+    }
     if (error.code_ != StatusCode::OK) {
         PARAM_ERROR_RETURN(mContext->GetLogger(),
                            mContext->GetAlarm(),
@@ -20,9 +20,11 @@
 
 #include "app_config/AppConfig.h"
 #include "application/Application.h"
+#include "common/CoarseClock.h"
 #include "common/Flags.h"
-#include "protobuf/sls/sls_logs.pb.h"
+#include "monitor/LogFileProfiler.h"
 #include "pipeline/Pipeline.h"
+#include "protobuf/sls/sls_logs.pb.h"
 #ifdef __ENTERPRISE__
 #include "config/provider/EnterpriseConfigProvider.h"
 #endif
@@ -36,6 +38,8 @@ namespace logtail {
 const string ProcessorTagNative::sName = "processor_tag_native";
 
 bool ProcessorTagNative::Init(const Json::Value& config) {
+    // the tag block is built on first use, since whether the pipeline flushes through the go pipeline is unknown until
+    // all plugins of the pipeline are initialized
     return true;
 }
 
@@ -46,39 +50,81 @@ void ProcessorTagNative::Process(PipelineEventGroup& logGroup) {
         logGroup.SetTagNoCopy(LOG_RESERVED_KEY_PATH, filePath.substr(0, 511));
     }
 
-    // process level
-#ifdef __ENTERPRISE__
-    string agentTag = EnterpriseConfigProvider::GetInstance()->GetUserDefinedIdSet();
-    if (!agentTag.empty()) {
-        auto sb = logGroup.GetSourceBuffer()->CopyString(agentTag);
-        logGroup.SetTagNoCopy(LOG_RESERVED_KEY_USER_DEFINED_ID, StringView(sb.data, sb.size));
+    // process level and pipeline level
+    auto block = GetTagBlock();
+    if (block->mTags.empty()) {
+        return;
+    }
+    logGroup.RetainSourceBuffer(block->mSourceBuffer);
+    for (const auto& tag : block->mTags) {
+        logGroup.SetTagNoCopy(tag.first, tag.second);
     }
+}
+
+ProcessorTagNative::TagSource ProcessorTagNative::GetTagSource() const {
+    TagSource source;
+#ifdef __ENTERPRISE__
+    source.mUserDefinedId = EnterpriseConfigProvider::GetInstance()->GetUserDefinedIdSet();
 #endif
+    if (!STRING_FLAG(ALIYUN_LOG_FILE_TAGS).empty()) {
+        source.mFileTagsVersion = AppConfig::GetInstance()->GetFileTagsVersion();
+    }
+    if (!mContext->GetPipeline().IsFlushingThroughGoPipeline()) {
+        source.mHostname = LogFileProfiler::mHostname;
+        source.mIp = LogFileProfiler::mIpAddr;
+        source.mMachineUUID = Application::GetInstance()->GetUUID();
+    }
+    return source;
+}
+
+shared_ptr<const ProcessorTagNative::TagBlock> ProcessorTagNative::BuildTagBlock(const TagSource& source) const {
+    auto block = make_shared<TagBlock>();
+    if (!source.mUserDefinedId.empty()) {
+        block->AddTag(LOG_RESERVED_KEY_USER_DEFINED_ID, source.mUserDefinedId);
+    }
 
     if (!STRING_FLAG(ALIYUN_LOG_FILE_TAGS).empty()) {
         vector<sls_logs::LogTag>& fileTags = AppConfig::GetInstance()->GetFileTags();
-        if (!fileTags.empty()) { // reloadable, so we must get it every time and copy value
-            for (size_t i = 0; i < fileTags.size(); ++i) {
-                logGroup.SetTag(fileTags[i].key(), fileTags[i].value());
-            }
+        for (size_t i = 0; i < fileTags.size(); ++i) {
+            block->AddTag(fileTags[i].key(), fileTags[i].value());
         }
     }
 
     if (mContext->GetPipeline().IsFlushingThroughGoPipeline()) {
-        return;
+        return block;
     }
 
-    // process level
-    logGroup.SetTagNoCopy(LOG_RESERVED_KEY_HOSTNAME, LogFileProfiler::mHostname);
-    logGroup.SetTagNoCopy(LOG_RESERVED_KEY_SOURCE, LogFileProfiler::mIpAddr);
-    auto sb = logGroup.GetSourceBuffer()->CopyString(Application::GetInstance()->GetUUID());
-    logGroup.SetTagNoCopy(LOG_RESERVED_KEY_MACHINE_UUID, StringView(sb.data, sb.size));
-    static const vector<sls_logs::LogTag>& sEnvTags = AppConfig::GetInstance()->GetEnvTags();
-    if (!sEnvTags.empty()) {
-        for (size_t i = 0; i < sEnvTags.size(); ++i) {
-            logGroup.SetTagNoCopy(sEnvTags[i].key(), sEnvTags[i].value());
+    block->AddTag(LOG_RESERVED_KEY_HOSTNAME, source.mHostname);
+    block->AddTag(LOG_RESERVED_KEY_SOURCE, source.mIp);
+    block->AddTag(LOG_RESERVED_KEY_MACHINE_UUID, source.mMachineUUID);
+    const vector<sls_logs::LogTag>& envTags = AppConfig::GetInstance()->GetEnvTags();
+    for (size_t i = 0; i < envTags.size(); ++i) {
+        block->AddTag(envTags[i].key(), envTags[i].value());
+    }
+    return block;
+}
+
+shared_ptr<const ProcessorTagNative::TagBlock> ProcessorTagNative::GetTagBlock() {
+    time_t now = GetCoarseTimeInSeconds();
+    if (!std::atomic_load(&mTagBlock)) {
+        lock_guard<mutex> lock(mTagBlockMux);
+        if (!std::atomic_load(&mTagBlock)) {
+            mLastCheckTime = now;
+            mTagSource = GetTagSource();
+            std::atomic_store(&mTagBlock, BuildTagBlock(mTagSource));
+        }
+    } else if (mLastCheckTime.load() != now) {
+        unique_lock<mutex> lock(mTagBlockMux, try_to_lock);
+        if (lock.owns_lock() && mLastCheckTime.load() != now) {
+            mLastCheckTime = now;
+            TagSource source = GetTagSource();
+            if (source != mTagSource) {
+                mTagSource = std::move(source);
+                std::atomic_store(&mTagBlock, BuildTagBlock(mTagSource));
+            }
         }
     }
+    return std::atomic_load(&mTagBlock);
 }
 
 bool ProcessorTagNative::IsSupportedEvent(const PipelineEventPtr& /*e*/) const {
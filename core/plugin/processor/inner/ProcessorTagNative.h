@@ -16,6 +16,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/memory/SourceBuffer.h"
 #include "pipeline/plugin/interface/Processor.h"
 
 namespace logtail {
@@ -31,6 +40,47 @@ public:
 protected:
     bool IsSupportedEvent(const PipelineEventPtr& e) const override;
 
+private:
+    // Agent and pipeline level tags, which are identical for all groups. The block is immutable once built and is
+    // shared by groups, which retain its source buffer instead of copying the strings.
+    struct TagBlock {
+        std::shared_ptr<SourceBuffer> mSourceBuffer = std::make_shared<SourceBuffer>();
+        std::vector<std::pair<StringView, StringView>> mTags;
+
+        void AddTag(StringView key, StringView val) {
+            StringBuffer k = mSourceBuffer->CopyString(key);
+            StringBuffer v = mSourceBuffer->CopyString(val);
+            mTags.emplace_back(StringView(k.data, k.size), StringView(v.data, v.size));
+        }
+    };
+
+    // source values the tag block is built from
+    struct TagSource {
+        std::string mUserDefinedId;
+        uint32_t mFileTagsVersion = 0;
+        std::string mHostname;
+        std::string mIp;
+        std::string mMachineUUID;
+
+        bool operator==(const TagSource& rhs) const {
+            return mUserDefinedId == rhs.mUserDefinedId && mFileTagsVersion == rhs.mFileTagsVersion
+                && mHostname == rhs.mHostname && mIp == rhs.mIp && mMachineUUID == rhs.mMachineUUID;
+        }
+        bool operator!=(const TagSource& rhs) const { return !(*this == rhs); }
+    };
+
+    TagSource GetTagSource() const;
+    std::shared_ptr<const TagBlock> BuildTagBlock(const TagSource& source) const;
+    std::shared_ptr<const TagBlock> GetTagBlock();
+
+    // sources are checked at most once per second, and the block is rebuilt only when any of them changes
+    std::mutex mTagBlockMux;
+    TagSource mTagSource;
+    std::atomic<time_t> mLastCheckTime{0};
+    // should only be accessed with std::atomic_load/atomic_store, since groups may be processed concurrently. Null
+    // until the first group is processed.
+    std::shared_ptr<const TagBlock> mTagBlock;
+
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ProcessorTagNativeUnittest;
 #endif
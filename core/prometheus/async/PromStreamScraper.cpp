@@ -0,0 +1,79 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "prometheus/async/PromStreamScraper.h"
+
+#include <cstring>
+#include <memory>
+
+#include "prometheus/Constants.h"
+#include "prometheus/Utils.h"
+
+using namespace std;
+
+namespace logtail {
+
+PromStreamScraper::PromStreamScraper() : mEventGroup(make_shared<SourceBuffer>()) {
+}
+
+void PromStreamScraper::Write(const char* data, size_t len) {
+    mRawSize += len;
+    const char* end = data + len;
+    const char* begin = data;
+    if (!mCache.empty()) {
+        const char* eol = static_cast<const char*>(memchr(begin, '\n', end - begin));
+        if (eol == nullptr) {
+            mCache.append(begin, end);
+            return;
+        }
+        mCache.append(begin, eol);
+        AddLine(mCache);
+        mCache.clear();
+        begin = eol + 1;
+    }
+    while (begin < end) {
+        const char* eol = static_cast<const char*>(memchr(begin, '\n', end - begin));
+        if (eol == nullptr) {
+            mCache.assign(begin, end);
+            return;
+        }
+        AddLine(StringView(begin, eol - begin));
+        begin = eol + 1;
+    }
+}
+
+void PromStreamScraper::Reset() {
+    mEventGroup = PipelineEventGroup(make_shared<SourceBuffer>());
+    mCache.clear();
+    mRawSize = 0;
+}
+
+PipelineEventGroup PromStreamScraper::Finish() {
+    if (!mCache.empty()) {
+        AddLine(mCache);
+        mCache.clear();
+    }
+    return std::move(mEventGroup);
+}
+
+void PromStreamScraper::AddLine(StringView line) {
+    if (!IsValidMetric(line)) {
+        return;
+    }
+    // the line is copied into the source buffer of the event group
+    auto* logEvent = mEventGroup.AddLogEvent();
+    logEvent->SetContent(prometheus::PROMETHEUS, line);
+}
+
+} // namespace logtail
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "common/http/HttpResponse.h"
+#include "models/PipelineEventGroup.h"
+
+namespace logtail {
+
+// Builds the event group of a scrape line by line while the response body is being received, which is equivalent to
+// TextParser::BuildLogGroup on the whole body. Only the incomplete last line of a chunk is cached, so the body is
+// never buffered as a whole besides the event group itself.
+class PromStreamScraper : public HttpResponseBodySink {
+public:
+    PromStreamScraper();
+
+    void Write(const char* data, size_t len) override;
+    void Reset() override;
+
+    // should be called once after the body is completely received
+    PipelineEventGroup Finish();
+    uint64_t GetRawSize() const { return mRawSize; }
+
+private:
+    void AddLine(StringView line);
+
+    PipelineEventGroup mEventGroup;
+    std::string mCache;
+    uint64_t mRawSize = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class PromStreamScraperUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -7,6 +7,7 @@
 
 #include "common/FileSystemUtil.h"
 #include "common/StringTools.h"
+#include "common/http/Curl.h"
 #include "logger/Logger.h"
 #include "prometheus/Constants.h"
 #include "prometheus/Utils.h"
@@ -43,9 +44,9 @@ bool ScrapeConfig::Init(const Json::Value& scrapeConfig) {
 
     if (scrapeConfig.isMember(prometheus::ENABLE_COMPRESSION)
         && scrapeConfig[prometheus::ENABLE_COMPRESSION].isBool()) {
-        // InitEnableCompression(scrapeConfig[prometheus::ENABLE_COMPRESSION].asBool());
+        InitEnableCompression(scrapeConfig[prometheus::ENABLE_COMPRESSION].asBool());
     } else {
-        // InitEnableCompression(true);
+        InitEnableCompression(true);
     }
 
     // basic auth, authorization, oauth2
@@ -332,7 +333,8 @@ bool ScrapeConfig::InitScrapeProtocols(const Json::Value& scrapeProtocols) {
 
 void ScrapeConfig::InitEnableCompression(bool enableCompression) {
     if (enableCompression) {
-        mRequestHeaders[prometheus::ACCEPT_ENCODING] = prometheus::GZIP;
+        // the response is decoded by curl on the fly
+        mRequestHeaders[prometheus::ACCEPT_ENCODING] = GetSupportedContentEncodings();
     } else {
         mRequestHeaders[prometheus::ACCEPT_ENCODING] = prometheus::IDENTITY;
     }
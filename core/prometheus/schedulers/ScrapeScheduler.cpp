@@ -32,6 +32,7 @@
 #include "prometheus/Constants.h"
 #include "prometheus/async/PromFuture.h"
 #include "prometheus/async/PromHttpRequest.h"
+#include "prometheus/async/PromStreamScraper.h"
 #include "sdk/Common.h"
 
 using namespace std;
@@ -61,14 +62,17 @@ ScrapeScheduler::ScrapeScheduler(std::shared_ptr<ScrapeConfig> scrapeConfigPtr,
 }
 
 void ScrapeScheduler::OnMetricResult(const HttpResponse& response, uint64_t timestampMilliSec) {
+    // the body is consumed on the fly by the scraper if set, see BuildScrapeTimerEvent
+    auto* scraper = static_cast<PromStreamScraper*>(response.mBodySink.get());
+    uint64_t bodySize = scraper ? scraper->GetRawSize() : response.mBody.size();
     mSelfMonitor->AddCounter(METRIC_PLUGIN_OUT_EVENTS_TOTAL, response.mStatusCode);
-    mSelfMonitor->AddCounter(METRIC_PLUGIN_OUT_SIZE_BYTES, response.mStatusCode, response.mBody.size());
+    mSelfMonitor->AddCounter(METRIC_PLUGIN_OUT_SIZE_BYTES, response.mStatusCode, bodySize);
     mSelfMonitor->AddCounter(
         METRIC_PLUGIN_PROM_SCRAPE_TIME_MS, response.mStatusCode, GetCurrentTimeInMilliSeconds() - timestampMilliSec);
 
     mScrapeTimestampMilliSec = timestampMilliSec;
     mScrapeDurationSeconds = 1.0 * (GetCurrentTimeInMilliSeconds() - timestampMilliSec) / 1000;
-    mScrapeResponseSizeBytes = response.mBody.size();
+    mScrapeResponseSizeBytes = bodySize;
     mUpState = response.mStatusCode == 200;
     if (response.mStatusCode != 200) {
         mScrapeResponseSizeBytes = 0;
@@ -79,7 +83,7 @@ void ScrapeScheduler::OnMetricResult(const HttpResponse& response, uint64_t time
         LOG_WARNING(sLogger,
                     ("scrape failed, status code", response.mStatusCode)("target", mHash)("http header", headerStr));
     }
-    auto eventGroup = BuildPipelineEventGroup(response.mBody);
+    auto eventGroup = scraper ? scraper->Finish() : BuildPipelineEventGroup(response.mBody);
 
     SetAutoMetricMeta(eventGroup);
     SetTargetLabels(eventGroup);
@@ -183,6 +187,7 @@ std::unique_ptr<TimerEvent> ScrapeScheduler::BuildScrapeTimerEvent(std::chrono::
                                                          / mScrapeConfigPtr->mScrapeTimeoutSeconds,
                                                      this->mFuture,
                                                      this->mIsContextValidFuture);
+    request->mResponse.mBodySink = std::make_shared<PromStreamScraper>();
     auto timerEvent = std::make_unique<HttpRequestTimerEvent>(execTime, std::move(request));
     return timerEvent;
 }
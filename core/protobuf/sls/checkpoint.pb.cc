@@ -0,0 +1,1127 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: checkpoint.proto
+
+#include "checkpoint.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace logtail {
+PROTOBUF_CONSTEXPR PrimaryCheckpointPB::PrimaryCheckpointPB(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.config_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.real_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.concurrency_)*/0u
+  , /*decltype(_impl_.sig_size_)*/0u
+  , /*decltype(_impl_.sig_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.dev_)*/uint64_t{0u}
+  , /*decltype(_impl_.inode_)*/uint64_t{0u}
+  , /*decltype(_impl_.update_time_)*/0} {}
+struct PrimaryCheckpointPBDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrimaryCheckpointPBDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrimaryCheckpointPBDefaultTypeInternal() {}
+  union {
+    PrimaryCheckpointPB _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrimaryCheckpointPBDefaultTypeInternal _PrimaryCheckpointPB_default_instance_;
+PROTOBUF_CONSTEXPR RangeCheckpointPB::RangeCheckpointPB(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hash_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sequence_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.read_offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.read_length_)*/uint64_t{0u}
+  , /*decltype(_impl_.update_time_)*/0
+  , /*decltype(_impl_.committed_)*/false} {}
+struct RangeCheckpointPBDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeCheckpointPBDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeCheckpointPBDefaultTypeInternal() {}
+  union {
+    RangeCheckpointPB _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeCheckpointPBDefaultTypeInternal _RangeCheckpointPB_default_instance_;
+}  // namespace logtail
+static ::_pb::Metadata file_level_metadata_checkpoint_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_checkpoint_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_checkpoint_2eproto = nullptr;
+
+const uint32_t TableStruct_checkpoint_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.concurrency_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.sig_size_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.sig_hash_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.config_name_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.log_path_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.real_path_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.dev_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.inode_),
+  PROTOBUF_FIELD_OFFSET(::logtail::PrimaryCheckpointPB, _impl_.update_time_),
+  3,
+  4,
+  5,
+  0,
+  1,
+  2,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.hash_key_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.sequence_id_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.read_offset_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.read_length_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.update_time_),
+  PROTOBUF_FIELD_OFFSET(::logtail::RangeCheckpointPB, _impl_.committed_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::logtail::PrimaryCheckpointPB)},
+  { 24, 36, -1, sizeof(::logtail::RangeCheckpointPB)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::logtail::_PrimaryCheckpointPB_default_instance_._instance,
+  &::logtail::_RangeCheckpointPB_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_checkpoint_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020checkpoint.proto\022\007logtail\"\271\001\n\023PrimaryC"
+  "heckpointPB\022\023\n\013concurrency\030\001 \002(\r\022\020\n\010sig_"
+  "size\030\002 \002(\r\022\020\n\010sig_hash\030\003 \002(\004\022\023\n\013config_n"
+  "ame\030\004 \001(\t\022\020\n\010log_path\030\005 \001(\t\022\021\n\treal_path"
+  "\030\006 \001(\t\022\013\n\003dev\030\007 \001(\004\022\r\n\005inode\030\010 \001(\004\022\023\n\013up"
+  "date_time\030\t \001(\005\"\214\001\n\021RangeCheckpointPB\022\020\n"
+  "\010hash_key\030\001 \002(\t\022\023\n\013sequence_id\030\002 \002(\004\022\023\n\013"
+  "read_offset\030\003 \002(\004\022\023\n\013read_length\030\004 \002(\004\022\023"
+  "\n\013update_time\030\005 \002(\005\022\021\n\tcommitted\030\006 \002(\010"
+  ;
+static ::_pbi::once_flag descriptor_table_checkpoint_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_checkpoint_2eproto = {
+    false, false, 358, descriptor_table_protodef_checkpoint_2eproto,
+    "checkpoint.proto",
+    &descriptor_table_checkpoint_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_checkpoint_2eproto::offsets,
+    file_level_metadata_checkpoint_2eproto, file_level_enum_descriptors_checkpoint_2eproto,
+    file_level_service_descriptors_checkpoint_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_checkpoint_2eproto_getter() {
+  return &descriptor_table_checkpoint_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_checkpoint_2eproto(&descriptor_table_checkpoint_2eproto);
+namespace logtail {
+
+// ===================================================================
+
+class PrimaryCheckpointPB::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrimaryCheckpointPB>()._impl_._has_bits_);
+  static void set_has_concurrency(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sig_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sig_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_config_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_log_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_real_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_dev(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_inode(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_update_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000038) ^ 0x00000038) != 0;
+  }
+};
+
+PrimaryCheckpointPB::PrimaryCheckpointPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:logtail.PrimaryCheckpointPB)
+}
+PrimaryCheckpointPB::PrimaryCheckpointPB(const PrimaryCheckpointPB& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrimaryCheckpointPB* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.config_name_){}
+    , decltype(_impl_.log_path_){}
+    , decltype(_impl_.real_path_){}
+    , decltype(_impl_.concurrency_){}
+    , decltype(_impl_.sig_size_){}
+    , decltype(_impl_.sig_hash_){}
+    , decltype(_impl_.dev_){}
+    , decltype(_impl_.inode_){}
+    , decltype(_impl_.update_time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.config_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.config_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_config_name()) {
+    _this->_impl_.config_name_.Set(from._internal_config_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.log_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_log_path()) {
+    _this->_impl_.log_path_.Set(from._internal_log_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.real_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.real_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_real_path()) {
+    _this->_impl_.real_path_.Set(from._internal_real_path(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.concurrency_, &from._impl_.concurrency_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.update_time_) -
+    reinterpret_cast<char*>(&_impl_.concurrency_)) + sizeof(_impl_.update_time_));
+  // @@protoc_insertion_point(copy_constructor:logtail.PrimaryCheckpointPB)
+}
+
+inline void PrimaryCheckpointPB::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.config_name_){}
+    , decltype(_impl_.log_path_){}
+    , decltype(_impl_.real_path_){}
+    , decltype(_impl_.concurrency_){0u}
+    , decltype(_impl_.sig_size_){0u}
+    , decltype(_impl_.sig_hash_){uint64_t{0u}}
+    , decltype(_impl_.dev_){uint64_t{0u}}
+    , decltype(_impl_.inode_){uint64_t{0u}}
+    , decltype(_impl_.update_time_){0}
+  };
+  _impl_.config_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.config_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.log_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.real_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.real_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrimaryCheckpointPB::~PrimaryCheckpointPB() {
+  // @@protoc_insertion_point(destructor:logtail.PrimaryCheckpointPB)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrimaryCheckpointPB::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.config_name_.Destroy();
+  _impl_.log_path_.Destroy();
+  _impl_.real_path_.Destroy();
+}
+
+void PrimaryCheckpointPB::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrimaryCheckpointPB::Clear() {
+// @@protoc_insertion_point(message_clear_start:logtail.PrimaryCheckpointPB)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.config_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.log_path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.real_path_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.concurrency_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.inode_) -
+        reinterpret_cast<char*>(&_impl_.concurrency_)) + sizeof(_impl_.inode_));
+  }
+  _impl_.update_time_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrimaryCheckpointPB::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 concurrency = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_concurrency(&has_bits);
+          _impl_.concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 sig_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sig_size(&has_bits);
+          _impl_.sig_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sig_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sig_hash(&has_bits);
+          _impl_.sig_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string config_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_config_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "logtail.PrimaryCheckpointPB.config_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string log_path = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_log_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "logtail.PrimaryCheckpointPB.log_path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string real_path = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_real_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "logtail.PrimaryCheckpointPB.real_path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 dev = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_dev(&has_bits);
+          _impl_.dev_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 inode = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_inode(&has_bits);
+          _impl_.inode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 update_time = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_update_time(&has_bits);
+          _impl_.update_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrimaryCheckpointPB::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:logtail.PrimaryCheckpointPB)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 concurrency = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_concurrency(), target);
+  }
+
+  // required uint32 sig_size = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sig_size(), target);
+  }
+
+  // required uint64 sig_hash = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sig_hash(), target);
+  }
+
+  // optional string config_name = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_config_name().data(), static_cast<int>(this->_internal_config_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "logtail.PrimaryCheckpointPB.config_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_config_name(), target);
+  }
+
+  // optional string log_path = 5;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_log_path().data(), static_cast<int>(this->_internal_log_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "logtail.PrimaryCheckpointPB.log_path");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_log_path(), target);
+  }
+
+  // optional string real_path = 6;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_real_path().data(), static_cast<int>(this->_internal_real_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "logtail.PrimaryCheckpointPB.real_path");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_real_path(), target);
+  }
+
+  // optional uint64 dev = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_dev(), target);
+  }
+
+  // optional uint64 inode = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_inode(), target);
+  }
+
+  // optional int32 update_time = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_update_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:logtail.PrimaryCheckpointPB)
+  return target;
+}
+
+size_t PrimaryCheckpointPB::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:logtail.PrimaryCheckpointPB)
+  size_t total_size = 0;
+
+  if (_internal_has_concurrency()) {
+    // required uint32 concurrency = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_concurrency());
+  }
+
+  if (_internal_has_sig_size()) {
+    // required uint32 sig_size = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sig_size());
+  }
+
+  if (_internal_has_sig_hash()) {
+    // required uint64 sig_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sig_hash());
+  }
+
+  return total_size;
+}
+size_t PrimaryCheckpointPB::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:logtail.PrimaryCheckpointPB)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000038) ^ 0x00000038) == 0) {  // All required fields are present.
+    // required uint32 concurrency = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_concurrency());
+
+    // required uint32 sig_size = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sig_size());
+
+    // required uint64 sig_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sig_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string config_name = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_config_name());
+    }
+
+    // optional string log_path = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_log_path());
+    }
+
+    // optional string real_path = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_real_path());
+    }
+
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    // optional uint64 dev = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dev());
+    }
+
+    // optional uint64 inode = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_inode());
+    }
+
+  }
+  // optional int32 update_time = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_update_time());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrimaryCheckpointPB::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrimaryCheckpointPB::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrimaryCheckpointPB::GetClassData() const { return &_class_data_; }
+
+
+void PrimaryCheckpointPB::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrimaryCheckpointPB*>(&to_msg);
+  auto& from = static_cast<const PrimaryCheckpointPB&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:logtail.PrimaryCheckpointPB)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_config_name(from._internal_config_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_log_path(from._internal_log_path());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_real_path(from._internal_real_path());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.concurrency_ = from._impl_.concurrency_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.sig_size_ = from._impl_.sig_size_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.sig_hash_ = from._impl_.sig_hash_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.dev_ = from._impl_.dev_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.inode_ = from._impl_.inode_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_update_time(from._internal_update_time());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrimaryCheckpointPB::CopyFrom(const PrimaryCheckpointPB& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:logtail.PrimaryCheckpointPB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrimaryCheckpointPB::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrimaryCheckpointPB::InternalSwap(PrimaryCheckpointPB* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.config_name_, lhs_arena,
+      &other->_impl_.config_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.log_path_, lhs_arena,
+      &other->_impl_.log_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.real_path_, lhs_arena,
+      &other->_impl_.real_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrimaryCheckpointPB, _impl_.update_time_)
+      + sizeof(PrimaryCheckpointPB::_impl_.update_time_)
+      - PROTOBUF_FIELD_OFFSET(PrimaryCheckpointPB, _impl_.concurrency_)>(
+          reinterpret_cast<char*>(&_impl_.concurrency_),
+          reinterpret_cast<char*>(&other->_impl_.concurrency_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrimaryCheckpointPB::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_checkpoint_2eproto_getter, &descriptor_table_checkpoint_2eproto_once,
+      file_level_metadata_checkpoint_2eproto[0]);
+}
+
+// ===================================================================
+
+class RangeCheckpointPB::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RangeCheckpointPB>()._impl_._has_bits_);
+  static void set_has_hash_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sequence_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_read_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_read_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_update_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_committed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
+
+RangeCheckpointPB::RangeCheckpointPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:logtail.RangeCheckpointPB)
+}
+RangeCheckpointPB::RangeCheckpointPB(const RangeCheckpointPB& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeCheckpointPB* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_key_){}
+    , decltype(_impl_.sequence_id_){}
+    , decltype(_impl_.read_offset_){}
+    , decltype(_impl_.read_length_){}
+    , decltype(_impl_.update_time_){}
+    , decltype(_impl_.committed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hash_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hash_key()) {
+    _this->_impl_.hash_key_.Set(from._internal_hash_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sequence_id_, &from._impl_.sequence_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.committed_) -
+    reinterpret_cast<char*>(&_impl_.sequence_id_)) + sizeof(_impl_.committed_));
+  // @@protoc_insertion_point(copy_constructor:logtail.RangeCheckpointPB)
+}
+
+inline void RangeCheckpointPB::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_key_){}
+    , decltype(_impl_.sequence_id_){uint64_t{0u}}
+    , decltype(_impl_.read_offset_){uint64_t{0u}}
+    , decltype(_impl_.read_length_){uint64_t{0u}}
+    , decltype(_impl_.update_time_){0}
+    , decltype(_impl_.committed_){false}
+  };
+  _impl_.hash_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RangeCheckpointPB::~RangeCheckpointPB() {
+  // @@protoc_insertion_point(destructor:logtail.RangeCheckpointPB)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RangeCheckpointPB::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hash_key_.Destroy();
+}
+
+void RangeCheckpointPB::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RangeCheckpointPB::Clear() {
+// @@protoc_insertion_point(message_clear_start:logtail.RangeCheckpointPB)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.hash_key_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.sequence_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.committed_) -
+        reinterpret_cast<char*>(&_impl_.sequence_id_)) + sizeof(_impl_.committed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RangeCheckpointPB::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string hash_key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_hash_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "logtail.RangeCheckpointPB.hash_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sequence_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sequence_id(&has_bits);
+          _impl_.sequence_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 read_offset = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_read_offset(&has_bits);
+          _impl_.read_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 read_length = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_read_length(&has_bits);
+          _impl_.read_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 update_time = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_update_time(&has_bits);
+          _impl_.update_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool committed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_committed(&has_bits);
+          _impl_.committed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RangeCheckpointPB::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:logtail.RangeCheckpointPB)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string hash_key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_hash_key().data(), static_cast<int>(this->_internal_hash_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "logtail.RangeCheckpointPB.hash_key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_hash_key(), target);
+  }
+
+  // required uint64 sequence_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sequence_id(), target);
+  }
+
+  // required uint64 read_offset = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_read_offset(), target);
+  }
+
+  // required uint64 read_length = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_read_length(), target);
+  }
+
+  // required int32 update_time = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_update_time(), target);
+  }
+
+  // required bool committed = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_committed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:logtail.RangeCheckpointPB)
+  return target;
+}
+
+size_t RangeCheckpointPB::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:logtail.RangeCheckpointPB)
+  size_t total_size = 0;
+
+  if (_internal_has_hash_key()) {
+    // required string hash_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hash_key());
+  }
+
+  if (_internal_has_sequence_id()) {
+    // required uint64 sequence_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_id());
+  }
+
+  if (_internal_has_read_offset()) {
+    // required uint64 read_offset = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_offset());
+  }
+
+  if (_internal_has_read_length()) {
+    // required uint64 read_length = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_length());
+  }
+
+  if (_internal_has_update_time()) {
+    // required int32 update_time = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_update_time());
+  }
+
+  if (_internal_has_committed()) {
+    // required bool committed = 6;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t RangeCheckpointPB::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:logtail.RangeCheckpointPB)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required string hash_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hash_key());
+
+    // required uint64 sequence_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_id());
+
+    // required uint64 read_offset = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_offset());
+
+    // required uint64 read_length = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_length());
+
+    // required int32 update_time = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_update_time());
+
+    // required bool committed = 6;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeCheckpointPB::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeCheckpointPB::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeCheckpointPB::GetClassData() const { return &_class_data_; }
+
+
+void RangeCheckpointPB::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeCheckpointPB*>(&to_msg);
+  auto& from = static_cast<const RangeCheckpointPB&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:logtail.RangeCheckpointPB)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_hash_key(from._internal_hash_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sequence_id_ = from._impl_.sequence_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.read_offset_ = from._impl_.read_offset_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.read_length_ = from._impl_.read_length_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.update_time_ = from._impl_.update_time_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.committed_ = from._impl_.committed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RangeCheckpointPB::CopyFrom(const RangeCheckpointPB& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:logtail.RangeCheckpointPB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RangeCheckpointPB::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RangeCheckpointPB::InternalSwap(RangeCheckpointPB* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_key_, lhs_arena,
+      &other->_impl_.hash_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RangeCheckpointPB, _impl_.committed_)
+      + sizeof(RangeCheckpointPB::_impl_.committed_)
+      - PROTOBUF_FIELD_OFFSET(RangeCheckpointPB, _impl_.sequence_id_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_id_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RangeCheckpointPB::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_checkpoint_2eproto_getter, &descriptor_table_checkpoint_2eproto_once,
+      file_level_metadata_checkpoint_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace logtail
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::logtail::PrimaryCheckpointPB*
+Arena::CreateMaybeMessage< ::logtail::PrimaryCheckpointPB >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::logtail::PrimaryCheckpointPB >(arena);
+}
+template<> PROTOBUF_NOINLINE ::logtail::RangeCheckpointPB*
+Arena::CreateMaybeMessage< ::logtail::RangeCheckpointPB >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::logtail::RangeCheckpointPB >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1210 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: checkpoint.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_checkpoint_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_checkpoint_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_checkpoint_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_checkpoint_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_checkpoint_2eproto;
+namespace logtail {
+class PrimaryCheckpointPB;
+struct PrimaryCheckpointPBDefaultTypeInternal;
+extern PrimaryCheckpointPBDefaultTypeInternal _PrimaryCheckpointPB_default_instance_;
+class RangeCheckpointPB;
+struct RangeCheckpointPBDefaultTypeInternal;
+extern RangeCheckpointPBDefaultTypeInternal _RangeCheckpointPB_default_instance_;
+}  // namespace logtail
+PROTOBUF_NAMESPACE_OPEN
+template<> ::logtail::PrimaryCheckpointPB* Arena::CreateMaybeMessage<::logtail::PrimaryCheckpointPB>(Arena*);
+template<> ::logtail::RangeCheckpointPB* Arena::CreateMaybeMessage<::logtail::RangeCheckpointPB>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace logtail {
+
+// ===================================================================
+
+class PrimaryCheckpointPB final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:logtail.PrimaryCheckpointPB) */ {
+ public:
+  inline PrimaryCheckpointPB() : PrimaryCheckpointPB(nullptr) {}
+  ~PrimaryCheckpointPB() override;
+  explicit PROTOBUF_CONSTEXPR PrimaryCheckpointPB(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrimaryCheckpointPB(const PrimaryCheckpointPB& from);
+  PrimaryCheckpointPB(PrimaryCheckpointPB&& from) noexcept
+    : PrimaryCheckpointPB() {
+    *this = ::std::move(from);
+  }
+
+  inline PrimaryCheckpointPB& operator=(const PrimaryCheckpointPB& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrimaryCheckpointPB& operator=(PrimaryCheckpointPB&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrimaryCheckpointPB& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrimaryCheckpointPB* internal_default_instance() {
+    return reinterpret_cast<const PrimaryCheckpointPB*>(
+               &_PrimaryCheckpointPB_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PrimaryCheckpointPB& a, PrimaryCheckpointPB& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrimaryCheckpointPB* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrimaryCheckpointPB* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrimaryCheckpointPB* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrimaryCheckpointPB>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrimaryCheckpointPB& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrimaryCheckpointPB& from) {
+    PrimaryCheckpointPB::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrimaryCheckpointPB* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "logtail.PrimaryCheckpointPB";
+  }
+  protected:
+  explicit PrimaryCheckpointPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConfigNameFieldNumber = 4,
+    kLogPathFieldNumber = 5,
+    kRealPathFieldNumber = 6,
+    kConcurrencyFieldNumber = 1,
+    kSigSizeFieldNumber = 2,
+    kSigHashFieldNumber = 3,
+    kDevFieldNumber = 7,
+    kInodeFieldNumber = 8,
+    kUpdateTimeFieldNumber = 9,
+  };
+  // optional string config_name = 4;
+  bool has_config_name() const;
+  private:
+  bool _internal_has_config_name() const;
+  public:
+  void clear_config_name();
+  const std::string& config_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_config_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_config_name();
+  PROTOBUF_NODISCARD std::string* release_config_name();
+  void set_allocated_config_name(std::string* config_name);
+  private:
+  const std::string& _internal_config_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_config_name(const std::string& value);
+  std::string* _internal_mutable_config_name();
+  public:
+
+  // optional string log_path = 5;
+  bool has_log_path() const;
+  private:
+  bool _internal_has_log_path() const;
+  public:
+  void clear_log_path();
+  const std::string& log_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_log_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_log_path();
+  PROTOBUF_NODISCARD std::string* release_log_path();
+  void set_allocated_log_path(std::string* log_path);
+  private:
+  const std::string& _internal_log_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_log_path(const std::string& value);
+  std::string* _internal_mutable_log_path();
+  public:
+
+  // optional string real_path = 6;
+  bool has_real_path() const;
+  private:
+  bool _internal_has_real_path() const;
+  public:
+  void clear_real_path();
+  const std::string& real_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_real_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_real_path();
+  PROTOBUF_NODISCARD std::string* release_real_path();
+  void set_allocated_real_path(std::string* real_path);
+  private:
+  const std::string& _internal_real_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_real_path(const std::string& value);
+  std::string* _internal_mutable_real_path();
+  public:
+
+  // required uint32 concurrency = 1;
+  bool has_concurrency() const;
+  private:
+  bool _internal_has_concurrency() const;
+  public:
+  void clear_concurrency();
+  uint32_t concurrency() const;
+  void set_concurrency(uint32_t value);
+  private:
+  uint32_t _internal_concurrency() const;
+  void _internal_set_concurrency(uint32_t value);
+  public:
+
+  // required uint32 sig_size = 2;
+  bool has_sig_size() const;
+  private:
+  bool _internal_has_sig_size() const;
+  public:
+  void clear_sig_size();
+  uint32_t sig_size() const;
+  void set_sig_size(uint32_t value);
+  private:
+  uint32_t _internal_sig_size() const;
+  void _internal_set_sig_size(uint32_t value);
+  public:
+
+  // required uint64 sig_hash = 3;
+  bool has_sig_hash() const;
+  private:
+  bool _internal_has_sig_hash() const;
+  public:
+  void clear_sig_hash();
+  uint64_t sig_hash() const;
+  void set_sig_hash(uint64_t value);
+  private:
+  uint64_t _internal_sig_hash() const;
+  void _internal_set_sig_hash(uint64_t value);
+  public:
+
+  // optional uint64 dev = 7;
+  bool has_dev() const;
+  private:
+  bool _internal_has_dev() const;
+  public:
+  void clear_dev();
+  uint64_t dev() const;
+  void set_dev(uint64_t value);
+  private:
+  uint64_t _internal_dev() const;
+  void _internal_set_dev(uint64_t value);
+  public:
+
+  // optional uint64 inode = 8;
+  bool has_inode() const;
+  private:
+  bool _internal_has_inode() const;
+  public:
+  void clear_inode();
+  uint64_t inode() const;
+  void set_inode(uint64_t value);
+  private:
+  uint64_t _internal_inode() const;
+  void _internal_set_inode(uint64_t value);
+  public:
+
+  // optional int32 update_time = 9;
+  bool has_update_time() const;
+  private:
+  bool _internal_has_update_time() const;
+  public:
+  void clear_update_time();
+  int32_t update_time() const;
+  void set_update_time(int32_t value);
+  private:
+  int32_t _internal_update_time() const;
+  void _internal_set_update_time(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:logtail.PrimaryCheckpointPB)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr config_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr log_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr real_path_;
+    uint32_t concurrency_;
+    uint32_t sig_size_;
+    uint64_t sig_hash_;
+    uint64_t dev_;
+    uint64_t inode_;
+    int32_t update_time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_checkpoint_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeCheckpointPB final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:logtail.RangeCheckpointPB) */ {
+ public:
+  inline RangeCheckpointPB() : RangeCheckpointPB(nullptr) {}
+  ~RangeCheckpointPB() override;
+  explicit PROTOBUF_CONSTEXPR RangeCheckpointPB(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeCheckpointPB(const RangeCheckpointPB& from);
+  RangeCheckpointPB(RangeCheckpointPB&& from) noexcept
+    : RangeCheckpointPB() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeCheckpointPB& operator=(const RangeCheckpointPB& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeCheckpointPB& operator=(RangeCheckpointPB&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeCheckpointPB& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeCheckpointPB* internal_default_instance() {
+    return reinterpret_cast<const RangeCheckpointPB*>(
+               &_RangeCheckpointPB_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RangeCheckpointPB& a, RangeCheckpointPB& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeCheckpointPB* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeCheckpointPB* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeCheckpointPB* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeCheckpointPB>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeCheckpointPB& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeCheckpointPB& from) {
+    RangeCheckpointPB::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeCheckpointPB* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "logtail.RangeCheckpointPB";
+  }
+  protected:
+  explicit RangeCheckpointPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHashKeyFieldNumber = 1,
+    kSequenceIdFieldNumber = 2,
+    kReadOffsetFieldNumber = 3,
+    kReadLengthFieldNumber = 4,
+    kUpdateTimeFieldNumber = 5,
+    kCommittedFieldNumber = 6,
+  };
+  // required string hash_key = 1;
+  bool has_hash_key() const;
+  private:
+  bool _internal_has_hash_key() const;
+  public:
+  void clear_hash_key();
+  const std::string& hash_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash_key();
+  PROTOBUF_NODISCARD std::string* release_hash_key();
+  void set_allocated_hash_key(std::string* hash_key);
+  private:
+  const std::string& _internal_hash_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash_key(const std::string& value);
+  std::string* _internal_mutable_hash_key();
+  public:
+
+  // required uint64 sequence_id = 2;
+  bool has_sequence_id() const;
+  private:
+  bool _internal_has_sequence_id() const;
+  public:
+  void clear_sequence_id();
+  uint64_t sequence_id() const;
+  void set_sequence_id(uint64_t value);
+  private:
+  uint64_t _internal_sequence_id() const;
+  void _internal_set_sequence_id(uint64_t value);
+  public:
+
+  // required uint64 read_offset = 3;
+  bool has_read_offset() const;
+  private:
+  bool _internal_has_read_offset() const;
+  public:
+  void clear_read_offset();
+  uint64_t read_offset() const;
+  void set_read_offset(uint64_t value);
+  private:
+  uint64_t _internal_read_offset() const;
+  void _internal_set_read_offset(uint64_t value);
+  public:
+
+  // required uint64 read_length = 4;
+  bool has_read_length() const;
+  private:
+  bool _internal_has_read_length() const;
+  public:
+  void clear_read_length();
+  uint64_t read_length() const;
+  void set_read_length(uint64_t value);
+  private:
+  uint64_t _internal_read_length() const;
+  void _internal_set_read_length(uint64_t value);
+  public:
+
+  // required int32 update_time = 5;
+  bool has_update_time() const;
+  private:
+  bool _internal_has_update_time() const;
+  public:
+  void clear_update_time();
+  int32_t update_time() const;
+  void set_update_time(int32_t value);
+  private:
+  int32_t _internal_update_time() const;
+  void _internal_set_update_time(int32_t value);
+  public:
+
+  // required bool committed = 6;
+  bool has_committed() const;
+  private:
+  bool _internal_has_committed() const;
+  public:
+  void clear_committed();
+  bool committed() const;
+  void set_committed(bool value);
+  private:
+  bool _internal_committed() const;
+  void _internal_set_committed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:logtail.RangeCheckpointPB)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_key_;
+    uint64_t sequence_id_;
+    uint64_t read_offset_;
+    uint64_t read_length_;
+    int32_t update_time_;
+    bool committed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_checkpoint_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PrimaryCheckpointPB
+
+// required uint32 concurrency = 1;
+inline bool PrimaryCheckpointPB::_internal_has_concurrency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_concurrency() const {
+  return _internal_has_concurrency();
+}
+inline void PrimaryCheckpointPB::clear_concurrency() {
+  _impl_.concurrency_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t PrimaryCheckpointPB::_internal_concurrency() const {
+  return _impl_.concurrency_;
+}
+inline uint32_t PrimaryCheckpointPB::concurrency() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.concurrency)
+  return _internal_concurrency();
+}
+inline void PrimaryCheckpointPB::_internal_set_concurrency(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.concurrency_ = value;
+}
+inline void PrimaryCheckpointPB::set_concurrency(uint32_t value) {
+  _internal_set_concurrency(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.concurrency)
+}
+
+// required uint32 sig_size = 2;
+inline bool PrimaryCheckpointPB::_internal_has_sig_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_sig_size() const {
+  return _internal_has_sig_size();
+}
+inline void PrimaryCheckpointPB::clear_sig_size() {
+  _impl_.sig_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t PrimaryCheckpointPB::_internal_sig_size() const {
+  return _impl_.sig_size_;
+}
+inline uint32_t PrimaryCheckpointPB::sig_size() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.sig_size)
+  return _internal_sig_size();
+}
+inline void PrimaryCheckpointPB::_internal_set_sig_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.sig_size_ = value;
+}
+inline void PrimaryCheckpointPB::set_sig_size(uint32_t value) {
+  _internal_set_sig_size(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.sig_size)
+}
+
+// required uint64 sig_hash = 3;
+inline bool PrimaryCheckpointPB::_internal_has_sig_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_sig_hash() const {
+  return _internal_has_sig_hash();
+}
+inline void PrimaryCheckpointPB::clear_sig_hash() {
+  _impl_.sig_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t PrimaryCheckpointPB::_internal_sig_hash() const {
+  return _impl_.sig_hash_;
+}
+inline uint64_t PrimaryCheckpointPB::sig_hash() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.sig_hash)
+  return _internal_sig_hash();
+}
+inline void PrimaryCheckpointPB::_internal_set_sig_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.sig_hash_ = value;
+}
+inline void PrimaryCheckpointPB::set_sig_hash(uint64_t value) {
+  _internal_set_sig_hash(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.sig_hash)
+}
+
+// optional string config_name = 4;
+inline bool PrimaryCheckpointPB::_internal_has_config_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_config_name() const {
+  return _internal_has_config_name();
+}
+inline void PrimaryCheckpointPB::clear_config_name() {
+  _impl_.config_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PrimaryCheckpointPB::config_name() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.config_name)
+  return _internal_config_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrimaryCheckpointPB::set_config_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.config_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.config_name)
+}
+inline std::string* PrimaryCheckpointPB::mutable_config_name() {
+  std::string* _s = _internal_mutable_config_name();
+  // @@protoc_insertion_point(field_mutable:logtail.PrimaryCheckpointPB.config_name)
+  return _s;
+}
+inline const std::string& PrimaryCheckpointPB::_internal_config_name() const {
+  return _impl_.config_name_.Get();
+}
+inline void PrimaryCheckpointPB::_internal_set_config_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.config_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::_internal_mutable_config_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.config_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::release_config_name() {
+  // @@protoc_insertion_point(field_release:logtail.PrimaryCheckpointPB.config_name)
+  if (!_internal_has_config_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.config_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.config_name_.IsDefault()) {
+    _impl_.config_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PrimaryCheckpointPB::set_allocated_config_name(std::string* config_name) {
+  if (config_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.config_name_.SetAllocated(config_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.config_name_.IsDefault()) {
+    _impl_.config_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:logtail.PrimaryCheckpointPB.config_name)
+}
+
+// optional string log_path = 5;
+inline bool PrimaryCheckpointPB::_internal_has_log_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_log_path() const {
+  return _internal_has_log_path();
+}
+inline void PrimaryCheckpointPB::clear_log_path() {
+  _impl_.log_path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PrimaryCheckpointPB::log_path() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.log_path)
+  return _internal_log_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrimaryCheckpointPB::set_log_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.log_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.log_path)
+}
+inline std::string* PrimaryCheckpointPB::mutable_log_path() {
+  std::string* _s = _internal_mutable_log_path();
+  // @@protoc_insertion_point(field_mutable:logtail.PrimaryCheckpointPB.log_path)
+  return _s;
+}
+inline const std::string& PrimaryCheckpointPB::_internal_log_path() const {
+  return _impl_.log_path_.Get();
+}
+inline void PrimaryCheckpointPB::_internal_set_log_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.log_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::_internal_mutable_log_path() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.log_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::release_log_path() {
+  // @@protoc_insertion_point(field_release:logtail.PrimaryCheckpointPB.log_path)
+  if (!_internal_has_log_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.log_path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.log_path_.IsDefault()) {
+    _impl_.log_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PrimaryCheckpointPB::set_allocated_log_path(std::string* log_path) {
+  if (log_path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.log_path_.SetAllocated(log_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.log_path_.IsDefault()) {
+    _impl_.log_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:logtail.PrimaryCheckpointPB.log_path)
+}
+
+// optional string real_path = 6;
+inline bool PrimaryCheckpointPB::_internal_has_real_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_real_path() const {
+  return _internal_has_real_path();
+}
+inline void PrimaryCheckpointPB::clear_real_path() {
+  _impl_.real_path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& PrimaryCheckpointPB::real_path() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.real_path)
+  return _internal_real_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrimaryCheckpointPB::set_real_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.real_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.real_path)
+}
+inline std::string* PrimaryCheckpointPB::mutable_real_path() {
+  std::string* _s = _internal_mutable_real_path();
+  // @@protoc_insertion_point(field_mutable:logtail.PrimaryCheckpointPB.real_path)
+  return _s;
+}
+inline const std::string& PrimaryCheckpointPB::_internal_real_path() const {
+  return _impl_.real_path_.Get();
+}
+inline void PrimaryCheckpointPB::_internal_set_real_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.real_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::_internal_mutable_real_path() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.real_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrimaryCheckpointPB::release_real_path() {
+  // @@protoc_insertion_point(field_release:logtail.PrimaryCheckpointPB.real_path)
+  if (!_internal_has_real_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.real_path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.real_path_.IsDefault()) {
+    _impl_.real_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PrimaryCheckpointPB::set_allocated_real_path(std::string* real_path) {
+  if (real_path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.real_path_.SetAllocated(real_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.real_path_.IsDefault()) {
+    _impl_.real_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:logtail.PrimaryCheckpointPB.real_path)
+}
+
+// optional uint64 dev = 7;
+inline bool PrimaryCheckpointPB::_internal_has_dev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_dev() const {
+  return _internal_has_dev();
+}
+inline void PrimaryCheckpointPB::clear_dev() {
+  _impl_.dev_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t PrimaryCheckpointPB::_internal_dev() const {
+  return _impl_.dev_;
+}
+inline uint64_t PrimaryCheckpointPB::dev() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.dev)
+  return _internal_dev();
+}
+inline void PrimaryCheckpointPB::_internal_set_dev(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.dev_ = value;
+}
+inline void PrimaryCheckpointPB::set_dev(uint64_t value) {
+  _internal_set_dev(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.dev)
+}
+
+// optional uint64 inode = 8;
+inline bool PrimaryCheckpointPB::_internal_has_inode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_inode() const {
+  return _internal_has_inode();
+}
+inline void PrimaryCheckpointPB::clear_inode() {
+  _impl_.inode_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t PrimaryCheckpointPB::_internal_inode() const {
+  return _impl_.inode_;
+}
+inline uint64_t PrimaryCheckpointPB::inode() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.inode)
+  return _internal_inode();
+}
+inline void PrimaryCheckpointPB::_internal_set_inode(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.inode_ = value;
+}
+inline void PrimaryCheckpointPB::set_inode(uint64_t value) {
+  _internal_set_inode(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.inode)
+}
+
+// optional int32 update_time = 9;
+inline bool PrimaryCheckpointPB::_internal_has_update_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool PrimaryCheckpointPB::has_update_time() const {
+  return _internal_has_update_time();
+}
+inline void PrimaryCheckpointPB::clear_update_time() {
+  _impl_.update_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t PrimaryCheckpointPB::_internal_update_time() const {
+  return _impl_.update_time_;
+}
+inline int32_t PrimaryCheckpointPB::update_time() const {
+  // @@protoc_insertion_point(field_get:logtail.PrimaryCheckpointPB.update_time)
+  return _internal_update_time();
+}
+inline void PrimaryCheckpointPB::_internal_set_update_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.update_time_ = value;
+}
+inline void PrimaryCheckpointPB::set_update_time(int32_t value) {
+  _internal_set_update_time(value);
+  // @@protoc_insertion_point(field_set:logtail.PrimaryCheckpointPB.update_time)
+}
+
+// -------------------------------------------------------------------
+
+// RangeCheckpointPB
+
+// required string hash_key = 1;
+inline bool RangeCheckpointPB::_internal_has_hash_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_hash_key() const {
+  return _internal_has_hash_key();
+}
+inline void RangeCheckpointPB::clear_hash_key() {
+  _impl_.hash_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RangeCheckpointPB::hash_key() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.hash_key)
+  return _internal_hash_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeCheckpointPB::set_hash_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.hash_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.hash_key)
+}
+inline std::string* RangeCheckpointPB::mutable_hash_key() {
+  std::string* _s = _internal_mutable_hash_key();
+  // @@protoc_insertion_point(field_mutable:logtail.RangeCheckpointPB.hash_key)
+  return _s;
+}
+inline const std::string& RangeCheckpointPB::_internal_hash_key() const {
+  return _impl_.hash_key_.Get();
+}
+inline void RangeCheckpointPB::_internal_set_hash_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hash_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeCheckpointPB::_internal_mutable_hash_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.hash_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeCheckpointPB::release_hash_key() {
+  // @@protoc_insertion_point(field_release:logtail.RangeCheckpointPB.hash_key)
+  if (!_internal_has_hash_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.hash_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_key_.IsDefault()) {
+    _impl_.hash_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RangeCheckpointPB::set_allocated_hash_key(std::string* hash_key) {
+  if (hash_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.hash_key_.SetAllocated(hash_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_key_.IsDefault()) {
+    _impl_.hash_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:logtail.RangeCheckpointPB.hash_key)
+}
+
+// required uint64 sequence_id = 2;
+inline bool RangeCheckpointPB::_internal_has_sequence_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_sequence_id() const {
+  return _internal_has_sequence_id();
+}
+inline void RangeCheckpointPB::clear_sequence_id() {
+  _impl_.sequence_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t RangeCheckpointPB::_internal_sequence_id() const {
+  return _impl_.sequence_id_;
+}
+inline uint64_t RangeCheckpointPB::sequence_id() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.sequence_id)
+  return _internal_sequence_id();
+}
+inline void RangeCheckpointPB::_internal_set_sequence_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sequence_id_ = value;
+}
+inline void RangeCheckpointPB::set_sequence_id(uint64_t value) {
+  _internal_set_sequence_id(value);
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.sequence_id)
+}
+
+// required uint64 read_offset = 3;
+inline bool RangeCheckpointPB::_internal_has_read_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_read_offset() const {
+  return _internal_has_read_offset();
+}
+inline void RangeCheckpointPB::clear_read_offset() {
+  _impl_.read_offset_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t RangeCheckpointPB::_internal_read_offset() const {
+  return _impl_.read_offset_;
+}
+inline uint64_t RangeCheckpointPB::read_offset() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.read_offset)
+  return _internal_read_offset();
+}
+inline void RangeCheckpointPB::_internal_set_read_offset(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.read_offset_ = value;
+}
+inline void RangeCheckpointPB::set_read_offset(uint64_t value) {
+  _internal_set_read_offset(value);
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.read_offset)
+}
+
+// required uint64 read_length = 4;
+inline bool RangeCheckpointPB::_internal_has_read_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_read_length() const {
+  return _internal_has_read_length();
+}
+inline void RangeCheckpointPB::clear_read_length() {
+  _impl_.read_length_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t RangeCheckpointPB::_internal_read_length() const {
+  return _impl_.read_length_;
+}
+inline uint64_t RangeCheckpointPB::read_length() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.read_length)
+  return _internal_read_length();
+}
+inline void RangeCheckpointPB::_internal_set_read_length(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.read_length_ = value;
+}
+inline void RangeCheckpointPB::set_read_length(uint64_t value) {
+  _internal_set_read_length(value);
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.read_length)
+}
+
+// required int32 update_time = 5;
+inline bool RangeCheckpointPB::_internal_has_update_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_update_time() const {
+  return _internal_has_update_time();
+}
+inline void RangeCheckpointPB::clear_update_time() {
+  _impl_.update_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t RangeCheckpointPB::_internal_update_time() const {
+  return _impl_.update_time_;
+}
+inline int32_t RangeCheckpointPB::update_time() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.update_time)
+  return _internal_update_time();
+}
+inline void RangeCheckpointPB::_internal_set_update_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.update_time_ = value;
+}
+inline void RangeCheckpointPB::set_update_time(int32_t value) {
+  _internal_set_update_time(value);
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.update_time)
+}
+
+// required bool committed = 6;
+inline bool RangeCheckpointPB::_internal_has_committed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool RangeCheckpointPB::has_committed() const {
+  return _internal_has_committed();
+}
+inline void RangeCheckpointPB::clear_committed() {
+  _impl_.committed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool RangeCheckpointPB::_internal_committed() const {
+  return _impl_.committed_;
+}
+inline bool RangeCheckpointPB::committed() const {
+  // @@protoc_insertion_point(field_get:logtail.RangeCheckpointPB.committed)
+  return _internal_committed();
+}
+inline void RangeCheckpointPB::_internal_set_committed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.committed_ = value;
+}
+inline void RangeCheckpointPB::set_committed(bool value) {
+  _internal_set_committed(value);
+  // @@protoc_insertion_point(field_set:logtail.RangeCheckpointPB.committed)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace logtail
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_checkpoint_2eproto
@@ -0,0 +1,749 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: logtail_buffer_meta.proto
+
+#include "logtail_buffer_meta.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace sls_logs {
+PROTOBUF_CONSTEXPR LogtailBufferMeta::LogtailBufferMeta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.project_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.endpoint_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.aliuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logstore_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shardhashkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.datatype_)*/0
+  , /*decltype(_impl_.rawsize_)*/0
+  , /*decltype(_impl_.compresstype_)*/0
+  , /*decltype(_impl_.telemetrytype_)*/0} {}
+struct LogtailBufferMetaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogtailBufferMetaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogtailBufferMetaDefaultTypeInternal() {}
+  union {
+    LogtailBufferMeta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogtailBufferMetaDefaultTypeInternal _LogtailBufferMeta_default_instance_;
+}  // namespace sls_logs
+static ::_pb::Metadata file_level_metadata_logtail_5fbuffer_5fmeta_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_logtail_5fbuffer_5fmeta_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_logtail_5fbuffer_5fmeta_2eproto = nullptr;
+
+const uint32_t TableStruct_logtail_5fbuffer_5fmeta_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.project_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.endpoint_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.aliuid_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.logstore_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.datatype_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.rawsize_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.shardhashkey_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.compresstype_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogtailBufferMeta, _impl_.telemetrytype_),
+  0,
+  1,
+  2,
+  3,
+  5,
+  6,
+  4,
+  7,
+  8,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::sls_logs::LogtailBufferMeta)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sls_logs::_LogtailBufferMeta_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_logtail_5fbuffer_5fmeta_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031logtail_buffer_meta.proto\022\010sls_logs\032\016s"
+  "ls_logs.proto\"\365\001\n\021LogtailBufferMeta\022\017\n\007p"
+  "roject\030\001 \002(\t\022\020\n\010endpoint\030\002 \002(\t\022\016\n\006aliuid"
+  "\030\003 \002(\t\022\020\n\010logstore\030\004 \001(\t\022\020\n\010datatype\030\005 \001"
+  "(\005\022\017\n\007rawsize\030\006 \001(\005\022\024\n\014shardhashkey\030\007 \001("
+  "\t\022/\n\014compresstype\030\010 \001(\0162\031.sls_logs.SlsCo"
+  "mpressType\0221\n\rtelemetrytype\030\t \001(\0162\032.sls_"
+  "logs.SlsTelemetryType"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_logtail_5fbuffer_5fmeta_2eproto_deps[1] = {
+  &::descriptor_table_sls_5flogs_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_logtail_5fbuffer_5fmeta_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_logtail_5fbuffer_5fmeta_2eproto = {
+    false, false, 301, descriptor_table_protodef_logtail_5fbuffer_5fmeta_2eproto,
+    "logtail_buffer_meta.proto",
+    &descriptor_table_logtail_5fbuffer_5fmeta_2eproto_once, descriptor_table_logtail_5fbuffer_5fmeta_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_logtail_5fbuffer_5fmeta_2eproto::offsets,
+    file_level_metadata_logtail_5fbuffer_5fmeta_2eproto, file_level_enum_descriptors_logtail_5fbuffer_5fmeta_2eproto,
+    file_level_service_descriptors_logtail_5fbuffer_5fmeta_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_logtail_5fbuffer_5fmeta_2eproto_getter() {
+  return &descriptor_table_logtail_5fbuffer_5fmeta_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_logtail_5fbuffer_5fmeta_2eproto(&descriptor_table_logtail_5fbuffer_5fmeta_2eproto);
+namespace sls_logs {
+
+// ===================================================================
+
+class LogtailBufferMeta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogtailBufferMeta>()._impl_._has_bits_);
+  static void set_has_project(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_endpoint(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_aliuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_logstore(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_datatype(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_rawsize(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_shardhashkey(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_compresstype(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_telemetrytype(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+LogtailBufferMeta::LogtailBufferMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.LogtailBufferMeta)
+}
+LogtailBufferMeta::LogtailBufferMeta(const LogtailBufferMeta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogtailBufferMeta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_){}
+    , decltype(_impl_.endpoint_){}
+    , decltype(_impl_.aliuid_){}
+    , decltype(_impl_.logstore_){}
+    , decltype(_impl_.shardhashkey_){}
+    , decltype(_impl_.datatype_){}
+    , decltype(_impl_.rawsize_){}
+    , decltype(_impl_.compresstype_){}
+    , decltype(_impl_.telemetrytype_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.project_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_project()) {
+    _this->_impl_.project_.Set(from._internal_project(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.endpoint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endpoint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_endpoint()) {
+    _this->_impl_.endpoint_.Set(from._internal_endpoint(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.aliuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aliuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_aliuid()) {
+    _this->_impl_.aliuid_.Set(from._internal_aliuid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.logstore_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logstore_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_logstore()) {
+    _this->_impl_.logstore_.Set(from._internal_logstore(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.shardhashkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shardhashkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_shardhashkey()) {
+    _this->_impl_.shardhashkey_.Set(from._internal_shardhashkey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.datatype_, &from._impl_.datatype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.telemetrytype_) -
+    reinterpret_cast<char*>(&_impl_.datatype_)) + sizeof(_impl_.telemetrytype_));
+  // @@protoc_insertion_point(copy_constructor:sls_logs.LogtailBufferMeta)
+}
+
+inline void LogtailBufferMeta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_){}
+    , decltype(_impl_.endpoint_){}
+    , decltype(_impl_.aliuid_){}
+    , decltype(_impl_.logstore_){}
+    , decltype(_impl_.shardhashkey_){}
+    , decltype(_impl_.datatype_){0}
+    , decltype(_impl_.rawsize_){0}
+    , decltype(_impl_.compresstype_){0}
+    , decltype(_impl_.telemetrytype_){0}
+  };
+  _impl_.project_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.endpoint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endpoint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.aliuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.aliuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.logstore_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logstore_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.shardhashkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shardhashkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogtailBufferMeta::~LogtailBufferMeta() {
+  // @@protoc_insertion_point(destructor:sls_logs.LogtailBufferMeta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogtailBufferMeta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.project_.Destroy();
+  _impl_.endpoint_.Destroy();
+  _impl_.aliuid_.Destroy();
+  _impl_.logstore_.Destroy();
+  _impl_.shardhashkey_.Destroy();
+}
+
+void LogtailBufferMeta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogtailBufferMeta::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.LogtailBufferMeta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.project_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.endpoint_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.aliuid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.logstore_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.shardhashkey_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.datatype_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.compresstype_) -
+        reinterpret_cast<char*>(&_impl_.datatype_)) + sizeof(_impl_.compresstype_));
+  }
+  _impl_.telemetrytype_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogtailBufferMeta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string project = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_project();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogtailBufferMeta.project");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string endpoint = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_endpoint();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogtailBufferMeta.endpoint");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string aliuid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_aliuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogtailBufferMeta.aliuid");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string logstore = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_logstore();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogtailBufferMeta.logstore");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 datatype = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_datatype(&has_bits);
+          _impl_.datatype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 rawsize = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_rawsize(&has_bits);
+          _impl_.rawsize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string shardhashkey = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_shardhashkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogtailBufferMeta.shardhashkey");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sls_logs.SlsCompressType compresstype = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sls_logs::SlsCompressType_IsValid(val))) {
+            _internal_set_compresstype(static_cast<::sls_logs::SlsCompressType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(8, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sls_logs.SlsTelemetryType telemetrytype = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sls_logs::SlsTelemetryType_IsValid(val))) {
+            _internal_set_telemetrytype(static_cast<::sls_logs::SlsTelemetryType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(9, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogtailBufferMeta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.LogtailBufferMeta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string project = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_project().data(), static_cast<int>(this->_internal_project().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogtailBufferMeta.project");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_project(), target);
+  }
+
+  // required string endpoint = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_endpoint().data(), static_cast<int>(this->_internal_endpoint().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogtailBufferMeta.endpoint");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_endpoint(), target);
+  }
+
+  // required string aliuid = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_aliuid().data(), static_cast<int>(this->_internal_aliuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogtailBufferMeta.aliuid");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_aliuid(), target);
+  }
+
+  // optional string logstore = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_logstore().data(), static_cast<int>(this->_internal_logstore().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogtailBufferMeta.logstore");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_logstore(), target);
+  }
+
+  // optional int32 datatype = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_datatype(), target);
+  }
+
+  // optional int32 rawsize = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_rawsize(), target);
+  }
+
+  // optional string shardhashkey = 7;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_shardhashkey().data(), static_cast<int>(this->_internal_shardhashkey().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogtailBufferMeta.shardhashkey");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_shardhashkey(), target);
+  }
+
+  // optional .sls_logs.SlsCompressType compresstype = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_compresstype(), target);
+  }
+
+  // optional .sls_logs.SlsTelemetryType telemetrytype = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_telemetrytype(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.LogtailBufferMeta)
+  return target;
+}
+
+size_t LogtailBufferMeta::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:sls_logs.LogtailBufferMeta)
+  size_t total_size = 0;
+
+  if (_internal_has_project()) {
+    // required string project = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project());
+  }
+
+  if (_internal_has_endpoint()) {
+    // required string endpoint = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_endpoint());
+  }
+
+  if (_internal_has_aliuid()) {
+    // required string aliuid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_aliuid());
+  }
+
+  return total_size;
+}
+size_t LogtailBufferMeta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.LogtailBufferMeta)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string project = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project());
+
+    // required string endpoint = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_endpoint());
+
+    // required string aliuid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_aliuid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000f8u) {
+    // optional string logstore = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_logstore());
+    }
+
+    // optional string shardhashkey = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_shardhashkey());
+    }
+
+    // optional int32 datatype = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_datatype());
+    }
+
+    // optional int32 rawsize = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rawsize());
+    }
+
+    // optional .sls_logs.SlsCompressType compresstype = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_compresstype());
+    }
+
+  }
+  // optional .sls_logs.SlsTelemetryType telemetrytype = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_telemetrytype());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogtailBufferMeta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogtailBufferMeta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogtailBufferMeta::GetClassData() const { return &_class_data_; }
+
+
+void LogtailBufferMeta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogtailBufferMeta*>(&to_msg);
+  auto& from = static_cast<const LogtailBufferMeta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.LogtailBufferMeta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_project(from._internal_project());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_endpoint(from._internal_endpoint());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_aliuid(from._internal_aliuid());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_logstore(from._internal_logstore());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_shardhashkey(from._internal_shardhashkey());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.datatype_ = from._impl_.datatype_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.rawsize_ = from._impl_.rawsize_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.compresstype_ = from._impl_.compresstype_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_telemetrytype(from._internal_telemetrytype());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogtailBufferMeta::CopyFrom(const LogtailBufferMeta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.LogtailBufferMeta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogtailBufferMeta::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LogtailBufferMeta::InternalSwap(LogtailBufferMeta* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.project_, lhs_arena,
+      &other->_impl_.project_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.endpoint_, lhs_arena,
+      &other->_impl_.endpoint_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.aliuid_, lhs_arena,
+      &other->_impl_.aliuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.logstore_, lhs_arena,
+      &other->_impl_.logstore_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.shardhashkey_, lhs_arena,
+      &other->_impl_.shardhashkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogtailBufferMeta, _impl_.telemetrytype_)
+      + sizeof(LogtailBufferMeta::_impl_.telemetrytype_)
+      - PROTOBUF_FIELD_OFFSET(LogtailBufferMeta, _impl_.datatype_)>(
+          reinterpret_cast<char*>(&_impl_.datatype_),
+          reinterpret_cast<char*>(&other->_impl_.datatype_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogtailBufferMeta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_logtail_5fbuffer_5fmeta_2eproto_getter, &descriptor_table_logtail_5fbuffer_5fmeta_2eproto_once,
+      file_level_metadata_logtail_5fbuffer_5fmeta_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace sls_logs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sls_logs::LogtailBufferMeta*
+Arena::CreateMaybeMessage< ::sls_logs::LogtailBufferMeta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::LogtailBufferMeta >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,842 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: logtail_buffer_meta.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_logtail_5fbuffer_5fmeta_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_logtail_5fbuffer_5fmeta_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "sls_logs.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_logtail_5fbuffer_5fmeta_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_logtail_5fbuffer_5fmeta_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_logtail_5fbuffer_5fmeta_2eproto;
+namespace sls_logs {
+class LogtailBufferMeta;
+struct LogtailBufferMetaDefaultTypeInternal;
+extern LogtailBufferMetaDefaultTypeInternal _LogtailBufferMeta_default_instance_;
+}  // namespace sls_logs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sls_logs::LogtailBufferMeta* Arena::CreateMaybeMessage<::sls_logs::LogtailBufferMeta>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sls_logs {
+
+// ===================================================================
+
+class LogtailBufferMeta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.LogtailBufferMeta) */ {
+ public:
+  inline LogtailBufferMeta() : LogtailBufferMeta(nullptr) {}
+  ~LogtailBufferMeta() override;
+  explicit PROTOBUF_CONSTEXPR LogtailBufferMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogtailBufferMeta(const LogtailBufferMeta& from);
+  LogtailBufferMeta(LogtailBufferMeta&& from) noexcept
+    : LogtailBufferMeta() {
+    *this = ::std::move(from);
+  }
+
+  inline LogtailBufferMeta& operator=(const LogtailBufferMeta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogtailBufferMeta& operator=(LogtailBufferMeta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogtailBufferMeta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogtailBufferMeta* internal_default_instance() {
+    return reinterpret_cast<const LogtailBufferMeta*>(
+               &_LogtailBufferMeta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LogtailBufferMeta& a, LogtailBufferMeta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogtailBufferMeta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogtailBufferMeta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogtailBufferMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogtailBufferMeta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogtailBufferMeta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogtailBufferMeta& from) {
+    LogtailBufferMeta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogtailBufferMeta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.LogtailBufferMeta";
+  }
+  protected:
+  explicit LogtailBufferMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProjectFieldNumber = 1,
+    kEndpointFieldNumber = 2,
+    kAliuidFieldNumber = 3,
+    kLogstoreFieldNumber = 4,
+    kShardhashkeyFieldNumber = 7,
+    kDatatypeFieldNumber = 5,
+    kRawsizeFieldNumber = 6,
+    kCompresstypeFieldNumber = 8,
+    kTelemetrytypeFieldNumber = 9,
+  };
+  // required string project = 1;
+  bool has_project() const;
+  private:
+  bool _internal_has_project() const;
+  public:
+  void clear_project();
+  const std::string& project() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_project(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_project();
+  PROTOBUF_NODISCARD std::string* release_project();
+  void set_allocated_project(std::string* project);
+  private:
+  const std::string& _internal_project() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_project(const std::string& value);
+  std::string* _internal_mutable_project();
+  public:
+
+  // required string endpoint = 2;
+  bool has_endpoint() const;
+  private:
+  bool _internal_has_endpoint() const;
+  public:
+  void clear_endpoint();
+  const std::string& endpoint() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint();
+  PROTOBUF_NODISCARD std::string* release_endpoint();
+  void set_allocated_endpoint(std::string* endpoint);
+  private:
+  const std::string& _internal_endpoint() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint(const std::string& value);
+  std::string* _internal_mutable_endpoint();
+  public:
+
+  // required string aliuid = 3;
+  bool has_aliuid() const;
+  private:
+  bool _internal_has_aliuid() const;
+  public:
+  void clear_aliuid();
+  const std::string& aliuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_aliuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_aliuid();
+  PROTOBUF_NODISCARD std::string* release_aliuid();
+  void set_allocated_aliuid(std::string* aliuid);
+  private:
+  const std::string& _internal_aliuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_aliuid(const std::string& value);
+  std::string* _internal_mutable_aliuid();
+  public:
+
+  // optional string logstore = 4;
+  bool has_logstore() const;
+  private:
+  bool _internal_has_logstore() const;
+  public:
+  void clear_logstore();
+  const std::string& logstore() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_logstore(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_logstore();
+  PROTOBUF_NODISCARD std::string* release_logstore();
+  void set_allocated_logstore(std::string* logstore);
+  private:
+  const std::string& _internal_logstore() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_logstore(const std::string& value);
+  std::string* _internal_mutable_logstore();
+  public:
+
+  // optional string shardhashkey = 7;
+  bool has_shardhashkey() const;
+  private:
+  bool _internal_has_shardhashkey() const;
+  public:
+  void clear_shardhashkey();
+  const std::string& shardhashkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_shardhashkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_shardhashkey();
+  PROTOBUF_NODISCARD std::string* release_shardhashkey();
+  void set_allocated_shardhashkey(std::string* shardhashkey);
+  private:
+  const std::string& _internal_shardhashkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shardhashkey(const std::string& value);
+  std::string* _internal_mutable_shardhashkey();
+  public:
+
+  // optional int32 datatype = 5;
+  bool has_datatype() const;
+  private:
+  bool _internal_has_datatype() const;
+  public:
+  void clear_datatype();
+  int32_t datatype() const;
+  void set_datatype(int32_t value);
+  private:
+  int32_t _internal_datatype() const;
+  void _internal_set_datatype(int32_t value);
+  public:
+
+  // optional int32 rawsize = 6;
+  bool has_rawsize() const;
+  private:
+  bool _internal_has_rawsize() const;
+  public:
+  void clear_rawsize();
+  int32_t rawsize() const;
+  void set_rawsize(int32_t value);
+  private:
+  int32_t _internal_rawsize() const;
+  void _internal_set_rawsize(int32_t value);
+  public:
+
+  // optional .sls_logs.SlsCompressType compresstype = 8;
+  bool has_compresstype() const;
+  private:
+  bool _internal_has_compresstype() const;
+  public:
+  void clear_compresstype();
+  ::sls_logs::SlsCompressType compresstype() const;
+  void set_compresstype(::sls_logs::SlsCompressType value);
+  private:
+  ::sls_logs::SlsCompressType _internal_compresstype() const;
+  void _internal_set_compresstype(::sls_logs::SlsCompressType value);
+  public:
+
+  // optional .sls_logs.SlsTelemetryType telemetrytype = 9;
+  bool has_telemetrytype() const;
+  private:
+  bool _internal_has_telemetrytype() const;
+  public:
+  void clear_telemetrytype();
+  ::sls_logs::SlsTelemetryType telemetrytype() const;
+  void set_telemetrytype(::sls_logs::SlsTelemetryType value);
+  private:
+  ::sls_logs::SlsTelemetryType _internal_telemetrytype() const;
+  void _internal_set_telemetrytype(::sls_logs::SlsTelemetryType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.LogtailBufferMeta)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr project_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr aliuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logstore_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shardhashkey_;
+    int32_t datatype_;
+    int32_t rawsize_;
+    int compresstype_;
+    int telemetrytype_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_logtail_5fbuffer_5fmeta_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogtailBufferMeta
+
+// required string project = 1;
+inline bool LogtailBufferMeta::_internal_has_project() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_project() const {
+  return _internal_has_project();
+}
+inline void LogtailBufferMeta::clear_project() {
+  _impl_.project_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& LogtailBufferMeta::project() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.project)
+  return _internal_project();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogtailBufferMeta::set_project(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.project_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.project)
+}
+inline std::string* LogtailBufferMeta::mutable_project() {
+  std::string* _s = _internal_mutable_project();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogtailBufferMeta.project)
+  return _s;
+}
+inline const std::string& LogtailBufferMeta::_internal_project() const {
+  return _impl_.project_.Get();
+}
+inline void LogtailBufferMeta::_internal_set_project(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.project_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::_internal_mutable_project() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.project_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::release_project() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogtailBufferMeta.project)
+  if (!_internal_has_project()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.project_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.project_.IsDefault()) {
+    _impl_.project_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogtailBufferMeta::set_allocated_project(std::string* project) {
+  if (project != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.project_.SetAllocated(project, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.project_.IsDefault()) {
+    _impl_.project_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogtailBufferMeta.project)
+}
+
+// required string endpoint = 2;
+inline bool LogtailBufferMeta::_internal_has_endpoint() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_endpoint() const {
+  return _internal_has_endpoint();
+}
+inline void LogtailBufferMeta::clear_endpoint() {
+  _impl_.endpoint_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& LogtailBufferMeta::endpoint() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.endpoint)
+  return _internal_endpoint();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogtailBufferMeta::set_endpoint(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.endpoint_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.endpoint)
+}
+inline std::string* LogtailBufferMeta::mutable_endpoint() {
+  std::string* _s = _internal_mutable_endpoint();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogtailBufferMeta.endpoint)
+  return _s;
+}
+inline const std::string& LogtailBufferMeta::_internal_endpoint() const {
+  return _impl_.endpoint_.Get();
+}
+inline void LogtailBufferMeta::_internal_set_endpoint(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.endpoint_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::_internal_mutable_endpoint() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.endpoint_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::release_endpoint() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogtailBufferMeta.endpoint)
+  if (!_internal_has_endpoint()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.endpoint_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endpoint_.IsDefault()) {
+    _impl_.endpoint_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogtailBufferMeta::set_allocated_endpoint(std::string* endpoint) {
+  if (endpoint != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.endpoint_.SetAllocated(endpoint, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endpoint_.IsDefault()) {
+    _impl_.endpoint_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogtailBufferMeta.endpoint)
+}
+
+// required string aliuid = 3;
+inline bool LogtailBufferMeta::_internal_has_aliuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_aliuid() const {
+  return _internal_has_aliuid();
+}
+inline void LogtailBufferMeta::clear_aliuid() {
+  _impl_.aliuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& LogtailBufferMeta::aliuid() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.aliuid)
+  return _internal_aliuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogtailBufferMeta::set_aliuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.aliuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.aliuid)
+}
+inline std::string* LogtailBufferMeta::mutable_aliuid() {
+  std::string* _s = _internal_mutable_aliuid();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogtailBufferMeta.aliuid)
+  return _s;
+}
+inline const std::string& LogtailBufferMeta::_internal_aliuid() const {
+  return _impl_.aliuid_.Get();
+}
+inline void LogtailBufferMeta::_internal_set_aliuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.aliuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::_internal_mutable_aliuid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.aliuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::release_aliuid() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogtailBufferMeta.aliuid)
+  if (!_internal_has_aliuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.aliuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.aliuid_.IsDefault()) {
+    _impl_.aliuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogtailBufferMeta::set_allocated_aliuid(std::string* aliuid) {
+  if (aliuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.aliuid_.SetAllocated(aliuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.aliuid_.IsDefault()) {
+    _impl_.aliuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogtailBufferMeta.aliuid)
+}
+
+// optional string logstore = 4;
+inline bool LogtailBufferMeta::_internal_has_logstore() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_logstore() const {
+  return _internal_has_logstore();
+}
+inline void LogtailBufferMeta::clear_logstore() {
+  _impl_.logstore_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& LogtailBufferMeta::logstore() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.logstore)
+  return _internal_logstore();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogtailBufferMeta::set_logstore(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.logstore_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.logstore)
+}
+inline std::string* LogtailBufferMeta::mutable_logstore() {
+  std::string* _s = _internal_mutable_logstore();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogtailBufferMeta.logstore)
+  return _s;
+}
+inline const std::string& LogtailBufferMeta::_internal_logstore() const {
+  return _impl_.logstore_.Get();
+}
+inline void LogtailBufferMeta::_internal_set_logstore(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.logstore_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::_internal_mutable_logstore() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.logstore_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::release_logstore() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogtailBufferMeta.logstore)
+  if (!_internal_has_logstore()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.logstore_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logstore_.IsDefault()) {
+    _impl_.logstore_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogtailBufferMeta::set_allocated_logstore(std::string* logstore) {
+  if (logstore != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.logstore_.SetAllocated(logstore, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logstore_.IsDefault()) {
+    _impl_.logstore_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogtailBufferMeta.logstore)
+}
+
+// optional int32 datatype = 5;
+inline bool LogtailBufferMeta::_internal_has_datatype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_datatype() const {
+  return _internal_has_datatype();
+}
+inline void LogtailBufferMeta::clear_datatype() {
+  _impl_.datatype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t LogtailBufferMeta::_internal_datatype() const {
+  return _impl_.datatype_;
+}
+inline int32_t LogtailBufferMeta::datatype() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.datatype)
+  return _internal_datatype();
+}
+inline void LogtailBufferMeta::_internal_set_datatype(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.datatype_ = value;
+}
+inline void LogtailBufferMeta::set_datatype(int32_t value) {
+  _internal_set_datatype(value);
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.datatype)
+}
+
+// optional int32 rawsize = 6;
+inline bool LogtailBufferMeta::_internal_has_rawsize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_rawsize() const {
+  return _internal_has_rawsize();
+}
+inline void LogtailBufferMeta::clear_rawsize() {
+  _impl_.rawsize_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t LogtailBufferMeta::_internal_rawsize() const {
+  return _impl_.rawsize_;
+}
+inline int32_t LogtailBufferMeta::rawsize() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.rawsize)
+  return _internal_rawsize();
+}
+inline void LogtailBufferMeta::_internal_set_rawsize(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.rawsize_ = value;
+}
+inline void LogtailBufferMeta::set_rawsize(int32_t value) {
+  _internal_set_rawsize(value);
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.rawsize)
+}
+
+// optional string shardhashkey = 7;
+inline bool LogtailBufferMeta::_internal_has_shardhashkey() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_shardhashkey() const {
+  return _internal_has_shardhashkey();
+}
+inline void LogtailBufferMeta::clear_shardhashkey() {
+  _impl_.shardhashkey_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& LogtailBufferMeta::shardhashkey() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.shardhashkey)
+  return _internal_shardhashkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogtailBufferMeta::set_shardhashkey(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.shardhashkey_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.shardhashkey)
+}
+inline std::string* LogtailBufferMeta::mutable_shardhashkey() {
+  std::string* _s = _internal_mutable_shardhashkey();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogtailBufferMeta.shardhashkey)
+  return _s;
+}
+inline const std::string& LogtailBufferMeta::_internal_shardhashkey() const {
+  return _impl_.shardhashkey_.Get();
+}
+inline void LogtailBufferMeta::_internal_set_shardhashkey(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.shardhashkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::_internal_mutable_shardhashkey() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.shardhashkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogtailBufferMeta::release_shardhashkey() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogtailBufferMeta.shardhashkey)
+  if (!_internal_has_shardhashkey()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.shardhashkey_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shardhashkey_.IsDefault()) {
+    _impl_.shardhashkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogtailBufferMeta::set_allocated_shardhashkey(std::string* shardhashkey) {
+  if (shardhashkey != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.shardhashkey_.SetAllocated(shardhashkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shardhashkey_.IsDefault()) {
+    _impl_.shardhashkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogtailBufferMeta.shardhashkey)
+}
+
+// optional .sls_logs.SlsCompressType compresstype = 8;
+inline bool LogtailBufferMeta::_internal_has_compresstype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_compresstype() const {
+  return _internal_has_compresstype();
+}
+inline void LogtailBufferMeta::clear_compresstype() {
+  _impl_.compresstype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::sls_logs::SlsCompressType LogtailBufferMeta::_internal_compresstype() const {
+  return static_cast< ::sls_logs::SlsCompressType >(_impl_.compresstype_);
+}
+inline ::sls_logs::SlsCompressType LogtailBufferMeta::compresstype() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.compresstype)
+  return _internal_compresstype();
+}
+inline void LogtailBufferMeta::_internal_set_compresstype(::sls_logs::SlsCompressType value) {
+  assert(::sls_logs::SlsCompressType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.compresstype_ = value;
+}
+inline void LogtailBufferMeta::set_compresstype(::sls_logs::SlsCompressType value) {
+  _internal_set_compresstype(value);
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.compresstype)
+}
+
+// optional .sls_logs.SlsTelemetryType telemetrytype = 9;
+inline bool LogtailBufferMeta::_internal_has_telemetrytype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogtailBufferMeta::has_telemetrytype() const {
+  return _internal_has_telemetrytype();
+}
+inline void LogtailBufferMeta::clear_telemetrytype() {
+  _impl_.telemetrytype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::sls_logs::SlsTelemetryType LogtailBufferMeta::_internal_telemetrytype() const {
+  return static_cast< ::sls_logs::SlsTelemetryType >(_impl_.telemetrytype_);
+}
+inline ::sls_logs::SlsTelemetryType LogtailBufferMeta::telemetrytype() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogtailBufferMeta.telemetrytype)
+  return _internal_telemetrytype();
+}
+inline void LogtailBufferMeta::_internal_set_telemetrytype(::sls_logs::SlsTelemetryType value) {
+  assert(::sls_logs::SlsTelemetryType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.telemetrytype_ = value;
+}
+inline void LogtailBufferMeta::set_telemetrytype(::sls_logs::SlsTelemetryType value) {
+  _internal_set_telemetrytype(value);
+  // @@protoc_insertion_point(field_set:sls_logs.LogtailBufferMeta.telemetrytype)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace sls_logs
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_logtail_5fbuffer_5fmeta_2eproto
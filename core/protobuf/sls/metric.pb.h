@@ -0,0 +1,1402 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: metric.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_metric_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_metric_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_metric_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_metric_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_metric_2eproto;
+namespace oas {
+class Metric;
+struct MetricDefaultTypeInternal;
+extern MetricDefaultTypeInternal _Metric_default_instance_;
+class MetricGroup;
+struct MetricGroupDefaultTypeInternal;
+extern MetricGroupDefaultTypeInternal _MetricGroup_default_instance_;
+class Metric_Context;
+struct Metric_ContextDefaultTypeInternal;
+extern Metric_ContextDefaultTypeInternal _Metric_Context_default_instance_;
+}  // namespace oas
+PROTOBUF_NAMESPACE_OPEN
+template<> ::oas::Metric* Arena::CreateMaybeMessage<::oas::Metric>(Arena*);
+template<> ::oas::MetricGroup* Arena::CreateMaybeMessage<::oas::MetricGroup>(Arena*);
+template<> ::oas::Metric_Context* Arena::CreateMaybeMessage<::oas::Metric_Context>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace oas {
+
+// ===================================================================
+
+class Metric_Context final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oas.Metric.Context) */ {
+ public:
+  inline Metric_Context() : Metric_Context(nullptr) {}
+  ~Metric_Context() override;
+  explicit PROTOBUF_CONSTEXPR Metric_Context(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metric_Context(const Metric_Context& from);
+  Metric_Context(Metric_Context&& from) noexcept
+    : Metric_Context() {
+    *this = ::std::move(from);
+  }
+
+  inline Metric_Context& operator=(const Metric_Context& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metric_Context& operator=(Metric_Context&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric_Context& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric_Context* internal_default_instance() {
+    return reinterpret_cast<const Metric_Context*>(
+               &_Metric_Context_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Metric_Context& a, Metric_Context& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric_Context* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric_Context* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metric_Context* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric_Context>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metric_Context& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric_Context& from) {
+    Metric_Context::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric_Context* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oas.Metric.Context";
+  }
+  protected:
+  explicit Metric_Context(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string Key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required string Value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:oas.Metric.Context)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metric_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Metric final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oas.Metric) */ {
+ public:
+  inline Metric() : Metric(nullptr) {}
+  ~Metric() override;
+  explicit PROTOBUF_CONSTEXPR Metric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metric(const Metric& from);
+  Metric(Metric&& from) noexcept
+    : Metric() {
+    *this = ::std::move(from);
+  }
+
+  inline Metric& operator=(const Metric& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metric& operator=(Metric&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric* internal_default_instance() {
+    return reinterpret_cast<const Metric*>(
+               &_Metric_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Metric& a, Metric& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metric& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric& from) {
+    Metric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oas.Metric";
+  }
+  protected:
+  explicit Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Metric_Context Context;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContextGroupFieldNumber = 7,
+    kMetricNameFieldNumber = 3,
+    kSourceFieldNumber = 5,
+    kAccessIDFieldNumber = 1,
+    kValueFieldNumber = 4,
+    kTimeFieldNumber = 2,
+    kTypeFieldNumber = 6,
+  };
+  // repeated .oas.Metric.Context ContextGroup = 7;
+  int contextgroup_size() const;
+  private:
+  int _internal_contextgroup_size() const;
+  public:
+  void clear_contextgroup();
+  ::oas::Metric_Context* mutable_contextgroup(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric_Context >*
+      mutable_contextgroup();
+  private:
+  const ::oas::Metric_Context& _internal_contextgroup(int index) const;
+  ::oas::Metric_Context* _internal_add_contextgroup();
+  public:
+  const ::oas::Metric_Context& contextgroup(int index) const;
+  ::oas::Metric_Context* add_contextgroup();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric_Context >&
+      contextgroup() const;
+
+  // optional string MetricName = 3;
+  bool has_metricname() const;
+  private:
+  bool _internal_has_metricname() const;
+  public:
+  void clear_metricname();
+  const std::string& metricname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metricname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_metricname();
+  PROTOBUF_NODISCARD std::string* release_metricname();
+  void set_allocated_metricname(std::string* metricname);
+  private:
+  const std::string& _internal_metricname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metricname(const std::string& value);
+  std::string* _internal_mutable_metricname();
+  public:
+
+  // optional string Source = 5;
+  bool has_source() const;
+  private:
+  bool _internal_has_source() const;
+  public:
+  void clear_source();
+  const std::string& source() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* source);
+  private:
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(const std::string& value);
+  std::string* _internal_mutable_source();
+  public:
+
+  // optional int64 AccessID = 1;
+  bool has_accessid() const;
+  private:
+  bool _internal_has_accessid() const;
+  public:
+  void clear_accessid();
+  int64_t accessid() const;
+  void set_accessid(int64_t value);
+  private:
+  int64_t _internal_accessid() const;
+  void _internal_set_accessid(int64_t value);
+  public:
+
+  // optional int64 Value = 4;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // required uint32 Time = 2;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  uint32_t time() const;
+  void set_time(uint32_t value);
+  private:
+  uint32_t _internal_time() const;
+  void _internal_set_time(uint32_t value);
+  public:
+
+  // optional int32 Type = 6;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oas.Metric)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric_Context > contextgroup_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metricname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_;
+    int64_t accessid_;
+    int64_t value_;
+    uint32_t time_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metric_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oas.MetricGroup) */ {
+ public:
+  inline MetricGroup() : MetricGroup(nullptr) {}
+  ~MetricGroup() override;
+  explicit PROTOBUF_CONSTEXPR MetricGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricGroup(const MetricGroup& from);
+  MetricGroup(MetricGroup&& from) noexcept
+    : MetricGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricGroup& operator=(const MetricGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricGroup& operator=(MetricGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricGroup* internal_default_instance() {
+    return reinterpret_cast<const MetricGroup*>(
+               &_MetricGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MetricGroup& a, MetricGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricGroup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricGroup>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricGroup& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricGroup& from) {
+    MetricGroup::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricGroup* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oas.MetricGroup";
+  }
+  protected:
+  explicit MetricGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMetricsFieldNumber = 1,
+    kMetricNameFieldNumber = 3,
+    kKeyFieldNumber = 4,
+    kAccessIDFieldNumber = 2,
+  };
+  // repeated .oas.Metric Metrics = 1;
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  ::oas::Metric* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric >*
+      mutable_metrics();
+  private:
+  const ::oas::Metric& _internal_metrics(int index) const;
+  ::oas::Metric* _internal_add_metrics();
+  public:
+  const ::oas::Metric& metrics(int index) const;
+  ::oas::Metric* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric >&
+      metrics() const;
+
+  // optional string MetricName = 3;
+  bool has_metricname() const;
+  private:
+  bool _internal_has_metricname() const;
+  public:
+  void clear_metricname();
+  const std::string& metricname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metricname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_metricname();
+  PROTOBUF_NODISCARD std::string* release_metricname();
+  void set_allocated_metricname(std::string* metricname);
+  private:
+  const std::string& _internal_metricname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metricname(const std::string& value);
+  std::string* _internal_mutable_metricname();
+  public:
+
+  // optional string Key = 4;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional int64 AccessID = 2;
+  bool has_accessid() const;
+  private:
+  bool _internal_has_accessid() const;
+  public:
+  void clear_accessid();
+  int64_t accessid() const;
+  void set_accessid(int64_t value);
+  private:
+  int64_t _internal_accessid() const;
+  void _internal_set_accessid(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oas.MetricGroup)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric > metrics_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metricname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int64_t accessid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metric_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Metric_Context
+
+// required string Key = 1;
+inline bool Metric_Context::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Metric_Context::has_key() const {
+  return _internal_has_key();
+}
+inline void Metric_Context::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Metric_Context::key() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Context.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric_Context::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.Metric.Context.Key)
+}
+inline std::string* Metric_Context::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:oas.Metric.Context.Key)
+  return _s;
+}
+inline const std::string& Metric_Context::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Metric_Context::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric_Context::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric_Context::release_key() {
+  // @@protoc_insertion_point(field_release:oas.Metric.Context.Key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Metric_Context::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.Metric.Context.Key)
+}
+
+// required string Value = 2;
+inline bool Metric_Context::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Metric_Context::has_value() const {
+  return _internal_has_value();
+}
+inline void Metric_Context::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Metric_Context::value() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Context.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric_Context::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.Metric.Context.Value)
+}
+inline std::string* Metric_Context::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:oas.Metric.Context.Value)
+  return _s;
+}
+inline const std::string& Metric_Context::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Metric_Context::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric_Context::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric_Context::release_value() {
+  // @@protoc_insertion_point(field_release:oas.Metric.Context.Value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Metric_Context::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.Metric.Context.Value)
+}
+
+// -------------------------------------------------------------------
+
+// Metric
+
+// optional int64 AccessID = 1;
+inline bool Metric::_internal_has_accessid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Metric::has_accessid() const {
+  return _internal_has_accessid();
+}
+inline void Metric::clear_accessid() {
+  _impl_.accessid_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t Metric::_internal_accessid() const {
+  return _impl_.accessid_;
+}
+inline int64_t Metric::accessid() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.AccessID)
+  return _internal_accessid();
+}
+inline void Metric::_internal_set_accessid(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.accessid_ = value;
+}
+inline void Metric::set_accessid(int64_t value) {
+  _internal_set_accessid(value);
+  // @@protoc_insertion_point(field_set:oas.Metric.AccessID)
+}
+
+// required uint32 Time = 2;
+inline bool Metric::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Metric::has_time() const {
+  return _internal_has_time();
+}
+inline void Metric::clear_time() {
+  _impl_.time_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Metric::_internal_time() const {
+  return _impl_.time_;
+}
+inline uint32_t Metric::time() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Time)
+  return _internal_time();
+}
+inline void Metric::_internal_set_time(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.time_ = value;
+}
+inline void Metric::set_time(uint32_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:oas.Metric.Time)
+}
+
+// optional string MetricName = 3;
+inline bool Metric::_internal_has_metricname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Metric::has_metricname() const {
+  return _internal_has_metricname();
+}
+inline void Metric::clear_metricname() {
+  _impl_.metricname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Metric::metricname() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.MetricName)
+  return _internal_metricname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_metricname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.metricname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.Metric.MetricName)
+}
+inline std::string* Metric::mutable_metricname() {
+  std::string* _s = _internal_mutable_metricname();
+  // @@protoc_insertion_point(field_mutable:oas.Metric.MetricName)
+  return _s;
+}
+inline const std::string& Metric::_internal_metricname() const {
+  return _impl_.metricname_.Get();
+}
+inline void Metric::_internal_set_metricname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.metricname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric::_internal_mutable_metricname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.metricname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric::release_metricname() {
+  // @@protoc_insertion_point(field_release:oas.Metric.MetricName)
+  if (!_internal_has_metricname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.metricname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metricname_.IsDefault()) {
+    _impl_.metricname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Metric::set_allocated_metricname(std::string* metricname) {
+  if (metricname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.metricname_.SetAllocated(metricname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metricname_.IsDefault()) {
+    _impl_.metricname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.Metric.MetricName)
+}
+
+// optional int64 Value = 4;
+inline bool Metric::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Metric::has_value() const {
+  return _internal_has_value();
+}
+inline void Metric::clear_value() {
+  _impl_.value_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t Metric::_internal_value() const {
+  return _impl_.value_;
+}
+inline int64_t Metric::value() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Value)
+  return _internal_value();
+}
+inline void Metric::_internal_set_value(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.value_ = value;
+}
+inline void Metric::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:oas.Metric.Value)
+}
+
+// optional string Source = 5;
+inline bool Metric::_internal_has_source() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Metric::has_source() const {
+  return _internal_has_source();
+}
+inline void Metric::clear_source() {
+  _impl_.source_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Metric::source() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Source)
+  return _internal_source();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_source(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.Metric.Source)
+}
+inline std::string* Metric::mutable_source() {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:oas.Metric.Source)
+  return _s;
+}
+inline const std::string& Metric::_internal_source() const {
+  return _impl_.source_.Get();
+}
+inline void Metric::_internal_set_source(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.source_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric::_internal_mutable_source() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.source_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric::release_source() {
+  // @@protoc_insertion_point(field_release:oas.Metric.Source)
+  if (!_internal_has_source()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.source_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Metric::set_allocated_source(std::string* source) {
+  if (source != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.source_.SetAllocated(source, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.Metric.Source)
+}
+
+// optional int32 Type = 6;
+inline bool Metric::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Metric::has_type() const {
+  return _internal_has_type();
+}
+inline void Metric::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Metric::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t Metric::type() const {
+  // @@protoc_insertion_point(field_get:oas.Metric.Type)
+  return _internal_type();
+}
+inline void Metric::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.type_ = value;
+}
+inline void Metric::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:oas.Metric.Type)
+}
+
+// repeated .oas.Metric.Context ContextGroup = 7;
+inline int Metric::_internal_contextgroup_size() const {
+  return _impl_.contextgroup_.size();
+}
+inline int Metric::contextgroup_size() const {
+  return _internal_contextgroup_size();
+}
+inline void Metric::clear_contextgroup() {
+  _impl_.contextgroup_.Clear();
+}
+inline ::oas::Metric_Context* Metric::mutable_contextgroup(int index) {
+  // @@protoc_insertion_point(field_mutable:oas.Metric.ContextGroup)
+  return _impl_.contextgroup_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric_Context >*
+Metric::mutable_contextgroup() {
+  // @@protoc_insertion_point(field_mutable_list:oas.Metric.ContextGroup)
+  return &_impl_.contextgroup_;
+}
+inline const ::oas::Metric_Context& Metric::_internal_contextgroup(int index) const {
+  return _impl_.contextgroup_.Get(index);
+}
+inline const ::oas::Metric_Context& Metric::contextgroup(int index) const {
+  // @@protoc_insertion_point(field_get:oas.Metric.ContextGroup)
+  return _internal_contextgroup(index);
+}
+inline ::oas::Metric_Context* Metric::_internal_add_contextgroup() {
+  return _impl_.contextgroup_.Add();
+}
+inline ::oas::Metric_Context* Metric::add_contextgroup() {
+  ::oas::Metric_Context* _add = _internal_add_contextgroup();
+  // @@protoc_insertion_point(field_add:oas.Metric.ContextGroup)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric_Context >&
+Metric::contextgroup() const {
+  // @@protoc_insertion_point(field_list:oas.Metric.ContextGroup)
+  return _impl_.contextgroup_;
+}
+
+// -------------------------------------------------------------------
+
+// MetricGroup
+
+// repeated .oas.Metric Metrics = 1;
+inline int MetricGroup::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
+}
+inline int MetricGroup::metrics_size() const {
+  return _internal_metrics_size();
+}
+inline void MetricGroup::clear_metrics() {
+  _impl_.metrics_.Clear();
+}
+inline ::oas::Metric* MetricGroup::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:oas.MetricGroup.Metrics)
+  return _impl_.metrics_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric >*
+MetricGroup::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:oas.MetricGroup.Metrics)
+  return &_impl_.metrics_;
+}
+inline const ::oas::Metric& MetricGroup::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
+}
+inline const ::oas::Metric& MetricGroup::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:oas.MetricGroup.Metrics)
+  return _internal_metrics(index);
+}
+inline ::oas::Metric* MetricGroup::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
+}
+inline ::oas::Metric* MetricGroup::add_metrics() {
+  ::oas::Metric* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:oas.MetricGroup.Metrics)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oas::Metric >&
+MetricGroup::metrics() const {
+  // @@protoc_insertion_point(field_list:oas.MetricGroup.Metrics)
+  return _impl_.metrics_;
+}
+
+// optional int64 AccessID = 2;
+inline bool MetricGroup::_internal_has_accessid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MetricGroup::has_accessid() const {
+  return _internal_has_accessid();
+}
+inline void MetricGroup::clear_accessid() {
+  _impl_.accessid_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t MetricGroup::_internal_accessid() const {
+  return _impl_.accessid_;
+}
+inline int64_t MetricGroup::accessid() const {
+  // @@protoc_insertion_point(field_get:oas.MetricGroup.AccessID)
+  return _internal_accessid();
+}
+inline void MetricGroup::_internal_set_accessid(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.accessid_ = value;
+}
+inline void MetricGroup::set_accessid(int64_t value) {
+  _internal_set_accessid(value);
+  // @@protoc_insertion_point(field_set:oas.MetricGroup.AccessID)
+}
+
+// optional string MetricName = 3;
+inline bool MetricGroup::_internal_has_metricname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetricGroup::has_metricname() const {
+  return _internal_has_metricname();
+}
+inline void MetricGroup::clear_metricname() {
+  _impl_.metricname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetricGroup::metricname() const {
+  // @@protoc_insertion_point(field_get:oas.MetricGroup.MetricName)
+  return _internal_metricname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricGroup::set_metricname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.metricname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.MetricGroup.MetricName)
+}
+inline std::string* MetricGroup::mutable_metricname() {
+  std::string* _s = _internal_mutable_metricname();
+  // @@protoc_insertion_point(field_mutable:oas.MetricGroup.MetricName)
+  return _s;
+}
+inline const std::string& MetricGroup::_internal_metricname() const {
+  return _impl_.metricname_.Get();
+}
+inline void MetricGroup::_internal_set_metricname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.metricname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricGroup::_internal_mutable_metricname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.metricname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricGroup::release_metricname() {
+  // @@protoc_insertion_point(field_release:oas.MetricGroup.MetricName)
+  if (!_internal_has_metricname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.metricname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metricname_.IsDefault()) {
+    _impl_.metricname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetricGroup::set_allocated_metricname(std::string* metricname) {
+  if (metricname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.metricname_.SetAllocated(metricname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metricname_.IsDefault()) {
+    _impl_.metricname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.MetricGroup.MetricName)
+}
+
+// optional string Key = 4;
+inline bool MetricGroup::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MetricGroup::has_key() const {
+  return _internal_has_key();
+}
+inline void MetricGroup::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& MetricGroup::key() const {
+  // @@protoc_insertion_point(field_get:oas.MetricGroup.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricGroup::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oas.MetricGroup.Key)
+}
+inline std::string* MetricGroup::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:oas.MetricGroup.Key)
+  return _s;
+}
+inline const std::string& MetricGroup::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void MetricGroup::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricGroup::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricGroup::release_key() {
+  // @@protoc_insertion_point(field_release:oas.MetricGroup.Key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetricGroup::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oas.MetricGroup.Key)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace oas
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_metric_2eproto
@@ -0,0 +1,2406 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sls_logs.proto
+
+#include "sls_logs.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace sls_logs {
+PROTOBUF_CONSTEXPR Log_Content::Log_Content(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct Log_ContentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Log_ContentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Log_ContentDefaultTypeInternal() {}
+  union {
+    Log_Content _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Log_ContentDefaultTypeInternal _Log_Content_default_instance_;
+PROTOBUF_CONSTEXPR Log::Log(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.time_)*/0u
+  , /*decltype(_impl_.time_ns_)*/0u} {}
+struct LogDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogDefaultTypeInternal() {}
+  union {
+    Log _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogDefaultTypeInternal _Log_default_instance_;
+PROTOBUF_CONSTEXPR LogTag::LogTag(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct LogTagDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogTagDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogTagDefaultTypeInternal() {}
+  union {
+    LogTag _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogTagDefaultTypeInternal _LogTag_default_instance_;
+PROTOBUF_CONSTEXPR LogGroup::LogGroup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.logs_)*/{}
+  , /*decltype(_impl_.logtags_)*/{}
+  , /*decltype(_impl_.category_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.topic_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.source_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.machineuuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct LogGroupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogGroupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogGroupDefaultTypeInternal() {}
+  union {
+    LogGroup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogGroupDefaultTypeInternal _LogGroup_default_instance_;
+PROTOBUF_CONSTEXPR SlsLogPackage::SlsLogPackage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uncompress_size_)*/0
+  , /*decltype(_impl_.compress_type_)*/0} {}
+struct SlsLogPackageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SlsLogPackageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SlsLogPackageDefaultTypeInternal() {}
+  union {
+    SlsLogPackage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlsLogPackageDefaultTypeInternal _SlsLogPackage_default_instance_;
+PROTOBUF_CONSTEXPR SlsLogPackageList::SlsLogPackageList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.packages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SlsLogPackageListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SlsLogPackageListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SlsLogPackageListDefaultTypeInternal() {}
+  union {
+    SlsLogPackageList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlsLogPackageListDefaultTypeInternal _SlsLogPackageList_default_instance_;
+PROTOBUF_CONSTEXPR LogGroupList::LogGroupList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.loggrouplist_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogGroupListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogGroupListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogGroupListDefaultTypeInternal() {}
+  union {
+    LogGroupList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogGroupListDefaultTypeInternal _LogGroupList_default_instance_;
+}  // namespace sls_logs
+static ::_pb::Metadata file_level_metadata_sls_5flogs_2eproto[7];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_sls_5flogs_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sls_5flogs_2eproto = nullptr;
+
+const uint32_t TableStruct_sls_5flogs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log_Content, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log_Content, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log_Content, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log_Content, _impl_.value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _impl_.contents_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::Log, _impl_.time_ns_),
+  0,
+  ~0u,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogTag, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogTag, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogTag, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogTag, _impl_.value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.logs_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.category_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.topic_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.machineuuid_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroup, _impl_.logtags_),
+  ~0u,
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackage, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackage, _impl_.uncompress_size_),
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackage, _impl_.compress_type_),
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackageList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::SlsLogPackageList, _impl_.packages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroupList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sls_logs::LogGroupList, _impl_.loggrouplist_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::sls_logs::Log_Content)},
+  { 10, 20, -1, sizeof(::sls_logs::Log)},
+  { 24, 32, -1, sizeof(::sls_logs::LogTag)},
+  { 34, 46, -1, sizeof(::sls_logs::LogGroup)},
+  { 52, 61, -1, sizeof(::sls_logs::SlsLogPackage)},
+  { 64, -1, -1, sizeof(::sls_logs::SlsLogPackageList)},
+  { 71, -1, -1, sizeof(::sls_logs::LogGroupList)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sls_logs::_Log_Content_default_instance_._instance,
+  &::sls_logs::_Log_default_instance_._instance,
+  &::sls_logs::_LogTag_default_instance_._instance,
+  &::sls_logs::_LogGroup_default_instance_._instance,
+  &::sls_logs::_SlsLogPackage_default_instance_._instance,
+  &::sls_logs::_SlsLogPackageList_default_instance_._instance,
+  &::sls_logs::_LogGroupList_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_sls_5flogs_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016sls_logs.proto\022\010sls_logs\"\204\001\n\003Log\022\014\n\004Ti"
+  "me\030\001 \002(\r\022\'\n\010Contents\030\002 \003(\0132\025.sls_logs.Lo"
+  "g.Content\022\016\n\006values\030\003 \003(\t\022\017\n\007Time_ns\030\004 \001"
+  "(\007\032%\n\007Content\022\013\n\003Key\030\001 \002(\t\022\r\n\005Value\030\002 \002("
+  "\t\"$\n\006LogTag\022\013\n\003Key\030\001 \002(\t\022\r\n\005Value\030\002 \002(\t\""
+  "\220\001\n\010LogGroup\022\033\n\004Logs\030\001 \003(\0132\r.sls_logs.Lo"
+  "g\022\020\n\010Category\030\002 \001(\t\022\r\n\005Topic\030\003 \001(\t\022\016\n\006So"
+  "urce\030\004 \001(\t\022\023\n\013MachineUUID\030\005 \001(\t\022!\n\007LogTa"
+  "gs\030\006 \003(\0132\020.sls_logs.LogTag\"h\n\rSlsLogPack"
+  "age\022\014\n\004data\030\001 \002(\014\022\027\n\017uncompress_size\030\002 \001"
+  "(\005\0220\n\rcompress_type\030\003 \001(\0162\031.sls_logs.Sls"
+  "CompressType\">\n\021SlsLogPackageList\022)\n\010pac"
+  "kages\030\001 \003(\0132\027.sls_logs.SlsLogPackage\"8\n\014"
+  "LogGroupList\022(\n\014logGroupList\030\001 \003(\0132\022.sls"
+  "_logs.LogGroup*[\n\017SlsCompressType\022\020\n\014SLS"
+  "_CMP_NONE\020\000\022\023\n\017SLS_CMP_DEFLATE\020\001\022\017\n\013SLS_"
+  "CMP_LZ4\020\002\022\020\n\014SLS_CMP_ZSTD\020\003*O\n\020SlsTeleme"
+  "tryType\022\033\n\027SLS_TELEMETRY_TYPE_LOGS\020\000\022\036\n\032"
+  "SLS_TELEMETRY_TYPE_METRICS\020\001"
+  ;
+static ::_pbi::once_flag descriptor_table_sls_5flogs_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_sls_5flogs_2eproto = {
+    false, false, 748, descriptor_table_protodef_sls_5flogs_2eproto,
+    "sls_logs.proto",
+    &descriptor_table_sls_5flogs_2eproto_once, nullptr, 0, 7,
+    schemas, file_default_instances, TableStruct_sls_5flogs_2eproto::offsets,
+    file_level_metadata_sls_5flogs_2eproto, file_level_enum_descriptors_sls_5flogs_2eproto,
+    file_level_service_descriptors_sls_5flogs_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_sls_5flogs_2eproto_getter() {
+  return &descriptor_table_sls_5flogs_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_sls_5flogs_2eproto(&descriptor_table_sls_5flogs_2eproto);
+namespace sls_logs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SlsCompressType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sls_5flogs_2eproto);
+  return file_level_enum_descriptors_sls_5flogs_2eproto[0];
+}
+bool SlsCompressType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SlsTelemetryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sls_5flogs_2eproto);
+  return file_level_enum_descriptors_sls_5flogs_2eproto[1];
+}
+bool SlsTelemetryType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Log_Content::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Log_Content>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Log_Content::Log_Content(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.Log.Content)
+}
+Log_Content::Log_Content(const Log_Content& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Log_Content* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:sls_logs.Log.Content)
+}
+
+inline void Log_Content::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Log_Content::~Log_Content() {
+  // @@protoc_insertion_point(destructor:sls_logs.Log.Content)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Log_Content::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void Log_Content::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Log_Content::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.Log.Content)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Log_Content::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.Log.Content.Key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.Log.Content.Value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Log_Content::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.Log.Content)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string Key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.Log.Content.Key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // required string Value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.Log.Content.Value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.Log.Content)
+  return target;
+}
+
+size_t Log_Content::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:sls_logs.Log.Content)
+  size_t total_size = 0;
+
+  if (_internal_has_key()) {
+    // required string Key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  if (_internal_has_value()) {
+    // required string Value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  return total_size;
+}
+size_t Log_Content::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.Log.Content)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string Key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required string Value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Log_Content::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Log_Content::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Log_Content::GetClassData() const { return &_class_data_; }
+
+
+void Log_Content::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Log_Content*>(&to_msg);
+  auto& from = static_cast<const Log_Content&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.Log.Content)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Log_Content::CopyFrom(const Log_Content& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.Log.Content)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Log_Content::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Log_Content::InternalSwap(Log_Content* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Log_Content::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[0]);
+}
+
+// ===================================================================
+
+class Log::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Log>()._impl_._has_bits_);
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_time_ns(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Log::Log(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.Log)
+}
+Log::Log(const Log& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Log* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.contents_){from._impl_.contents_}
+    , decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.time_){}
+    , decltype(_impl_.time_ns_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.time_, &from._impl_.time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_ns_) -
+    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.time_ns_));
+  // @@protoc_insertion_point(copy_constructor:sls_logs.Log)
+}
+
+inline void Log::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.contents_){arena}
+    , decltype(_impl_.values_){arena}
+    , decltype(_impl_.time_){0u}
+    , decltype(_impl_.time_ns_){0u}
+  };
+}
+
+Log::~Log() {
+  // @@protoc_insertion_point(destructor:sls_logs.Log)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Log::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+  _impl_.values_.~RepeatedPtrField();
+}
+
+void Log::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Log::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.Log)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  _impl_.values_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.time_ns_) -
+        reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.time_ns_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Log::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 Time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sls_logs.Log.Content Contents = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_contents(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_values();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "sls_logs.Log.values");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 Time_ns = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_time_ns(&has_bits);
+          _impl_.time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Log::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.Log)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 Time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_time(), target);
+  }
+
+  // repeated .sls_logs.Log.Content Contents = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_contents_size()); i < n; i++) {
+    const auto& repfield = this->_internal_contents(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string values = 3;
+  for (int i = 0, n = this->_internal_values_size(); i < n; i++) {
+    const auto& s = this->_internal_values(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.Log.values");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // optional fixed32 Time_ns = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_time_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.Log)
+  return target;
+}
+
+size_t Log::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.Log)
+  size_t total_size = 0;
+
+  // required uint32 Time = 1;
+  if (_internal_has_time()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_time());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.Log.Content Contents = 2;
+  total_size += 1UL * this->_internal_contents_size();
+  for (const auto& msg : this->_impl_.contents_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string values = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.values_.size());
+  for (int i = 0, n = _impl_.values_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.values_.Get(i));
+  }
+
+  // optional fixed32 Time_ns = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Log::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Log::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Log::GetClassData() const { return &_class_data_; }
+
+
+void Log::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Log*>(&to_msg);
+  auto& from = static_cast<const Log&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.Log)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.time_ns_ = from._impl_.time_ns_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Log::CopyFrom(const Log& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.Log)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Log::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.contents_))
+    return false;
+  return true;
+}
+
+void Log::InternalSwap(Log* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Log, _impl_.time_ns_)
+      + sizeof(Log::_impl_.time_ns_)
+      - PROTOBUF_FIELD_OFFSET(Log, _impl_.time_)>(
+          reinterpret_cast<char*>(&_impl_.time_),
+          reinterpret_cast<char*>(&other->_impl_.time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Log::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[1]);
+}
+
+// ===================================================================
+
+class LogTag::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogTag>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+LogTag::LogTag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.LogTag)
+}
+LogTag::LogTag(const LogTag& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogTag* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:sls_logs.LogTag)
+}
+
+inline void LogTag::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogTag::~LogTag() {
+  // @@protoc_insertion_point(destructor:sls_logs.LogTag)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogTag::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void LogTag::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogTag::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.LogTag)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogTag::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogTag.Key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogTag.Value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogTag::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.LogTag)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string Key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogTag.Key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // required string Value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogTag.Value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.LogTag)
+  return target;
+}
+
+size_t LogTag::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:sls_logs.LogTag)
+  size_t total_size = 0;
+
+  if (_internal_has_key()) {
+    // required string Key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  if (_internal_has_value()) {
+    // required string Value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  return total_size;
+}
+size_t LogTag::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.LogTag)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string Key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required string Value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogTag::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogTag::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogTag::GetClassData() const { return &_class_data_; }
+
+
+void LogTag::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogTag*>(&to_msg);
+  auto& from = static_cast<const LogTag&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.LogTag)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogTag::CopyFrom(const LogTag& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.LogTag)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogTag::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LogTag::InternalSwap(LogTag* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogTag::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[2]);
+}
+
+// ===================================================================
+
+class LogGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogGroup>()._impl_._has_bits_);
+  static void set_has_category(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_topic(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_source(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_machineuuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+LogGroup::LogGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.LogGroup)
+}
+LogGroup::LogGroup(const LogGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogGroup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.logs_){from._impl_.logs_}
+    , decltype(_impl_.logtags_){from._impl_.logtags_}
+    , decltype(_impl_.category_){}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.machineuuid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.category_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.category_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_category()) {
+    _this->_impl_.category_.Set(from._internal_category(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_topic()) {
+    _this->_impl_.topic_.Set(from._internal_topic(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_source()) {
+    _this->_impl_.source_.Set(from._internal_source(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.machineuuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machineuuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machineuuid()) {
+    _this->_impl_.machineuuid_.Set(from._internal_machineuuid(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:sls_logs.LogGroup)
+}
+
+inline void LogGroup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.logs_){arena}
+    , decltype(_impl_.logtags_){arena}
+    , decltype(_impl_.category_){}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.machineuuid_){}
+  };
+  _impl_.category_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.category_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.machineuuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machineuuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogGroup::~LogGroup() {
+  // @@protoc_insertion_point(destructor:sls_logs.LogGroup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.logs_.~RepeatedPtrField();
+  _impl_.logtags_.~RepeatedPtrField();
+  _impl_.category_.Destroy();
+  _impl_.topic_.Destroy();
+  _impl_.source_.Destroy();
+  _impl_.machineuuid_.Destroy();
+}
+
+void LogGroup::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.LogGroup)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.logs_.Clear();
+  _impl_.logtags_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.category_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.topic_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.source_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.machineuuid_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sls_logs.Log Logs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_logs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string Category = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_category();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogGroup.Category");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string Topic = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_topic();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogGroup.Topic");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string Source = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_source();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogGroup.Source");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string MachineUUID = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_machineuuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "sls_logs.LogGroup.MachineUUID");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sls_logs.LogTag LogTags = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_logtags(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogGroup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.LogGroup)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.Log Logs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_logs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_logs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string Category = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_category().data(), static_cast<int>(this->_internal_category().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogGroup.Category");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_category(), target);
+  }
+
+  // optional string Topic = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_topic().data(), static_cast<int>(this->_internal_topic().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogGroup.Topic");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_topic(), target);
+  }
+
+  // optional string Source = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_source().data(), static_cast<int>(this->_internal_source().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogGroup.Source");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_source(), target);
+  }
+
+  // optional string MachineUUID = 5;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machineuuid().data(), static_cast<int>(this->_internal_machineuuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "sls_logs.LogGroup.MachineUUID");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_machineuuid(), target);
+  }
+
+  // repeated .sls_logs.LogTag LogTags = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_logtags_size()); i < n; i++) {
+    const auto& repfield = this->_internal_logtags(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.LogGroup)
+  return target;
+}
+
+size_t LogGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.LogGroup)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.Log Logs = 1;
+  total_size += 1UL * this->_internal_logs_size();
+  for (const auto& msg : this->_impl_.logs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .sls_logs.LogTag LogTags = 6;
+  total_size += 1UL * this->_internal_logtags_size();
+  for (const auto& msg : this->_impl_.logtags_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string Category = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_category());
+    }
+
+    // optional string Topic = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_topic());
+    }
+
+    // optional string Source = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_source());
+    }
+
+    // optional string MachineUUID = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_machineuuid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogGroup::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogGroup::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogGroup::GetClassData() const { return &_class_data_; }
+
+
+void LogGroup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogGroup*>(&to_msg);
+  auto& from = static_cast<const LogGroup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.LogGroup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.logs_.MergeFrom(from._impl_.logs_);
+  _this->_impl_.logtags_.MergeFrom(from._impl_.logtags_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_category(from._internal_category());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_topic(from._internal_topic());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_source(from._internal_source());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_machineuuid(from._internal_machineuuid());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogGroup::CopyFrom(const LogGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.LogGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogGroup::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.logs_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.logtags_))
+    return false;
+  return true;
+}
+
+void LogGroup::InternalSwap(LogGroup* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.logs_.InternalSwap(&other->_impl_.logs_);
+  _impl_.logtags_.InternalSwap(&other->_impl_.logtags_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.category_, lhs_arena,
+      &other->_impl_.category_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.topic_, lhs_arena,
+      &other->_impl_.topic_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.source_, lhs_arena,
+      &other->_impl_.source_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machineuuid_, lhs_arena,
+      &other->_impl_.machineuuid_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogGroup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[3]);
+}
+
+// ===================================================================
+
+class SlsLogPackage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SlsLogPackage>()._impl_._has_bits_);
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_uncompress_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_compress_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SlsLogPackage::SlsLogPackage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.SlsLogPackage)
+}
+SlsLogPackage::SlsLogPackage(const SlsLogPackage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SlsLogPackage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.uncompress_size_){}
+    , decltype(_impl_.compress_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.uncompress_size_, &from._impl_.uncompress_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compress_type_) -
+    reinterpret_cast<char*>(&_impl_.uncompress_size_)) + sizeof(_impl_.compress_type_));
+  // @@protoc_insertion_point(copy_constructor:sls_logs.SlsLogPackage)
+}
+
+inline void SlsLogPackage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.uncompress_size_){0}
+    , decltype(_impl_.compress_type_){0}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SlsLogPackage::~SlsLogPackage() {
+  // @@protoc_insertion_point(destructor:sls_logs.SlsLogPackage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SlsLogPackage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void SlsLogPackage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SlsLogPackage::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.SlsLogPackage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.uncompress_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.compress_type_) -
+        reinterpret_cast<char*>(&_impl_.uncompress_size_)) + sizeof(_impl_.compress_type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlsLogPackage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 uncompress_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_uncompress_size(&has_bits);
+          _impl_.uncompress_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sls_logs.SlsCompressType compress_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sls_logs::SlsCompressType_IsValid(val))) {
+            _internal_set_compress_type(static_cast<::sls_logs::SlsCompressType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SlsLogPackage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.SlsLogPackage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes data = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_data(), target);
+  }
+
+  // optional int32 uncompress_size = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_uncompress_size(), target);
+  }
+
+  // optional .sls_logs.SlsCompressType compress_type = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compress_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.SlsLogPackage)
+  return target;
+}
+
+size_t SlsLogPackage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.SlsLogPackage)
+  size_t total_size = 0;
+
+  // required bytes data = 1;
+  if (_internal_has_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional int32 uncompress_size = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_uncompress_size());
+    }
+
+    // optional .sls_logs.SlsCompressType compress_type = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_compress_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SlsLogPackage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SlsLogPackage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SlsLogPackage::GetClassData() const { return &_class_data_; }
+
+
+void SlsLogPackage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SlsLogPackage*>(&to_msg);
+  auto& from = static_cast<const SlsLogPackage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.SlsLogPackage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.uncompress_size_ = from._impl_.uncompress_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.compress_type_ = from._impl_.compress_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SlsLogPackage::CopyFrom(const SlsLogPackage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.SlsLogPackage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlsLogPackage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SlsLogPackage::InternalSwap(SlsLogPackage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SlsLogPackage, _impl_.compress_type_)
+      + sizeof(SlsLogPackage::_impl_.compress_type_)
+      - PROTOBUF_FIELD_OFFSET(SlsLogPackage, _impl_.uncompress_size_)>(
+          reinterpret_cast<char*>(&_impl_.uncompress_size_),
+          reinterpret_cast<char*>(&other->_impl_.uncompress_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlsLogPackage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[4]);
+}
+
+// ===================================================================
+
+class SlsLogPackageList::_Internal {
+ public:
+};
+
+SlsLogPackageList::SlsLogPackageList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.SlsLogPackageList)
+}
+SlsLogPackageList::SlsLogPackageList(const SlsLogPackageList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SlsLogPackageList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packages_){from._impl_.packages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sls_logs.SlsLogPackageList)
+}
+
+inline void SlsLogPackageList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SlsLogPackageList::~SlsLogPackageList() {
+  // @@protoc_insertion_point(destructor:sls_logs.SlsLogPackageList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SlsLogPackageList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.packages_.~RepeatedPtrField();
+}
+
+void SlsLogPackageList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SlsLogPackageList::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.SlsLogPackageList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.packages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlsLogPackageList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sls_logs.SlsLogPackage packages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_packages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SlsLogPackageList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.SlsLogPackageList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.SlsLogPackage packages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_packages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_packages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.SlsLogPackageList)
+  return target;
+}
+
+size_t SlsLogPackageList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.SlsLogPackageList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.SlsLogPackage packages = 1;
+  total_size += 1UL * this->_internal_packages_size();
+  for (const auto& msg : this->_impl_.packages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SlsLogPackageList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SlsLogPackageList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SlsLogPackageList::GetClassData() const { return &_class_data_; }
+
+
+void SlsLogPackageList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SlsLogPackageList*>(&to_msg);
+  auto& from = static_cast<const SlsLogPackageList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.SlsLogPackageList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.packages_.MergeFrom(from._impl_.packages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SlsLogPackageList::CopyFrom(const SlsLogPackageList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.SlsLogPackageList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlsLogPackageList::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.packages_))
+    return false;
+  return true;
+}
+
+void SlsLogPackageList::InternalSwap(SlsLogPackageList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.packages_.InternalSwap(&other->_impl_.packages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlsLogPackageList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[5]);
+}
+
+// ===================================================================
+
+class LogGroupList::_Internal {
+ public:
+};
+
+LogGroupList::LogGroupList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sls_logs.LogGroupList)
+}
+LogGroupList::LogGroupList(const LogGroupList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogGroupList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.loggrouplist_){from._impl_.loggrouplist_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sls_logs.LogGroupList)
+}
+
+inline void LogGroupList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.loggrouplist_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LogGroupList::~LogGroupList() {
+  // @@protoc_insertion_point(destructor:sls_logs.LogGroupList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogGroupList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.loggrouplist_.~RepeatedPtrField();
+}
+
+void LogGroupList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogGroupList::Clear() {
+// @@protoc_insertion_point(message_clear_start:sls_logs.LogGroupList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.loggrouplist_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogGroupList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sls_logs.LogGroup logGroupList = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_loggrouplist(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogGroupList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sls_logs.LogGroupList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.LogGroup logGroupList = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_loggrouplist_size()); i < n; i++) {
+    const auto& repfield = this->_internal_loggrouplist(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sls_logs.LogGroupList)
+  return target;
+}
+
+size_t LogGroupList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sls_logs.LogGroupList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sls_logs.LogGroup logGroupList = 1;
+  total_size += 1UL * this->_internal_loggrouplist_size();
+  for (const auto& msg : this->_impl_.loggrouplist_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogGroupList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogGroupList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogGroupList::GetClassData() const { return &_class_data_; }
+
+
+void LogGroupList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogGroupList*>(&to_msg);
+  auto& from = static_cast<const LogGroupList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sls_logs.LogGroupList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.loggrouplist_.MergeFrom(from._impl_.loggrouplist_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogGroupList::CopyFrom(const LogGroupList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sls_logs.LogGroupList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogGroupList::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.loggrouplist_))
+    return false;
+  return true;
+}
+
+void LogGroupList::InternalSwap(LogGroupList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.loggrouplist_.InternalSwap(&other->_impl_.loggrouplist_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogGroupList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sls_5flogs_2eproto_getter, &descriptor_table_sls_5flogs_2eproto_once,
+      file_level_metadata_sls_5flogs_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace sls_logs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sls_logs::Log_Content*
+Arena::CreateMaybeMessage< ::sls_logs::Log_Content >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::Log_Content >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::Log*
+Arena::CreateMaybeMessage< ::sls_logs::Log >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::Log >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::LogTag*
+Arena::CreateMaybeMessage< ::sls_logs::LogTag >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::LogTag >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::LogGroup*
+Arena::CreateMaybeMessage< ::sls_logs::LogGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::LogGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::SlsLogPackage*
+Arena::CreateMaybeMessage< ::sls_logs::SlsLogPackage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::SlsLogPackage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::SlsLogPackageList*
+Arena::CreateMaybeMessage< ::sls_logs::SlsLogPackageList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::SlsLogPackageList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sls_logs::LogGroupList*
+Arena::CreateMaybeMessage< ::sls_logs::LogGroupList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sls_logs::LogGroupList >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
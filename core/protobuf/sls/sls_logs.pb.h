@@ -0,0 +1,2590 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sls_logs.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sls_5flogs_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sls_5flogs_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_sls_5flogs_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_sls_5flogs_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sls_5flogs_2eproto;
+namespace sls_logs {
+class Log;
+struct LogDefaultTypeInternal;
+extern LogDefaultTypeInternal _Log_default_instance_;
+class LogGroup;
+struct LogGroupDefaultTypeInternal;
+extern LogGroupDefaultTypeInternal _LogGroup_default_instance_;
+class LogGroupList;
+struct LogGroupListDefaultTypeInternal;
+extern LogGroupListDefaultTypeInternal _LogGroupList_default_instance_;
+class LogTag;
+struct LogTagDefaultTypeInternal;
+extern LogTagDefaultTypeInternal _LogTag_default_instance_;
+class Log_Content;
+struct Log_ContentDefaultTypeInternal;
+extern Log_ContentDefaultTypeInternal _Log_Content_default_instance_;
+class SlsLogPackage;
+struct SlsLogPackageDefaultTypeInternal;
+extern SlsLogPackageDefaultTypeInternal _SlsLogPackage_default_instance_;
+class SlsLogPackageList;
+struct SlsLogPackageListDefaultTypeInternal;
+extern SlsLogPackageListDefaultTypeInternal _SlsLogPackageList_default_instance_;
+}  // namespace sls_logs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sls_logs::Log* Arena::CreateMaybeMessage<::sls_logs::Log>(Arena*);
+template<> ::sls_logs::LogGroup* Arena::CreateMaybeMessage<::sls_logs::LogGroup>(Arena*);
+template<> ::sls_logs::LogGroupList* Arena::CreateMaybeMessage<::sls_logs::LogGroupList>(Arena*);
+template<> ::sls_logs::LogTag* Arena::CreateMaybeMessage<::sls_logs::LogTag>(Arena*);
+template<> ::sls_logs::Log_Content* Arena::CreateMaybeMessage<::sls_logs::Log_Content>(Arena*);
+template<> ::sls_logs::SlsLogPackage* Arena::CreateMaybeMessage<::sls_logs::SlsLogPackage>(Arena*);
+template<> ::sls_logs::SlsLogPackageList* Arena::CreateMaybeMessage<::sls_logs::SlsLogPackageList>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sls_logs {
+
+enum SlsCompressType : int {
+  SLS_CMP_NONE = 0,
+  SLS_CMP_DEFLATE = 1,
+  SLS_CMP_LZ4 = 2,
+  SLS_CMP_ZSTD = 3
+};
+bool SlsCompressType_IsValid(int value);
+constexpr SlsCompressType SlsCompressType_MIN = SLS_CMP_NONE;
+constexpr SlsCompressType SlsCompressType_MAX = SLS_CMP_ZSTD;
+constexpr int SlsCompressType_ARRAYSIZE = SlsCompressType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SlsCompressType_descriptor();
+template<typename T>
+inline const std::string& SlsCompressType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SlsCompressType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SlsCompressType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SlsCompressType_descriptor(), enum_t_value);
+}
+inline bool SlsCompressType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SlsCompressType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SlsCompressType>(
+    SlsCompressType_descriptor(), name, value);
+}
+enum SlsTelemetryType : int {
+  SLS_TELEMETRY_TYPE_LOGS = 0,
+  SLS_TELEMETRY_TYPE_METRICS = 1
+};
+bool SlsTelemetryType_IsValid(int value);
+constexpr SlsTelemetryType SlsTelemetryType_MIN = SLS_TELEMETRY_TYPE_LOGS;
+constexpr SlsTelemetryType SlsTelemetryType_MAX = SLS_TELEMETRY_TYPE_METRICS;
+constexpr int SlsTelemetryType_ARRAYSIZE = SlsTelemetryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SlsTelemetryType_descriptor();
+template<typename T>
+inline const std::string& SlsTelemetryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SlsTelemetryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SlsTelemetryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SlsTelemetryType_descriptor(), enum_t_value);
+}
+inline bool SlsTelemetryType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SlsTelemetryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SlsTelemetryType>(
+    SlsTelemetryType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Log_Content final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.Log.Content) */ {
+ public:
+  inline Log_Content() : Log_Content(nullptr) {}
+  ~Log_Content() override;
+  explicit PROTOBUF_CONSTEXPR Log_Content(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Log_Content(const Log_Content& from);
+  Log_Content(Log_Content&& from) noexcept
+    : Log_Content() {
+    *this = ::std::move(from);
+  }
+
+  inline Log_Content& operator=(const Log_Content& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Log_Content& operator=(Log_Content&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Log_Content& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Log_Content* internal_default_instance() {
+    return reinterpret_cast<const Log_Content*>(
+               &_Log_Content_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Log_Content& a, Log_Content& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Log_Content* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Log_Content* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Log_Content* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Log_Content>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Log_Content& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Log_Content& from) {
+    Log_Content::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Log_Content* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.Log.Content";
+  }
+  protected:
+  explicit Log_Content(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string Key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required string Value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.Log.Content)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Log final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.Log) */ {
+ public:
+  inline Log() : Log(nullptr) {}
+  ~Log() override;
+  explicit PROTOBUF_CONSTEXPR Log(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Log(const Log& from);
+  Log(Log&& from) noexcept
+    : Log() {
+    *this = ::std::move(from);
+  }
+
+  inline Log& operator=(const Log& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Log& operator=(Log&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Log& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Log* internal_default_instance() {
+    return reinterpret_cast<const Log*>(
+               &_Log_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Log& a, Log& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Log* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Log* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Log* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Log>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Log& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Log& from) {
+    Log::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Log* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.Log";
+  }
+  protected:
+  explicit Log(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Log_Content Content;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentsFieldNumber = 2,
+    kValuesFieldNumber = 3,
+    kTimeFieldNumber = 1,
+    kTimeNsFieldNumber = 4,
+  };
+  // repeated .sls_logs.Log.Content Contents = 2;
+  int contents_size() const;
+  private:
+  int _internal_contents_size() const;
+  public:
+  void clear_contents();
+  ::sls_logs::Log_Content* mutable_contents(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log_Content >*
+      mutable_contents();
+  private:
+  const ::sls_logs::Log_Content& _internal_contents(int index) const;
+  ::sls_logs::Log_Content* _internal_add_contents();
+  public:
+  const ::sls_logs::Log_Content& contents(int index) const;
+  ::sls_logs::Log_Content* add_contents();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log_Content >&
+      contents() const;
+
+  // repeated string values = 3;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const char* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
+  private:
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
+  public:
+
+  // required uint32 Time = 1;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  uint32_t time() const;
+  void set_time(uint32_t value);
+  private:
+  uint32_t _internal_time() const;
+  void _internal_set_time(uint32_t value);
+  public:
+
+  // optional fixed32 Time_ns = 4;
+  bool has_time_ns() const;
+  private:
+  bool _internal_has_time_ns() const;
+  public:
+  void clear_time_ns();
+  uint32_t time_ns() const;
+  void set_time_ns(uint32_t value);
+  private:
+  uint32_t _internal_time_ns() const;
+  void _internal_set_time_ns(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.Log)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log_Content > contents_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    uint32_t time_;
+    uint32_t time_ns_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogTag final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.LogTag) */ {
+ public:
+  inline LogTag() : LogTag(nullptr) {}
+  ~LogTag() override;
+  explicit PROTOBUF_CONSTEXPR LogTag(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogTag(const LogTag& from);
+  LogTag(LogTag&& from) noexcept
+    : LogTag() {
+    *this = ::std::move(from);
+  }
+
+  inline LogTag& operator=(const LogTag& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogTag& operator=(LogTag&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogTag& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogTag* internal_default_instance() {
+    return reinterpret_cast<const LogTag*>(
+               &_LogTag_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(LogTag& a, LogTag& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogTag* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogTag* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogTag* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogTag>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogTag& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogTag& from) {
+    LogTag::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogTag* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.LogTag";
+  }
+  protected:
+  explicit LogTag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string Key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required string Value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.LogTag)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.LogGroup) */ {
+ public:
+  inline LogGroup() : LogGroup(nullptr) {}
+  ~LogGroup() override;
+  explicit PROTOBUF_CONSTEXPR LogGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogGroup(const LogGroup& from);
+  LogGroup(LogGroup&& from) noexcept
+    : LogGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline LogGroup& operator=(const LogGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogGroup& operator=(LogGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogGroup* internal_default_instance() {
+    return reinterpret_cast<const LogGroup*>(
+               &_LogGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(LogGroup& a, LogGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogGroup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogGroup>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogGroup& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogGroup& from) {
+    LogGroup::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogGroup* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.LogGroup";
+  }
+  protected:
+  explicit LogGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogsFieldNumber = 1,
+    kLogTagsFieldNumber = 6,
+    kCategoryFieldNumber = 2,
+    kTopicFieldNumber = 3,
+    kSourceFieldNumber = 4,
+    kMachineUUIDFieldNumber = 5,
+  };
+  // repeated .sls_logs.Log Logs = 1;
+  int logs_size() const;
+  private:
+  int _internal_logs_size() const;
+  public:
+  void clear_logs();
+  ::sls_logs::Log* mutable_logs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log >*
+      mutable_logs();
+  private:
+  const ::sls_logs::Log& _internal_logs(int index) const;
+  ::sls_logs::Log* _internal_add_logs();
+  public:
+  const ::sls_logs::Log& logs(int index) const;
+  ::sls_logs::Log* add_logs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log >&
+      logs() const;
+
+  // repeated .sls_logs.LogTag LogTags = 6;
+  int logtags_size() const;
+  private:
+  int _internal_logtags_size() const;
+  public:
+  void clear_logtags();
+  ::sls_logs::LogTag* mutable_logtags(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogTag >*
+      mutable_logtags();
+  private:
+  const ::sls_logs::LogTag& _internal_logtags(int index) const;
+  ::sls_logs::LogTag* _internal_add_logtags();
+  public:
+  const ::sls_logs::LogTag& logtags(int index) const;
+  ::sls_logs::LogTag* add_logtags();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogTag >&
+      logtags() const;
+
+  // optional string Category = 2;
+  bool has_category() const;
+  private:
+  bool _internal_has_category() const;
+  public:
+  void clear_category();
+  const std::string& category() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_category(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_category();
+  PROTOBUF_NODISCARD std::string* release_category();
+  void set_allocated_category(std::string* category);
+  private:
+  const std::string& _internal_category() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_category(const std::string& value);
+  std::string* _internal_mutable_category();
+  public:
+
+  // optional string Topic = 3;
+  bool has_topic() const;
+  private:
+  bool _internal_has_topic() const;
+  public:
+  void clear_topic();
+  const std::string& topic() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_topic(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_topic();
+  PROTOBUF_NODISCARD std::string* release_topic();
+  void set_allocated_topic(std::string* topic);
+  private:
+  const std::string& _internal_topic() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_topic(const std::string& value);
+  std::string* _internal_mutable_topic();
+  public:
+
+  // optional string Source = 4;
+  bool has_source() const;
+  private:
+  bool _internal_has_source() const;
+  public:
+  void clear_source();
+  const std::string& source() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* source);
+  private:
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(const std::string& value);
+  std::string* _internal_mutable_source();
+  public:
+
+  // optional string MachineUUID = 5;
+  bool has_machineuuid() const;
+  private:
+  bool _internal_has_machineuuid() const;
+  public:
+  void clear_machineuuid();
+  const std::string& machineuuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machineuuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machineuuid();
+  PROTOBUF_NODISCARD std::string* release_machineuuid();
+  void set_allocated_machineuuid(std::string* machineuuid);
+  private:
+  const std::string& _internal_machineuuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machineuuid(const std::string& value);
+  std::string* _internal_mutable_machineuuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.LogGroup)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log > logs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogTag > logtags_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr category_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr topic_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machineuuid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlsLogPackage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.SlsLogPackage) */ {
+ public:
+  inline SlsLogPackage() : SlsLogPackage(nullptr) {}
+  ~SlsLogPackage() override;
+  explicit PROTOBUF_CONSTEXPR SlsLogPackage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SlsLogPackage(const SlsLogPackage& from);
+  SlsLogPackage(SlsLogPackage&& from) noexcept
+    : SlsLogPackage() {
+    *this = ::std::move(from);
+  }
+
+  inline SlsLogPackage& operator=(const SlsLogPackage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlsLogPackage& operator=(SlsLogPackage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlsLogPackage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlsLogPackage* internal_default_instance() {
+    return reinterpret_cast<const SlsLogPackage*>(
+               &_SlsLogPackage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SlsLogPackage& a, SlsLogPackage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlsLogPackage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlsLogPackage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlsLogPackage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlsLogPackage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlsLogPackage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlsLogPackage& from) {
+    SlsLogPackage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlsLogPackage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.SlsLogPackage";
+  }
+  protected:
+  explicit SlsLogPackage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+    kUncompressSizeFieldNumber = 2,
+    kCompressTypeFieldNumber = 3,
+  };
+  // required bytes data = 1;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional int32 uncompress_size = 2;
+  bool has_uncompress_size() const;
+  private:
+  bool _internal_has_uncompress_size() const;
+  public:
+  void clear_uncompress_size();
+  int32_t uncompress_size() const;
+  void set_uncompress_size(int32_t value);
+  private:
+  int32_t _internal_uncompress_size() const;
+  void _internal_set_uncompress_size(int32_t value);
+  public:
+
+  // optional .sls_logs.SlsCompressType compress_type = 3;
+  bool has_compress_type() const;
+  private:
+  bool _internal_has_compress_type() const;
+  public:
+  void clear_compress_type();
+  ::sls_logs::SlsCompressType compress_type() const;
+  void set_compress_type(::sls_logs::SlsCompressType value);
+  private:
+  ::sls_logs::SlsCompressType _internal_compress_type() const;
+  void _internal_set_compress_type(::sls_logs::SlsCompressType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sls_logs.SlsLogPackage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t uncompress_size_;
+    int compress_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlsLogPackageList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.SlsLogPackageList) */ {
+ public:
+  inline SlsLogPackageList() : SlsLogPackageList(nullptr) {}
+  ~SlsLogPackageList() override;
+  explicit PROTOBUF_CONSTEXPR SlsLogPackageList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SlsLogPackageList(const SlsLogPackageList& from);
+  SlsLogPackageList(SlsLogPackageList&& from) noexcept
+    : SlsLogPackageList() {
+    *this = ::std::move(from);
+  }
+
+  inline SlsLogPackageList& operator=(const SlsLogPackageList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlsLogPackageList& operator=(SlsLogPackageList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlsLogPackageList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlsLogPackageList* internal_default_instance() {
+    return reinterpret_cast<const SlsLogPackageList*>(
+               &_SlsLogPackageList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SlsLogPackageList& a, SlsLogPackageList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlsLogPackageList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlsLogPackageList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlsLogPackageList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlsLogPackageList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlsLogPackageList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlsLogPackageList& from) {
+    SlsLogPackageList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlsLogPackageList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.SlsLogPackageList";
+  }
+  protected:
+  explicit SlsLogPackageList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPackagesFieldNumber = 1,
+  };
+  // repeated .sls_logs.SlsLogPackage packages = 1;
+  int packages_size() const;
+  private:
+  int _internal_packages_size() const;
+  public:
+  void clear_packages();
+  ::sls_logs::SlsLogPackage* mutable_packages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::SlsLogPackage >*
+      mutable_packages();
+  private:
+  const ::sls_logs::SlsLogPackage& _internal_packages(int index) const;
+  ::sls_logs::SlsLogPackage* _internal_add_packages();
+  public:
+  const ::sls_logs::SlsLogPackage& packages(int index) const;
+  ::sls_logs::SlsLogPackage* add_packages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::SlsLogPackage >&
+      packages() const;
+
+  // @@protoc_insertion_point(class_scope:sls_logs.SlsLogPackageList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::SlsLogPackage > packages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogGroupList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sls_logs.LogGroupList) */ {
+ public:
+  inline LogGroupList() : LogGroupList(nullptr) {}
+  ~LogGroupList() override;
+  explicit PROTOBUF_CONSTEXPR LogGroupList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogGroupList(const LogGroupList& from);
+  LogGroupList(LogGroupList&& from) noexcept
+    : LogGroupList() {
+    *this = ::std::move(from);
+  }
+
+  inline LogGroupList& operator=(const LogGroupList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogGroupList& operator=(LogGroupList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogGroupList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogGroupList* internal_default_instance() {
+    return reinterpret_cast<const LogGroupList*>(
+               &_LogGroupList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(LogGroupList& a, LogGroupList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogGroupList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogGroupList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogGroupList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogGroupList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogGroupList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogGroupList& from) {
+    LogGroupList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogGroupList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sls_logs.LogGroupList";
+  }
+  protected:
+  explicit LogGroupList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogGroupListFieldNumber = 1,
+  };
+  // repeated .sls_logs.LogGroup logGroupList = 1;
+  int loggrouplist_size() const;
+  private:
+  int _internal_loggrouplist_size() const;
+  public:
+  void clear_loggrouplist();
+  ::sls_logs::LogGroup* mutable_loggrouplist(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogGroup >*
+      mutable_loggrouplist();
+  private:
+  const ::sls_logs::LogGroup& _internal_loggrouplist(int index) const;
+  ::sls_logs::LogGroup* _internal_add_loggrouplist();
+  public:
+  const ::sls_logs::LogGroup& loggrouplist(int index) const;
+  ::sls_logs::LogGroup* add_loggrouplist();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogGroup >&
+      loggrouplist() const;
+
+  // @@protoc_insertion_point(class_scope:sls_logs.LogGroupList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogGroup > loggrouplist_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sls_5flogs_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Log_Content
+
+// required string Key = 1;
+inline bool Log_Content::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Log_Content::has_key() const {
+  return _internal_has_key();
+}
+inline void Log_Content::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Log_Content::key() const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.Content.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Log_Content::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.Log.Content.Key)
+}
+inline std::string* Log_Content::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:sls_logs.Log.Content.Key)
+  return _s;
+}
+inline const std::string& Log_Content::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Log_Content::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Log_Content::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Log_Content::release_key() {
+  // @@protoc_insertion_point(field_release:sls_logs.Log.Content.Key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Log_Content::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.Log.Content.Key)
+}
+
+// required string Value = 2;
+inline bool Log_Content::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Log_Content::has_value() const {
+  return _internal_has_value();
+}
+inline void Log_Content::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Log_Content::value() const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.Content.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Log_Content::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.Log.Content.Value)
+}
+inline std::string* Log_Content::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:sls_logs.Log.Content.Value)
+  return _s;
+}
+inline const std::string& Log_Content::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Log_Content::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Log_Content::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Log_Content::release_value() {
+  // @@protoc_insertion_point(field_release:sls_logs.Log.Content.Value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Log_Content::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.Log.Content.Value)
+}
+
+// -------------------------------------------------------------------
+
+// Log
+
+// required uint32 Time = 1;
+inline bool Log::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Log::has_time() const {
+  return _internal_has_time();
+}
+inline void Log::clear_time() {
+  _impl_.time_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Log::_internal_time() const {
+  return _impl_.time_;
+}
+inline uint32_t Log::time() const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.Time)
+  return _internal_time();
+}
+inline void Log::_internal_set_time(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.time_ = value;
+}
+inline void Log::set_time(uint32_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:sls_logs.Log.Time)
+}
+
+// repeated .sls_logs.Log.Content Contents = 2;
+inline int Log::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int Log::contents_size() const {
+  return _internal_contents_size();
+}
+inline void Log::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline ::sls_logs::Log_Content* Log::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.Log.Contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log_Content >*
+Log::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.Log.Contents)
+  return &_impl_.contents_;
+}
+inline const ::sls_logs::Log_Content& Log::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const ::sls_logs::Log_Content& Log::contents(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.Contents)
+  return _internal_contents(index);
+}
+inline ::sls_logs::Log_Content* Log::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline ::sls_logs::Log_Content* Log::add_contents() {
+  ::sls_logs::Log_Content* _add = _internal_add_contents();
+  // @@protoc_insertion_point(field_add:sls_logs.Log.Contents)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log_Content >&
+Log::contents() const {
+  // @@protoc_insertion_point(field_list:sls_logs.Log.Contents)
+  return _impl_.contents_;
+}
+
+// repeated string values = 3;
+inline int Log::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int Log::values_size() const {
+  return _internal_values_size();
+}
+inline void Log::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* Log::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:sls_logs.Log.values)
+  return _s;
+}
+inline const std::string& Log::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& Log::values(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.values)
+  return _internal_values(index);
+}
+inline std::string* Log::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.Log.values)
+  return _impl_.values_.Mutable(index);
+}
+inline void Log::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:sls_logs.Log.values)
+}
+inline void Log::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:sls_logs.Log.values)
+}
+inline void Log::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:sls_logs.Log.values)
+}
+inline void Log::set_values(int index, const char* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:sls_logs.Log.values)
+}
+inline std::string* Log::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void Log::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:sls_logs.Log.values)
+}
+inline void Log::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:sls_logs.Log.values)
+}
+inline void Log::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:sls_logs.Log.values)
+}
+inline void Log::add_values(const char* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:sls_logs.Log.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Log::values() const {
+  // @@protoc_insertion_point(field_list:sls_logs.Log.values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Log::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.Log.values)
+  return &_impl_.values_;
+}
+
+// optional fixed32 Time_ns = 4;
+inline bool Log::_internal_has_time_ns() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Log::has_time_ns() const {
+  return _internal_has_time_ns();
+}
+inline void Log::clear_time_ns() {
+  _impl_.time_ns_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Log::_internal_time_ns() const {
+  return _impl_.time_ns_;
+}
+inline uint32_t Log::time_ns() const {
+  // @@protoc_insertion_point(field_get:sls_logs.Log.Time_ns)
+  return _internal_time_ns();
+}
+inline void Log::_internal_set_time_ns(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.time_ns_ = value;
+}
+inline void Log::set_time_ns(uint32_t value) {
+  _internal_set_time_ns(value);
+  // @@protoc_insertion_point(field_set:sls_logs.Log.Time_ns)
+}
+
+// -------------------------------------------------------------------
+
+// LogTag
+
+// required string Key = 1;
+inline bool LogTag::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogTag::has_key() const {
+  return _internal_has_key();
+}
+inline void LogTag::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& LogTag::key() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogTag.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogTag::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogTag.Key)
+}
+inline std::string* LogTag::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogTag.Key)
+  return _s;
+}
+inline const std::string& LogTag::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void LogTag::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogTag::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogTag::release_key() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogTag.Key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogTag::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogTag.Key)
+}
+
+// required string Value = 2;
+inline bool LogTag::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogTag::has_value() const {
+  return _internal_has_value();
+}
+inline void LogTag::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& LogTag::value() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogTag.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogTag::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogTag.Value)
+}
+inline std::string* LogTag::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogTag.Value)
+  return _s;
+}
+inline const std::string& LogTag::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void LogTag::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogTag::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogTag::release_value() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogTag.Value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogTag::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogTag.Value)
+}
+
+// -------------------------------------------------------------------
+
+// LogGroup
+
+// repeated .sls_logs.Log Logs = 1;
+inline int LogGroup::_internal_logs_size() const {
+  return _impl_.logs_.size();
+}
+inline int LogGroup::logs_size() const {
+  return _internal_logs_size();
+}
+inline void LogGroup::clear_logs() {
+  _impl_.logs_.Clear();
+}
+inline ::sls_logs::Log* LogGroup::mutable_logs(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.Logs)
+  return _impl_.logs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log >*
+LogGroup::mutable_logs() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.LogGroup.Logs)
+  return &_impl_.logs_;
+}
+inline const ::sls_logs::Log& LogGroup::_internal_logs(int index) const {
+  return _impl_.logs_.Get(index);
+}
+inline const ::sls_logs::Log& LogGroup::logs(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.Logs)
+  return _internal_logs(index);
+}
+inline ::sls_logs::Log* LogGroup::_internal_add_logs() {
+  return _impl_.logs_.Add();
+}
+inline ::sls_logs::Log* LogGroup::add_logs() {
+  ::sls_logs::Log* _add = _internal_add_logs();
+  // @@protoc_insertion_point(field_add:sls_logs.LogGroup.Logs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::Log >&
+LogGroup::logs() const {
+  // @@protoc_insertion_point(field_list:sls_logs.LogGroup.Logs)
+  return _impl_.logs_;
+}
+
+// optional string Category = 2;
+inline bool LogGroup::_internal_has_category() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogGroup::has_category() const {
+  return _internal_has_category();
+}
+inline void LogGroup::clear_category() {
+  _impl_.category_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& LogGroup::category() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.Category)
+  return _internal_category();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogGroup::set_category(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.category_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogGroup.Category)
+}
+inline std::string* LogGroup::mutable_category() {
+  std::string* _s = _internal_mutable_category();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.Category)
+  return _s;
+}
+inline const std::string& LogGroup::_internal_category() const {
+  return _impl_.category_.Get();
+}
+inline void LogGroup::_internal_set_category(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.category_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogGroup::_internal_mutable_category() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.category_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogGroup::release_category() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogGroup.Category)
+  if (!_internal_has_category()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.category_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.category_.IsDefault()) {
+    _impl_.category_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogGroup::set_allocated_category(std::string* category) {
+  if (category != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.category_.SetAllocated(category, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.category_.IsDefault()) {
+    _impl_.category_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogGroup.Category)
+}
+
+// optional string Topic = 3;
+inline bool LogGroup::_internal_has_topic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogGroup::has_topic() const {
+  return _internal_has_topic();
+}
+inline void LogGroup::clear_topic() {
+  _impl_.topic_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& LogGroup::topic() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.Topic)
+  return _internal_topic();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogGroup::set_topic(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.topic_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogGroup.Topic)
+}
+inline std::string* LogGroup::mutable_topic() {
+  std::string* _s = _internal_mutable_topic();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.Topic)
+  return _s;
+}
+inline const std::string& LogGroup::_internal_topic() const {
+  return _impl_.topic_.Get();
+}
+inline void LogGroup::_internal_set_topic(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.topic_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogGroup::_internal_mutable_topic() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.topic_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogGroup::release_topic() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogGroup.Topic)
+  if (!_internal_has_topic()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.topic_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.topic_.IsDefault()) {
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogGroup::set_allocated_topic(std::string* topic) {
+  if (topic != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.topic_.SetAllocated(topic, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.topic_.IsDefault()) {
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogGroup.Topic)
+}
+
+// optional string Source = 4;
+inline bool LogGroup::_internal_has_source() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LogGroup::has_source() const {
+  return _internal_has_source();
+}
+inline void LogGroup::clear_source() {
+  _impl_.source_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& LogGroup::source() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.Source)
+  return _internal_source();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogGroup::set_source(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogGroup.Source)
+}
+inline std::string* LogGroup::mutable_source() {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.Source)
+  return _s;
+}
+inline const std::string& LogGroup::_internal_source() const {
+  return _impl_.source_.Get();
+}
+inline void LogGroup::_internal_set_source(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.source_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogGroup::_internal_mutable_source() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.source_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogGroup::release_source() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogGroup.Source)
+  if (!_internal_has_source()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.source_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogGroup::set_allocated_source(std::string* source) {
+  if (source != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.source_.SetAllocated(source, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogGroup.Source)
+}
+
+// optional string MachineUUID = 5;
+inline bool LogGroup::_internal_has_machineuuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogGroup::has_machineuuid() const {
+  return _internal_has_machineuuid();
+}
+inline void LogGroup::clear_machineuuid() {
+  _impl_.machineuuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& LogGroup::machineuuid() const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.MachineUUID)
+  return _internal_machineuuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogGroup::set_machineuuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.machineuuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.LogGroup.MachineUUID)
+}
+inline std::string* LogGroup::mutable_machineuuid() {
+  std::string* _s = _internal_mutable_machineuuid();
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.MachineUUID)
+  return _s;
+}
+inline const std::string& LogGroup::_internal_machineuuid() const {
+  return _impl_.machineuuid_.Get();
+}
+inline void LogGroup::_internal_set_machineuuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.machineuuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogGroup::_internal_mutable_machineuuid() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.machineuuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogGroup::release_machineuuid() {
+  // @@protoc_insertion_point(field_release:sls_logs.LogGroup.MachineUUID)
+  if (!_internal_has_machineuuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.machineuuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machineuuid_.IsDefault()) {
+    _impl_.machineuuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogGroup::set_allocated_machineuuid(std::string* machineuuid) {
+  if (machineuuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.machineuuid_.SetAllocated(machineuuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machineuuid_.IsDefault()) {
+    _impl_.machineuuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.LogGroup.MachineUUID)
+}
+
+// repeated .sls_logs.LogTag LogTags = 6;
+inline int LogGroup::_internal_logtags_size() const {
+  return _impl_.logtags_.size();
+}
+inline int LogGroup::logtags_size() const {
+  return _internal_logtags_size();
+}
+inline void LogGroup::clear_logtags() {
+  _impl_.logtags_.Clear();
+}
+inline ::sls_logs::LogTag* LogGroup::mutable_logtags(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroup.LogTags)
+  return _impl_.logtags_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogTag >*
+LogGroup::mutable_logtags() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.LogGroup.LogTags)
+  return &_impl_.logtags_;
+}
+inline const ::sls_logs::LogTag& LogGroup::_internal_logtags(int index) const {
+  return _impl_.logtags_.Get(index);
+}
+inline const ::sls_logs::LogTag& LogGroup::logtags(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroup.LogTags)
+  return _internal_logtags(index);
+}
+inline ::sls_logs::LogTag* LogGroup::_internal_add_logtags() {
+  return _impl_.logtags_.Add();
+}
+inline ::sls_logs::LogTag* LogGroup::add_logtags() {
+  ::sls_logs::LogTag* _add = _internal_add_logtags();
+  // @@protoc_insertion_point(field_add:sls_logs.LogGroup.LogTags)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogTag >&
+LogGroup::logtags() const {
+  // @@protoc_insertion_point(field_list:sls_logs.LogGroup.LogTags)
+  return _impl_.logtags_;
+}
+
+// -------------------------------------------------------------------
+
+// SlsLogPackage
+
+// required bytes data = 1;
+inline bool SlsLogPackage::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SlsLogPackage::has_data() const {
+  return _internal_has_data();
+}
+inline void SlsLogPackage::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SlsLogPackage::data() const {
+  // @@protoc_insertion_point(field_get:sls_logs.SlsLogPackage.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SlsLogPackage::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sls_logs.SlsLogPackage.data)
+}
+inline std::string* SlsLogPackage::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:sls_logs.SlsLogPackage.data)
+  return _s;
+}
+inline const std::string& SlsLogPackage::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void SlsLogPackage::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SlsLogPackage::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SlsLogPackage::release_data() {
+  // @@protoc_insertion_point(field_release:sls_logs.SlsLogPackage.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SlsLogPackage::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sls_logs.SlsLogPackage.data)
+}
+
+// optional int32 uncompress_size = 2;
+inline bool SlsLogPackage::_internal_has_uncompress_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SlsLogPackage::has_uncompress_size() const {
+  return _internal_has_uncompress_size();
+}
+inline void SlsLogPackage::clear_uncompress_size() {
+  _impl_.uncompress_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SlsLogPackage::_internal_uncompress_size() const {
+  return _impl_.uncompress_size_;
+}
+inline int32_t SlsLogPackage::uncompress_size() const {
+  // @@protoc_insertion_point(field_get:sls_logs.SlsLogPackage.uncompress_size)
+  return _internal_uncompress_size();
+}
+inline void SlsLogPackage::_internal_set_uncompress_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.uncompress_size_ = value;
+}
+inline void SlsLogPackage::set_uncompress_size(int32_t value) {
+  _internal_set_uncompress_size(value);
+  // @@protoc_insertion_point(field_set:sls_logs.SlsLogPackage.uncompress_size)
+}
+
+// optional .sls_logs.SlsCompressType compress_type = 3;
+inline bool SlsLogPackage::_internal_has_compress_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SlsLogPackage::has_compress_type() const {
+  return _internal_has_compress_type();
+}
+inline void SlsLogPackage::clear_compress_type() {
+  _impl_.compress_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::sls_logs::SlsCompressType SlsLogPackage::_internal_compress_type() const {
+  return static_cast< ::sls_logs::SlsCompressType >(_impl_.compress_type_);
+}
+inline ::sls_logs::SlsCompressType SlsLogPackage::compress_type() const {
+  // @@protoc_insertion_point(field_get:sls_logs.SlsLogPackage.compress_type)
+  return _internal_compress_type();
+}
+inline void SlsLogPackage::_internal_set_compress_type(::sls_logs::SlsCompressType value) {
+  assert(::sls_logs::SlsCompressType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.compress_type_ = value;
+}
+inline void SlsLogPackage::set_compress_type(::sls_logs::SlsCompressType value) {
+  _internal_set_compress_type(value);
+  // @@protoc_insertion_point(field_set:sls_logs.SlsLogPackage.compress_type)
+}
+
+// -------------------------------------------------------------------
+
+// SlsLogPackageList
+
+// repeated .sls_logs.SlsLogPackage packages = 1;
+inline int SlsLogPackageList::_internal_packages_size() const {
+  return _impl_.packages_.size();
+}
+inline int SlsLogPackageList::packages_size() const {
+  return _internal_packages_size();
+}
+inline void SlsLogPackageList::clear_packages() {
+  _impl_.packages_.Clear();
+}
+inline ::sls_logs::SlsLogPackage* SlsLogPackageList::mutable_packages(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.SlsLogPackageList.packages)
+  return _impl_.packages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::SlsLogPackage >*
+SlsLogPackageList::mutable_packages() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.SlsLogPackageList.packages)
+  return &_impl_.packages_;
+}
+inline const ::sls_logs::SlsLogPackage& SlsLogPackageList::_internal_packages(int index) const {
+  return _impl_.packages_.Get(index);
+}
+inline const ::sls_logs::SlsLogPackage& SlsLogPackageList::packages(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.SlsLogPackageList.packages)
+  return _internal_packages(index);
+}
+inline ::sls_logs::SlsLogPackage* SlsLogPackageList::_internal_add_packages() {
+  return _impl_.packages_.Add();
+}
+inline ::sls_logs::SlsLogPackage* SlsLogPackageList::add_packages() {
+  ::sls_logs::SlsLogPackage* _add = _internal_add_packages();
+  // @@protoc_insertion_point(field_add:sls_logs.SlsLogPackageList.packages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::SlsLogPackage >&
+SlsLogPackageList::packages() const {
+  // @@protoc_insertion_point(field_list:sls_logs.SlsLogPackageList.packages)
+  return _impl_.packages_;
+}
+
+// -------------------------------------------------------------------
+
+// LogGroupList
+
+// repeated .sls_logs.LogGroup logGroupList = 1;
+inline int LogGroupList::_internal_loggrouplist_size() const {
+  return _impl_.loggrouplist_.size();
+}
+inline int LogGroupList::loggrouplist_size() const {
+  return _internal_loggrouplist_size();
+}
+inline void LogGroupList::clear_loggrouplist() {
+  _impl_.loggrouplist_.Clear();
+}
+inline ::sls_logs::LogGroup* LogGroupList::mutable_loggrouplist(int index) {
+  // @@protoc_insertion_point(field_mutable:sls_logs.LogGroupList.logGroupList)
+  return _impl_.loggrouplist_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogGroup >*
+LogGroupList::mutable_loggrouplist() {
+  // @@protoc_insertion_point(field_mutable_list:sls_logs.LogGroupList.logGroupList)
+  return &_impl_.loggrouplist_;
+}
+inline const ::sls_logs::LogGroup& LogGroupList::_internal_loggrouplist(int index) const {
+  return _impl_.loggrouplist_.Get(index);
+}
+inline const ::sls_logs::LogGroup& LogGroupList::loggrouplist(int index) const {
+  // @@protoc_insertion_point(field_get:sls_logs.LogGroupList.logGroupList)
+  return _internal_loggrouplist(index);
+}
+inline ::sls_logs::LogGroup* LogGroupList::_internal_add_loggrouplist() {
+  return _impl_.loggrouplist_.Add();
+}
+inline ::sls_logs::LogGroup* LogGroupList::add_loggrouplist() {
+  ::sls_logs::LogGroup* _add = _internal_add_loggrouplist();
+  // @@protoc_insertion_point(field_add:sls_logs.LogGroupList.logGroupList)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sls_logs::LogGroup >&
+LogGroupList::loggrouplist() const {
+  // @@protoc_insertion_point(field_list:sls_logs.LogGroupList.logGroupList)
+  return _impl_.loggrouplist_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace sls_logs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::sls_logs::SlsCompressType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sls_logs::SlsCompressType>() {
+  return ::sls_logs::SlsCompressType_descriptor();
+}
+template <> struct is_proto_enum< ::sls_logs::SlsTelemetryType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sls_logs::SlsTelemetryType>() {
+  return ::sls_logs::SlsTelemetryType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sls_5flogs_2eproto
@@ -14,6 +14,8 @@
 
 #include "runner/FlusherRunner.h"
 
+#include <algorithm>
+
 #include "app_config/AppConfig.h"
 #include "application/Application.h"
 #include "common/LogtailCommonFlags.h"
@@ -21,11 +23,13 @@
 #include "common/http/HttpRequest.h"
 #include "logger/Logger.h"
 #include "monitor/LogtailAlarm.h"
+#include "pipeline/plugin/interface/FileFlusher.h"
 #include "pipeline/plugin/interface/HttpFlusher.h"
 #include "pipeline/queue/QueueKeyManager.h"
 #include "pipeline/queue/SenderQueueItem.h"
 #include "pipeline/queue/SenderQueueManager.h"
 #include "plugin/flusher/sls/DiskBufferWriter.h"
+#include "runner/sink/file/FileSink.h"
 #include "runner/sink/http/HttpSink.h"
 // TODO: temporarily used here
 #include "plugin/flusher/sls/PackIdManager.h"
@@ -41,6 +45,12 @@ static const int SEND_BLOCK_COST_TIME_ALARM_INTERVAL_SECOND = 3;
 
 namespace logtail {
 
+static bool IsAllToFileSink(const vector<SenderQueueItem*>& items) {
+    return all_of(items.begin(), items.end(), [](SenderQueueItem* item) {
+        return item->mFlusher->GetSinkType() == SinkType::FILE;
+    });
+}
+
 bool FlusherRunner::Init() {
     srand(time(nullptr));
     WriteMetrics::GetInstance()->PrepareMetricsRecordRef(mMetricsRecordRef,
@@ -147,6 +157,13 @@ void FlusherRunner::PushToHttpSink(SenderQueueItem* item, bool withLimit) {
     ++mHttpSendingCnt;
 }
 
+void FlusherRunner::PushToFileSink(SenderQueueItem* item) {
+    auto req = static_cast<FileFlusher*>(item->mFlusher)->BuildRequest(item);
+    item->mLastSendTime = time(nullptr);
+    req->mEnqueTime = item->mLastSendTime;
+    FileSink::GetInstance()->AddRequest(std::move(req));
+}
+
 void FlusherRunner::Run() {
     LOG_INFO(sLogger, ("flusher runner", "started"));
     while (true) {
@@ -168,7 +185,7 @@ void FlusherRunner::Run() {
 
             // smoothing send tps, walk around webserver load burst
             uint32_t bufferPackageCount = items.size();
-            if (!Application::GetInstance()->IsExiting() && mSendRandomSleep) {
+            if (!Application::GetInstance()->IsExiting() && mSendRandomSleep && !IsAllToFileSink(items)) {
                 int64_t sleepMicroseconds = 0;
                 if (bufferPackageCount < 20)
                     sleepMicroseconds = (rand() % 30) * 10000; // 0ms ~ 300ms
@@ -188,7 +205,9 @@ void FlusherRunner::Run() {
                        *itr)("config-flusher-dst", QueueKeyManager::GetInstance()->GetName((*itr)->mQueueKey))(
                           "wait time", ToString(waitTime.count()) + "ms")("try cnt", ToString((*itr)->mTryCnt)));
 
-            if (!Application::GetInstance()->IsExiting() && mSendFlowControl) {
+            // local files are not limited by the network bandwidth
+            if (!Application::GetInstance()->IsExiting() && mSendFlowControl
+                && (*itr)->mFlusher->GetSinkType() != SinkType::FILE) {
                 RateLimiter::FlowControl((*itr)->mRawSize, mSendLastTime, mSendLastByte, true);
             }
 
@@ -217,6 +236,9 @@ void FlusherRunner::Dispatch(SenderQueueItem* item) {
         case SinkType::HTTP:
             PushToHttpSink(item);
             break;
+        case SinkType::FILE:
+            PushToFileSink(item);
+            break;
         default:
             SenderQueueManager::GetInstance()->RemoveItem(item->mFlusher->GetQueueKey(), item);
             break;
@@ -19,9 +19,11 @@
 #include "app_config/AppConfig.h"
 #include "batch/TimeoutFlushManager.h"
 #include "common/Flags.h"
+#include "go_pipeline/FlatLogGroup.h"
 #include "go_pipeline/LogtailPlugin.h"
 #include "monitor/LogFileProfiler.h"
 #include "monitor/LogtailAlarm.h"
+#include "monitor/ResourceGovernor.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "pipeline/PipelineManager.h"
 #include "queue/ExactlyOnceQueueManager.h"
@@ -39,6 +41,9 @@ using namespace std;
 DEFINE_FLAG_BOOL(enable_chinese_tag_path, "Enable Chinese __tag__.__path__", true);
 #endif
 DEFINE_FLAG_INT32(default_flush_merged_buffer_interval, "default flush merged buffer, seconds", 1);
+DEFINE_FLAG_BOOL(enable_go_flat_log_group,
+                 "hand log groups over to go pipeline in flat format if supported by the plugin base",
+                 true);
 
 namespace logtail {
 
@@ -109,6 +114,11 @@ void ProcessorRunner::Run(uint32_t threadNo) {
 
         {
             sLastRunTime->Set(curTime);
+            if (!mIsFlush && !ResourceGovernor::GetInstance()->IsProcessThreadActive(threadNo, mThreadCount)) {
+                // do not wait on process queue manager, otherwise the notification may be taken by an idle thread
+                this_thread::sleep_for(chrono::milliseconds(100));
+                continue;
+            }
             unique_ptr<ProcessQueueItem> item;
             string configName;
             if (!ProcessQueueManager::GetInstance()->PopItem(threadNo, item, configName)) {
@@ -164,13 +174,14 @@ void ProcessorRunner::Run(uint32_t threadNo) {
 
             if (pipeline->IsFlushingThroughGoPipeline()) {
                 if (isLog) {
+                    bool useFlat
+                        = BOOL_FLAG(enable_go_flat_log_group) && LogtailPlugin::GetInstance()->IsFlatLogGroupSupported();
                     for (auto& group : eventGroupList) {
                         string res, errorMsg;
-                        if (!Serialize(group,
-                                       pipeline->GetContext().GetGlobalConfig().mEnableTimestampNanosecond,
-                                       pipeline->GetContext().GetLogstoreName(),
-                                       res,
-                                       errorMsg)) {
+                        bool enableNanosecond = pipeline->GetContext().GetGlobalConfig().mEnableTimestampNanosecond;
+                        const string& logstore = pipeline->GetContext().GetLogstoreName();
+                        if (!(useFlat ? FlatLogGroup::Serialize(group, enableNanosecond, logstore, res, errorMsg)
+                                      : Serialize(group, enableNanosecond, logstore, res, errorMsg))) {
                             LOG_WARNING(pipeline->GetContext().GetLogger(),
                                         ("failed to serialize event group",
                                          errorMsg)("action", "discard data")("config", configName));
@@ -183,10 +194,17 @@ void ProcessorRunner::Run(uint32_t threadNo) {
                                                                         pipeline->GetContext().GetRegion());
                             continue;
                         }
-                        LogtailPlugin::GetInstance()->ProcessLogGroup(
-                            pipeline->GetContext().GetConfigName(),
-                            res,
-                            group.GetMetadata(EventGroupMetaKey::SOURCE_ID).to_string());
+                        if (useFlat) {
+                            LogtailPlugin::GetInstance()->ProcessFlatLogGroup(
+                                pipeline->GetContext().GetConfigName(),
+                                res,
+                                group.GetMetadata(EventGroupMetaKey::SOURCE_ID).to_string());
+                        } else {
+                            LogtailPlugin::GetInstance()->ProcessLogGroup(
+                                pipeline->GetContext().GetConfigName(),
+                                res,
+                                group.GetMetadata(EventGroupMetaKey::SOURCE_ID).to_string());
+                        }
                     }
                 }
             } else {
@@ -64,6 +64,11 @@ private:
     thread_local static CounterPtr sInEventsCnt;
     thread_local static CounterPtr sInGroupDataSizeBytes;
     thread_local static IntGaugePtr sLastRunTime;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlatLogGroupUnittest;
+    friend class FlatLogGroupBenchmark;
+#endif
 };
 
 } // namespace logtail
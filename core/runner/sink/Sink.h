@@ -18,23 +18,34 @@
 
 #include <memory>
 
-#include "common/SafeQueue.h"
+#include "common/RingQueue.h"
 
 namespace logtail {
 
+// Requests are handed from the flusher runner to the sink thread through a bounded lock-free queue. The number of
+// requests in flight is already bounded by sender queues, so the queue is rarely full, in which case the flusher
+// runner waits for the sink.
 template <class T>
 class Sink {
 public:
+    Sink() : mQueue(sQueueCapacity, sQueueSpinCnt) {}
+    virtual ~Sink() = default;
+
     virtual bool Init() = 0;
     virtual void Stop() = 0;
-    
+
     bool AddRequest(std::unique_ptr<T>&& request) {
-        mQueue.Push(std::move(request));
+        // request is left untouched if not pushed
+        while (!mQueue.Push(std::move(request), 1000)) {
+        }
         return true;
     }
 
 protected:
-    SafeQueue<std::unique_ptr<T>> mQueue;
+    static constexpr size_t sQueueCapacity = 4096;
+    static constexpr uint32_t sQueueSpinCnt = 64;
+
+    RingQueue<std::unique_ptr<T>> mQueue;
 };
 
 } // namespace logtail
@@ -0,0 +1,180 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runner/sink/file/FileSink.h"
+
+#include <chrono>
+#include <thread>
+
+#include "common/FileSystemUtil.h"
+#include "common/StringTools.h"
+#include "logger/Logger.h"
+#include "monitor/metric_constants/MetricConstants.h"
+#include "pipeline/plugin/interface/FileFlusher.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "pipeline/queue/SenderQueueItem.h"
+
+using namespace std;
+
+namespace logtail {
+
+// disk failures seldom go away within milliseconds, so failed items are not written again until then
+static const int64_t kRetryIntervalMs = 1000;
+
+bool FileSink::Init() {
+    WriteMetrics::GetInstance()->PrepareMetricsRecordRef(
+        mMetricsRecordRef, {{METRIC_LABEL_KEY_RUNNER_NAME, METRIC_LABEL_VALUE_RUNNER_NAME_FILE_SINK}});
+    mInItemsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_IN_ITEMS_TOTAL);
+    mInItemDataSizeBytes = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_IN_SIZE_BYTES);
+    mLastRunTime = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_LAST_RUN_TIME);
+    mOutSuccessfulItemsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_SINK_OUT_SUCCESSFUL_ITEMS_TOTAL);
+    mOutFailedItemsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_SINK_OUT_FAILED_ITEMS_TOTAL);
+
+    mIsFlush = false;
+    mThreadRes = async(launch::async, &FileSink::Run, this);
+    return true;
+}
+
+void FileSink::Stop() {
+    mIsFlush = true;
+    future_status s = mThreadRes.wait_for(chrono::seconds(3));
+    if (s == future_status::ready) {
+        LOG_INFO(sLogger, ("file sink", "stopped successfully"));
+    } else {
+        LOG_WARNING(sLogger, ("file sink", "forced to stopped"));
+    }
+}
+
+shared_ptr<RecordFileWriter>
+FileSink::GetWriter(const string& dir, const string& prefix, uint64_t maxFileSize, uint32_t rotateIntervalSecs) {
+    string path = PathJoin(dir, prefix);
+    string key = path + "#" + ToString(maxFileSize) + "#" + ToString(rotateIntervalSecs);
+    lock_guard<mutex> lock(mWritersMux);
+    auto& writer = mWriters[key];
+    auto res = writer.lock();
+    if (res) {
+        return res;
+    }
+    if (mRecoveredPrefixes.insert(path).second) {
+        size_t cnt = RecoverRecordFiles(dir, prefix);
+        if (cnt > 0) {
+            LOG_INFO(sLogger, ("unsealed record files recovered", cnt)("dir", dir)("prefix", prefix));
+        }
+    }
+    res = make_shared<RecordFileWriter>(dir, prefix, maxFileSize, rotateIntervalSecs);
+    writer = res;
+    return res;
+}
+
+void FileSink::Run() {
+    LOG_INFO(sLogger, ("file sink", "started"));
+    time_t lastSealTime = 0;
+    while (true) {
+        time_t now = time(nullptr);
+        mLastRunTime->Set(now);
+        vector<unique_ptr<FileSinkRequest>> requests;
+        if (mQueue.WaitAndPopBatch(requests, sQueueCapacity, 500) > 0) {
+            if (!WriteRequests(requests)) {
+                this_thread::sleep_for(chrono::milliseconds(kRetryIntervalMs));
+            }
+        } else if (mIsFlush && mQueue.Empty()) {
+            break;
+        }
+        // files of idle writers should also be sealed on time
+        if (now != lastSealTime) {
+            for (auto& writer : GetAliveWriters()) {
+                string errorMsg;
+                if (!writer->SealIfExpired(now, errorMsg)) {
+                    LOG_WARNING(sLogger, ("failed to seal expired record file", errorMsg));
+                }
+            }
+            lastSealTime = now;
+        }
+    }
+    for (auto& writer : GetAliveWriters()) {
+        string errorMsg;
+        if (!writer->Seal(errorMsg)) {
+            LOG_WARNING(sLogger, ("failed to seal record file", errorMsg));
+        }
+    }
+}
+
+bool FileSink::WriteRequests(vector<unique_ptr<FileSinkRequest>>& requests) {
+    mInItemsTotal->Add(requests.size());
+    // error of each writer, where empty means success. Once a writer fails, all data appended to it but not synced yet
+    // is dropped by the writer, so the following requests to it are not tried to keep the order of records.
+    unordered_map<RecordFileWriter*, string> errors;
+    // number of the record of each request in its writer, where 0 means not appended
+    vector<uint64_t> recordNos(requests.size(), 0);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        auto& request = requests[i];
+        auto& errorMsg = errors[request->mWriter.get()];
+        if (!errorMsg.empty()) {
+            continue;
+        }
+        mInItemDataSizeBytes->Add(request->mItem->mData.size());
+        LOG_DEBUG(sLogger,
+                  ("got item from flusher runner, item address", request->mItem)(
+                      "config-flusher-dst", QueueKeyManager::GetInstance()->GetName(request->mItem->mQueueKey))(
+                      "wait time", ToString(time(nullptr) - request->mEnqueTime)));
+        if (request->mWriter->Append(request->mItem->mData,
+                                     request->mCompressType,
+                                     request->mDataType,
+                                     static_cast<uint32_t>(request->mItem->mRawSize),
+                                     errorMsg)) {
+            recordNos[i] = request->mWriter->GetAppendedRecordCnt();
+        }
+    }
+    for (auto& error : errors) {
+        // a failed writer is synced as well, since a record may be rejected without dropping the previous ones
+        string syncErrorMsg;
+        if (!error.first->Sync(syncErrorMsg) && error.second.empty()) {
+            error.second = syncErrorMsg;
+        }
+    }
+
+    bool allSucceeded = true;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        auto& request = requests[i];
+        // records synced by a rotation before the writer failed are durable and must not be written again
+        bool succeeded = recordNos[i] > 0 && recordNos[i] <= request->mWriter->GetSyncedRecordCnt();
+        const string& errorMsg = succeeded ? string() : errors[request->mWriter.get()];
+        if (succeeded) {
+            mOutSuccessfulItemsTotal->Add(1);
+        } else {
+            mOutFailedItemsTotal->Add(1);
+            allSucceeded = false;
+        }
+        // the item may be destructed after this
+        static_cast<FileFlusher*>(request->mItem->mFlusher)->OnWriteDone(succeeded, errorMsg, request->mItem);
+    }
+    return allSucceeded;
+}
+
+vector<shared_ptr<RecordFileWriter>> FileSink::GetAliveWriters() {
+    vector<shared_ptr<RecordFileWriter>> res;
+    lock_guard<mutex> lock(mWritersMux);
+    for (auto it = mWriters.begin(); it != mWriters.end();) {
+        auto writer = it->second.lock();
+        if (writer) {
+            res.emplace_back(std::move(writer));
+            ++it;
+        } else {
+            it = mWriters.erase(it);
+        }
+    }
+    return res;
+}
+
+} // namespace logtail
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "monitor/LogtailMetric.h"
+#include "runner/sink/Sink.h"
+#include "runner/sink/file/FileSinkRequest.h"
+#include "runner/sink/file/RecordFile.h"
+
+namespace logtail {
+
+// Writes the data of file flushers on a dedicated thread. All requests available at a time are appended before the
+// files involved are synced, so that a single sync is paid for many requests. Items are released from the sender queue
+// only after their data is synced.
+class FileSink : public Sink<FileSinkRequest> {
+public:
+    FileSink(const FileSink&) = delete;
+    FileSink& operator=(const FileSink&) = delete;
+
+    static FileSink* GetInstance() {
+        static FileSink instance;
+        return &instance;
+    }
+
+    bool Init() override;
+    void Stop() override;
+
+    // Flushers writing to the same files with the same options share one writer. Files left unsealed by a previous run
+    // are recovered the first time a prefix is used.
+    std::shared_ptr<RecordFileWriter>
+    GetWriter(const std::string& dir, const std::string& prefix, uint64_t maxFileSize, uint32_t rotateIntervalSecs);
+
+private:
+    FileSink() = default;
+    ~FileSink() = default;
+
+    void Run();
+    bool WriteRequests(std::vector<std::unique_ptr<FileSinkRequest>>& requests);
+    std::vector<std::shared_ptr<RecordFileWriter>> GetAliveWriters();
+
+    std::future<void> mThreadRes;
+    std::atomic_bool mIsFlush = false;
+
+    std::mutex mWritersMux;
+    std::unordered_map<std::string, std::weak_ptr<RecordFileWriter>> mWriters;
+    std::unordered_set<std::string> mRecoveredPrefixes;
+
+    mutable MetricsRecordRef mMetricsRecordRef;
+    CounterPtr mInItemsTotal;
+    CounterPtr mInItemDataSizeBytes;
+    CounterPtr mOutSuccessfulItemsTotal;
+    CounterPtr mOutFailedItemsTotal;
+    IntGaugePtr mLastRunTime;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherFileUnittest;
+    friend class FlusherRunnerUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <memory>
+
+#include "common/compression/CompressType.h"
+#include "pipeline/queue/SenderQueueItem.h"
+#include "runner/sink/file/RecordFile.h"
+
+namespace logtail {
+
+struct FileSinkRequest {
+    SenderQueueItem* mItem = nullptr;
+    std::shared_ptr<RecordFileWriter> mWriter;
+    CompressType mCompressType = CompressType::NONE;
+    RecordDataType mDataType = RecordDataType::UNKNOWN;
+    time_t mEnqueTime = 0;
+
+    FileSinkRequest(SenderQueueItem* item,
+                    const std::shared_ptr<RecordFileWriter>& writer,
+                    CompressType compressType,
+                    RecordDataType dataType)
+        : mItem(item), mWriter(writer), mCompressType(compressType), mDataType(dataType) {}
+};
+
+} // namespace logtail
@@ -0,0 +1,480 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runner/sink/file/RecordFile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#if defined(_MSC_VER)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#ifdef __ANDROID__
+#include <zlib.h>
+#else
+#include <zlib/zlib.h>
+#endif
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "common/ErrorUtil.h"
+#include "common/FileSystemUtil.h"
+#include "common/StringTools.h"
+#include "common/TimeUtil.h"
+#include "logger/Logger.h"
+
+using namespace std;
+
+namespace logtail {
+
+const size_t RecordFileWriter::kWriteBlockSize = 1024 * 1024;
+
+static const char kRecordMagic[4] = {'L', 'R', 'E', 'C'};
+static const uint8_t kRecordVersion = 1;
+static const size_t kRecordHeaderSize = 24;
+static const string kRecordFileSuffix = ".rec";
+static const string kWritingSuffix = ".writing";
+
+static bool EncodeCompressType(CompressType type, uint8_t& code) {
+    switch (type) {
+        case CompressType::NONE:
+            code = 0;
+            return true;
+        case CompressType::LZ4:
+            code = 1;
+            return true;
+        case CompressType::ZSTD:
+            code = 2;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool DecodeCompressType(uint8_t code, CompressType& type) {
+    switch (code) {
+        case 0:
+            type = CompressType::NONE;
+            return true;
+        case 1:
+            type = CompressType::LZ4;
+            return true;
+        case 2:
+            type = CompressType::ZSTD;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsValidDataType(uint8_t code) {
+    return code <= static_cast<uint8_t>(RecordDataType::OTLP_TRACES);
+}
+
+static void PutUint32(char* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+}
+
+static uint32_t GetUint32(const char* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) {
+        v |= static_cast<uint32_t>(static_cast<uint8_t>(p[i])) << (8 * i);
+    }
+    return v;
+}
+
+static uint32_t Crc32(const char* data, size_t size) {
+    return static_cast<uint32_t>(
+        crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size)));
+}
+
+// wrappers of the few file APIs that differ between platforms
+#if defined(_MSC_VER)
+static int OpenNewFd(const string& path) {
+    return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+}
+static int OpenExistingFd(const string& path) {
+    return _open(path.c_str(), _O_WRONLY | _O_BINARY);
+}
+static int64_t WriteFd(int fd, const char* data, size_t size) {
+    return _write(fd, data, static_cast<unsigned int>(size));
+}
+static bool SyncFd(int fd) {
+    return _commit(fd) == 0;
+}
+static bool TruncateFd(int fd, uint64_t size) {
+    return _chsize_s(fd, size) == 0 && _lseeki64(fd, size, SEEK_SET) >= 0;
+}
+static void CloseFd(int fd) {
+    _close(fd);
+}
+static void SyncDir(const string& dir) {
+}
+#else
+static int OpenNewFd(const string& path) {
+    return open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+}
+static int OpenExistingFd(const string& path) {
+    return open(path.c_str(), O_WRONLY | O_CLOEXEC);
+}
+static int64_t WriteFd(int fd, const char* data, size_t size) {
+    return write(fd, data, size);
+}
+static bool SyncFd(int fd) {
+#if defined(__linux__)
+    return fdatasync(fd) == 0;
+#else
+    return fsync(fd) == 0;
+#endif
+}
+static bool TruncateFd(int fd, uint64_t size) {
+    return ftruncate(fd, size) == 0 && lseek(fd, size, SEEK_SET) >= 0;
+}
+static void CloseFd(int fd) {
+    close(fd);
+}
+// makes renames and creations in the directory durable
+static void SyncDir(const string& dir) {
+    int fd = open(dir.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+}
+#endif
+
+RecordFileWriter::RecordFileWriter(const string& dir,
+                                   const string& prefix,
+                                   uint64_t maxFileSize,
+                                   uint32_t rotateIntervalSecs)
+    : mDir(dir), mPrefix(prefix), mMaxFileSize(maxFileSize), mRotateIntervalSecs(rotateIntervalSecs) {
+}
+
+RecordFileWriter::~RecordFileWriter() {
+    string errorMsg;
+    if (!Seal(errorMsg)) {
+        LOG_WARNING(sLogger, ("failed to seal record file", errorMsg)("dir", mDir)("prefix", mPrefix));
+    }
+}
+
+bool RecordFileWriter::Append(
+    StringView payload, CompressType compressType, RecordDataType dataType, uint32_t rawSize, string& errorMsg) {
+    uint8_t compressCode = 0;
+    if (!EncodeCompressType(compressType, compressCode)) {
+        errorMsg = "unsupported compress type";
+        return false;
+    }
+    if (payload.size() > UINT32_MAX) {
+        errorMsg = "record too large";
+        return false;
+    }
+
+    uint64_t recordSize = kRecordHeaderSize + payload.size();
+    if (mFd >= 0) {
+        uint64_t fileSize = mWrittenSize + mBuffer.size();
+        bool full = fileSize > 0 && fileSize + recordSize > mMaxFileSize;
+        if (full || IsExpired(time(nullptr))) {
+            if (!Seal(errorMsg)) {
+                return false;
+            }
+        }
+    }
+    if (mFd < 0 && !OpenNewFile(errorMsg)) {
+        return false;
+    }
+
+    char header[kRecordHeaderSize];
+    memcpy(header, kRecordMagic, sizeof(kRecordMagic));
+    header[4] = static_cast<char>(kRecordVersion);
+    header[5] = static_cast<char>(compressCode);
+    header[6] = static_cast<char>(dataType);
+    header[7] = '\0';
+    PutUint32(header + 8, static_cast<uint32_t>(payload.size()));
+    PutUint32(header + 12, rawSize);
+    PutUint32(header + 16, Crc32(payload.data(), payload.size()));
+    PutUint32(header + 20, Crc32(header, 20));
+    mBuffer.append(header, kRecordHeaderSize);
+    mBuffer.append(payload.data(), payload.size());
+    ++mAppendedRecordCnt;
+
+    if (mBuffer.size() >= kWriteBlockSize && !WriteBuffer(false, errorMsg)) {
+        Rollback();
+        return false;
+    }
+    return true;
+}
+
+bool RecordFileWriter::Sync(string& errorMsg) {
+    if (mFd < 0) {
+        return true;
+    }
+    if (!WriteBuffer(true, errorMsg)) {
+        Rollback();
+        return false;
+    }
+    if (mSyncedSize != mWrittenSize) {
+        if (!SyncFd(mFd)) {
+            errorMsg = "failed to sync file " + mFilePath + ": " + ErrnoToString(GetErrno());
+            Rollback();
+            return false;
+        }
+        mSyncedSize = mWrittenSize;
+    }
+    mSyncedRecordCnt = mAppendedRecordCnt;
+    return true;
+}
+
+bool RecordFileWriter::Seal(string& errorMsg) {
+    if (mFd < 0) {
+        return true;
+    }
+    if (!Sync(errorMsg)) {
+        return false;
+    }
+    CloseFile();
+    return true;
+}
+
+bool RecordFileWriter::SealIfExpired(time_t now, string& errorMsg) {
+    if (mFd < 0 || !IsExpired(now)) {
+        return true;
+    }
+    return Seal(errorMsg);
+}
+
+bool RecordFileWriter::IsExpired(time_t now) const {
+    return mRotateIntervalSecs > 0 && now - mFileOpenTime >= static_cast<time_t>(mRotateIntervalSecs);
+}
+
+bool RecordFileWriter::OpenNewFile(string& errorMsg) {
+    if (!Mkdirs(mDir)) {
+        errorMsg = "failed to create dir " + mDir + ": " + ErrnoToString(GetErrno());
+        return false;
+    }
+    time_t now = time(nullptr);
+    string namePrefix = PathJoin(mDir, mPrefix) + "-" + GetTimeStamp(now) + "-";
+    // a file with the same name may be left by a previous run or by another writer with the same prefix
+    for (size_t i = 0; i < 1000; ++i) {
+        string path = namePrefix + ToString(mFileSeq++) + kRecordFileSuffix;
+        if (CheckExistance(path)) {
+            continue;
+        }
+        int fd = OpenNewFd(path + kWritingSuffix);
+        if (fd >= 0) {
+            mFd = fd;
+            mFilePath = path + kWritingSuffix;
+            mFileOpenTime = now;
+            mWrittenSize = 0;
+            mSyncedSize = 0;
+            SyncDir(mDir);
+            return true;
+        }
+        if (errno != EEXIST) {
+            errorMsg = "failed to open file " + path + kWritingSuffix + ": " + ErrnoToString(GetErrno());
+            return false;
+        }
+    }
+    errorMsg = "failed to find an unused file name with prefix " + namePrefix;
+    return false;
+}
+
+bool RecordFileWriter::WriteBuffer(bool all, string& errorMsg) {
+    size_t size = mBuffer.size();
+    if (!all) {
+        // only whole blocks are written, which keeps the file offset aligned to the block size so that both the page
+        // cache and the device see large aligned writes
+        uint64_t alignedEnd = (mWrittenSize + mBuffer.size()) / kWriteBlockSize * kWriteBlockSize;
+        if (alignedEnd <= mWrittenSize) {
+            return true;
+        }
+        size = alignedEnd - mWrittenSize;
+    }
+    size_t written = 0;
+    while (written < size) {
+        int64_t n = WriteFd(mFd, mBuffer.data() + written, size - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            errorMsg = "failed to write file " + mFilePath + ": " + ErrnoToString(GetErrno());
+            return false;
+        }
+        written += n;
+    }
+    mBuffer.erase(0, size);
+    mWrittenSize += size;
+    return true;
+}
+
+void RecordFileWriter::Rollback() {
+    // the data not synced yet will be written again by the caller. The current file is abandoned no matter whether its
+    // unsynced tail can be removed, since the state of a file after a failed sync is undefined on some platforms, and
+    // readers stop at a torn tail anyway.
+    mBuffer.clear();
+    mAppendedRecordCnt = mSyncedRecordCnt;
+    if (mFd < 0) {
+        return;
+    }
+    if (mWrittenSize != mSyncedSize && !TruncateFd(mFd, mSyncedSize)) {
+        LOG_WARNING(sLogger,
+                    ("failed to truncate record file", ErrnoToString(GetErrno()))("action", "leave the tail as is")(
+                        "file", mFilePath));
+    }
+    mWrittenSize = mSyncedSize;
+    CloseFile();
+}
+
+void RecordFileWriter::CloseFile() {
+    CloseFd(mFd);
+    mFd = -1;
+    string path = mFilePath.substr(0, mFilePath.size() - kWritingSuffix.size());
+    if (rename(mFilePath.c_str(), path.c_str()) != 0) {
+        LOG_WARNING(sLogger,
+                    ("failed to seal record file", ErrnoToString(GetErrno()))("action", "leave it unsealed")(
+                        "file", mFilePath));
+    } else {
+        SyncDir(mDir);
+    }
+    mFilePath.clear();
+}
+
+static bool ScanRecords(FILE* f, vector<Record>* records, uint64_t& validSize) {
+    validSize = 0;
+    char header[kRecordHeaderSize];
+    string payload;
+    while (true) {
+        if (fread(header, 1, kRecordHeaderSize, f) != kRecordHeaderSize) {
+            break;
+        }
+        CompressType type = CompressType::NONE;
+        if (memcmp(header, kRecordMagic, sizeof(kRecordMagic)) != 0
+            || static_cast<uint8_t>(header[4]) != kRecordVersion
+            || !DecodeCompressType(static_cast<uint8_t>(header[5]), type)
+            || !IsValidDataType(static_cast<uint8_t>(header[6]))
+            || GetUint32(header + 20) != Crc32(header, 20)) {
+            break;
+        }
+        payload.resize(GetUint32(header + 8));
+        if (fread(&payload[0], 1, payload.size(), f) != payload.size()
+            || GetUint32(header + 16) != Crc32(payload.data(), payload.size())) {
+            break;
+        }
+        validSize += kRecordHeaderSize + payload.size();
+        if (records) {
+            records->emplace_back();
+            records->back().mCompressType = type;
+            records->back().mDataType = static_cast<RecordDataType>(static_cast<uint8_t>(header[6]));
+            records->back().mRawSize = GetUint32(header + 12);
+            records->back().mData.swap(payload);
+        }
+    }
+    return !ferror(f);
+}
+
+bool ReadRecordFile(const string& path, vector<Record>& records, uint64_t& validSize, string& errorMsg) {
+    FILE* f = FileReadOnlyOpen(path.c_str(), "rb");
+    if (f == nullptr) {
+        errorMsg = "failed to open file " + path + ": " + ErrnoToString(GetErrno());
+        return false;
+    }
+    bool res = ScanRecords(f, &records, validSize);
+    if (!res) {
+        errorMsg = "failed to read file " + path;
+    }
+    fclose(f);
+    return res;
+}
+
+// matches <prefix>-<timestamp>-<seq>.rec.writing
+static bool IsUnsealedRecordFile(const string& name, const string& prefix) {
+    string suffix = kRecordFileSuffix + kWritingSuffix;
+    if (name.size() <= prefix.size() + 1 + suffix.size() || !StartWith(name, prefix + "-") || !EndWith(name, suffix)) {
+        return false;
+    }
+    string middle = name.substr(prefix.size() + 1, name.size() - prefix.size() - 1 - suffix.size());
+    size_t pos = middle.find('-');
+    if (pos != 14 || pos + 1 == middle.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < middle.size(); ++i) {
+        if (i != pos && !isdigit(static_cast<unsigned char>(middle[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t RecoverRecordFiles(const string& dir, const string& prefix) {
+    fsutil::Dir d(dir);
+    if (!d.Open()) {
+        return 0;
+    }
+    vector<string> names;
+    fsutil::Entry entry;
+    while ((entry = d.ReadNext(false))) {
+        if (entry.IsRegFile() && IsUnsealedRecordFile(entry.Name(), prefix)) {
+            names.emplace_back(entry.Name());
+        }
+    }
+    d.Close();
+
+    size_t cnt = 0;
+    for (const auto& name : names) {
+        string path = PathJoin(dir, name);
+        uint64_t validSize = 0;
+        FILE* f = FileReadOnlyOpen(path.c_str(), "rb");
+        if (f == nullptr) {
+            continue;
+        }
+        bool res = ScanRecords(f, nullptr, validSize);
+        fclose(f);
+        if (!res) {
+            LOG_WARNING(sLogger, ("failed to recover record file", "read failed")("file", path));
+            continue;
+        }
+        if (validSize == 0) {
+            remove(path.c_str());
+            continue;
+        }
+        int fd = OpenExistingFd(path);
+        bool truncated = fd >= 0 && TruncateFd(fd, validSize) && SyncFd(fd);
+        if (fd >= 0) {
+            CloseFd(fd);
+        }
+        if (!truncated) {
+            LOG_WARNING(sLogger,
+                        ("failed to recover record file", ErrnoToString(GetErrno()))("action", "leave the tail as is")(
+                            "file", path));
+        }
+        string sealedPath = path.substr(0, path.size() - kWritingSuffix.size());
+        if (rename(path.c_str(), sealedPath.c_str()) != 0) {
+            LOG_WARNING(sLogger, ("failed to seal record file", ErrnoToString(GetErrno()))("file", path));
+            continue;
+        }
+        LOG_INFO(sLogger, ("record file recovered", sealedPath)("valid size", validSize));
+        ++cnt;
+    }
+    if (cnt > 0) {
+        SyncDir(dir);
+    }
+    return cnt;
+}
+
+} // namespace logtail
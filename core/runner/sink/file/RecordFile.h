@@ -0,0 +1,124 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "common/compression/CompressType.h"
+#include "models/StringView.h"
+
+namespace logtail {
+
+// A record file is a sequence of records, each of which is a header followed by the payload. All integers in the
+// header are little-endian:
+//
+//   magic "LREC" (4) | version (1) | compress type (1) | data type (1) | reserved (1) | payload size (4) |
+//   raw size (4) | payload crc32 (4) | header crc32 (4)
+//
+// The header crc covers the preceding 20 bytes, so that a torn or corrupted size never makes a reader skip over valid
+// records. A file being written has the suffix ".writing", which is dropped once the file is sealed.
+
+// what the uncompressed payload is, so that a reader can decode the records of a file without knowing its writer
+enum class RecordDataType : uint8_t {
+    UNKNOWN = 0,
+    SLS_LOG_GROUP = 1,
+    OTLP_LOGS = 2,
+    OTLP_METRICS = 3,
+    OTLP_TRACES = 4,
+};
+
+struct Record {
+    CompressType mCompressType = CompressType::NONE;
+    RecordDataType mDataType = RecordDataType::UNKNOWN;
+    uint32_t mRawSize = 0;
+    std::string mData;
+};
+
+// Appends records to files under a directory, starting a new file when the current one would exceed the size limit or
+// is older than the rotation interval, if any. Data is buffered and written in whole blocks, so it is durable only
+// after Sync. Not thread-safe.
+class RecordFileWriter {
+public:
+    static const size_t kWriteBlockSize;
+
+    RecordFileWriter(const std::string& dir,
+                     const std::string& prefix,
+                     uint64_t maxFileSize,
+                     uint32_t rotateIntervalSecs);
+    ~RecordFileWriter();
+    RecordFileWriter(const RecordFileWriter&) = delete;
+    RecordFileWriter& operator=(const RecordFileWriter&) = delete;
+
+    // On failure, all records appended since the last successful Sync are dropped.
+    bool Append(StringView payload,
+                CompressType compressType,
+                RecordDataType dataType,
+                uint32_t rawSize,
+                std::string& errorMsg);
+    bool Sync(std::string& errorMsg);
+    // Syncs and seals the current file. The next Append opens a new one.
+    bool Seal(std::string& errorMsg);
+    bool SealIfExpired(time_t now, std::string& errorMsg);
+
+    bool HasOpenFile() const { return mFd >= 0; }
+    // Records are numbered from 1 in the order they are appended. All records up to GetSyncedRecordCnt() are durable,
+    // including those synced by a rotation inside Append, while the rest are dropped if a later write fails.
+    uint64_t GetAppendedRecordCnt() const { return mAppendedRecordCnt; }
+    uint64_t GetSyncedRecordCnt() const { return mSyncedRecordCnt; }
+    const std::string& GetFilePath() const { return mFilePath; }
+
+private:
+    bool IsExpired(time_t now) const;
+    bool OpenNewFile(std::string& errorMsg);
+    bool WriteBuffer(bool all, std::string& errorMsg);
+    void Rollback();
+    void CloseFile();
+
+    std::string mDir;
+    std::string mPrefix;
+    uint64_t mMaxFileSize = 0;
+    uint32_t mRotateIntervalSecs = 0;
+
+    int mFd = -1;
+    std::string mFilePath;
+    time_t mFileOpenTime = 0;
+    uint32_t mFileSeq = 0;
+    // bytes in the file, excluding those still in mBuffer
+    uint64_t mWrittenSize = 0;
+    uint64_t mSyncedSize = 0;
+    std::string mBuffer;
+    uint64_t mAppendedRecordCnt = 0;
+    uint64_t mSyncedRecordCnt = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class RecordFileUnittest;
+#endif
+};
+
+// Reads records from the beginning of the file until the first incomplete or corrupted one, which is what a crash in
+// the middle of a write leaves behind. validSize is set to the size of the intact prefix. Returns false only if the
+// file cannot be read.
+bool ReadRecordFile(const std::string& path, std::vector<Record>& records, uint64_t& validSize, std::string& errorMsg);
+
+// Seals the files with the given prefix left unsealed by a previous run, after truncating their torn tails. Returns the
+// number of files sealed.
+size_t RecoverRecordFiles(const std::string& dir, const std::string& prefix);
+
+} // namespace logtail
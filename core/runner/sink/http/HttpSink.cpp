@@ -15,6 +15,7 @@
 #include "runner/sink/http/HttpSink.h"
 
 #include "app_config/AppConfig.h"
+#include "common/Flags.h"
 #include "common/StringTools.h"
 #include "common/http/Curl.h"
 #include "logger/Logger.h"
@@ -22,8 +23,11 @@
 #include "pipeline/plugin/interface/HttpFlusher.h"
 #include "pipeline/queue/QueueKeyManager.h"
 #include "pipeline/queue/SenderQueueItem.h"
+#include "pipeline/queue/SenderQueueManager.h"
 #include "runner/FlusherRunner.h"
 
+DECLARE_FLAG_INT32(curl_max_host_connections);
+
 using namespace std;
 
 namespace logtail {
@@ -34,6 +38,7 @@ bool HttpSink::Init() {
         LOG_ERROR(sLogger, ("failed to init http sink", "failed to init curl multi client"));
         return false;
     }
+    curl_multi_setopt(mClient, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(INT32_FLAG(curl_max_host_connections)));
 
     WriteMetrics::GetInstance()->PrepareMetricsRecordRef(mMetricsRecordRef,
                                                          {{METRIC_LABEL_KEY_RUNNER_NAME, METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK}});
@@ -43,6 +48,8 @@ bool HttpSink::Init() {
     mOutFailedItemsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_SINK_OUT_FAILED_ITEMS_TOTAL);
     mSendingItemsTotal = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_SINK_SENDING_ITEMS_TOTAL);
     mSendConcurrency = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_SINK_SEND_CONCURRENCY);
+    mNewConnectionsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_SINK_NEW_CONNECTIONS_TOTAL);
+    mReusedConnectionsTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_SINK_REUSED_CONNECTIONS_TOTAL);
 
     // TODO: should be dynamic
     mSendConcurrency->Set(AppConfig::GetInstance()->GetSendRequestConcurrency());
@@ -89,6 +96,7 @@ void HttpSink::Run() {
     if (mc != CURLM_OK) {
         LOG_ERROR(sLogger, ("failed to cleanup curl multi handle", "exit anyway")("errMsg", curl_multi_strerror(mc)));
     }
+    mHandlerPool.Clear();
 }
 
 bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
@@ -105,9 +113,11 @@ bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
                                    headers,
                                    request->mTimeout,
                                    AppConfig::GetInstance()->IsHostIPReplacePolicyEnabled(),
-                                   AppConfig::GetInstance()->GetBindInterface());
+                                   AppConfig::GetInstance()->GetBindInterface(),
+                                   &mHandlerPool);
     if (curl == nullptr) {
         request->mItem->mStatus.Set(SendingStatus::IDLE);
+        SenderQueueManager::GetInstance()->MarkQueueReady(request->mItem->mQueueKey);
         FlusherRunner::GetInstance()->DecreaseHttpSendingCnt();
         mOutFailedItemsTotal->Add(1);
         LOG_ERROR(sLogger,
@@ -124,8 +134,9 @@ bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
     auto res = curl_multi_add_handle(mClient, curl);
     if (res != CURLM_OK) {
         request->mItem->mStatus.Set(SendingStatus::IDLE);
+        SenderQueueManager::GetInstance()->MarkQueueReady(request->mItem->mQueueKey);
         FlusherRunner::GetInstance()->DecreaseHttpSendingCnt();
-        curl_easy_cleanup(curl);
+        mHandlerPool.Release(request->mHTTPSFlag, request->mHost, request->mPort, curl, false);
         mOutFailedItemsTotal->Add(1);
         LOG_ERROR(sLogger,
                   ("failed to send request",
@@ -215,14 +226,18 @@ void HttpSink::HandleCompletedRequests() {
             CURL* handler = msg->easy_handle;
             HttpSinkRequest* request = nullptr;
             curl_easy_getinfo(handler, CURLINFO_PRIVATE, &request);
+            // the request may be gone after retry
+            bool httpsFlag = request->mHTTPSFlag;
+            string host = request->mHost;
+            int32_t port = request->mPort;
+            request->mResponse.mResponseTimeMs = static_cast<uint32_t>(
+                chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now() - request->mLastSendTime)
+                    .count());
             LOG_DEBUG(sLogger,
                       ("send http request completed, item address", request->mItem)(
                           "config-flusher-dst", QueueKeyManager::GetInstance()->GetName(request->mItem->mQueueKey))(
-                          "response time",
-                          ToString(chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now()
-                                                                               - request->mLastSendTime)
-                                       .count())
-                              + "ms")("try cnt", ToString(request->mTryCnt)));
+                          "response time", ToString(request->mResponse.mResponseTimeMs) + "ms")(
+                          "try cnt", ToString(request->mTryCnt)));
             switch (msg->data.result) {
                 case CURLE_OK: {
                     long statusCode = 0;
@@ -259,8 +274,13 @@ void HttpSink::HandleCompletedRequests() {
                     mSendingItemsTotal->Sub(1);
                     break;
             }
+            if (CurlHandlerPool::GetNewConnectionCnt(handler) > 0) {
+                mNewConnectionsTotal->Add(1);
+            } else {
+                mReusedConnectionsTotal->Add(1);
+            }
             curl_multi_remove_handle(mClient, handler);
-            curl_easy_cleanup(handler);
+            mHandlerPool.Release(httpsFlag, host, port, handler);
             if (!requestReused) {
                 if (request->mPrivateData) {
                     curl_slist_free_all((curl_slist*)request->mPrivateData);
@@ -23,6 +23,7 @@
 #include <future>
 #include <mutex>
 
+#include "common/http/CurlHandlerPool.h"
 #include "runner/sink/Sink.h"
 #include "runner/sink/http/HttpSinkRequest.h"
 #include "monitor/LogtailMetric.h"
@@ -52,6 +53,8 @@ private:
     void HandleCompletedRequests();
 
     CURLM* mClient = nullptr;
+    // only accessed by the running thread
+    CurlHandlerPool mHandlerPool;
 
     std::future<void> mThreadRes;
     std::atomic_bool mIsFlush = false;
@@ -63,6 +66,8 @@ private:
     // CounterPtr mTotalDelayMs; // TODO: should record distribution instead of average
     IntGaugePtr mSendingItemsTotal;
     IntGaugePtr mSendConcurrency;
+    CounterPtr mNewConnectionsTotal;
+    CounterPtr mReusedConnectionsTotal;
     IntGaugePtr mLastRunTime;
 
 #ifdef APSARA_UNIT_TEST_MAIN
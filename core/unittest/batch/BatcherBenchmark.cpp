@@ -0,0 +1,100 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+
+#include "pipeline/batch/Batcher.h"
+#include "unittest/Unittest.h"
+#include "unittest/plugin/PluginMock.h"
+
+using namespace std;
+
+namespace logtail {
+
+class BatcherBenchmark : public ::testing::Test {
+public:
+    void TestContendedAdd();
+
+protected:
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        mFlusher.SetContext(mCtx);
+        mFlusher.SetMetricsRecordRef(FlusherMock::sName, "1");
+        mFlusher.SetPluginID("1");
+    }
+
+    void TearDown() override { TimeoutFlushManager::GetInstance()->ClearRecords("test_config"); }
+
+private:
+    static const size_t sProducerCnt = 16;
+    static const size_t sTagSetCnt = 10000;
+    static const size_t sGroupsPerProducer = 20000;
+
+    FlusherMock mFlusher;
+    PipelineContext mCtx;
+};
+
+void BatcherBenchmark::TestContendedAdd() {
+    DefaultFlushStrategyOptions strategy;
+    strategy.mMaxCnt = 4000;
+    strategy.mMaxSizeBytes = 512 * 1024;
+    strategy.mTimeoutSecs = 3;
+
+    Batcher<> batch;
+    batch.Init(Json::Value(), &mFlusher, strategy);
+
+    // prepare all groups in advance so that only Add is measured, groups of one producer share the same source buffer
+    vector<vector<PipelineEventGroup>> groups(sProducerCnt);
+    for (size_t i = 0; i < sProducerCnt; ++i) {
+        auto sourceBuffer = make_shared<SourceBuffer>();
+        groups[i].reserve(sGroupsPerProducer);
+        for (size_t j = 0; j < sGroupsPerProducer; ++j) {
+            PipelineEventGroup group(sourceBuffer);
+            group.SetTag(string("container"), to_string((i * sGroupsPerProducer + j) % sTagSetCnt));
+            group.AddLogEvent();
+            groups[i].emplace_back(std::move(group));
+        }
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    vector<thread> producers;
+    for (size_t i = 0; i < sProducerCnt; ++i) {
+        producers.emplace_back([&batch, &groups, i]() {
+            vector<BatchedEventsList> res;
+            for (auto& group : groups[i]) {
+                batch.Add(std::move(group), res);
+                res.clear();
+            }
+        });
+    }
+    for (auto& p : producers) {
+        p.join();
+    }
+    auto end = chrono::high_resolution_clock::now();
+
+    vector<BatchedEventsList> res;
+    batch.FlushAll(res);
+
+    chrono::duration<double> elapsed = end - start;
+    cout << "producers: " << sProducerCnt << ", tag sets: " << sTagSetCnt
+         << ", groups: " << sProducerCnt * sGroupsPerProducer << ", elapsed: " << elapsed.count() << " seconds"
+         << endl;
+}
+
+UNIT_TEST_CASE(BatcherBenchmark, TestContendedAdd)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thread>
+
 #include "common/JsonUtil.h"
 #include "pipeline/batch/Batcher.h"
 #include "unittest/Unittest.h"
@@ -34,6 +36,7 @@ public:
     void TestFlushAllWithoutGroupBatch();
     void TestFlushAllWithGroupBatch();
     void TestMetric();
+    void TestConcurrentAdd();
 
 protected:
     static void SetUpTestCase() { sFlusher = make_unique<FlusherMock>(); }
@@ -45,7 +48,10 @@ protected:
         sFlusher->SetPluginID("1");
     }
 
-    void TearDown() override { TimeoutFlushManager::GetInstance()->mTimeoutRecords.clear(); }
+    void TearDown() override {
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords.clear();
+        TimeoutFlushManager::GetInstance()->mDeadlineBuckets.clear();
+    }
 
 private:
     PipelineEventGroup CreateEventGroup(size_t cnt);
@@ -151,12 +157,12 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     SourceBuffer* buffer1 = group1.GetSourceBuffer().get();
     RangeCheckpoint* eoo1 = group1.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group1), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(2U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(2U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(0U, res.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
-    TimeoutRecord& record = TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key));
+    TimeoutRecord& record = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key));
     time_t updateTime = record.mUpdateTime;
     APSARA_TEST_EQUAL(3U, record.mTimeoutSecs);
     APSARA_TEST_EQUAL(sFlusher.get(), record.mFlusher);
@@ -168,8 +174,8 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     SourceBuffer* buffer2 = group2.GetSourceBuffer().get();
     RangeCheckpoint* eoo2 = group2.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group2), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(3U, res[0][0].mEvents.size());
@@ -180,8 +186,9 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     APSARA_TEST_EQUAL(buffer2, res[0][0].mSourceBuffers[1].get());
     APSARA_TEST_EQUAL(eoo1, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 
     // flush by time then by size
     res.clear();
@@ -191,8 +198,8 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     SourceBuffer* buffer3 = group3.GetSourceBuffer().get();
     RangeCheckpoint* eoo3 = group3.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group3), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(2U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(1U, res[0][0].mEvents.size());
@@ -202,8 +209,9 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     APSARA_TEST_EQUAL(buffer2, res[0][0].mSourceBuffers[0].get());
     APSARA_TEST_EQUAL(eoo2, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
     APSARA_TEST_EQUAL(1U, res[1].size());
     APSARA_TEST_EQUAL(1U, res[1][0].mEvents.size());
     APSARA_TEST_EQUAL(1U, res[1][0].mTags.mInner.size());
@@ -212,8 +220,9 @@ void BatcherUnittest::TestAddWithoutGroupBatch() {
     APSARA_TEST_EQUAL(buffer3, res[1][0].mSourceBuffers[0].get());
     APSARA_TEST_EQUAL(eoo3, res[1][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[1][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 }
 
 void BatcherUnittest::TestAddWithGroupBatch() {
@@ -232,12 +241,12 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     SourceBuffer* buffer1 = group1.GetSourceBuffer().get();
     RangeCheckpoint* eoo1 = group1.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group1), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(2U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(2U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(0U, res.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
-    TimeoutRecord& record = TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key));
+    TimeoutRecord& record = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key));
     time_t updateTime = record.mUpdateTime;
     APSARA_TEST_EQUAL(2U, record.mTimeoutSecs);
     APSARA_TEST_EQUAL(sFlusher.get(), record.mFlusher);
@@ -249,8 +258,8 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     SourceBuffer* buffer2 = group2.GetSourceBuffer().get();
     RangeCheckpoint* eoo2 = group2.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group2), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(3U, res[0][0].mEvents.size());
@@ -261,8 +270,9 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     APSARA_TEST_EQUAL(buffer2, res[0][0].mSourceBuffers[1].get());
     APSARA_TEST_EQUAL(eoo1, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 
     // flush by time to group batch
     res.clear();
@@ -272,8 +282,8 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     RangeCheckpoint* eoo3 = group3.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group3), res);
     APSARA_TEST_EQUAL(0U, res.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueue(key).mBatch.mEvents.size());
 
     // flush by time to group batch, and then group flush by time
     batch.mGroupFlushStrategy->SetTimeoutSecs(0);
@@ -281,8 +291,8 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     SourceBuffer* buffer4 = group4.GetSourceBuffer().get();
     RangeCheckpoint* eoo4 = group4.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group4), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(1U, res[0][0].mEvents.size());
@@ -292,8 +302,9 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     APSARA_TEST_EQUAL(buffer2, res[0][0].mSourceBuffers[0].get());
     APSARA_TEST_EQUAL(eoo2, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 
     // flush by time to group batch, and then group flush by size
     res.clear();
@@ -303,8 +314,8 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     SourceBuffer* buffer5 = group5.GetSourceBuffer().get();
     RangeCheckpoint* eoo5 = group5.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group5), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(2U, res[0].size());
     APSARA_TEST_EQUAL(1U, res[0][0].mEvents.size());
@@ -314,8 +325,9 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     APSARA_TEST_EQUAL(buffer3, res[0][0].mSourceBuffers[0].get());
     APSARA_TEST_EQUAL(eoo3, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
     APSARA_TEST_EQUAL(1U, res[0][1].mEvents.size());
     APSARA_TEST_EQUAL(1U, res[0][1].mTags.mInner.size());
     APSARA_TEST_STREQ("val", res[0][1].mTags.mInner["key"].data());
@@ -323,8 +335,9 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     APSARA_TEST_EQUAL(buffer4, res[0][1].mSourceBuffers[0].get());
     APSARA_TEST_EQUAL(eoo4, res[0][1].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][1].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 
     // flush by size
     res.clear();
@@ -333,8 +346,8 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     PipelineEventGroup group6 = CreateEventGroup(1);
     SourceBuffer* buffer6 = group6.GetSourceBuffer().get();
     batch.Add(std::move(group6), res);
-    APSARA_TEST_EQUAL(1U, batch.mEventQueueMap.size());
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap[key].mBatch.mEvents.size());
+    APSARA_TEST_EQUAL(1U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueue(key).mBatch.mEvents.size());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(2U, res[0][0].mEvents.size());
@@ -345,8 +358,9 @@ void BatcherUnittest::TestAddWithGroupBatch() {
     APSARA_TEST_EQUAL(buffer6, res[0][0].mSourceBuffers[1].get());
     APSARA_TEST_EQUAL(eoo5, res[0][0].mExactlyOnceCheckpoint.get());
     APSARA_TEST_STREQ("pack_id", res[0][0].mPackIdPrefix.data());
-    APSARA_TEST_GT(TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key)).mUpdateTime,
-                   updateTime - 1);
+    APSARA_TEST_GT(
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, key))->mUpdateTime.load(),
+        updateTime - 1);
 }
 
 void BatcherUnittest::TestFlushEventQueueWithoutGroupBatch() {
@@ -372,7 +386,7 @@ void BatcherUnittest::TestFlushEventQueueWithoutGroupBatch() {
 
     // key existed
     batch.FlushQueue(key, res);
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(2U, res[0].mEvents.size());
     APSARA_TEST_EQUAL(1U, res[0].mTags.mInner.size());
@@ -401,11 +415,11 @@ void BatcherUnittest::TestFlushEventQueueWithGroupBatch() {
     RangeCheckpoint* eoo1 = group1.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group1), tmp);
     batch.FlushQueue(key, res);
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
     APSARA_TEST_EQUAL(0U, res.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
     APSARA_TEST_EQUAL(2U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
-    TimeoutRecord& record = TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 0));
+    TimeoutRecord& record = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 0));
     time_t updateTime = record.mUpdateTime;
     APSARA_TEST_EQUAL(1U, record.mTimeoutSecs);
     APSARA_TEST_EQUAL(sFlusher.get(), record.mFlusher);
@@ -421,7 +435,7 @@ void BatcherUnittest::TestFlushEventQueueWithGroupBatch() {
     RangeCheckpoint* eoo2 = group2.GetExactlyOnceCheckpoint().get();
     batch.Add(std::move(group2), tmp);
     batch.FlushQueue(key, res);
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
     APSARA_TEST_EQUAL(2U, res.size());
     APSARA_TEST_EQUAL(2U, res[0].mEvents.size());
     APSARA_TEST_EQUAL(1U, res[0].mTags.mInner.size());
@@ -495,7 +509,7 @@ void BatcherUnittest::TestFlushAllWithoutGroupBatch() {
 
     vector<BatchedEventsList> res;
     batch.FlushAll(res);
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
     APSARA_TEST_EQUAL(1U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(2U, res[0][0].mEvents.size());
@@ -540,7 +554,7 @@ void BatcherUnittest::TestFlushAllWithGroupBatch() {
     batch.mGroupFlushStrategy->SetMaxSizeBytes(10);
     vector<BatchedEventsList> res;
     batch.FlushAll(res);
-    APSARA_TEST_EQUAL(0U, batch.mEventQueueMap.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
     APSARA_TEST_EQUAL(2U, res.size());
     APSARA_TEST_EQUAL(1U, res[0].size());
     APSARA_TEST_EQUAL(2U, res[0][0].mEvents.size());
@@ -617,6 +631,43 @@ void BatcherUnittest::TestMetric() {
     }
 }
 
+void BatcherUnittest::TestConcurrentAdd() {
+    DefaultFlushStrategyOptions strategy;
+    strategy.mMaxCnt = 10000;
+    strategy.mMaxSizeBytes = 1000000;
+    strategy.mTimeoutSecs = 3;
+
+    Batcher<> batch;
+    batch.Init(Json::Value(), sFlusher.get(), strategy);
+
+    const size_t threadCnt = 8, groupCnt = 100;
+    vector<thread> threads;
+    for (size_t i = 0; i < threadCnt; ++i) {
+        threads.emplace_back([&batch, i]() {
+            vector<BatchedEventsList> res;
+            for (size_t j = 0; j < groupCnt; ++j) {
+                PipelineEventGroup group(make_shared<SourceBuffer>());
+                group.SetTag(string("key"), to_string(i * groupCnt + j));
+                group.AddLogEvent();
+                batch.Add(std::move(group), res);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    APSARA_TEST_EQUAL(threadCnt * groupCnt, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(threadCnt * groupCnt, batch.mEventBatchItemsTotal->GetValue());
+    APSARA_TEST_EQUAL(threadCnt * groupCnt, batch.mBufferedEventsTotal->GetValue());
+
+    vector<BatchedEventsList> res;
+    batch.FlushAll(res);
+    APSARA_TEST_EQUAL(threadCnt * groupCnt, res.size());
+    APSARA_TEST_EQUAL(0U, batch.GetEventQueueCnt());
+    APSARA_TEST_EQUAL(0U, batch.mEventBatchItemsTotal->GetValue());
+    APSARA_TEST_EQUAL(0U, batch.mBufferedEventsTotal->GetValue());
+}
+
 PipelineEventGroup BatcherUnittest::CreateEventGroup(size_t cnt) {
     PipelineEventGroup group(make_shared<SourceBuffer>());
     group.SetTag(string("key"), string("val"));
@@ -640,6 +691,7 @@ UNIT_TEST_CASE(BatcherUnittest, TestFlushGroupQueue)
 UNIT_TEST_CASE(BatcherUnittest, TestFlushAllWithoutGroupBatch)
 UNIT_TEST_CASE(BatcherUnittest, TestFlushAllWithGroupBatch)
 UNIT_TEST_CASE(BatcherUnittest, TestMetric)
+UNIT_TEST_CASE(BatcherUnittest, TestConcurrentAdd)
 
 } // namespace logtail
 
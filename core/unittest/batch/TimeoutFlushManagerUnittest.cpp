@@ -24,7 +24,10 @@ class TimeoutFlushManagerUnittest : public ::testing::Test {
 public:
     void TestUpdateRecord();
     void TestFlushTimeoutBatch();
+    void TestFlushUpdatedRecord();
     void TestClearRecords();
+    void TestFlushClearedRecord();
+    void TestUpdateRecordByHandle();
 
 protected:
     static void SetUpTestCase() {
@@ -34,7 +37,11 @@ protected:
         sFlusher->SetMetricsRecordRef(FlusherMock::sName, "1");
     }
 
-    void TearDown() override { TimeoutFlushManager::GetInstance()->mTimeoutRecords.clear(); }
+    void TearDown() override {
+        TimeoutFlushManager::GetInstance()->mTimeoutRecords.clear();
+        TimeoutFlushManager::GetInstance()->mDeadlineBuckets.clear();
+        sFlusher->mFlushedQueues.clear();
+    }
 
 private:
     static unique_ptr<FlusherMock> sFlusher;
@@ -49,22 +56,22 @@ void TimeoutFlushManagerUnittest::TestUpdateRecord() {
     TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 1, 3, sFlusher.get());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
-    auto& record1 = TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1));
+    auto& record1 = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1));
     APSARA_TEST_EQUAL(1U, record1.mKey);
     APSARA_TEST_EQUAL(3U, record1.mTimeoutSecs);
     APSARA_TEST_EQUAL(sFlusher.get(), record1.mFlusher);
-    APSARA_TEST_GT(record1.mUpdateTime, 0);
+    APSARA_TEST_GT(record1.mUpdateTime.load(), 0);
 
     // existed batch queue
     time_t lastTime = record1.mUpdateTime;
     TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 1, 3, sFlusher.get());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
-    auto& record2 = TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1));
+    auto& record2 = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1));
     APSARA_TEST_EQUAL(1U, record2.mKey);
     APSARA_TEST_EQUAL(3U, record2.mTimeoutSecs);
     APSARA_TEST_EQUAL(sFlusher.get(), record2.mFlusher);
-    APSARA_TEST_GT(record2.mUpdateTime, lastTime - 1);
+    APSARA_TEST_GT(record2.mUpdateTime.load(), lastTime - 1);
 }
 
 void TimeoutFlushManagerUnittest::TestFlushTimeoutBatch() {
@@ -77,6 +84,24 @@ void TimeoutFlushManagerUnittest::TestFlushTimeoutBatch() {
     APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
 }
 
+void TimeoutFlushManagerUnittest::TestFlushUpdatedRecord() {
+    TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 1, 0, sFlusher.get());
+    TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 2, 0, sFlusher.get());
+    APSARA_TEST_EQUAL(2U, TimeoutFlushManager::GetInstance()->mDeadlineBuckets.begin()->second.size());
+
+    // simulate that record 1 is updated after being bucketed
+    auto& record = *TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1));
+    record.mUpdateTime += 10;
+    time_t deadline = record.GetDeadline();
+
+    TimeoutFlushManager::GetInstance()->FlushTimeoutBatch();
+    APSARA_TEST_EQUAL(1U, sFlusher->mFlushedQueues.size()); // key 2
+    APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
+    APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mDeadlineBuckets.size());
+    APSARA_TEST_EQUAL(deadline, TimeoutFlushManager::GetInstance()->mDeadlineBuckets.begin()->first);
+    APSARA_TEST_EQUAL(deadline, record.mScheduledDeadline);
+}
+
 void TimeoutFlushManagerUnittest::TestClearRecords() {
     TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 1, 3, sFlusher.get());
     TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
@@ -84,9 +109,53 @@ void TimeoutFlushManagerUnittest::TestClearRecords() {
     APSARA_TEST_EQUAL(0U, TimeoutFlushManager::GetInstance()->mTimeoutRecords.size());
 }
 
+void TimeoutFlushManagerUnittest::TestFlushClearedRecord() {
+    TimeoutFlushManager::GetInstance()->UpdateRecord("test_config", 0, 1, 0, sFlusher.get());
+    TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
+    APSARA_TEST_FALSE(TimeoutFlushManager::GetInstance()->mDeadlineBuckets.empty());
+
+    // stale bucket entries are dropped without flushing
+    TimeoutFlushManager::GetInstance()->FlushTimeoutBatch();
+    APSARA_TEST_EQUAL(0U, sFlusher->mFlushedQueues.size());
+    APSARA_TEST_TRUE(TimeoutFlushManager::GetInstance()->mDeadlineBuckets.empty());
+}
+
+void TimeoutFlushManagerUnittest::TestUpdateRecordByHandle() {
+    TimeoutRecordHandle handle;
+    TimeoutFlushManager::GetInstance()->UpdateRecord(handle, "test_config", 0, 1, 0, sFlusher.get());
+    APSARA_TEST_NOT_EQUAL(nullptr, handle);
+    APSARA_TEST_EQUAL(handle, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1)));
+
+    // a registered record is refreshed through the handle
+    auto record = handle;
+    TimeoutFlushManager::GetInstance()->UpdateRecord(handle, "test_config", 0, 1, 0, sFlusher.get());
+    APSARA_TEST_EQUAL(record, handle);
+    APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mDeadlineBuckets.size());
+
+    // a flushed record is registered again
+    TimeoutFlushManager::GetInstance()->FlushTimeoutBatch();
+    APSARA_TEST_EQUAL(1U, sFlusher->mFlushedQueues.size());
+    APSARA_TEST_FALSE(handle->mRegistered);
+    TimeoutFlushManager::GetInstance()->UpdateRecord(handle, "test_config", 0, 1, 0, sFlusher.get());
+    APSARA_TEST_NOT_EQUAL(record, handle);
+    APSARA_TEST_TRUE(handle->mRegistered);
+    APSARA_TEST_EQUAL(handle, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].at(make_pair(0, 1)));
+
+    // so is a cleared one
+    record = handle;
+    TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
+    APSARA_TEST_FALSE(handle->mRegistered);
+    TimeoutFlushManager::GetInstance()->UpdateRecord(handle, "test_config", 0, 1, 0, sFlusher.get());
+    APSARA_TEST_NOT_EQUAL(record, handle);
+    APSARA_TEST_EQUAL(1U, TimeoutFlushManager::GetInstance()->mTimeoutRecords["test_config"].size());
+}
+
 UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestUpdateRecord)
 UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestFlushTimeoutBatch)
+UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestFlushUpdatedRecord)
 UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestClearRecords)
+UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestFlushClearedRecord)
+UNIT_TEST_CASE(TimeoutFlushManagerUnittest, TestUpdateRecordByHandle)
 
 } // namespace logtail
 
@@ -0,0 +1,246 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/DNSCache.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+// resolver with configurable latency and failures
+class StubResolver {
+public:
+    bool Resolve(const string& host, vector<string>& addresses) {
+        ++mResolveCnt;
+        this_thread::sleep_for(chrono::milliseconds(mLatencyMs.load()));
+        if (mFail) {
+            return false;
+        }
+        lock_guard<mutex> lock(mMux);
+        addresses = mAddresses;
+        return true;
+    }
+
+    void SetAddresses(const vector<string>& addresses) {
+        lock_guard<mutex> lock(mMux);
+        mAddresses = addresses;
+    }
+
+    atomic_int mLatencyMs = 0;
+    atomic_bool mFail = false;
+    atomic_int mResolveCnt = 0;
+
+private:
+    mutex mMux;
+    vector<string> mAddresses = {"10.0.0.1"};
+};
+
+class DnsCacheUnittest : public ::testing::Test {
+public:
+    void TestRawIp();
+    void TestResolveInBackground();
+    void TestRoundRobin();
+    void TestNegativeCache();
+    void TestRefreshBeforeExpiry();
+    void TestFirstResolve();
+    void TestMaxStale();
+
+protected:
+    void SetUp() override {
+        mResolver.reset(new StubResolver());
+        mCache = new DnsCache([this](const string& host, vector<string>& addresses) {
+            return mResolver->Resolve(host, addresses);
+        });
+        mCache->mTTLMs = 300;
+        mCache->mRefreshAheadMs = 100;
+        mCache->mMinRetryIntervalMs = 100;
+        mCache->mMaxRetryIntervalMs = 200;
+        mCache->mMaxStaleMs = 10000;
+        mCache->mFirstResolveTimeoutMs = 0;
+    }
+
+    void TearDown() override { delete mCache; }
+
+private:
+    static bool WaitFor(const function<bool()>& pred, int timeoutMs = 1000) {
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+        while (chrono::steady_clock::now() < deadline) {
+            if (pred()) {
+                return true;
+            }
+            this_thread::sleep_for(chrono::milliseconds(5));
+        }
+        return pred();
+    }
+
+    unique_ptr<StubResolver> mResolver;
+    DnsCache* mCache = nullptr;
+};
+
+void DnsCacheUnittest::TestRawIp() {
+    string address;
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("127.0.0.1", address));
+    APSARA_TEST_EQUAL("127.0.0.1", address);
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("999.0.0.1", address));
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("", address));
+    APSARA_TEST_EQUAL(0, mResolver->mResolveCnt.load());
+}
+
+void DnsCacheUnittest::TestResolveInBackground() {
+    mResolver->mLatencyMs = 300;
+    string address;
+    auto start = chrono::steady_clock::now();
+    // a slow resolver never blocks the caller
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(chrono::steady_clock::now() - start < chrono::milliseconds(100));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address); }));
+    APSARA_TEST_EQUAL("10.0.0.1", address);
+    // requests for the same host are merged
+    APSARA_TEST_EQUAL(1, mResolver->mResolveCnt.load());
+}
+
+void DnsCacheUnittest::TestRoundRobin() {
+    mResolver->SetAddresses({"10.0.0.1", "10.0.0.2", "10.0.0.3"});
+    string address;
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address); }));
+    vector<string> res;
+    for (int i = 0; i < 6; ++i) {
+        APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+        res.push_back(address);
+    }
+    for (int i = 0; i < 3; ++i) {
+        APSARA_TEST_NOT_EQUAL(res[i], res[i + 1]);
+        APSARA_TEST_EQUAL(res[i], res[i + 3]);
+    }
+}
+
+void DnsCacheUnittest::TestNegativeCache() {
+    mResolver->mFail = true;
+    string address;
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mResolver->mResolveCnt == 1; }));
+    this_thread::sleep_for(chrono::milliseconds(20));
+    // failure is cached, no resolve before retry interval
+    for (int i = 0; i < 10; ++i) {
+        APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    }
+    this_thread::sleep_for(chrono::milliseconds(20));
+    APSARA_TEST_EQUAL(1, mResolver->mResolveCnt.load());
+
+    // retried after 100ms
+    this_thread::sleep_for(chrono::milliseconds(100));
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mResolver->mResolveCnt == 2; }));
+    // backoff: the next retry is 200ms later
+    this_thread::sleep_for(chrono::milliseconds(120));
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    this_thread::sleep_for(chrono::milliseconds(20));
+    APSARA_TEST_EQUAL(2, mResolver->mResolveCnt.load());
+
+    mResolver->mFail = false;
+    this_thread::sleep_for(chrono::milliseconds(100));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address); }));
+    APSARA_TEST_EQUAL("10.0.0.1", address);
+}
+
+void DnsCacheUnittest::TestRefreshBeforeExpiry() {
+    string address;
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address); }));
+    APSARA_TEST_EQUAL(1, mResolver->mResolveCnt.load());
+
+    // refreshed 100ms before expiry
+    mResolver->SetAddresses({"10.0.0.2"});
+    this_thread::sleep_for(chrono::milliseconds(220));
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_EQUAL("10.0.0.1", address);
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address) && address == "10.0.0.2"; }));
+    APSARA_TEST_EQUAL(2, mResolver->mResolveCnt.load());
+
+    // stale address is served when refresh fails
+    mResolver->mFail = true;
+    this_thread::sleep_for(chrono::milliseconds(220));
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mResolver->mResolveCnt == 3; }));
+    this_thread::sleep_for(chrono::milliseconds(20));
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_EQUAL("10.0.0.2", address);
+}
+
+void DnsCacheUnittest::TestFirstResolve() {
+    mCache->mFirstResolveTimeoutMs = 500;
+    string address;
+    // a fast resolver is waited for
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_EQUAL("10.0.0.1", address);
+
+    // a slow resolver is waited for no longer than the timeout
+    mCache->mFirstResolveTimeoutMs = 50;
+    mResolver->mLatencyMs = 300;
+    auto start = chrono::steady_clock::now();
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("slow_host", address));
+    auto cost = chrono::steady_clock::now() - start;
+    APSARA_TEST_TRUE(cost >= chrono::milliseconds(50));
+    APSARA_TEST_TRUE(cost < chrono::milliseconds(250));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("slow_host", address); }));
+
+    // no wait once stopped
+    mCache->Stop();
+    start = chrono::steady_clock::now();
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("new_host", address));
+    APSARA_TEST_TRUE(chrono::steady_clock::now() - start < chrono::milliseconds(50));
+}
+
+void DnsCacheUnittest::TestMaxStale() {
+    mCache->mMaxStaleMs = 400;
+    string address;
+    APSARA_TEST_TRUE(WaitFor([&]() { return mCache->GetIPFromDnsCache("host", address); }));
+
+    // stale address is served within the limit
+    mResolver->mFail = true;
+    this_thread::sleep_for(chrono::milliseconds(220));
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mResolver->mResolveCnt == 2; }));
+    this_thread::sleep_for(chrono::milliseconds(20));
+    APSARA_TEST_TRUE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_EQUAL("10.0.0.1", address);
+
+    // and dropped after the limit
+    this_thread::sleep_for(chrono::milliseconds(200));
+    APSARA_TEST_FALSE(mCache->GetIPFromDnsCache("host", address));
+    APSARA_TEST_TRUE(WaitFor([&]() { return mResolver->mResolveCnt == 3; }));
+    this_thread::sleep_for(chrono::milliseconds(20));
+    APSARA_TEST_TRUE(atomic_load(&mCache->mTable)->at("host")->mAddresses.empty());
+}
+
+UNIT_TEST_CASE(DnsCacheUnittest, TestRawIp)
+UNIT_TEST_CASE(DnsCacheUnittest, TestResolveInBackground)
+UNIT_TEST_CASE(DnsCacheUnittest, TestRoundRobin)
+UNIT_TEST_CASE(DnsCacheUnittest, TestNegativeCache)
+UNIT_TEST_CASE(DnsCacheUnittest, TestRefreshBeforeExpiry)
+UNIT_TEST_CASE(DnsCacheUnittest, TestFirstResolve)
+UNIT_TEST_CASE(DnsCacheUnittest, TestMaxStale)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
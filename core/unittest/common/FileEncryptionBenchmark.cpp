@@ -0,0 +1,107 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ctime>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "common/FileEncryption.h"
+#include "common/TimeUtil.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Cost of encrypting the data spilled to disk buffer files. Key version 1 is the legacy xor cipher, and key version 2
+// is AES-256-GCM.
+class FileEncryptionBenchmark {
+public:
+    explicit FileEncryptionBenchmark(size_t size) : mSize(size) {}
+
+    void TestEncrypt(int32_t version);
+    void TestDecrypt(int32_t version);
+
+private:
+    void Report(const char* name, int32_t version, uint64_t wallUs, clock_t cpu) const;
+
+    static const size_t sTotalBytes = 1024 * 1024 * 1024;
+    size_t mSize;
+};
+
+void FileEncryptionBenchmark::Report(const char* name, int32_t version, uint64_t wallUs, clock_t cpu) const {
+    double mb = static_cast<double>(sTotalBytes) / 1024 / 1024;
+    double cpuMs = static_cast<double>(cpu) * 1000 / CLOCKS_PER_SEC;
+    printf("%s version %d, %zu bytes per buffer: %.1f MB/s, %.3f cpu ms/MB\n",
+           name,
+           version,
+           mSize,
+           mb * 1000000 / wallUs,
+           cpuMs / mb);
+}
+
+void FileEncryptionBenchmark::TestEncrypt(int32_t version) {
+    string data(mSize, 'x');
+    size_t cnt = sTotalBytes / mSize;
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    clock_t startCpu = clock();
+    for (size_t i = 0; i < cnt; ++i) {
+        char* des = nullptr;
+        int32_t desLength = 0;
+        if (FileEncryption::GetInstance()->Encrypt(data.data(), data.size(), des, desLength, version)) {
+            delete[] des;
+        }
+    }
+    Report(__func__, version, GetCurrentTimeInMicroSeconds() - starttime, clock() - startCpu);
+}
+
+void FileEncryptionBenchmark::TestDecrypt(int32_t version) {
+    string data(mSize, 'x');
+    char* des = nullptr;
+    int32_t desLength = 0;
+    if (!FileEncryption::GetInstance()->Encrypt(data.data(), data.size(), des, desLength, version)) {
+        return;
+    }
+    size_t cnt = sTotalBytes / mSize;
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    clock_t startCpu = clock();
+    for (size_t i = 0; i < cnt; ++i) {
+        FileEncryption::GetInstance()->Decrypt(des, desLength, &data[0], data.size(), version);
+    }
+    Report(__func__, version, GetCurrentTimeInMicroSeconds() - starttime, clock() - startCpu);
+    delete[] des;
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    for (size_t size : std::vector<size_t>{64 * 1024, 1024 * 1024}) {
+        logtail::FileEncryptionBenchmark benchmark(size);
+        for (int32_t version : {1, 2}) {
+            benchmark.TestEncrypt(version);
+            benchmark.TestDecrypt(version);
+        }
+    }
+    /* Result (-O2, x86_64 with AES-NI, 1GB in total):
+       TestEncrypt version 1, 65536 bytes per buffer: 286.4 MB/s, 3.263 cpu ms/MB
+       TestDecrypt version 1, 65536 bytes per buffer: 325.7 MB/s, 2.967 cpu ms/MB
+       TestEncrypt version 2, 65536 bytes per buffer: 1809.4 MB/s, 0.528 cpu ms/MB
+       TestDecrypt version 2, 65536 bytes per buffer: 2019.3 MB/s, 0.489 cpu ms/MB
+       TestEncrypt version 1, 1048576 bytes per buffer: 305.8 MB/s, 3.037 cpu ms/MB
+       TestDecrypt version 1, 1048576 bytes per buffer: 310.0 MB/s, 3.061 cpu ms/MB
+       TestEncrypt version 2, 1048576 bytes per buffer: 2382.1 MB/s, 0.411 cpu ms/MB
+       TestDecrypt version 2, 1048576 bytes per buffer: 2084.9 MB/s, 0.463 cpu ms/MB
+     */
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "common/FileEncryption.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class FileEncryptionUnittest : public testing::Test {
+public:
+    void TestDefaultKey();
+    void TestAesGcm();
+    void TestAesGcmCorrupted();
+    void TestXorCompatibility();
+
+private:
+    static string GenerateData(size_t size) {
+        string data(size, '\0');
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>('a' + i % 26);
+        }
+        return data;
+    }
+
+    static bool Encrypt(const string& data, string& encryption, int32_t version = 0) {
+        char* des = nullptr;
+        int32_t desLength = 0;
+        if (!FileEncryption::GetInstance()->Encrypt(data.data(), data.size(), des, desLength, version)) {
+            return false;
+        }
+        encryption.assign(des, desLength);
+        delete[] des;
+        return true;
+    }
+
+    static bool Decrypt(const string& encryption, size_t size, string& data, int32_t version) {
+        unique_ptr<char[]> des(new char[size]);
+        if (!FileEncryption::GetInstance()->Decrypt(encryption.data(), encryption.size(), des.get(), size, version)) {
+            return false;
+        }
+        data.assign(des.get(), size);
+        return true;
+    }
+};
+
+void FileEncryptionUnittest::TestDefaultKey() {
+    auto encryption = FileEncryption::GetInstance();
+    APSARA_TEST_EQUAL(2, encryption->GetDefaultKeyVersion());
+    APSARA_TEST_TRUE(FileEncryption::CipherType::AES_256_GCM == encryption->mDefaultKey->mCipher);
+    APSARA_TEST_TRUE(FileEncryption::CipherType::XOR == encryption->mKeyMap[1]->mCipher);
+}
+
+void FileEncryptionUnittest::TestAesGcm() {
+    for (size_t size : {1, 15, 16, 17, 1024 * 1024 + 3}) {
+        string data = GenerateData(size);
+        string encryption1, encryption2;
+        APSARA_TEST_TRUE(Encrypt(data, encryption1));
+        APSARA_TEST_EQUAL(data.size() + FileEncryption::AES_GCM_IV_SIZE + FileEncryption::AES_GCM_TAG_SIZE,
+                          encryption1.size());
+        APSARA_TEST_TRUE(encryption1.find(data) == string::npos);
+        // iv differs for each call
+        APSARA_TEST_TRUE(Encrypt(data, encryption2));
+        APSARA_TEST_NOT_EQUAL(encryption1, encryption2);
+
+        string decryption;
+        APSARA_TEST_TRUE(Decrypt(encryption1, size, decryption, 2));
+        APSARA_TEST_EQUAL(data, decryption);
+        APSARA_TEST_TRUE(Decrypt(encryption2, size, decryption, 2));
+        APSARA_TEST_EQUAL(data, decryption);
+    }
+    string encryption;
+    APSARA_TEST_FALSE(Encrypt("", encryption));
+}
+
+void FileEncryptionUnittest::TestAesGcmCorrupted() {
+    string data = GenerateData(4096);
+    string encryption, decryption;
+    APSARA_TEST_TRUE(Encrypt(data, encryption));
+    // iv, cipher text and tag are all authenticated
+    for (size_t pos : {size_t(0), size_t(100), encryption.size() - 1}) {
+        string corrupted = encryption;
+        corrupted[pos] ^= 1;
+        APSARA_TEST_FALSE(Decrypt(corrupted, data.size(), decryption, 2));
+    }
+    // truncated
+    APSARA_TEST_FALSE(Decrypt(encryption.substr(0, encryption.size() - 1), data.size() - 1, decryption, 2));
+    // size mismatch
+    APSARA_TEST_FALSE(Decrypt(encryption, data.size() - 1, decryption, 2));
+    // wrong key
+    APSARA_TEST_FALSE(Decrypt(encryption, data.size(), decryption, 1));
+}
+
+void FileEncryptionUnittest::TestXorCompatibility() {
+    // buffer files written by old versions are still readable
+    string data = GenerateData(1000);
+    string encryption, decryption;
+    APSARA_TEST_TRUE(Encrypt(data, encryption, 1));
+    APSARA_TEST_EQUAL(1024U, encryption.size());
+    APSARA_TEST_TRUE(Decrypt(encryption, data.size(), decryption, 1));
+    APSARA_TEST_EQUAL(data, decryption);
+}
+
+UNIT_TEST_CASE(FileEncryptionUnittest, TestDefaultKey)
+UNIT_TEST_CASE(FileEncryptionUnittest, TestAesGcm)
+UNIT_TEST_CASE(FileEncryptionUnittest, TestAesGcmCorrupted)
+UNIT_TEST_CASE(FileEncryptionUnittest, TestXorCompatibility)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,185 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/RingQueue.h"
+#include "common/SafeQueue.h"
+#include "common/TimeUtil.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Throughput of cross-thread handoff. SafeQueue consumers pop one item at a time, while RingQueue consumers drain up
+// to sBatchSize items per CAS.
+class RingQueueBenchmark {
+public:
+    RingQueueBenchmark(size_t producerCnt, size_t consumerCnt) : mProducerCnt(producerCnt), mConsumerCnt(consumerCnt) {}
+
+    void TestSafeQueue();
+    void TestRingQueue(uint32_t spinCnt, size_t pushBatchSize);
+    // handoff of heap allocated requests as done by sinks, with a single consumer popping one request at a time
+    void TestSinkSafeQueue();
+    void TestSinkRingQueue();
+
+private:
+    template <typename Produce, typename Consume>
+    uint64_t Run(const Produce& produce, const Consume& consume);
+
+    static const size_t sItemCnt = 4 * 1024 * 1024;
+    static const size_t sBatchSize = 256;
+    static const size_t sCapacity = 4096;
+    size_t mProducerCnt;
+    size_t mConsumerCnt;
+};
+
+template <typename Produce, typename Consume>
+uint64_t RingQueueBenchmark::Run(const Produce& produce, const Consume& consume) {
+    size_t itemCntPerProducer = sItemCnt / mProducerCnt;
+    size_t total = itemCntPerProducer * mProducerCnt;
+    atomic_size_t poppedCnt = 0;
+    vector<future<void>> res;
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    for (size_t i = 0; i < mConsumerCnt; ++i) {
+        res.emplace_back(async(launch::async, [&]() {
+            while (poppedCnt.load(memory_order_relaxed) < total) {
+                poppedCnt.fetch_add(consume(), memory_order_relaxed);
+            }
+        }));
+    }
+    for (size_t i = 0; i < mProducerCnt; ++i) {
+        res.emplace_back(async(launch::async, [&]() { produce(itemCntPerProducer); }));
+    }
+    for (auto& r : res) {
+        r.get();
+    }
+    return GetCurrentTimeInMicroSeconds() - starttime;
+}
+
+void RingQueueBenchmark::TestSafeQueue() {
+    SafeQueue<size_t> queue;
+    auto cost = Run(
+        [&](size_t cnt) {
+            for (size_t i = 0; i < cnt; ++i) {
+                queue.Push(size_t(i));
+            }
+        },
+        [&]() -> size_t {
+            size_t item = 0;
+            return queue.WaitAndPop(item, 10) ? 1 : 0;
+        });
+    printf("%zuP%zuC SafeQueue: %.1f M items/s\n", mProducerCnt, mConsumerCnt, double(sItemCnt) / cost);
+}
+
+void RingQueueBenchmark::TestRingQueue(uint32_t spinCnt, size_t pushBatchSize) {
+    RingQueue<size_t> queue(sCapacity, spinCnt);
+    auto cost = Run(
+        [&](size_t cnt) {
+            vector<size_t> items(pushBatchSize);
+            for (size_t i = 0; i < cnt; i += pushBatchSize) {
+                size_t n = min(pushBatchSize, cnt - i), pushed = 0;
+                while (pushed < n) {
+                    pushed += queue.TryPushBatch(items.data() + pushed, n - pushed);
+                    if (pushed < n && queue.Push(size_t(i + pushed), 10)) {
+                        ++pushed;
+                    }
+                }
+            }
+        },
+        [&]() -> size_t {
+            thread_local vector<size_t> items;
+            items.clear();
+            return queue.WaitAndPopBatch(items, sBatchSize, 10);
+        });
+    printf("%zuP%zuC RingQueue, spin %u, push batch %zu: %.1f M items/s\n",
+           mProducerCnt,
+           mConsumerCnt,
+           spinCnt,
+           pushBatchSize,
+           double(sItemCnt) / cost);
+}
+
+void RingQueueBenchmark::TestSinkSafeQueue() {
+    SafeQueue<unique_ptr<string>> queue;
+    auto cost = Run(
+        [&](size_t cnt) {
+            for (size_t i = 0; i < cnt; ++i) {
+                queue.Push(make_unique<string>(64, 'a'));
+            }
+        },
+        [&]() -> size_t {
+            unique_ptr<string> item;
+            return queue.WaitAndPop(item, 10) ? 1 : 0;
+        });
+    printf("%zuP%zuC sink SafeQueue: %.1f M items/s\n", mProducerCnt, mConsumerCnt, double(sItemCnt) / cost);
+}
+
+void RingQueueBenchmark::TestSinkRingQueue() {
+    // same as Sink
+    RingQueue<unique_ptr<string>> queue(sCapacity, 64);
+    auto cost = Run(
+        [&](size_t cnt) {
+            for (size_t i = 0; i < cnt; ++i) {
+                auto item = make_unique<string>(64, 'a');
+                while (!queue.Push(std::move(item), 1000)) {
+                }
+            }
+        },
+        [&]() -> size_t {
+            unique_ptr<string> item;
+            return queue.WaitAndPop(item, 10) ? 1 : 0;
+        });
+    printf("%zuP%zuC sink RingQueue: %.1f M items/s\n", mProducerCnt, mConsumerCnt, double(sItemCnt) / cost);
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    for (auto& cnt : std::vector<std::pair<size_t, size_t>>{{1, 1}, {4, 1}, {8, 8}}) {
+        logtail::RingQueueBenchmark benchmark(cnt.first, cnt.second);
+        benchmark.TestSafeQueue();
+        benchmark.TestRingQueue(0, 1);
+        benchmark.TestRingQueue(64, 1);
+        benchmark.TestRingQueue(64, 32);
+        benchmark.TestSinkSafeQueue();
+        benchmark.TestSinkRingQueue();
+    }
+    /* Result (-O2, 1 vCPU, 4M items of size_t, or of unique_ptr<string> for sink cases):
+       1P1C SafeQueue: 7.9 M items/s
+       1P1C RingQueue, spin 0, push batch 1: 4.9 M items/s
+       1P1C RingQueue, spin 64, push batch 1: 24.3 M items/s
+       1P1C RingQueue, spin 64, push batch 32: 103.5 M items/s
+       1P1C sink SafeQueue: 2.9 M items/s
+       1P1C sink RingQueue: 3.3 M items/s
+       4P1C SafeQueue: 7.4 M items/s
+       4P1C RingQueue, spin 0, push batch 1: 8.3 M items/s
+       4P1C RingQueue, spin 64, push batch 1: 22.3 M items/s
+       4P1C RingQueue, spin 64, push batch 32: 94.9 M items/s
+       4P1C sink SafeQueue: 2.6 M items/s
+       4P1C sink RingQueue: 3.2 M items/s
+       8P8C SafeQueue: 7.5 M items/s
+       8P8C RingQueue, spin 0, push batch 1: 12.2 M items/s
+       8P8C RingQueue, spin 64, push batch 1: 27.8 M items/s
+       8P8C RingQueue, spin 64, push batch 32: 104.0 M items/s
+       8P8C sink SafeQueue: 3.7 M items/s
+       8P8C sink RingQueue: 3.9 M items/s
+     */
+    return 0;
+}
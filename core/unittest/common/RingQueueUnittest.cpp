@@ -0,0 +1,165 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "common/RingQueue.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class RingQueueUnittest : public ::testing::Test {
+public:
+    void TestCapacity();
+    void TestPushAndPop();
+    void TestBatch();
+    void TestWait();
+    void TestConcurrency();
+};
+
+void RingQueueUnittest::TestCapacity() {
+    APSARA_TEST_EQUAL(2U, RingQueue<int>(0).Capacity());
+    APSARA_TEST_EQUAL(8U, RingQueue<int>(8).Capacity());
+    APSARA_TEST_EQUAL(16U, RingQueue<int>(9).Capacity());
+}
+
+void RingQueueUnittest::TestPushAndPop() {
+    RingQueue<unique_ptr<int>> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(i)));
+    }
+    APSARA_TEST_EQUAL(4U, queue.Size());
+    // full, and the item is left untouched
+    auto item = make_unique<int>(4);
+    APSARA_TEST_FALSE(queue.TryPush(std::move(item)));
+    APSARA_TEST_NOT_EQUAL(nullptr, item);
+    APSARA_TEST_FALSE(queue.Push(std::move(item), 1));
+    APSARA_TEST_NOT_EQUAL(nullptr, item);
+
+    // slots are reused after wrapping around
+    for (int round = 0; round < 3; ++round) {
+        unique_ptr<int> res;
+        APSARA_TEST_TRUE(queue.TryPop(res));
+        APSARA_TEST_EQUAL(round, *res);
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(round + 4)));
+    }
+    for (int i = 3; i < 7; ++i) {
+        unique_ptr<int> res;
+        APSARA_TEST_TRUE(queue.WaitAndPop(res, 1000));
+        APSARA_TEST_EQUAL(i, *res);
+    }
+    unique_ptr<int> res;
+    APSARA_TEST_FALSE(queue.TryPop(res));
+    APSARA_TEST_FALSE(queue.WaitAndPop(res, 1));
+    APSARA_TEST_TRUE(queue.Empty());
+}
+
+void RingQueueUnittest::TestBatch() {
+    RingQueue<int> queue(8);
+    vector<int> items = {0, 1, 2, 3, 4, 5};
+    APSARA_TEST_EQUAL(6U, queue.TryPushBatch(items.data(), items.size()));
+    // only the free slots are taken
+    APSARA_TEST_EQUAL(2U, queue.TryPushBatch(items.data(), items.size()));
+    APSARA_TEST_EQUAL(0U, queue.TryPushBatch(items.data(), items.size()));
+
+    vector<int> res;
+    APSARA_TEST_EQUAL(5U, queue.TryPopBatch(res, 5));
+    APSARA_TEST_EQUAL(3U, queue.WaitAndPopBatch(res, 100, 1000));
+    APSARA_TEST_EQUAL(0U, queue.WaitAndPopBatch(res, 100, 1));
+    APSARA_TEST_EQUAL(vector<int>({0, 1, 2, 3, 4, 5, 0, 1}), res);
+}
+
+void RingQueueUnittest::TestWait() {
+    RingQueue<unique_ptr<int>> queue(2);
+    {
+        auto res = async(launch::async, [&queue] {
+            unique_ptr<int> item;
+            return queue.WaitAndPop(item, 10000);
+        });
+        this_thread::sleep_for(chrono::milliseconds(10));
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(1)));
+        APSARA_TEST_TRUE(res.get());
+    }
+    {
+        auto res = async(launch::async, [&queue] {
+            vector<unique_ptr<int>> items;
+            return queue.WaitAndPopBatch(items, 10, 10000);
+        });
+        this_thread::sleep_for(chrono::milliseconds(10));
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(1)));
+        APSARA_TEST_EQUAL(1U, res.get());
+    }
+    {
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(1)));
+        APSARA_TEST_TRUE(queue.TryPush(make_unique<int>(2)));
+        auto res = async(launch::async, [&queue] { return queue.Push(make_unique<int>(3), 10000); });
+        this_thread::sleep_for(chrono::milliseconds(10));
+        unique_ptr<int> item;
+        APSARA_TEST_TRUE(queue.TryPop(item));
+        APSARA_TEST_TRUE(res.get());
+        APSARA_TEST_EQUAL(2U, queue.Size());
+    }
+}
+
+void RingQueueUnittest::TestConcurrency() {
+    static const size_t sProducerCnt = 4, sConsumerCnt = 4, sItemCnt = 100000;
+    RingQueue<size_t> queue(64, 16);
+    atomic_size_t poppedCnt = 0, poppedSum = 0;
+    vector<future<void>> producers, consumers;
+    for (size_t i = 0; i < sProducerCnt; ++i) {
+        producers.emplace_back(async(launch::async, [&queue]() {
+            for (size_t j = 1; j <= sItemCnt; ++j) {
+                while (!queue.Push(size_t(j), 100)) {
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < sConsumerCnt; ++i) {
+        consumers.emplace_back(async(launch::async, [&]() {
+            vector<size_t> items;
+            while (poppedCnt.load() < sProducerCnt * sItemCnt) {
+                items.clear();
+                queue.WaitAndPopBatch(items, 16, 10);
+                for (auto item : items) {
+                    poppedSum += item;
+                }
+                poppedCnt += items.size();
+            }
+        }));
+    }
+    for (auto& res : producers) {
+        res.get();
+    }
+    for (auto& res : consumers) {
+        res.get();
+    }
+    APSARA_TEST_EQUAL(sProducerCnt * sItemCnt, poppedCnt.load());
+    APSARA_TEST_EQUAL(sProducerCnt * sItemCnt * (sItemCnt + 1) / 2, poppedSum.load());
+    APSARA_TEST_TRUE(queue.Empty());
+}
+
+UNIT_TEST_CASE(RingQueueUnittest, TestCapacity)
+UNIT_TEST_CASE(RingQueueUnittest, TestPushAndPop)
+UNIT_TEST_CASE(RingQueueUnittest, TestBatch)
+UNIT_TEST_CASE(RingQueueUnittest, TestWait)
+UNIT_TEST_CASE(RingQueueUnittest, TestConcurrency)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,185 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "common/Flags.h"
+#include "common/http/CurlHandlerPool.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(curl_handler_pool_max_idle_per_host);
+DECLARE_FLAG_INT32(curl_handler_pool_idle_timeout_sec);
+
+using namespace std;
+
+namespace logtail {
+
+// minimal http/1.1 server keeping connections alive
+class KeepAliveHttpServer {
+public:
+    bool Start() {
+        mListenFd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (bind(mListenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(mListenFd, 16) != 0
+            || getsockname(mListenFd, (sockaddr*)&addr, &len) != 0) {
+            return false;
+        }
+        mPort = ntohs(addr.sin_port);
+        mThread = thread([this]() { Run(); });
+        return true;
+    }
+
+    void Stop() {
+        shutdown(mListenFd, SHUT_RDWR);
+        close(mListenFd);
+        mThread.join();
+    }
+
+    int32_t mPort = 0;
+    atomic_int mAcceptCnt = 0;
+
+private:
+    void Run() {
+        while (true) {
+            int fd = accept(mListenFd, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            ++mAcceptCnt;
+            thread([fd]() {
+                static const char sResponse[] = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok";
+                string buf;
+                char tmp[1024];
+                ssize_t n;
+                while ((n = read(fd, tmp, sizeof(tmp))) > 0) {
+                    buf.append(tmp, n);
+                    size_t pos;
+                    while ((pos = buf.find("\r\n\r\n")) != string::npos) {
+                        buf.erase(0, pos + 4);
+                        if (write(fd, sResponse, sizeof(sResponse) - 1) < 0) {
+                            break;
+                        }
+                    }
+                }
+                close(fd);
+            }).detach();
+        }
+    }
+
+    int mListenFd = -1;
+    thread mThread;
+};
+
+class CurlHandlerPoolUnittest : public ::testing::Test {
+public:
+    void TestAcquireAndRelease();
+    void TestEvictIdleHandlers();
+    void TestConnectionReuse();
+
+protected:
+    void SetUp() override {
+        INT32_FLAG(curl_handler_pool_max_idle_per_host) = 2;
+        INT32_FLAG(curl_handler_pool_idle_timeout_sec) = 60;
+    }
+};
+
+void CurlHandlerPoolUnittest::TestAcquireAndRelease() {
+    CurlHandlerPool pool;
+    CURL* h1 = pool.Acquire(false, "a", 80);
+    CURL* h2 = pool.Acquire(false, "a", 80);
+    CURL* h3 = pool.Acquire(false, "a", 80);
+    APSARA_TEST_NOT_EQUAL(h1, h2);
+    pool.Release(false, "a", 80, h1, false);
+    pool.Release(false, "a", 80, h2, false);
+    pool.Release(false, "a", 80, h3, false);
+    // the oldest one is cleaned up
+    APSARA_TEST_EQUAL(2U, pool.mIdleHandlers["http://a:80"].size());
+    APSARA_TEST_EQUAL(0U, pool.GetNewConnectionCnt() + pool.GetReusedConnectionCnt());
+
+    // most recently used first
+    APSARA_TEST_EQUAL(h3, pool.Acquire(false, "a", 80));
+    APSARA_TEST_EQUAL(1U, pool.GetReusedHandlerCnt());
+    // handlers are not shared between endpoints
+    CURL* h4 = pool.Acquire(true, "a", 80);
+    APSARA_TEST_NOT_EQUAL(h2, h4);
+    APSARA_TEST_EQUAL(1U, pool.GetReusedHandlerCnt());
+    pool.Release(false, "a", 80, h3, false);
+    pool.Release(true, "a", 80, h4, false);
+    APSARA_TEST_EQUAL(2U, pool.mIdleHandlers.size());
+}
+
+void CurlHandlerPoolUnittest::TestEvictIdleHandlers() {
+    CurlHandlerPool pool;
+    pool.Release(false, "a", 80, pool.Acquire(false, "a", 80), false);
+    pool.Release(false, "b", 80, pool.Acquire(false, "b", 80), false);
+    pool.mIdleHandlers["http://a:80"].front().mIdleSinceMs -= 61 * 1000;
+    pool.mLastEvictTimeMs = 0;
+
+    CURL* curl = pool.Acquire(false, "c", 80);
+    APSARA_TEST_EQUAL(1U, pool.mIdleHandlers.size());
+    APSARA_TEST_TRUE(pool.mIdleHandlers.find("http://b:80") != pool.mIdleHandlers.end());
+    pool.Release(false, "c", 80, curl, false);
+}
+
+void CurlHandlerPoolUnittest::TestConnectionReuse() {
+    KeepAliveHttpServer server;
+    APSARA_TEST_TRUE(server.Start());
+    string url = "http://127.0.0.1:" + to_string(server.mPort) + "/";
+    CurlHandlerPool pool;
+    for (int i = 0; i < 3; ++i) {
+        string body;
+        CURL* curl = pool.Acquire(false, "127.0.0.1", server.mPort);
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+        curl_easy_setopt(curl,
+                         CURLOPT_WRITEFUNCTION,
+                         +[](char* ptr, size_t size, size_t nmemb, string* data) {
+                             data->append(ptr, size * nmemb);
+                             return size * nmemb;
+                         });
+        APSARA_TEST_EQUAL(CURLE_OK, curl_easy_perform(curl));
+        APSARA_TEST_EQUAL("ok", body);
+        pool.Release(false, "127.0.0.1", server.mPort, curl);
+    }
+    APSARA_TEST_EQUAL(1, server.mAcceptCnt.load());
+    APSARA_TEST_EQUAL(1U, pool.GetNewConnectionCnt());
+    APSARA_TEST_EQUAL(2U, pool.GetReusedConnectionCnt());
+    APSARA_TEST_EQUAL(2U, pool.GetReusedHandlerCnt());
+
+    // connections are closed with the handlers
+    pool.Clear();
+    server.Stop();
+}
+
+UNIT_TEST_CASE(CurlHandlerPoolUnittest, TestAcquireAndRelease)
+UNIT_TEST_CASE(CurlHandlerPoolUnittest, TestEvictIdleHandlers)
+UNIT_TEST_CASE(CurlHandlerPoolUnittest, TestConnectionReuse)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
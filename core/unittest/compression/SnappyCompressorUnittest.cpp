@@ -0,0 +1,92 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/compression/SnappyCompressor.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class SnappyCompressorUnittest : public ::testing::Test {
+public:
+    void TestCompress();
+    void TestCompressRepetitiveInput();
+    void TestCompressLongInput();
+};
+
+void SnappyCompressorUnittest::TestCompress() {
+    SnappyCompressor compressor(CompressType::SNAPPY);
+    {
+        string input = "hello world";
+        string output;
+        string errorMsg;
+        APSARA_TEST_TRUE(compressor.DoCompress(input, output, errorMsg));
+        // varint length followed by a single literal
+        APSARA_TEST_EQUAL(string("\x0b\x28hello world", 13), output);
+        string decompressed;
+        decompressed.resize(input.size());
+        APSARA_TEST_TRUE(compressor.UnCompress(output, decompressed, errorMsg));
+        APSARA_TEST_EQUAL(input, decompressed);
+    }
+    {
+        string input;
+        string output;
+        string errorMsg;
+        APSARA_TEST_TRUE(compressor.DoCompress(input, output, errorMsg));
+        APSARA_TEST_EQUAL(string("\x00", 1), output);
+    }
+}
+
+void SnappyCompressorUnittest::TestCompressRepetitiveInput() {
+    SnappyCompressor compressor(CompressType::SNAPPY);
+    string input;
+    for (size_t i = 0; i < 1000; ++i) {
+        input += "http_requests_total{method=\"GET\",code=\"200\"} ";
+    }
+    string output;
+    string errorMsg;
+    APSARA_TEST_TRUE(compressor.DoCompress(input, output, errorMsg));
+    APSARA_TEST_TRUE(output.size() < input.size() / 10);
+    string decompressed;
+    decompressed.resize(input.size());
+    APSARA_TEST_TRUE(compressor.UnCompress(output, decompressed, errorMsg));
+    APSARA_TEST_EQUAL(input, decompressed);
+}
+
+void SnappyCompressorUnittest::TestCompressLongInput() {
+    // longer than the maximum copy offset and with literals longer than 60 bytes
+    SnappyCompressor compressor(CompressType::SNAPPY);
+    string input;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < 200000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        input.push_back(static_cast<char>(i % 1000 < 500 ? 'a' + (seed >> 16) % 26 : input[i - 500]));
+    }
+    string output;
+    string errorMsg;
+    APSARA_TEST_TRUE(compressor.DoCompress(input, output, errorMsg));
+    string decompressed;
+    decompressed.resize(input.size());
+    APSARA_TEST_TRUE(compressor.UnCompress(output, decompressed, errorMsg));
+    APSARA_TEST_EQUAL(input, decompressed);
+}
+
+UNIT_TEST_CASE(SnappyCompressorUnittest, TestCompress)
+UNIT_TEST_CASE(SnappyCompressorUnittest, TestCompressRepetitiveInput)
+UNIT_TEST_CASE(SnappyCompressorUnittest, TestCompressLongInput)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,152 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ebpf/handler/EventGroupCoalescer.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+class EventGroupCoalescerUnittest : public testing::Test {
+public:
+    void TestCoalesce();
+    void TestFlushBySize();
+    void TestFlushTimeout();
+    void TestDisabled();
+    void TestIntern();
+
+protected:
+    void TearDown() override { mGroups.clear(); }
+
+    EventGroupCoalescer::PushFunc Capture() {
+        return [this](PipelineEventGroup&& group) { mGroups.emplace_back(std::move(group)); };
+    }
+
+    static void AddLogs(CoalescedGroup& group, size_t cnt) {
+        static const string key = "key";
+        for (size_t i = 0; i < cnt; ++i) {
+            auto event = group.GetGroup().AddLogEvent();
+            event->SetContentNoCopy(group.Intern(key), group.Intern("value"));
+        }
+    }
+
+    vector<PipelineEventGroup> mGroups;
+};
+
+void EventGroupCoalescerUnittest::TestCoalesce() {
+    EventGroupCoalescer coalescer(Capture(), 100, 1024 * 1024, 60000);
+    auto init = [](const string& tag) {
+        return [tag](CoalescedGroup& group) { group.GetGroup().SetTag(string("tag"), tag); };
+    };
+    for (int i = 0; i < 5; ++i) {
+        coalescer.Append("a", init("a"), [](CoalescedGroup& group) { AddLogs(group, 3); });
+        coalescer.Append("b", init("b"), [](CoalescedGroup& group) { AddLogs(group, 2); });
+    }
+    // nothing is pushed until the group is large enough or old enough
+    APSARA_TEST_TRUE(mGroups.empty());
+    APSARA_TEST_EQUAL(2U, coalescer.mGroups.size());
+
+    coalescer.FlushAll();
+    APSARA_TEST_EQUAL(2U, mGroups.size());
+    APSARA_TEST_TRUE(coalescer.mGroups.empty());
+    for (auto& group : mGroups) {
+        if (group.GetTag("tag") == "a") {
+            APSARA_TEST_EQUAL(15U, group.GetEvents().size());
+        } else {
+            APSARA_TEST_EQUAL("b", group.GetTag("tag").to_string());
+            APSARA_TEST_EQUAL(10U, group.GetEvents().size());
+        }
+    }
+
+    // empty groups are not pushed
+    coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup&) {});
+    coalescer.FlushAll();
+    APSARA_TEST_EQUAL(2U, mGroups.size());
+}
+
+void EventGroupCoalescerUnittest::TestFlushBySize() {
+    {
+        EventGroupCoalescer coalescer(Capture(), 10, 1024 * 1024, 60000);
+        for (int i = 0; i < 4; ++i) {
+            coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 3); });
+        }
+        APSARA_TEST_EQUAL(1U, mGroups.size());
+        APSARA_TEST_EQUAL(12U, mGroups[0].GetEvents().size());
+        APSARA_TEST_TRUE(coalescer.mGroups.empty());
+    }
+    mGroups.clear();
+    {
+        EventGroupCoalescer coalescer(Capture(), 1000, 1, 60000);
+        coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 1); });
+        APSARA_TEST_EQUAL(1U, mGroups.size());
+    }
+}
+
+void EventGroupCoalescerUnittest::TestFlushTimeout() {
+    EventGroupCoalescer coalescer(Capture(), 1000, 1024 * 1024, 50);
+    coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 1); });
+    coalescer.FlushTimeout();
+    APSARA_TEST_TRUE(mGroups.empty());
+
+    this_thread::sleep_for(chrono::milliseconds(100));
+    coalescer.Append("b", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 1); });
+    coalescer.FlushTimeout();
+    APSARA_TEST_EQUAL(1U, mGroups.size());
+    APSARA_TEST_EQUAL(1U, coalescer.mGroups.size());
+    APSARA_TEST_TRUE(coalescer.mGroups.find("b") != coalescer.mGroups.end());
+}
+
+void EventGroupCoalescerUnittest::TestDisabled() {
+    EventGroupCoalescer coalescer(Capture(), 1000, 1024 * 1024, 0);
+    coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 1); });
+    coalescer.Append("a", [](CoalescedGroup&) {}, [](CoalescedGroup& group) { AddLogs(group, 1); });
+    APSARA_TEST_EQUAL(2U, mGroups.size());
+    APSARA_TEST_TRUE(coalescer.mGroups.empty());
+}
+
+void EventGroupCoalescerUnittest::TestIntern() {
+    CoalescedGroup group(0);
+    auto s1 = group.Intern("value");
+    auto s2 = group.Intern(string("value"));
+    auto s3 = group.Intern("other");
+    APSARA_TEST_EQUAL(s1.data(), s2.data());
+    APSARA_TEST_NOT_EQUAL(s1.data(), s3.data());
+    APSARA_TEST_EQUAL("value", s1.to_string());
+
+    for (size_t i = 0; i < CoalescedGroup::sMaxInternedCnt; ++i) {
+        group.Intern("value" + to_string(i));
+    }
+    APSARA_TEST_EQUAL(CoalescedGroup::sMaxInternedCnt, group.mInterned.size());
+    // strings are still copied after the cap is reached
+    auto s4 = group.Intern("new");
+    APSARA_TEST_EQUAL("new", s4.to_string());
+    APSARA_TEST_NOT_EQUAL(s4.data(), group.Intern("new").data());
+}
+
+UNIT_TEST_CASE(EventGroupCoalescerUnittest, TestCoalesce)
+UNIT_TEST_CASE(EventGroupCoalescerUnittest, TestFlushBySize)
+UNIT_TEST_CASE(EventGroupCoalescerUnittest, TestFlushTimeout)
+UNIT_TEST_CASE(EventGroupCoalescerUnittest, TestDisabled)
+UNIT_TEST_CASE(EventGroupCoalescerUnittest, TestIntern)
+
+} // namespace ebpf
+} // namespace logtail
+
+UNIT_TEST_MAIN
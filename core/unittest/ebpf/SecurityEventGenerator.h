@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ebpf/include/export.h"
+
+namespace logtail {
+namespace ebpf {
+
+// Generates security events shaped like the ones reported by the process, file and network probes.
+class SecurityEventGenerator {
+public:
+    explicit SecurityEventGenerator(uint64_t startTimeNs = 1700000000000000000ULL) : mTimeNs(startTimeNs) {}
+
+    std::vector<std::unique_ptr<AbstractSecurityEvent>> Generate(SecureEventType type, size_t cnt) {
+        std::vector<std::unique_ptr<AbstractSecurityEvent>> events;
+        events.reserve(cnt);
+        for (size_t i = 0; i < cnt; ++i) {
+            std::vector<std::pair<std::string, std::string>> tags;
+            auto pid = std::to_string(1000 + mSeq % 50000);
+            tags.emplace_back("process.pid", pid);
+            tags.emplace_back("process.ppid", std::to_string(1 + mSeq % 1000));
+            tags.emplace_back("process.uid", "0");
+            tags.emplace_back("process.exec_id", "aG9zdG5hbWU6" + std::to_string(mTimeNs) + ":" + pid);
+            tags.emplace_back("process.binary", "/usr/bin/curl");
+            tags.emplace_back("process.arguments", "-s -o /dev/null http://example.com/api/v1/items?page=" + pid);
+            tags.emplace_back("process.cwd", "/home/admin/workspace");
+            tags.emplace_back("container.id", "3f4a1b2c9d8e7f60a1b2c3d4e5f60718293a4b5c6d7e8f90a1b2c3d4e5f60718");
+            tags.emplace_back("k8s.pod.name", "frontend-7c9f8d6b5-x2k4p");
+            tags.emplace_back("k8s.namespace", "default");
+            switch (type) {
+                case SecureEventType::SECURE_EVENT_TYPE_FILE_SECURE:
+                    tags.emplace_back("call_name", "security_file_permission");
+                    tags.emplace_back("file.path", "/etc/passwd");
+                    break;
+                case SecureEventType::SECURE_EVENT_TYPE_SOCKET_SECURE:
+                    tags.emplace_back("call_name", "tcp_connect");
+                    tags.emplace_back("network.saddr", "192.168.0.12");
+                    tags.emplace_back("network.daddr", "10.0.3." + std::to_string(mSeq % 255));
+                    tags.emplace_back("network.sport", std::to_string(30000 + mSeq % 30000));
+                    tags.emplace_back("network.dport", "443");
+                    break;
+                default:
+                    tags.emplace_back("call_name", "execve");
+                    tags.emplace_back("event_type", "execve");
+                    break;
+            }
+            events.emplace_back(std::make_unique<AbstractSecurityEvent>(std::move(tags), type, mTimeNs));
+            mTimeNs += 1000;
+            ++mSeq;
+        }
+        return events;
+    }
+
+private:
+    uint64_t mTimeNs;
+    uint64_t mSeq = 0;
+};
+
+} // namespace ebpf
+} // namespace logtail
@@ -0,0 +1,114 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/TimeUtil.h"
+#include "ebpf/handler/SecurityHandler.h"
+#include "models/PipelineEventGroup.h"
+#include "unittest/ebpf/SecurityEventGenerator.h"
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+// Cost of converting security events into event groups.
+class SecurityHandlerBenchmark {
+public:
+    explicit SecurityHandlerBenchmark(size_t batchSize) : mBatchSize(batchSize) {}
+
+    void TestCopy();
+    void TestBuildEventGroup();
+
+private:
+    vector<vector<unique_ptr<AbstractSecurityEvent>>> CreateBatches() const;
+
+    static const size_t sEventCnt = 1000000;
+    size_t mBatchSize;
+};
+
+vector<vector<unique_ptr<AbstractSecurityEvent>>> SecurityHandlerBenchmark::CreateBatches() const {
+    SecurityEventGenerator generator;
+    vector<vector<unique_ptr<AbstractSecurityEvent>>> batches;
+    for (size_t i = 0; i < sEventCnt / mBatchSize; ++i) {
+        batches.emplace_back(generator.Generate(SecureEventType::SECURE_EVENT_TYPE_SOCKET_SECURE, mBatchSize));
+    }
+    return batches;
+}
+
+// the way events were converted before, which copies all tags of each event twice
+void SecurityHandlerBenchmark::TestCopy() {
+    auto batches = CreateBatches();
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    for (auto& events : batches) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("host.ip"), string("192.168.0.12"));
+        group.SetTag(string("host.name"), string("host"));
+        for (auto& x : events) {
+            auto event = group.AddLogEvent();
+            vector<pair<string, string>> tags = x->GetAllTags();
+            for (auto& tag : tags) {
+                event->SetContent(tag.first, tag.second);
+            }
+            auto seconds = chrono::duration_cast<chrono::seconds>(chrono::nanoseconds(x->GetTimestamp()));
+            event->SetTimestamp(seconds.count(), x->GetTimestamp());
+        }
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMicroSeconds() - starttime;
+    printf("%s batch %zu costs %luus, %.0f events/s\n",
+           __func__,
+           mBatchSize,
+           timeelapsed,
+           sEventCnt * 1000000.0 / timeelapsed);
+}
+
+void SecurityHandlerBenchmark::TestBuildEventGroup() {
+    auto batches = CreateBatches();
+    SecurityHandler handler(nullptr, -1, 0);
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    for (auto& events : batches) {
+        auto group = handler.BuildEventGroup(events);
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMicroSeconds() - starttime;
+    printf("%s batch %zu costs %luus, %.0f events/s\n",
+           __func__,
+           mBatchSize,
+           timeelapsed,
+           sEventCnt * 1000000.0 / timeelapsed);
+}
+
+} // namespace ebpf
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    for (size_t batchSize : std::vector<size_t>{10, 100, 1000}) {
+        logtail::ebpf::SecurityHandlerBenchmark benchmark(batchSize);
+        benchmark.TestCopy();
+        benchmark.TestBuildEventGroup();
+    }
+    /* Result (-O2, 1000000 network security events with 15 tags):
+       TestCopy batch 10 costs 4397629us, 227395 events/s
+       TestBuildEventGroup batch 10 costs 3589788us, 278568 events/s
+       TestCopy batch 100 costs 4348575us, 229960 events/s
+       TestBuildEventGroup batch 100 costs 3619566us, 276276 events/s
+       TestCopy batch 1000 costs 4395803us, 227490 events/s
+       TestBuildEventGroup batch 1000 costs 3662490us, 273038 events/s
+     */
+    return 0;
+}
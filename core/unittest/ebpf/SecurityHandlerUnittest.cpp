@@ -0,0 +1,100 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ebpf/handler/SecurityHandler.h"
+#include "models/LogEvent.h"
+#include "unittest/Unittest.h"
+#include "unittest/ebpf/SecurityEventGenerator.h"
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+class SecurityHandlerUnittest : public testing::Test {
+public:
+    void TestBuildEventGroup();
+    void TestInternKey();
+};
+
+void SecurityHandlerUnittest::TestBuildEventGroup() {
+    SecurityHandler handler(nullptr, -1, 0);
+    SecurityEventGenerator generator;
+    auto events = generator.Generate(SecureEventType::SECURE_EVENT_TYPE_SOCKET_SECURE, 10);
+    auto group = handler.BuildEventGroup(events);
+
+    APSARA_TEST_EQUAL(2U, group.GetTags().size());
+    APSARA_TEST_TRUE(group.HasTag("host.ip"));
+    APSARA_TEST_TRUE(group.HasTag("host.name"));
+    APSARA_TEST_EQUAL(1U, group.GetRetainedSourceBuffers().size());
+    APSARA_TEST_EQUAL(handler.mKeyBuffer, group.GetRetainedSourceBuffers()[0]);
+    APSARA_TEST_EQUAL(events.size(), group.GetEvents().size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        const auto& logEvent = group.GetEvents()[i].Cast<LogEvent>();
+        const auto& tags = events[i]->GetAllTags();
+        APSARA_TEST_EQUAL(tags.size(), logEvent.Size());
+        for (const auto& tag : tags) {
+            APSARA_TEST_EQUAL(tag.second, logEvent.GetContent(tag.first).to_string());
+        }
+        APSARA_TEST_EQUAL(static_cast<time_t>(events[i]->GetTimestamp() / 1000000000), logEvent.GetTimestamp());
+    }
+
+    // values are independent of the original events
+    events.clear();
+    APSARA_TEST_EQUAL("443", group.GetEvents()[0].Cast<LogEvent>().GetContent("network.dport").to_string());
+}
+
+void SecurityHandlerUnittest::TestInternKey() {
+    SecurityHandler handler(nullptr, -1, 0);
+    SecurityEventGenerator generator;
+    auto events = generator.Generate(SecureEventType::SECURE_EVENT_TYPE_PROCESS_SECURE, 2);
+    auto group1 = handler.BuildEventGroup(events);
+    auto group2 = handler.BuildEventGroup(events);
+    size_t keyCnt = handler.mKeys.size();
+    APSARA_TEST_EQUAL(events[0]->GetAllTags().size(), keyCnt);
+    // keys are shared by all groups
+    for (const auto& kv1 : group1.GetEvents()[0].Cast<LogEvent>()) {
+        bool found = false;
+        for (const auto& kv2 : group2.GetEvents()[1].Cast<LogEvent>()) {
+            if (kv1.first == kv2.first) {
+                APSARA_TEST_EQUAL(kv1.first.data(), kv2.first.data());
+                found = true;
+            }
+        }
+        APSARA_TEST_TRUE(found);
+    }
+
+    // keys beyond the limit are copied into the group
+    for (size_t i = keyCnt; i < SecurityHandler::sMaxKeyCnt; ++i) {
+        APSARA_TEST_FALSE(handler.InternKey("key_" + to_string(i)).empty());
+    }
+    vector<unique_ptr<AbstractSecurityEvent>> overflow;
+    overflow.emplace_back(make_unique<AbstractSecurityEvent>(
+        vector<pair<string, string>>{{"new_key", "value"}}, SecureEventType::SECURE_EVENT_TYPE_PROCESS_SECURE, 0));
+    auto group3 = handler.BuildEventGroup(overflow);
+    APSARA_TEST_EQUAL(SecurityHandler::sMaxKeyCnt, handler.mKeys.size());
+    APSARA_TEST_EQUAL("value", group3.GetEvents()[0].Cast<LogEvent>().GetContent("new_key").to_string());
+}
+
+UNIT_TEST_CASE(SecurityHandlerUnittest, TestBuildEventGroup)
+UNIT_TEST_CASE(SecurityHandlerUnittest, TestInternKey)
+
+} // namespace ebpf
+} // namespace logtail
+
+UNIT_TEST_MAIN
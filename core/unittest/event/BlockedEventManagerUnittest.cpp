@@ -0,0 +1,160 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "file_server/event/BlockEventManager.h"
+#include "file_server/polling/PollingEventQueue.h"
+#include "pipeline/PipelineContext.h"
+#include "pipeline/queue/ProcessQueueManager.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class BlockedEventManagerUnittest : public testing::Test {
+public:
+    void TestFeedback();
+    void TestGetTimeoutEvent();
+    void TestUpdateBlockEvent();
+
+protected:
+    static void SetUpTestCase() {
+        // queue 1 is always valid to push, while queue 2 does not exist
+        ProcessQueueManager::GetInstance()->CreateOrUpdateCircularQueue(sValidKey, 0, 10, sCtx);
+    }
+
+    static void TearDownTestCase() {
+        ProcessQueueManager::GetInstance()->Clear();
+        QueueKeyManager::GetInstance()->Clear();
+    }
+
+    void TearDown() override {
+        auto manager = BlockedEventManager::GetInstance();
+        for (auto& item : manager->mBlockEventMap) {
+            delete item.second.mEvent;
+        }
+        manager->mBlockEventMap.clear();
+        manager->mQueueIndex.clear();
+        manager->mDeadlineIndex.clear();
+        PollingEventQueue::GetInstance()->Clear();
+    }
+
+    void AddEvent(QueueKey key, const string& object, int32_t curTime) {
+        Event event("/tmp", object, EVENT_MODIFY, -1, 0, 1, mInode++);
+        BlockedEventManager::GetInstance()->UpdateBlockEvent(
+            key, "config", event, DevInode(event.GetDev(), event.GetInode()), curTime);
+    }
+
+    static constexpr QueueKey sValidKey = 1;
+    static constexpr QueueKey sInvalidKey = 2;
+    static PipelineContext sCtx;
+    uint64_t mInode = 1;
+};
+
+PipelineContext BlockedEventManagerUnittest::sCtx;
+
+void BlockedEventManagerUnittest::TestFeedback() {
+    auto manager = BlockedEventManager::GetInstance();
+    int32_t now = time(nullptr);
+    AddEvent(sValidKey, "a.log", now);
+    AddEvent(sValidKey, "b.log", now);
+    AddEvent(sInvalidKey, "c.log", now);
+    APSARA_TEST_EQUAL(3U, manager->mBlockEventMap.size());
+    APSARA_TEST_EQUAL(2U, manager->mQueueIndex.size());
+    APSARA_TEST_EQUAL(3U, manager->mDeadlineIndex.size());
+
+    manager->Feedback(sValidKey);
+    APSARA_TEST_EQUAL(1U, manager->mBlockEventMap.size());
+    APSARA_TEST_EQUAL(1U, manager->mQueueIndex.size());
+    APSARA_TEST_EQUAL(1U, manager->mQueueIndex[sInvalidKey].size());
+    APSARA_TEST_EQUAL(1U, manager->mDeadlineIndex.size());
+    APSARA_TEST_EQUAL("c.log", manager->mBlockEventMap.begin()->second.mEvent->GetObject());
+
+    // feedback of a queue without blocked events
+    manager->Feedback(3);
+    APSARA_TEST_EQUAL(1U, manager->mBlockEventMap.size());
+
+    // stale index entries left by modifying the map directly are skipped
+    delete manager->mBlockEventMap.begin()->second.mEvent;
+    manager->mBlockEventMap.clear();
+    manager->Feedback(sInvalidKey);
+    APSARA_TEST_TRUE(manager->mQueueIndex.empty());
+    vector<Event*> eventVec;
+    manager->GetTimeoutEvent(eventVec, now + 3600);
+    APSARA_TEST_TRUE(eventVec.empty());
+    APSARA_TEST_TRUE(manager->mDeadlineIndex.empty());
+}
+
+void BlockedEventManagerUnittest::TestGetTimeoutEvent() {
+    auto manager = BlockedEventManager::GetInstance();
+    int32_t now = time(nullptr);
+    AddEvent(sValidKey, "a.log", now);
+    AddEvent(sInvalidKey, "b.log", now);
+    // timeout = 1s
+    int32_t deadline = manager->mDeadlineIndex.begin()->first;
+
+    vector<Event*> eventVec;
+    manager->GetTimeoutEvent(eventVec, deadline - 1);
+    APSARA_TEST_TRUE(eventVec.empty());
+
+    manager->GetTimeoutEvent(eventVec, deadline);
+    APSARA_TEST_EQUAL(1U, eventVec.size());
+    APSARA_TEST_EQUAL("a.log", eventVec[0]->GetObject());
+    delete eventVec[0];
+    // the event blocked by invalid queue is delayed
+    APSARA_TEST_EQUAL(1U, manager->mBlockEventMap.size());
+    APSARA_TEST_EQUAL(1U, manager->mDeadlineIndex.size());
+    APSARA_TEST_TRUE(manager->mDeadlineIndex.begin()->first > deadline);
+    APSARA_TEST_EQUAL(manager->mBlockEventMap.begin()->second.GetDeadline(), manager->mDeadlineIndex.begin()->first);
+    APSARA_TEST_EQUAL(0U, manager->mQueueIndex.count(sValidKey));
+    APSARA_TEST_EQUAL(1U, manager->mQueueIndex[sInvalidKey].size());
+}
+
+void BlockedEventManagerUnittest::TestUpdateBlockEvent() {
+    auto manager = BlockedEventManager::GetInstance();
+    int32_t now = time(nullptr);
+    Event event("/tmp", "a.log", EVENT_MODIFY, -1, 0, 1, 1);
+    DevInode devInode(1, 1);
+    manager->UpdateBlockEvent(sInvalidKey, "config", event, devInode, now);
+    // the same file blocked by another queue is reindexed
+    manager->UpdateBlockEvent(sValidKey, "config", event, devInode, now + 2);
+    APSARA_TEST_EQUAL(1U, manager->mBlockEventMap.size());
+    APSARA_TEST_EQUAL(0U, manager->mQueueIndex.count(sInvalidKey));
+    APSARA_TEST_EQUAL(1U, manager->mQueueIndex[sValidKey].size());
+    APSARA_TEST_EQUAL(1U, manager->mDeadlineIndex.size());
+    APSARA_TEST_EQUAL(manager->mBlockEventMap.begin()->second.GetDeadline(), manager->mDeadlineIndex.begin()->first);
+
+    // flush timeout event does not cover normal event
+    Event timeoutEvent("/tmp", "a.log", EVENT_MODIFY | EVENT_READER_FLUSH_TIMEOUT, -1, 0, 1, 1);
+    manager->UpdateBlockEvent(sInvalidKey, "config", timeoutEvent, devInode, now + 3);
+    APSARA_TEST_FALSE(manager->mBlockEventMap.begin()->second.mEvent->IsReaderFlushTimeout());
+    APSARA_TEST_EQUAL(1U, manager->mQueueIndex[sValidKey].size());
+    APSARA_TEST_EQUAL(1U, manager->mDeadlineIndex.size());
+
+    manager->Feedback(sValidKey);
+    APSARA_TEST_TRUE(manager->mBlockEventMap.empty());
+    APSARA_TEST_TRUE(manager->mDeadlineIndex.empty());
+}
+
+UNIT_TEST_CASE(BlockedEventManagerUnittest, TestFeedback)
+UNIT_TEST_CASE(BlockedEventManagerUnittest, TestGetTimeoutEvent)
+UNIT_TEST_CASE(BlockedEventManagerUnittest, TestUpdateBlockEvent)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,89 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "common/FileSystemUtil.h"
+#include "runner/sink/file/RecordFile.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Batches of the size produced by flusher_file are appended to a record file, and the file is synced once per round
+// as the file sink does. The sustained throughput, including fdatasync and file rotation, is measured against the
+// target of 500MB/s.
+class FlusherFileBenchmark : public ::testing::Test {
+public:
+    void TestThroughput();
+
+protected:
+    void SetUp() override {
+        mDir = (bfs::path(GetProcessExecutionDir()) / "FlusherFileBenchmark").string();
+        bfs::remove_all(mDir);
+        bfs::create_directories(mDir);
+    }
+
+    void TearDown() override { bfs::remove_all(mDir); }
+
+private:
+    static const size_t sPayloadSize = 256 * 1024;
+    // number of batches appended before each sync, i.e. the batches available to the file sink in one round
+    static const size_t sBatchesPerRound = 16;
+    static const size_t sRoundCnt = 256;
+    static const uint64_t sMaxFileSize = 256 * 1024 * 1024;
+    static constexpr double sTargetBytesPerSec = 500.0 * 1024 * 1024;
+
+    string mDir;
+};
+
+void FlusherFileBenchmark::TestThroughput() {
+    string payload(sPayloadSize, '\0');
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<char>(i * 131 + i / 7);
+    }
+
+    RecordFileWriter writer(mDir, "benchmark", sMaxFileSize, 0);
+    string errorMsg;
+    auto start = chrono::steady_clock::now();
+    for (size_t round = 0; round < sRoundCnt; ++round) {
+        for (size_t i = 0; i < sBatchesPerRound; ++i) {
+            ASSERT_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg))
+                << errorMsg;
+        }
+        ASSERT_TRUE(writer.Sync(errorMsg)) << errorMsg;
+    }
+    ASSERT_TRUE(writer.Seal(errorMsg)) << errorMsg;
+    auto end = chrono::steady_clock::now();
+
+    double totalSecs = chrono::duration<double>(end - start).count();
+    size_t totalBytes = sRoundCnt * sBatchesPerRound * sPayloadSize;
+    printf("%s %zu bytes in %zu syncs, written in %.3fs, %.1f MB/s, target %.1f MB/s %s\n",
+           __func__,
+           totalBytes,
+           sRoundCnt,
+           totalSecs,
+           totalBytes / totalSecs / 1024 / 1024,
+           sTargetBytesPerSec / 1024 / 1024,
+           totalBytes / totalSecs >= sTargetBytesPerSec ? "met" : "not met");
+}
+
+UNIT_TEST_CASE(FlusherFileBenchmark, TestThroughput)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,409 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/FileSystemUtil.h"
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "pipeline/PipelineContext.h"
+#include "pipeline/batch/TimeoutFlushManager.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "pipeline/queue/SenderQueueManager.h"
+#include "plugin/flusher/file/FlusherFile.h"
+#include "protobuf/sls/sls_logs.pb.h"
+#include "runner/sink/file/FileSink.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherFileUnittest : public testing::Test {
+public:
+    void OnSuccessfulInit();
+    void OnFailedInit();
+    void TestSharedWriter();
+    void TestSend();
+    void TestSendOTLPMixedGroup();
+    void TestWriteToFile();
+    void TestWriteFailure();
+    void TestWriteFailureAfterRotation();
+
+protected:
+    void SetUp() override {
+        ctx.SetConfigName("test_config");
+        mDir = (bfs::path(GetProcessExecutionDir()) / "FlusherFileUnittest").string();
+        bfs::remove_all(mDir);
+    }
+
+    void TearDown() override {
+        TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+        bfs::remove_all(mDir);
+        bfs::remove_all(mDir + ".bak");
+    }
+
+private:
+    unique_ptr<FlusherFile> CreateFlusher(const string& configStr, bool expectedRes = true) {
+        Json::Value configJson, optionalGoPipeline;
+        string errorMsg;
+        EXPECT_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        auto flusher = make_unique<FlusherFile>();
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef(FlusherFile::sName, "1");
+        EXPECT_EQ(expectedRes, flusher->Init(configJson, optionalGoPipeline));
+        EXPECT_TRUE(optionalGoPipeline.isNull());
+        return flusher;
+    }
+
+    void SendLog(FlusherFile& flusher, const string& content) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1234567890);
+        e->SetContent(string("content"), content);
+        APSARA_TEST_TRUE(flusher.Send(std::move(group)));
+        APSARA_TEST_TRUE(flusher.FlushAll());
+    }
+
+    // hands the available items to the file sink and waits until they are all done
+    bool WriteAvailableItems(FlusherFile& flusher) {
+        vector<SenderQueueItem*> items;
+        SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+        for (auto item : items) {
+            FileSink::GetInstance()->AddRequest(flusher.BuildRequest(item));
+        }
+        for (size_t i = 0; i < 500; ++i) {
+            if (FileSink::GetInstance()->mQueue.Empty() && SenderQueueManager::GetInstance()->IsAllQueueEmpty()) {
+                return true;
+            }
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    PipelineContext ctx;
+    string mDir;
+};
+
+void FlusherFileUnittest::OnSuccessfulInit() {
+    // only mandatory param
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                 + mDir + R"("
+        }
+    )");
+    APSARA_TEST_EQUAL(mDir, flusher->mDirectory);
+    APSARA_TEST_EQUAL("test_config", flusher->mFilePrefix);
+    APSARA_TEST_EQUAL(256U, flusher->mMaxFileSizeMB);
+    APSARA_TEST_EQUAL(3600U, flusher->mRotateIntervalSecs);
+    APSARA_TEST_EQUAL("sls", flusher->mFormat);
+    APSARA_TEST_EQUAL(CompressType::NONE, flusher->GetCompressType());
+    APSARA_TEST_NOT_EQUAL(nullptr, flusher->mWriter);
+    APSARA_TEST_EQUAL(
+        QueueKeyManager::GetInstance()->GetKey("test_config-flusher_file-" + PathJoin(mDir, "test_config")),
+        flusher->GetQueueKey());
+    APSARA_TEST_NOT_EQUAL(nullptr, SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
+    // no file is created until data arrives
+    APSARA_TEST_FALSE(bfs::exists(mDir));
+
+    // valid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                            + mDir + R"(",
+            "FilePrefix": "archive",
+            "MaxFileSizeMB": 64,
+            "RotateIntervalSecs": 0,
+            "Format": "otlp",
+            "CompressType": "zstd"
+        }
+    )");
+    APSARA_TEST_EQUAL("archive", flusher->mFilePrefix);
+    APSARA_TEST_EQUAL(64U, flusher->mMaxFileSizeMB);
+    APSARA_TEST_EQUAL(0U, flusher->mRotateIntervalSecs);
+    APSARA_TEST_EQUAL("otlp", flusher->mFormat);
+    APSARA_TEST_EQUAL(CompressType::ZSTD, flusher->GetCompressType());
+
+    // invalid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                            + mDir + R"(",
+            "FilePrefix": true,
+            "MaxFileSizeMB": 0,
+            "RotateIntervalSecs": "60",
+            "Format": "json",
+            "CompressType": "snappy"
+        }
+    )");
+    APSARA_TEST_EQUAL("test_config", flusher->mFilePrefix);
+    APSARA_TEST_EQUAL(256U, flusher->mMaxFileSizeMB);
+    APSARA_TEST_EQUAL(3600U, flusher->mRotateIntervalSecs);
+    APSARA_TEST_EQUAL("sls", flusher->mFormat);
+    APSARA_TEST_EQUAL(CompressType::NONE, flusher->GetCompressType());
+}
+
+void FlusherFileUnittest::OnFailedInit() {
+    CreateFlusher(R"(
+        {
+            "Type": "flusher_file"
+        }
+    )",
+                  false);
+    CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                      + mDir + R"(",
+            "FilePrefix": "sub/archive"
+        }
+    )",
+                  false);
+}
+
+void FlusherFileUnittest::TestSharedWriter() {
+    string configStr = R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+        + mDir + R"(",
+            "MaxFileSizeMB": 1
+        }
+    )";
+    auto flusher1 = CreateFlusher(configStr);
+    auto flusher2 = CreateFlusher(configStr);
+    APSARA_TEST_EQUAL(flusher1->mWriter, flusher2->mWriter);
+
+    // a flusher with different options, e.g. a new version of the config, has its own writer
+    auto flusher3 = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                  + mDir + R"(",
+            "MaxFileSizeMB": 2
+        }
+    )");
+    APSARA_TEST_NOT_EQUAL(flusher1->mWriter, flusher3->mWriter);
+}
+
+void FlusherFileUnittest::TestSend() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                 + mDir + R"(",
+            "CompressType": "lz4"
+        }
+    )");
+    SendLog(*flusher, "hello");
+
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(1U, res.size());
+    APSARA_TEST_EQUAL(flusher.get(), res[0]->mFlusher);
+    APSARA_TEST_EQUAL(flusher->GetQueueKey(), res[0]->mQueueKey);
+    APSARA_TEST_EQUAL(SinkType::FILE, flusher->GetSinkType());
+
+    auto request = flusher->BuildRequest(res[0]);
+    APSARA_TEST_EQUAL(res[0], request->mItem);
+    APSARA_TEST_EQUAL(flusher->mWriter, request->mWriter);
+    APSARA_TEST_EQUAL(CompressType::LZ4, request->mCompressType);
+    APSARA_TEST_EQUAL(RecordDataType::SLS_LOG_GROUP, request->mDataType);
+
+    // failed writes are retried
+    flusher->OnWriteDone(false, "disk full", res[0]);
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(2U, res[0]->mTryCnt);
+    flusher->OnWriteDone(true, "", res[0]);
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+}
+
+void FlusherFileUnittest::TestSendOTLPMixedGroup() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                 + mDir + R"(",
+            "Format": "otlp"
+        }
+    )");
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.AddLogEvent()->SetContent(string("content"), string("hello"));
+    auto metric = group.AddMetricEvent();
+    metric->SetName("cpu_usage");
+    metric->SetValue(UntypedSingleValue{0.5});
+    group.AddLogEvent()->SetContent(string("content"), string("world"));
+    APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+
+    // one record per signal, and no event is dropped
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(2U, res.size());
+    vector<RecordDataType> types;
+    for (auto item : res) {
+        auto request = flusher->BuildRequest(item);
+        types.emplace_back(request->mDataType);
+        if (request->mDataType == RecordDataType::OTLP_LOGS) {
+            APSARA_TEST_NOT_EQUAL(string::npos, item->mData.find("hello"));
+            APSARA_TEST_NOT_EQUAL(string::npos, item->mData.find("world"));
+        } else {
+            APSARA_TEST_NOT_EQUAL(string::npos, item->mData.find("cpu_usage"));
+        }
+    }
+    sort(types.begin(), types.end());
+    APSARA_TEST_EQUAL(RecordDataType::OTLP_LOGS, types[0]);
+    APSARA_TEST_EQUAL(RecordDataType::OTLP_METRICS, types[1]);
+}
+
+void FlusherFileUnittest::TestWriteToFile() {
+    APSARA_TEST_TRUE(FileSink::GetInstance()->Init());
+    {
+        auto flusher = CreateFlusher(R"(
+            {
+                "Type": "flusher_file",
+                "Directory": ")"
+                                     + mDir + R"(",
+                "FilePrefix": "archive",
+                "CompressType": "zstd"
+            }
+        )");
+        SendLog(*flusher, "hello");
+        SendLog(*flusher, "world");
+        APSARA_TEST_TRUE(WriteAvailableItems(*flusher));
+    }
+    // the file is sealed when the sink stops
+    FileSink::GetInstance()->Stop();
+    vector<string> files;
+    for (bfs::directory_iterator it(mDir); it != bfs::directory_iterator(); ++it) {
+        files.emplace_back(it->path().filename().string());
+    }
+    APSARA_TEST_EQUAL(1U, files.size());
+    APSARA_TEST_TRUE(StartWith(files[0], "archive-"));
+    APSARA_TEST_TRUE(EndWith(files[0], ".rec"));
+
+    vector<Record> records;
+    uint64_t validSize = 0;
+    string errorMsg;
+    APSARA_TEST_TRUE(ReadRecordFile(PathJoin(mDir, files[0]), records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(2U, records.size());
+    auto compressor = CompressorFactory::GetInstance()->Create(CompressType::ZSTD);
+    vector<string> contents;
+    for (const auto& record : records) {
+        APSARA_TEST_EQUAL(CompressType::ZSTD, record.mCompressType);
+        APSARA_TEST_EQUAL(RecordDataType::SLS_LOG_GROUP, record.mDataType);
+        string data;
+        data.resize(record.mRawSize);
+        APSARA_TEST_TRUE(compressor->UnCompress(record.mData, data, errorMsg));
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_TRUE(logGroup.ParseFromString(data));
+        APSARA_TEST_EQUAL(1, logGroup.logs_size());
+        APSARA_TEST_EQUAL(1234567890U, logGroup.logs(0).time());
+        APSARA_TEST_EQUAL("content", logGroup.logs(0).contents(0).key());
+        contents.emplace_back(logGroup.logs(0).contents(0).value());
+    }
+    sort(contents.begin(), contents.end());
+    APSARA_TEST_EQUAL(vector<string>({"hello", "world"}), contents);
+}
+
+void FlusherFileUnittest::TestWriteFailure() {
+    // the directory cannot be created under a regular file
+    bfs::create_directories(mDir);
+    { ofstream(PathJoin(mDir, "file")) << "content"; }
+
+    APSARA_TEST_TRUE(FileSink::GetInstance()->Init());
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                 + PathJoin(PathJoin(mDir, "file"), "sub") + R"("
+        }
+    )");
+    SendLog(*flusher, "hello");
+    vector<SenderQueueItem*> items;
+    SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+    APSARA_TEST_EQUAL(1U, items.size());
+    auto item = items[0];
+    FileSink::GetInstance()->AddRequest(flusher->BuildRequest(item));
+    for (size_t i = 0; i < 500 && item->mTryCnt == 1; ++i) {
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    // the item is kept for retry
+    APSARA_TEST_EQUAL(2U, item->mTryCnt);
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    FileSink::GetInstance()->Stop();
+}
+
+void FlusherFileUnittest::TestWriteFailureAfterRotation() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_file",
+            "Directory": ")"
+                                 + mDir + R"(",
+            "MaxFileSizeMB": 1
+        }
+    )");
+    // two items do not fit in one file
+    SendLog(*flusher, string(600 * 1024, 'a'));
+    SendLog(*flusher, string(600 * 1024, 'b'));
+    vector<SenderQueueItem*> items;
+    SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+    APSARA_TEST_EQUAL(2U, items.size());
+
+    string errorMsg;
+    APSARA_TEST_TRUE(flusher->mWriter->Append("open", CompressType::NONE, RecordDataType::UNKNOWN, 4, errorMsg));
+    APSARA_TEST_TRUE(flusher->mWriter->Sync(errorMsg));
+    // the current file stays writable, but no new file can be created after rotation
+    bfs::rename(mDir, mDir + ".bak");
+    { ofstream(mDir) << "content"; }
+
+    vector<unique_ptr<FileSinkRequest>> requests;
+    for (auto item : items) {
+        requests.emplace_back(flusher->BuildRequest(item));
+    }
+    auto second = items[1];
+    APSARA_TEST_FALSE(FileSink::GetInstance()->WriteRequests(requests));
+    // the first item is synced by the rotation, so only the second one is kept for retry
+    APSARA_TEST_EQUAL(2U, second->mTryCnt);
+    items.clear();
+    SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+    APSARA_TEST_EQUAL(1U, items.size());
+    APSARA_TEST_EQUAL(second, items[0]);
+}
+
+UNIT_TEST_CASE(FlusherFileUnittest, OnSuccessfulInit)
+UNIT_TEST_CASE(FlusherFileUnittest, OnFailedInit)
+UNIT_TEST_CASE(FlusherFileUnittest, TestSharedWriter)
+UNIT_TEST_CASE(FlusherFileUnittest, TestSend)
+UNIT_TEST_CASE(FlusherFileUnittest, TestSendOTLPMixedGroup)
+UNIT_TEST_CASE(FlusherFileUnittest, TestWriteToFile)
+UNIT_TEST_CASE(FlusherFileUnittest, TestWriteFailure)
+UNIT_TEST_CASE(FlusherFileUnittest, TestWriteFailureAfterRotation)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,289 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/http/Curl.h"
+#include "pipeline/PipelineContext.h"
+#include "pipeline/queue/OTLPSenderQueueItem.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "pipeline/queue/SenderQueueManager.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "unittest/Unittest.h"
+#include "unittest/flusher/StubHttpReceiver.h"
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherOTLPUnittest : public testing::Test {
+public:
+    void OnSuccessfulInit();
+    void OnFailedInit();
+    void TestSend();
+    void TestSendMixedGroup();
+    void TestSendToReceiver();
+
+protected:
+    void SetUp() override { ctx.SetConfigName("test_config"); }
+
+    void TearDown() override {
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+    }
+
+private:
+    unique_ptr<FlusherOTLP> CreateFlusher(const string& configStr, bool expectedRes = true) {
+        Json::Value configJson, optionalGoPipeline;
+        string errorMsg;
+        EXPECT_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        auto flusher = make_unique<FlusherOTLP>();
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef(FlusherOTLP::sName, "1");
+        EXPECT_EQ(expectedRes, flusher->Init(configJson, optionalGoPipeline));
+        EXPECT_TRUE(optionalGoPipeline.isNull());
+        return flusher;
+    }
+
+    PipelineContext ctx;
+};
+
+void FlusherOTLPUnittest::OnSuccessfulInit() {
+    // only mandatory param
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "localhost:4318"
+        }
+    )");
+    APSARA_TEST_EQUAL("localhost:4318", flusher->mEndpoint);
+    APSARA_TEST_FALSE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL("localhost", flusher->mHost);
+    APSARA_TEST_EQUAL(4318, flusher->mPort);
+    APSARA_TEST_EQUAL("", flusher->mPathPrefix);
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+    APSARA_TEST_EQUAL(CompressType::NONE, flusher->GetCompressType());
+    APSARA_TEST_TRUE(flusher->mGroupSerializer);
+    APSARA_TEST_EQUAL(QueueKeyManager::GetInstance()->GetKey("test_config-flusher_otlp_native-localhost:4318"),
+                      flusher->GetQueueKey());
+    APSARA_TEST_NOT_EQUAL(nullptr, SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
+
+    // valid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "https://collector/otel/",
+            "Headers": {
+                "Authorization": "Bearer token"
+            },
+            "CompressType": "zstd"
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL("collector", flusher->mHost);
+    APSARA_TEST_EQUAL(443, flusher->mPort);
+    APSARA_TEST_EQUAL("/otel", flusher->mPathPrefix);
+    APSARA_TEST_EQUAL(1U, flusher->mHeaders.size());
+    APSARA_TEST_EQUAL("Bearer token", flusher->mHeaders["Authorization"]);
+    APSARA_TEST_EQUAL(CompressType::ZSTD, flusher->GetCompressType());
+
+    // invalid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "http://collector",
+            "Headers": true,
+            "CompressType": "lz4"
+        }
+    )");
+    APSARA_TEST_EQUAL(80, flusher->mPort);
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+    APSARA_TEST_EQUAL(CompressType::NONE, flusher->GetCompressType());
+}
+
+void FlusherOTLPUnittest::OnFailedInit() {
+    CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native"
+        }
+    )",
+                  false);
+    for (const string& endpoint : {"", "grpc://collector:4317", "http://:4318", "http://collector:port", "collector:0"}) {
+        CreateFlusher(R"(
+            {
+                "Type": "flusher_otlp_native",
+                "Endpoint": ")"
+                          + endpoint + R"("
+            }
+        )",
+                      false);
+    }
+}
+
+void FlusherOTLPUnittest::TestSend() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "http://localhost:4318"
+        }
+    )");
+    {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.AddLogEvent()->SetContent(string("content"), string("hello"));
+        APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    }
+    {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("service.name"), string("test"));
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+        e->SetSpanId("0102030405060708");
+        e->SetName("span");
+        APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    }
+    APSARA_TEST_TRUE(flusher->FlushAll());
+
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(2U, res.size());
+    vector<string> paths;
+    for (auto item : res) {
+        APSARA_TEST_EQUAL(flusher.get(), item->mFlusher);
+        APSARA_TEST_EQUAL(flusher->GetQueueKey(), item->mQueueKey);
+        APSARA_TEST_EQUAL(item->mData.size(), item->mRawSize);
+        paths.emplace_back(static_cast<OTLPSenderQueueItem*>(item)->mPath);
+    }
+    sort(paths.begin(), paths.end());
+    APSARA_TEST_EQUAL("/v1/logs", paths[0]);
+    APSARA_TEST_EQUAL("/v1/traces", paths[1]);
+}
+
+void FlusherOTLPUnittest::TestSendMixedGroup() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "http://localhost:4318"
+        }
+    )");
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("service.name"), string("test"));
+    group.AddLogEvent()->SetContent(string("content"), string("hello"));
+    auto metric = group.AddMetricEvent();
+    metric->SetName("cpu_usage");
+    metric->SetValue(UntypedSingleValue{0.5});
+    auto span = group.AddSpanEvent();
+    span->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+    span->SetSpanId("0102030405060708");
+    span->SetName("span");
+    group.AddLogEvent()->SetContent(string("content"), string("world"));
+    APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+
+    // one request per signal, and no event is dropped
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(3U, res.size());
+    vector<string> paths;
+    for (auto item : res) {
+        APSARA_TEST_FALSE(item->mData.empty());
+        paths.emplace_back(static_cast<OTLPSenderQueueItem*>(item)->mPath);
+    }
+    sort(paths.begin(), paths.end());
+    APSARA_TEST_EQUAL("/v1/logs", paths[0]);
+    APSARA_TEST_EQUAL("/v1/metrics", paths[1]);
+    APSARA_TEST_EQUAL("/v1/traces", paths[2]);
+    for (auto item : res) {
+        if (static_cast<OTLPSenderQueueItem*>(item)->mPath == "/v1/logs") {
+            APSARA_TEST_NOT_EQUAL(string::npos, item->mData.find("hello"));
+            APSARA_TEST_NOT_EQUAL(string::npos, item->mData.find("world"));
+        }
+    }
+}
+
+void FlusherOTLPUnittest::TestSendToReceiver() {
+    StubHttpReceiver receiver;
+    APSARA_TEST_TRUE(receiver.Start());
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_otlp_native",
+            "Endpoint": "http://127.0.0.1:)"
+                                 + ToString(receiver.mPort) + R"(/prefix",
+            "Headers": {
+                "X-Test": "value"
+            }
+        }
+    )");
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    auto e = group.AddMetricEvent();
+    e->SetName("cpu_usage");
+    e->SetTimestamp(1234567890);
+    e->SetValue(UntypedSingleValue{0.5});
+    APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+
+    auto sendOnce = [&](int32_t statusCode) {
+        receiver.mStatusCode = statusCode;
+        vector<SenderQueueItem*> res;
+        SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+        APSARA_TEST_EQUAL(1U, res.size());
+        string data = res[0]->mData;
+        auto request = flusher->BuildRequest(res[0]);
+        HttpResponse response;
+        APSARA_TEST_TRUE(SendHttpRequest(unique_ptr<HttpRequest>(request.release()), response));
+        APSARA_TEST_EQUAL(statusCode, response.mStatusCode);
+        flusher->OnSendDone(response, res[0]);
+
+        auto requests = receiver.GetRequests();
+        const auto& last = requests.back();
+        APSARA_TEST_TRUE(StartWith(last.mHead, "POST /prefix/v1/metrics "));
+        auto head = ToLowerCaseString(last.mHead);
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("content-type: application/x-protobuf"));
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("x-test: value"));
+        APSARA_TEST_EQUAL(data, last.mBody);
+        return requests.size();
+    };
+
+    // retryable status keeps the item
+    APSARA_TEST_EQUAL(1U, sendOnce(503));
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(2U, sendOnce(200));
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    // non-retryable status discards the item
+    group = PipelineEventGroup(make_shared<SourceBuffer>());
+    e = group.AddMetricEvent();
+    e->SetName("cpu_usage");
+    e->SetValue(UntypedSingleValue{1.0});
+    APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+    APSARA_TEST_EQUAL(3U, sendOnce(400));
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    receiver.Stop();
+}
+
+UNIT_TEST_CASE(FlusherOTLPUnittest, OnSuccessfulInit)
+UNIT_TEST_CASE(FlusherOTLPUnittest, OnFailedInit)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestSend)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestSendMixedGroup)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestSendToReceiver)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
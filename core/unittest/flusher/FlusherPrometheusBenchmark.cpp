@@ -0,0 +1,179 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/http/Curl.h"
+#include "logger/Logger.h"
+#include "pipeline/batch/TimeoutFlushManager.h"
+#include "pipeline/queue/SenderQueueManager.h"
+#include "plugin/flusher/prometheus/FlusherPrometheus.h"
+#include "unittest/flusher/StubHttpReceiver.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Scraped samples are sent by several processing threads into one flusher_prometheus_native, while several sending
+// threads drain the sender queues into a local stub receiver. The whole path, i.e. grouping by series, serialization,
+// snappy compression and http, is measured against the target of 1M samples/s.
+class FlusherPrometheusBenchmark {
+public:
+    FlusherPrometheusBenchmark() {
+        mCtx.SetConfigName("test_config");
+        mReceiver.mKeepRequests = false;
+    }
+
+    void TestThroughput();
+
+private:
+    static const size_t sProducerCnt = 4;
+    static const size_t sSenderCnt = 4;
+    // each group is a scrape of one target, which has sSeriesPerTarget series
+    static const size_t sTargetCnt = 100;
+    static const size_t sSeriesPerTarget = 1000;
+    static const size_t sScrapeCnt = 10;
+    static constexpr double sTargetSamplesPerSec = 1000000.0;
+
+    PipelineContext mCtx;
+    StubHttpReceiver mReceiver;
+};
+
+void FlusherPrometheusBenchmark::TestThroughput() {
+    if (!mReceiver.Start()) {
+        printf("%s failed to start receiver\n", __func__);
+        return;
+    }
+    Json::Value configJson, optionalGoPipeline;
+    string errorMsg;
+    ParseJsonTable(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://127.0.0.1:)"
+                       + ToString(mReceiver.mPort) + R"(/api/v1/write",
+            "ShardCount": 4,
+            "Batch": {
+                "MaxCnt": 2000
+            }
+        }
+    )",
+                   configJson,
+                   errorMsg);
+    FlusherPrometheus flusher;
+    flusher.SetContext(mCtx);
+    flusher.SetMetricsRecordRef(FlusherPrometheus::sName, "1");
+    flusher.SetPluginID("1");
+    if (!flusher.Init(configJson, optionalGoPipeline)) {
+        printf("%s failed to init flusher\n", __func__);
+        mReceiver.Stop();
+        return;
+    }
+
+    // prepare all groups in advance so that only the flusher is measured
+    vector<vector<PipelineEventGroup>> groups(sProducerCnt);
+    for (size_t scrape = 0; scrape < sScrapeCnt; ++scrape) {
+        for (size_t target = 0; target < sTargetCnt; ++target) {
+            PipelineEventGroup group(make_shared<SourceBuffer>());
+            group.SetTag(string("job"), string("benchmark"));
+            group.SetTag(string("instance"), "10.0.0." + ToString(target) + ":9100");
+            for (size_t i = 0; i < sSeriesPerTarget; ++i) {
+                auto e = group.AddMetricEvent();
+                e->SetName("node_metric_" + ToString(i % 50));
+                e->SetTag(string("__name__"), "node_metric_" + ToString(i % 50));
+                e->SetTag(string("device"), "dev" + ToString(i / 50));
+                e->SetTimestamp(1700000000 + scrape * 15);
+                e->SetValue(UntypedSingleValue{static_cast<double>(i * scrape)});
+            }
+            groups[target % sProducerCnt].emplace_back(std::move(group));
+        }
+    }
+    size_t totalSamples = sScrapeCnt * sTargetCnt * sSeriesPerTarget;
+
+    atomic_bool producing = true;
+    vector<thread> senders;
+    for (size_t i = 0; i < sSenderCnt; ++i) {
+        senders.emplace_back([&]() {
+            while (true) {
+                vector<SenderQueueItem*> items;
+                SenderQueueManager::GetInstance()->GetAvailableItems(items, 1);
+                if (items.empty()) {
+                    if (!producing && SenderQueueManager::GetInstance()->IsAllQueueEmpty()) {
+                        return;
+                    }
+                    this_thread::sleep_for(chrono::milliseconds(1));
+                    continue;
+                }
+                for (auto item : items) {
+                    auto request = flusher.BuildRequest(item);
+                    HttpResponse response;
+                    SendHttpRequest(unique_ptr<HttpRequest>(request.release()), response);
+                    flusher.OnSendDone(response, item);
+                }
+            }
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> producers;
+    for (size_t i = 0; i < sProducerCnt; ++i) {
+        producers.emplace_back([&, i]() {
+            for (auto& group : groups[i]) {
+                flusher.Send(std::move(group));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    flusher.FlushAll();
+    auto serialized = chrono::steady_clock::now();
+    producing = false;
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    auto end = chrono::steady_clock::now();
+
+    double sendSecs = chrono::duration<double>(serialized - start).count();
+    double totalSecs = chrono::duration<double>(end - start).count();
+    printf("%s %zu samples of %zu series, queued in %.3fs, received in %.3fs (%zu requests, %zu bytes), "
+           "%.0f samples/s, target %.0f samples/s %s\n",
+           __func__,
+           totalSamples,
+           sTargetCnt * sSeriesPerTarget,
+           sendSecs,
+           totalSecs,
+           mReceiver.mRequestCnt.load(),
+           mReceiver.mReceivedBytes.load(),
+           totalSamples / totalSecs,
+           sTargetSamplesPerSec,
+           totalSamples / totalSecs >= sTargetSamplesPerSec ? "met" : "not met");
+
+    mReceiver.Stop();
+    TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    logtail::Logger::Instance().InitGlobalLoggers();
+    logtail::FlusherPrometheusBenchmark benchmark;
+    benchmark.TestThroughput();
+    return 0;
+}
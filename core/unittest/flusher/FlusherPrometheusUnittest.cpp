@@ -0,0 +1,381 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/unknown_field_set.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/Flags.h"
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/compression/SnappyCompressor.h"
+#include "common/http/Curl.h"
+#include "pipeline/PipelineContext.h"
+#include "pipeline/batch/TimeoutFlushManager.h"
+#include "pipeline/queue/QueueKeyManager.h"
+#include "pipeline/queue/SenderQueueManager.h"
+#include "plugin/flusher/prometheus/FlusherPrometheus.h"
+#include "unittest/Unittest.h"
+#include "unittest/flusher/StubHttpReceiver.h"
+
+DECLARE_FLAG_INT32(batch_send_interval);
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherPrometheusUnittest : public testing::Test {
+public:
+    void OnSuccessfulInit();
+    void OnFailedInit();
+    void TestSendBySeries();
+    void TestFlushBySize();
+    void TestOneRequestInFlightPerShard();
+    void TestSendToReceiver();
+
+protected:
+    void SetUp() override { ctx.SetConfigName("test_config"); }
+
+    void TearDown() override {
+        TimeoutFlushManager::GetInstance()->ClearRecords("test_config");
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+    }
+
+private:
+    unique_ptr<FlusherPrometheus> CreateFlusher(const string& configStr, bool expectedRes = true) {
+        Json::Value configJson, optionalGoPipeline;
+        string errorMsg;
+        EXPECT_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        auto flusher = make_unique<FlusherPrometheus>();
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef(FlusherPrometheus::sName, "1");
+        EXPECT_EQ(expectedRes, flusher->Init(configJson, optionalGoPipeline));
+        EXPECT_TRUE(optionalGoPipeline.isNull());
+        return flusher;
+    }
+
+    // fetches the items available to send, and completes them with the status code
+    static size_t SendAvailableItems(FlusherPrometheus& flusher, int32_t statusCode = 200) {
+        vector<SenderQueueItem*> res;
+        SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+        HttpResponse response;
+        response.mStatusCode = statusCode;
+        for (auto item : res) {
+            flusher.OnSendDone(response, item);
+        }
+        return res.size();
+    }
+
+    static PipelineEventGroup CreateGroup(size_t seriesCnt, size_t samplesPerSeries) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("job"), string("test"));
+        for (size_t i = 0; i < samplesPerSeries; ++i) {
+            for (size_t j = 0; j < seriesCnt; ++j) {
+                auto e = group.AddMetricEvent();
+                e->SetName("http_requests_total");
+                e->SetTag(string("instance"), "localhost:" + ToString(8000 + j));
+                e->SetTimestamp(1700000000 + i);
+                e->SetValue(UntypedSingleValue{static_cast<double>(i)});
+            }
+        }
+        return group;
+    }
+
+    PipelineContext ctx;
+};
+
+void FlusherPrometheusUnittest::OnSuccessfulInit() {
+    // only mandatory param
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://localhost:9090/api/v1/write"
+        }
+    )");
+    APSARA_TEST_FALSE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL("localhost", flusher->mHost);
+    APSARA_TEST_EQUAL(9090, flusher->mPort);
+    APSARA_TEST_EQUAL("/api/v1/write", flusher->mPath);
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+    APSARA_TEST_EQUAL(4U, flusher->mShardCnt);
+    APSARA_TEST_EQUAL(4U, flusher->mShards.size());
+    APSARA_TEST_EQUAL(2000U, flusher->mMaxSamplesPerSend);
+    APSARA_TEST_EQUAL(static_cast<uint32_t>(INT32_FLAG(batch_send_interval)), flusher->mBatchTimeoutSecs);
+    APSARA_TEST_EQUAL(CompressType::SNAPPY, flusher->mCompressor->GetCompressType());
+    APSARA_TEST_TRUE(flusher->mSerializer);
+    APSARA_TEST_EQUAL(
+        QueueKeyManager::GetInstance()->GetKey("test_config-flusher_prometheus_native-http://localhost:9090/api/v1/write"),
+        flusher->GetQueueKey());
+    // each shard has its own queue, the first of which is the flusher's
+    auto keys = flusher->GetQueueKeys();
+    APSARA_TEST_EQUAL(4U, keys.size());
+    APSARA_TEST_EQUAL(flusher->GetQueueKey(), keys[0]);
+    APSARA_TEST_EQUAL(4U, set<QueueKey>(keys.begin(), keys.end()).size());
+    for (auto key : keys) {
+        APSARA_TEST_NOT_EQUAL(nullptr, SenderQueueManager::GetInstance()->GetQueue(key));
+    }
+
+    // valid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "https://remote-write",
+            "Headers": {
+                "Authorization": "Bearer token"
+            },
+            "ShardCount": 8,
+            "Batch": {
+                "MaxCnt": 500,
+                "TimeoutSecs": 1
+            }
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL(443, flusher->mPort);
+    APSARA_TEST_EQUAL("/", flusher->mPath);
+    APSARA_TEST_EQUAL("Bearer token", flusher->mHeaders["Authorization"]);
+    APSARA_TEST_EQUAL(8U, flusher->mShards.size());
+    APSARA_TEST_EQUAL(8U, flusher->GetQueueKeys().size());
+    APSARA_TEST_EQUAL(500U, flusher->mMaxSamplesPerSend);
+    APSARA_TEST_EQUAL(1U, flusher->mBatchTimeoutSecs);
+
+    // invalid optional param
+    flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://localhost:9090/api/v1/write",
+            "Headers": true,
+            "ShardCount": 0,
+            "Batch": {
+                "MaxCnt": 0,
+                "TimeoutSecs": "1"
+            }
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+    APSARA_TEST_EQUAL(4U, flusher->mShards.size());
+    APSARA_TEST_EQUAL(2000U, flusher->mMaxSamplesPerSend);
+    APSARA_TEST_EQUAL(static_cast<uint32_t>(INT32_FLAG(batch_send_interval)), flusher->mBatchTimeoutSecs);
+}
+
+void FlusherPrometheusUnittest::OnFailedInit() {
+    CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native"
+        }
+    )",
+                  false);
+    for (const string& endpoint : {"", "tcp://localhost:9090", "http://:9090/api/v1/write"}) {
+        CreateFlusher(R"(
+            {
+                "Type": "flusher_prometheus_native",
+                "Endpoint": ")"
+                          + endpoint + R"("
+            }
+        )",
+                      false);
+    }
+}
+
+void FlusherPrometheusUnittest::TestSendBySeries() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://localhost:9090/api/v1/write"
+        }
+    )");
+    for (size_t i = 0; i < 3; ++i) {
+        auto group = CreateGroup(100, 1);
+        // non-metric and valueless events are dropped
+        group.AddLogEvent();
+        group.AddMetricEvent()->SetName("no_value");
+        APSARA_TEST_TRUE(flusher->Send(std::move(group)));
+    }
+    // all samples of a series are kept by the same shard
+    size_t seriesCnt = 0, sampleCnt = 0, usedShardCnt = 0;
+    for (auto& shard : flusher->mShards) {
+        seriesCnt += shard->mBatch.SeriesCnt();
+        sampleCnt += shard->mBatch.SampleCnt();
+        usedShardCnt += shard->mBatch.Empty() ? 0 : 1;
+    }
+    APSARA_TEST_EQUAL(100U, seriesCnt);
+    APSARA_TEST_EQUAL(300U, sampleCnt);
+    APSARA_TEST_EQUAL(4U, usedShardCnt);
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    APSARA_TEST_TRUE(flusher->FlushAll());
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(4U, res.size());
+    set<QueueKey> keys;
+    for (auto item : res) {
+        APSARA_TEST_EQUAL(flusher.get(), item->mFlusher);
+        APSARA_TEST_TRUE(item->mData.size() < item->mRawSize);
+        keys.insert(item->mQueueKey);
+    }
+    // each shard pushes to its own queue
+    auto expectedKeys = flusher->GetQueueKeys();
+    APSARA_TEST_EQUAL(set<QueueKey>(expectedKeys.begin(), expectedKeys.end()), keys);
+}
+
+void FlusherPrometheusUnittest::TestFlushBySize() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://localhost:9090/api/v1/write",
+            "ShardCount": 1,
+            "Batch": {
+                "MaxCnt": 10
+            }
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(5, 1)));
+    APSARA_TEST_EQUAL(5U, flusher->mShards[0]->mBatch.SampleCnt());
+    APSARA_TEST_EQUAL(0U, SendAvailableItems(*flusher));
+
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(5, 1)));
+    APSARA_TEST_TRUE(flusher->mShards[0]->mBatch.Empty());
+    APSARA_TEST_EQUAL(1U, SendAvailableItems(*flusher));
+
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(5, 1)));
+    // keys out of range are ignored
+    APSARA_TEST_TRUE(flusher->Flush(0));
+    APSARA_TEST_TRUE(flusher->Flush(2));
+    APSARA_TEST_EQUAL(5U, flusher->mShards[0]->mBatch.SampleCnt());
+    APSARA_TEST_TRUE(flusher->Flush(1));
+    APSARA_TEST_TRUE(flusher->mShards[0]->mBatch.Empty());
+    APSARA_TEST_EQUAL(1U, SendAvailableItems(*flusher));
+
+    // a large group is sent in requests of at most MaxCnt samples
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(5, 5)));
+    APSARA_TEST_TRUE(flusher->mShards[0]->mBatch.Empty());
+    for (size_t i = 0; i < 3; ++i) {
+        APSARA_TEST_EQUAL(1U, SendAvailableItems(*flusher));
+    }
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+}
+
+void FlusherPrometheusUnittest::TestOneRequestInFlightPerShard() {
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://localhost:9090/api/v1/write",
+            "ShardCount": 1,
+            "Batch": {
+                "MaxCnt": 10
+            }
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(5, 5)));
+
+    vector<SenderQueueItem*> res;
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(1U, res.size());
+    auto first = res[0];
+    // no more request is sent until the one in flight is done
+    res.clear();
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(0U, res.size());
+
+    // a retried request is sent again before the following ones
+    HttpResponse response;
+    response.mStatusCode = 503;
+    flusher->OnSendDone(response, first);
+    SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+    APSARA_TEST_EQUAL(1U, res.size());
+    APSARA_TEST_EQUAL(first, res[0]);
+
+    response.mStatusCode = 200;
+    flusher->OnSendDone(response, first);
+    APSARA_TEST_EQUAL(1U, SendAvailableItems(*flusher));
+    APSARA_TEST_EQUAL(1U, SendAvailableItems(*flusher));
+    APSARA_TEST_EQUAL(0U, SendAvailableItems(*flusher));
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+}
+
+void FlusherPrometheusUnittest::TestSendToReceiver() {
+    StubHttpReceiver receiver;
+    APSARA_TEST_TRUE(receiver.Start());
+    auto flusher = CreateFlusher(R"(
+        {
+            "Type": "flusher_prometheus_native",
+            "Endpoint": "http://127.0.0.1:)"
+                                 + ToString(receiver.mPort) + R"(/api/v1/write",
+            "ShardCount": 1,
+            "Headers": {
+                "X-Test": "value"
+            }
+        }
+    )");
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(10, 2)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+
+    auto sendOnce = [&](int32_t statusCode) {
+        receiver.mStatusCode = statusCode;
+        vector<SenderQueueItem*> res;
+        SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+        APSARA_TEST_EQUAL(1U, res.size());
+        size_t rawSize = res[0]->mRawSize;
+        auto request = flusher->BuildRequest(res[0]);
+        HttpResponse response;
+        APSARA_TEST_TRUE(SendHttpRequest(unique_ptr<HttpRequest>(request.release()), response));
+        APSARA_TEST_EQUAL(statusCode, response.mStatusCode);
+        flusher->OnSendDone(response, res[0]);
+
+        auto requests = receiver.GetRequests();
+        const auto& last = requests.back();
+        APSARA_TEST_TRUE(StartWith(last.mHead, "POST /api/v1/write "));
+        auto head = ToLowerCaseString(last.mHead);
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("content-encoding: snappy"));
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("content-type: application/x-protobuf"));
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("x-prometheus-remote-write-version: 0.1.0"));
+        APSARA_TEST_NOT_EQUAL(string::npos, head.find("x-test: value"));
+
+        string errorMsg, body(rawSize, '\0');
+        APSARA_TEST_TRUE(SnappyCompressor(CompressType::SNAPPY).UnCompress(last.mBody, body, errorMsg));
+        google::protobuf::UnknownFieldSet set;
+        APSARA_TEST_TRUE(set.ParseFromString(body));
+        APSARA_TEST_EQUAL(10, set.field_count());
+        return requests.size();
+    };
+
+    // retryable status keeps the item
+    APSARA_TEST_EQUAL(1U, sendOnce(503));
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(2U, sendOnce(200));
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    // non-retryable status discards the item
+    APSARA_TEST_TRUE(flusher->Send(CreateGroup(10, 1)));
+    APSARA_TEST_TRUE(flusher->FlushAll());
+    APSARA_TEST_EQUAL(3U, sendOnce(400));
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    receiver.Stop();
+}
+
+UNIT_TEST_CASE(FlusherPrometheusUnittest, OnSuccessfulInit)
+UNIT_TEST_CASE(FlusherPrometheusUnittest, OnFailedInit)
+UNIT_TEST_CASE(FlusherPrometheusUnittest, TestSendBySeries)
+UNIT_TEST_CASE(FlusherPrometheusUnittest, TestFlushBySize)
+UNIT_TEST_CASE(FlusherPrometheusUnittest, TestOneRequestInFlightPerShard)
+UNIT_TEST_CASE(FlusherPrometheusUnittest, TestSendToReceiver)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
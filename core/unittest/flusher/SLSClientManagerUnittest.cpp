@@ -0,0 +1,233 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "common/Flags.h"
+#include "common/http/Curl.h"
+#include "plugin/flusher/sls/SLSClientManager.h"
+#include "unittest/Unittest.h"
+#include "unittest/flusher/StubHttpReceiver.h"
+
+DECLARE_FLAG_INT32(sls_endpoint_hedge_latency_ms);
+
+using namespace std;
+
+namespace logtail {
+
+class SLSClientManagerUnittest : public testing::Test {
+public:
+    void TestShiftToFasterEndpoint();
+    void TestAbortShiftWhenTargetDegrades();
+    void TestShiftByErrorRate();
+    void TestNoHedgeWhenHealthy();
+    void TestNoShiftByStaleProbeStat();
+    void TestFallbackWhenPreferredUnavailable();
+
+protected:
+    void SetUp() override {
+        // both receivers share a port, since the port of an sls client is not part of its endpoint
+        ASSERT_TRUE(mSlowReceiver.Start("127.0.0.1"));
+        ASSERT_TRUE(mFastReceiver.Start("127.0.0.2", mSlowReceiver.mPort));
+        mSlowReceiver.mKeepRequests = false;
+        mFastReceiver.mKeepRequests = false;
+        mSlowReceiver.mDelayMs = 100;
+
+        mHedgeLatencyMs = INT32_FLAG(sls_endpoint_hedge_latency_ms);
+        INT32_FLAG(sls_endpoint_hedge_latency_ms) = 50;
+
+        auto manager = SLSClientManager::GetInstance();
+        manager->AddEndpointEntry(sRegion, sSlowEndpoint, true);
+        manager->AddEndpointEntry(sRegion, sFastEndpoint);
+        manager->mProbeNetworkClient = make_unique<sdk::Client>("", "", "", 5);
+        manager->mProbeNetworkClient->SetPort(mSlowReceiver.mPort);
+        mClient = make_unique<sdk::Client>(sSlowEndpoint, "", "", 5);
+        mClient->SetPort(mSlowReceiver.mPort);
+    }
+
+    void TearDown() override {
+        auto manager = SLSClientManager::GetInstance();
+        manager->mRegionEndpointEntryMap.erase(sRegion);
+        manager->mProbeNetworkClient.reset();
+        INT32_FLAG(sls_endpoint_hedge_latency_ms) = mHedgeLatencyMs;
+        mSlowReceiver.Stop();
+        mFastReceiver.Stop();
+    }
+
+private:
+    // sends requests the way flusher_sls does, and returns the number of requests sent to each endpoint
+    map<string, size_t> SendRequests(size_t cnt);
+    SLSClientManager::RegionEndpointsInfo& GetRegionInfo() {
+        return SLSClientManager::GetInstance()->mRegionEndpointEntryMap[sRegion];
+    }
+
+    static const string sRegion;
+    static const string sSlowEndpoint;
+    static const string sFastEndpoint;
+
+    StubHttpReceiver mSlowReceiver;
+    StubHttpReceiver mFastReceiver;
+    unique_ptr<sdk::Client> mClient;
+    int32_t mHedgeLatencyMs = 0;
+};
+
+const string SLSClientManagerUnittest::sRegion = "test-region";
+const string SLSClientManagerUnittest::sSlowEndpoint = "http://127.0.0.1";
+const string SLSClientManagerUnittest::sFastEndpoint = "http://127.0.0.2";
+
+map<string, size_t> SLSClientManagerUnittest::SendRequests(size_t cnt) {
+    auto manager = SLSClientManager::GetInstance();
+    map<string, size_t> res;
+    for (size_t i = 0; i < cnt; ++i) {
+        manager->UpdateClientEndpointForRequest(mClient.get(), sRegion);
+        string endpoint = mClient->GetRawSlsHost();
+        auto request = make_unique<HttpRequest>("POST",
+                                                false,
+                                                mClient->GetSlsHost(),
+                                                mSlowReceiver.mPort,
+                                                "/logstores/test/shards/lb",
+                                                "",
+                                                map<string, string>(),
+                                                "data");
+        HttpResponse response;
+        bool success = SendHttpRequest(std::move(request), response) && response.mStatusCode == 200;
+        manager->UpdateEndpointSendStat(sRegion, endpoint, success, response.mResponseTimeMs);
+        ++res[endpoint];
+    }
+    return res;
+}
+
+void SLSClientManagerUnittest::TestShiftToFasterEndpoint() {
+    auto manager = SLSClientManager::GetInstance();
+    auto sent = SendRequests(4);
+    APSARA_TEST_EQUAL(4U, sent[sSlowEndpoint]);
+
+    // the default endpoint is slow, so both endpoints are probed and traffic starts to shift
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_TRUE(mFastReceiver.mRequestCnt > 0U);
+    APSARA_TEST_EQUAL(sFastEndpoint, GetRegionInfo().mShiftTarget);
+    APSARA_TEST_EQUAL(25U, GetRegionInfo().mShiftPercent);
+    sent = SendRequests(8);
+    APSARA_TEST_EQUAL(2U, sent[sFastEndpoint]);
+    APSARA_TEST_EQUAL(6U, sent[sSlowEndpoint]);
+
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(50U, GetRegionInfo().mShiftPercent);
+    sent = SendRequests(8);
+    APSARA_TEST_EQUAL(4U, sent[sFastEndpoint]);
+    APSARA_TEST_EQUAL(4U, sent[sSlowEndpoint]);
+
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(75U, GetRegionInfo().mShiftPercent);
+    SendRequests(4);
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(sFastEndpoint, GetRegionInfo().mPreferredEndpoint);
+    APSARA_TEST_EQUAL("", GetRegionInfo().mShiftTarget);
+    APSARA_TEST_EQUAL(sFastEndpoint, manager->GetAvailableEndpointWithTopPriority(sRegion));
+    sent = SendRequests(4);
+    APSARA_TEST_EQUAL(4U, sent[sFastEndpoint]);
+
+    // the preferred endpoint is healthy, so no more probing
+    size_t slowCnt = mSlowReceiver.mRequestCnt;
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(slowCnt, mSlowReceiver.mRequestCnt.load());
+}
+
+void SLSClientManagerUnittest::TestAbortShiftWhenTargetDegrades() {
+    auto manager = SLSClientManager::GetInstance();
+    SendRequests(2);
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(sFastEndpoint, GetRegionInfo().mShiftTarget);
+
+    mFastReceiver.mDelayMs = 300;
+    auto sent = SendRequests(8);
+    APSARA_TEST_EQUAL(2U, sent[sFastEndpoint]);
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL("", GetRegionInfo().mShiftTarget);
+    APSARA_TEST_EQUAL(0U, GetRegionInfo().mShiftPercent);
+    APSARA_TEST_EQUAL("", GetRegionInfo().mPreferredEndpoint);
+    sent = SendRequests(4);
+    APSARA_TEST_EQUAL(4U, sent[sSlowEndpoint]);
+}
+
+void SLSClientManagerUnittest::TestShiftByErrorRate() {
+    auto manager = SLSClientManager::GetInstance();
+    // equally fast, but the default endpoint fails
+    mSlowReceiver.mDelayMs = 0;
+    mSlowReceiver.mStatusCode = 500;
+    SendRequests(5);
+    APSARA_TEST_TRUE(GetRegionInfo().mEndpointInfoMap.at(sSlowEndpoint).mErrorRate > 0.5);
+
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(sFastEndpoint, GetRegionInfo().mShiftTarget);
+}
+
+void SLSClientManagerUnittest::TestNoHedgeWhenHealthy() {
+    auto manager = SLSClientManager::GetInstance();
+    mSlowReceiver.mDelayMs = 0;
+    SendRequests(4);
+    size_t slowCnt = mSlowReceiver.mRequestCnt;
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(slowCnt, mSlowReceiver.mRequestCnt.load());
+    APSARA_TEST_EQUAL(0U, mFastReceiver.mRequestCnt.load());
+    APSARA_TEST_EQUAL("", GetRegionInfo().mShiftTarget);
+}
+
+void SLSClientManagerUnittest::TestNoShiftByStaleProbeStat() {
+    auto manager = SLSClientManager::GetInstance();
+    mSlowReceiver.mDelayMs = 0;
+    SendRequests(4);
+    // probe stats left by an earlier degradation, in which the other endpoint was faster
+    auto& slow = GetRegionInfo().mEndpointInfoMap.at(sSlowEndpoint);
+    auto& fast = GetRegionInfo().mEndpointInfoMap.at(sFastEndpoint);
+    slow.mProbeLatencyMs = 100.0;
+    slow.mProbeCnt = 1;
+    fast.mProbeLatencyMs = 1.0;
+    fast.mProbeCnt = 1;
+
+    // the current endpoint is healthy, so it is not probed and no shift is started
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL(0U, mFastReceiver.mRequestCnt.load());
+    APSARA_TEST_EQUAL("", GetRegionInfo().mShiftTarget);
+    auto sent = SendRequests(4);
+    APSARA_TEST_EQUAL(4U, sent[sSlowEndpoint]);
+}
+
+void SLSClientManagerUnittest::TestFallbackWhenPreferredUnavailable() {
+    auto manager = SLSClientManager::GetInstance();
+    GetRegionInfo().mPreferredEndpoint = sFastEndpoint;
+    APSARA_TEST_EQUAL(sFastEndpoint, manager->GetAvailableEndpointWithTopPriority(sRegion));
+
+    // failover is immediate instead of gradual
+    manager->UpdateEndpointStatus(sRegion, sFastEndpoint, false);
+    APSARA_TEST_EQUAL(sSlowEndpoint, manager->GetAvailableEndpointWithTopPriority(sRegion));
+    auto sent = SendRequests(2);
+    APSARA_TEST_EQUAL(2U, sent[sSlowEndpoint]);
+
+    manager->HedgeProbeAndShiftTraffic();
+    APSARA_TEST_EQUAL("", GetRegionInfo().mPreferredEndpoint);
+}
+
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestShiftToFasterEndpoint)
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestAbortShiftWhenTargetDegrades)
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestShiftByErrorRate)
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestNoHedgeWhenHealthy)
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestNoShiftByStaleProbeStat)
+UNIT_TEST_CASE(SLSClientManagerUnittest, TestFallbackWhenPreferredUnavailable)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
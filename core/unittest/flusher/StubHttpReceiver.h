@@ -0,0 +1,131 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/StringTools.h"
+
+namespace logtail {
+
+// minimal http receiver on loopback, which records the requests and replies with the given status code after the
+// given delay
+class StubHttpReceiver {
+public:
+    struct Request {
+        std::string mHead;
+        std::string mBody;
+    };
+
+    // any address in 127.0.0.0/8 can be used, so that receivers with different ips can share a port
+    bool Start(const std::string& ip = "127.0.0.1", int32_t port = 0) {
+        mListenFd = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        if (inet_pton(AF_INET, ip.c_str(), &addr.sin_addr) != 1) {
+            return false;
+        }
+        addr.sin_port = htons(port);
+        socklen_t len = sizeof(addr);
+        if (bind(mListenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(mListenFd, 16) != 0
+            || getsockname(mListenFd, (sockaddr*)&addr, &len) != 0) {
+            return false;
+        }
+        mPort = ntohs(addr.sin_port);
+        mThread = std::thread([this]() { Run(); });
+        return true;
+    }
+
+    void Stop() {
+        shutdown(mListenFd, SHUT_RDWR);
+        close(mListenFd);
+        mThread.join();
+    }
+
+    std::vector<Request> GetRequests() {
+        std::lock_guard<std::mutex> lock(mMux);
+        return mRequests;
+    }
+
+    int32_t mPort = 0;
+    std::atomic_int mStatusCode = 200;
+    std::atomic_uint32_t mDelayMs = 0;
+    // requests are only counted if not kept, e.g. in benchmarks
+    bool mKeepRequests = true;
+    std::atomic_size_t mRequestCnt = 0;
+    std::atomic_size_t mReceivedBytes = 0;
+
+private:
+    void Run() {
+        while (true) {
+            int fd = accept(mListenFd, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            // one request per connection
+            std::string buf;
+            char tmp[4096];
+            ssize_t n;
+            size_t headEnd = std::string::npos, bodySize = 0;
+            while ((n = read(fd, tmp, sizeof(tmp))) > 0) {
+                buf.append(tmp, n);
+                if (headEnd == std::string::npos && (headEnd = buf.find("\r\n\r\n")) != std::string::npos) {
+                    auto pos = ToLowerCaseString(buf.substr(0, headEnd)).find("content-length:");
+                    if (pos != std::string::npos) {
+                        bodySize = std::stoul(buf.substr(pos + strlen("content-length:")));
+                    }
+                }
+                if (headEnd != std::string::npos && buf.size() >= headEnd + 4 + bodySize) {
+                    break;
+                }
+            }
+            ++mRequestCnt;
+            mReceivedBytes += buf.size();
+            if (mKeepRequests) {
+                std::lock_guard<std::mutex> lock(mMux);
+                mRequests.push_back({buf.substr(0, headEnd), buf.substr(headEnd + 4)});
+            }
+            if (mDelayMs > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(mDelayMs.load()));
+            }
+            std::string response = "HTTP/1.1 " + ToString(mStatusCode.load()) + " Status\r\nContent-Length: 0\r\n"
+                + "Connection: close\r\n\r\n";
+            if (write(fd, response.data(), response.size()) < 0) {
+                // ignore
+            }
+            close(fd);
+        }
+    }
+
+    int mListenFd = -1;
+    std::thread mThread;
+    std::mutex mMux;
+    std::vector<Request> mRequests;
+};
+
+} // namespace logtail
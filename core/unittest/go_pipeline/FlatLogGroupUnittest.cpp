@@ -0,0 +1,192 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "common/Constants.h"
+#include "common/Flags.h"
+#include "go_pipeline/FlatLogGroup.h"
+#include "models/PipelineEventGroup.h"
+#include "runner/ProcessorRunner.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(max_send_log_group_size);
+
+using namespace std;
+
+namespace logtail {
+
+class FlatLogGroupUnittest : public testing::Test {
+public:
+    void TestRoundTrip();
+    void TestRoundTripWithoutNanosecond();
+    void TestEmptyGroup();
+    void TestUnsupportedEvent();
+    void TestSizeLimit();
+    void TestParseInvalid();
+
+private:
+    static PipelineEventGroup CreateEventGroup(size_t logCnt, size_t contentCnt);
+    // protobuf path used before flat log group is introduced
+    static string SerializeAsProtobuf(const PipelineEventGroup& group, bool enableNanosecond);
+    static string SerializeAsFlat(const PipelineEventGroup& group, bool enableNanosecond);
+};
+
+PipelineEventGroup FlatLogGroupUnittest::CreateEventGroup(size_t logCnt, size_t contentCnt) {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(LOG_RESERVED_KEY_TOPIC, string("topic"));
+    group.SetTag(string("__hostname__"), string("host"));
+    group.SetTag(string("__path__"), string("/var/log/test.log"));
+    for (size_t i = 0; i < logCnt; ++i) {
+        auto e = group.AddLogEvent();
+        if (i % 3 == 0) {
+            e->SetTimestamp(1700000000 + i);
+        } else {
+            e->SetTimestamp(1700000000 + i, static_cast<uint32_t>(i));
+        }
+        // log with no content is legal
+        if (i == 1) {
+            continue;
+        }
+        for (size_t j = 0; j < contentCnt; ++j) {
+            e->SetContent("key_" + to_string(j), "value of log " + to_string(i) + " content " + to_string(j));
+        }
+    }
+    return group;
+}
+
+string FlatLogGroupUnittest::SerializeAsProtobuf(const PipelineEventGroup& group, bool enableNanosecond) {
+    string res, errorMsg;
+    APSARA_TEST_TRUE(ProcessorRunner::GetInstance()->Serialize(group, enableNanosecond, "logstore", res, errorMsg));
+    return res;
+}
+
+string FlatLogGroupUnittest::SerializeAsFlat(const PipelineEventGroup& group, bool enableNanosecond) {
+    string flat, errorMsg;
+    APSARA_TEST_TRUE(FlatLogGroup::Serialize(group, enableNanosecond, "logstore", flat, errorMsg));
+    sls_logs::LogGroup logGroup;
+    APSARA_TEST_TRUE(FlatLogGroup::Parse(flat.data(), flat.size(), logGroup, errorMsg));
+    return logGroup.SerializeAsString();
+}
+
+void FlatLogGroupUnittest::TestRoundTrip() {
+    auto group = CreateEventGroup(10, 5);
+    APSARA_TEST_EQUAL(SerializeAsProtobuf(group, true), SerializeAsFlat(group, true));
+
+    string flat, errorMsg;
+    APSARA_TEST_TRUE(FlatLogGroup::Serialize(group, true, "logstore", flat, errorMsg));
+    sls_logs::LogGroup logGroup;
+    APSARA_TEST_TRUE(FlatLogGroup::Parse(flat.data(), flat.size(), logGroup, errorMsg));
+    APSARA_TEST_EQUAL("topic", logGroup.topic());
+    APSARA_TEST_EQUAL("logstore", logGroup.category());
+    APSARA_TEST_EQUAL(2, logGroup.logtags_size());
+    APSARA_TEST_EQUAL(10, logGroup.logs_size());
+    APSARA_TEST_FALSE(logGroup.logs(0).has_time_ns());
+    APSARA_TEST_EQUAL(2U, logGroup.logs(2).time_ns());
+    APSARA_TEST_EQUAL(0, logGroup.logs(1).contents_size());
+    APSARA_TEST_EQUAL("value of log 9 content 4", logGroup.logs(9).contents(4).value());
+}
+
+void FlatLogGroupUnittest::TestRoundTripWithoutNanosecond() {
+    auto group = CreateEventGroup(10, 5);
+    APSARA_TEST_EQUAL(SerializeAsProtobuf(group, false), SerializeAsFlat(group, false));
+}
+
+void FlatLogGroupUnittest::TestEmptyGroup() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    APSARA_TEST_EQUAL(SerializeAsProtobuf(group, true), SerializeAsFlat(group, true));
+
+    string flat, errorMsg;
+    APSARA_TEST_TRUE(FlatLogGroup::Serialize(group, true, "", flat, errorMsg));
+    APSARA_TEST_EQUAL(FlatLogGroup::sHeaderSize + 8U, flat.size());
+}
+
+void FlatLogGroupUnittest::TestUnsupportedEvent() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.AddLogEvent();
+    group.AddMetricEvent();
+    string flat, errorMsg;
+    APSARA_TEST_FALSE(FlatLogGroup::Serialize(group, true, "logstore", flat, errorMsg));
+    APSARA_TEST_FALSE(errorMsg.empty());
+}
+
+void FlatLogGroupUnittest::TestSizeLimit() {
+    auto group = CreateEventGroup(10, 5);
+    int32_t limit = INT32_FLAG(max_send_log_group_size);
+    INT32_FLAG(max_send_log_group_size) = 100;
+    string flat, errorMsg;
+    APSARA_TEST_FALSE(FlatLogGroup::Serialize(group, true, "logstore", flat, errorMsg));
+    APSARA_TEST_TRUE(errorMsg.find("exceeds size limit") != string::npos);
+    INT32_FLAG(max_send_log_group_size) = limit;
+}
+
+void FlatLogGroupUnittest::TestParseInvalid() {
+    auto group = CreateEventGroup(3, 2);
+    string flat, errorMsg;
+    APSARA_TEST_TRUE(FlatLogGroup::Serialize(group, true, "logstore", flat, errorMsg));
+    {
+        // header too short
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(flat.data(), FlatLogGroup::sHeaderSize - 1, logGroup, errorMsg));
+    }
+    {
+        // bad magic
+        string data = flat;
+        data[0] = 'X';
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(data.data(), data.size(), logGroup, errorMsg));
+    }
+    {
+        // unknown version
+        string data = flat;
+        data[4] = 2;
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(data.data(), data.size(), logGroup, errorMsg));
+        APSARA_TEST_TRUE(errorMsg.find("version") != string::npos);
+    }
+    {
+        // truncated columns
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(flat.data(), FlatLogGroup::sHeaderSize + 8, logGroup, errorMsg));
+    }
+    {
+        // truncated arena
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(flat.data(), flat.size() - 1, logGroup, errorMsg));
+    }
+    {
+        // trailing garbage
+        string data = flat + "x";
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(data.data(), data.size(), logGroup, errorMsg));
+    }
+    {
+        // content cnt of the first log exceeds the total
+        string data = flat;
+        data[FlatLogGroup::sHeaderSize + 24] = 9;
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_FALSE(FlatLogGroup::Parse(data.data(), data.size(), logGroup, errorMsg));
+    }
+}
+
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestRoundTrip)
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestRoundTripWithoutNanosecond)
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestEmptyGroup)
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestUnsupportedEvent)
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestSizeLimit)
+UNIT_TEST_CASE(FlatLogGroupUnittest, TestParseInvalid)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
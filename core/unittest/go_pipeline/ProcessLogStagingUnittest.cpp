@@ -0,0 +1,181 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Flags.h"
+#include "go_pipeline/ProcessLogStaging.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(go_process_log_batch_size);
+DECLARE_FLAG_INT32(go_process_log_batch_bytes);
+DECLARE_FLAG_INT32(go_process_log_batch_timeout_ms);
+
+using namespace std;
+
+namespace logtail {
+
+class ProcessLogStagingUnittest : public testing::Test {
+public:
+    void TestCoalesce();
+    void TestFlushWhenFull();
+    void TestFlushWhenTimeout();
+    void TestFlushByConfig();
+    void TestStop();
+
+protected:
+    static void SetUpTestCase() {
+        INT32_FLAG(go_process_log_batch_size) = 10;
+        INT32_FLAG(go_process_log_batch_bytes) = 1024 * 1024;
+        INT32_FLAG(go_process_log_batch_timeout_ms) = 100;
+    }
+
+    void SetUp() override {
+        mStaging.reset(new ProcessLogStaging([this](const string& configName,
+                                                    vector<sls_logs::Log>& logs,
+                                                    const string& packId,
+                                                    const string& topic,
+                                                    const string& tags) {
+            lock_guard<mutex> lock(mMux);
+            mCalls.push_back({configName, topic, tags, std::move(logs)});
+        }));
+    }
+
+    void TearDown() override {
+        mStaging.reset();
+        mCalls.clear();
+    }
+
+private:
+    struct Call {
+        string mConfigName;
+        string mTopic;
+        string mTags;
+        vector<sls_logs::Log> mLogs;
+    };
+
+    static vector<sls_logs::Log> CreateLogs(size_t cnt, uint32_t startTime = 0) {
+        vector<sls_logs::Log> logs(cnt);
+        for (size_t i = 0; i < cnt; ++i) {
+            logs[i].set_time(startTime + i);
+            auto content = logs[i].add_contents();
+            content->set_key("key");
+            content->set_value("value");
+        }
+        return logs;
+    }
+
+    size_t GetCallCnt() {
+        lock_guard<mutex> lock(mMux);
+        return mCalls.size();
+    }
+
+    unique_ptr<ProcessLogStaging> mStaging;
+    mutex mMux;
+    vector<Call> mCalls;
+};
+
+void ProcessLogStagingUnittest::TestCoalesce() {
+    auto logs = CreateLogs(2);
+    mStaging->Add("config_a", logs, "", "", "");
+    APSARA_TEST_TRUE(logs.empty());
+    logs = CreateLogs(2, 2);
+    mStaging->Add("config_a", logs, "", "", "");
+    // different topic goes to a different batch
+    logs = CreateLogs(1);
+    mStaging->Add("config_a", logs, "", "topic", "");
+    logs = CreateLogs(3);
+    mStaging->Add("config_b", logs, "", "", "");
+    APSARA_TEST_EQUAL(3U, mStaging->mBatches.size());
+    APSARA_TEST_EQUAL(0U, GetCallCnt());
+
+    mStaging->FlushAll();
+    APSARA_TEST_EQUAL(3U, mCalls.size());
+    APSARA_TEST_TRUE(mStaging->mBatches.empty());
+    size_t total = 0;
+    for (const auto& call : mCalls) {
+        total += call.mLogs.size();
+        if (call.mConfigName == "config_a" && call.mTopic.empty()) {
+            APSARA_TEST_EQUAL(4U, call.mLogs.size());
+            // order is kept
+            for (size_t i = 0; i < call.mLogs.size(); ++i) {
+                APSARA_TEST_EQUAL(i, call.mLogs[i].time());
+            }
+        }
+    }
+    APSARA_TEST_EQUAL(8U, total);
+}
+
+void ProcessLogStagingUnittest::TestFlushWhenFull() {
+    auto logs = CreateLogs(9);
+    mStaging->Add("config", logs, "", "", "");
+    APSARA_TEST_EQUAL(0U, GetCallCnt());
+    logs = CreateLogs(1);
+    mStaging->Add("config", logs, "", "", "");
+    APSARA_TEST_EQUAL(1U, GetCallCnt());
+    APSARA_TEST_EQUAL(10U, mCalls[0].mLogs.size());
+    APSARA_TEST_TRUE(mStaging->mBatches.empty());
+
+    // bytes limit
+    INT32_FLAG(go_process_log_batch_bytes) = 10;
+    logs = CreateLogs(1);
+    mStaging->Add("config", logs, "", "", "");
+    APSARA_TEST_EQUAL(2U, GetCallCnt());
+    INT32_FLAG(go_process_log_batch_bytes) = 1024 * 1024;
+}
+
+void ProcessLogStagingUnittest::TestFlushWhenTimeout() {
+    auto logs = CreateLogs(1);
+    mStaging->Add("config", logs, "", "", "");
+    APSARA_TEST_EQUAL(0U, GetCallCnt());
+    // never staged for more than 1.5 timeout
+    this_thread::sleep_for(chrono::milliseconds(300));
+    APSARA_TEST_EQUAL(1U, GetCallCnt());
+}
+
+void ProcessLogStagingUnittest::TestFlushByConfig() {
+    auto logs = CreateLogs(1);
+    mStaging->Add("config_a", logs, "", "", "");
+    logs = CreateLogs(1);
+    mStaging->Add("config_a", logs, "", "topic", "");
+    logs = CreateLogs(1);
+    mStaging->Add("config_b", logs, "", "", "");
+    mStaging->Flush("config_a");
+    APSARA_TEST_EQUAL(2U, GetCallCnt());
+    APSARA_TEST_EQUAL("config_a", mCalls[0].mConfigName);
+    APSARA_TEST_EQUAL("config_a", mCalls[1].mConfigName);
+    APSARA_TEST_EQUAL(1U, mStaging->mBatches.size());
+}
+
+void ProcessLogStagingUnittest::TestStop() {
+    auto logs = CreateLogs(1);
+    mStaging->Add("config", logs, "", "", "");
+    mStaging->Stop();
+    APSARA_TEST_EQUAL(1U, GetCallCnt());
+    APSARA_TEST_FALSE(mStaging->mIsThreadRunning);
+}
+
+UNIT_TEST_CASE(ProcessLogStagingUnittest, TestCoalesce)
+UNIT_TEST_CASE(ProcessLogStagingUnittest, TestFlushWhenFull)
+UNIT_TEST_CASE(ProcessLogStagingUnittest, TestFlushWhenTimeout)
+UNIT_TEST_CASE(ProcessLogStagingUnittest, TestFlushByConfig)
+UNIT_TEST_CASE(ProcessLogStagingUnittest, TestStop)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
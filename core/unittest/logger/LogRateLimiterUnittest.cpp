@@ -0,0 +1,82 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include "common/Flags.h"
+#include "logger/LogRateLimiter.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(log_rate_limit_burst);
+DECLARE_FLAG_INT32(log_rate_limit_per_sec);
+
+using namespace std;
+
+namespace logtail {
+
+class LogRateLimiterUnittest : public testing::Test {
+public:
+    void TestBurst();
+    void TestRefill();
+
+protected:
+    void SetUp() override {
+        INT32_FLAG(log_rate_limit_burst) = 3;
+        INT32_FLAG(log_rate_limit_per_sec) = 1;
+    }
+};
+
+void LogRateLimiterUnittest::TestBurst() {
+    LogRateLimiter limiter;
+    uint32_t suppressedCnt = 100;
+    for (int i = 0; i < 3; ++i) {
+        APSARA_TEST_TRUE(limiter.TryAcquire(suppressedCnt));
+        APSARA_TEST_EQUAL(0U, suppressedCnt);
+    }
+    for (int i = 0; i < 5; ++i) {
+        APSARA_TEST_FALSE(limiter.TryAcquire(suppressedCnt));
+    }
+    APSARA_TEST_EQUAL(5U, limiter.mSuppressedCnt.load());
+}
+
+void LogRateLimiterUnittest::TestRefill() {
+    LogRateLimiter limiter;
+    uint32_t suppressedCnt = 0;
+    for (int i = 0; i < 3; ++i) {
+        limiter.TryAcquire(suppressedCnt);
+    }
+    APSARA_TEST_FALSE(limiter.TryAcquire(suppressedCnt));
+    APSARA_TEST_FALSE(limiter.TryAcquire(suppressedCnt));
+
+    // 1.5s elapsed, 1 token is refilled
+    limiter.mLastRefillTimeMs -= 1500;
+    APSARA_TEST_TRUE(limiter.TryAcquire(suppressedCnt));
+    APSARA_TEST_EQUAL(2U, suppressedCnt);
+    APSARA_TEST_FALSE(limiter.TryAcquire(suppressedCnt));
+
+    // refill never exceeds the burst
+    limiter.mLastRefillTimeMs -= 3600 * 1000;
+    APSARA_TEST_TRUE(limiter.TryAcquire(suppressedCnt));
+    APSARA_TEST_EQUAL(1U, suppressedCnt);
+    APSARA_TEST_TRUE(limiter.TryAcquire(suppressedCnt));
+    APSARA_TEST_TRUE(limiter.TryAcquire(suppressedCnt));
+    APSARA_TEST_FALSE(limiter.TryAcquire(suppressedCnt));
+}
+
+UNIT_TEST_CASE(LogRateLimiterUnittest, TestBurst)
+UNIT_TEST_CASE(LogRateLimiterUnittest, TestRefill)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
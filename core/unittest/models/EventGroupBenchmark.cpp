@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cstdlib>
+#include "common/HashUtil.h"
 #include "common/JsonUtil.h"
 #include "common/TimeUtil.h"
 #include "models/LogEvent.h"
@@ -34,6 +35,8 @@ class EventGroupBenchmark {
 public:
     void TestEraseInLoop();
     void TestWriteIndexInLoop();
+    void TestStringHashTags();
+    void TestGetTagsHash();
 };
 
 void EraseInLoop(PipelineEventGroup& logGroup) {
@@ -101,12 +104,71 @@ void EventGroupBenchmark::TestWriteIndexInLoop() {
     printf("%s costs %lums\n", __func__, timeelapsed);
 }
 
+// tags hash computed by materializing each field, for comparison
+size_t StringHashTags(const PipelineEventGroup& logGroup) {
+    size_t seed = 0;
+    for (const auto& item : logGroup.GetTags()) {
+        HashCombine(seed, std::hash<std::string>{}(item.first.to_string()));
+        HashCombine(seed, std::hash<std::string>{}(item.second.to_string()));
+    }
+    HashCombine(seed, std::hash<std::string>{}(logGroup.GetMetadata(EventGroupMetaKey::SOURCE_ID).to_string()));
+    return seed;
+}
+
+std::vector<PipelineEventGroup> CreateTaggedGroups() {
+    std::vector<PipelineEventGroup> eventGroups;
+    for (int i = 0; i < 10000; ++i) {
+        eventGroups.emplace_back(std::make_shared<SourceBuffer>());
+        for (int j = 0; j < 20; ++j) {
+            eventGroups.back().SetTag("__tag_key_" + std::to_string(j) + "__",
+                                      "tag_value_" + std::to_string(i) + "_" + std::to_string(j));
+        }
+        eventGroups.back().SetMetadata(EventGroupMetaKey::SOURCE_ID, std::string("source_id_") + std::to_string(i));
+    }
+    return eventGroups;
+}
+
+void EventGroupBenchmark::TestStringHashTags() {
+    // SetUp
+    std::vector<PipelineEventGroup> eventGroups = CreateTaggedGroups();
+    // Test
+    size_t res = 0;
+    uint64_t starttime = GetCurrentTimeInMilliSeconds();
+    for (auto& group : eventGroups) {
+        res ^= StringHashTags(group);
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMilliSeconds() - starttime;
+    printf("%s costs %lums, result %lu\n", __func__, timeelapsed, res);
+}
+
+void EventGroupBenchmark::TestGetTagsHash() {
+    // SetUp
+    std::vector<PipelineEventGroup> eventGroups = CreateTaggedGroups();
+    // Test
+    size_t res = 0;
+    uint64_t starttime = GetCurrentTimeInMilliSeconds();
+    for (auto& group : eventGroups) {
+        res ^= group.GetTagsHash();
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMilliSeconds() - starttime;
+    printf("%s costs %lums, result %lu\n", __func__, timeelapsed, res);
+
+    starttime = GetCurrentTimeInMilliSeconds();
+    for (auto& group : eventGroups) {
+        res ^= group.GetTagsHash();
+    }
+    timeelapsed = GetCurrentTimeInMilliSeconds() - starttime;
+    printf("%s (cached) costs %lums, result %lu\n", __func__, timeelapsed, res);
+}
+
 } // namespace logtail
 
 int main(int argc, char* argv[]) {
     logtail::EventGroupBenchmark benchmark;
     benchmark.TestEraseInLoop();
     benchmark.TestWriteIndexInLoop();
+    benchmark.TestStringHashTags();
+    benchmark.TestGetTagsHash();
     /* Result:
        TestEraseInLoop costs 453ms
        TestWriteIndexInLoop costs 22ms
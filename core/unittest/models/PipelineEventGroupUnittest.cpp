@@ -27,6 +27,7 @@ public:
     void TestSetMetadata();
     void TestDelMetadata();
     void TestFromJsonToJson();
+    void TestGetTagsHash();
 
 protected:
     void SetUp() override {
@@ -135,11 +136,49 @@ void PipelineEventGroupUnittest::TestFromJsonToJson() {
     APSARA_TEST_STREQ_FATAL(CompactJson(inJson).c_str(), CompactJson(outJson).c_str());
 }
 
+void PipelineEventGroupUnittest::TestGetTagsHash() {
+    mEventGroup->SetTag(std::string("c"), std::string("d"));
+    mEventGroup->SetTag(std::string("a"), std::string("b"));
+    mEventGroup->SetMetadata(EventGroupMetaKey::SOURCE_ID, std::string("source"));
+    size_t hash = mEventGroup->GetTagsHash();
+    // value must be stable across processes and platforms
+    APSARA_TEST_EQUAL(static_cast<size_t>(2646472689406503097ULL), hash);
+    APSARA_TEST_EQUAL(hash, mEventGroup->mTagsHash.value());
+
+    // cached value is kept on move and copy
+    PipelineEventGroup moved(std::move(*mEventGroup));
+    APSARA_TEST_TRUE(moved.mTagsHash.has_value());
+    PipelineEventGroup copied = moved.Copy();
+    APSARA_TEST_EQUAL(hash, copied.GetTagsHash());
+
+    // field boundaries are reflected
+    PipelineEventGroup other(mSourceBuffer);
+    other.SetTag(std::string("ab"), std::string(""));
+    other.SetTag(std::string("cd"), std::string(""));
+    other.SetMetadata(EventGroupMetaKey::SOURCE_ID, std::string("source"));
+    APSARA_TEST_NOT_EQUAL(hash, other.GetTagsHash());
+
+    // cache is invalidated on modification
+    moved.SetTag(std::string("e"), std::string("f"));
+    APSARA_TEST_FALSE(moved.mTagsHash.has_value());
+    APSARA_TEST_NOT_EQUAL(hash, moved.GetTagsHash());
+    moved.DelTag(StringView("e"));
+    APSARA_TEST_EQUAL(hash, moved.GetTagsHash());
+    moved.SetMetadata(EventGroupMetaKey::SOURCE_ID, std::string("other"));
+    APSARA_TEST_NOT_EQUAL(hash, moved.GetTagsHash());
+    moved.DelMetadata(EventGroupMetaKey::SOURCE_ID);
+    APSARA_TEST_FALSE(moved.mTagsHash.has_value());
+    moved.GetTagsHash();
+    moved.GetSizedTags();
+    APSARA_TEST_FALSE(moved.mTagsHash.has_value());
+}
+
 UNIT_TEST_CASE(PipelineEventGroupUnittest, TestSwapEvents)
 UNIT_TEST_CASE(PipelineEventGroupUnittest, TestCopy)
 UNIT_TEST_CASE(PipelineEventGroupUnittest, TestSetMetadata)
 UNIT_TEST_CASE(PipelineEventGroupUnittest, TestDelMetadata)
 UNIT_TEST_CASE(PipelineEventGroupUnittest, TestFromJsonToJson)
+UNIT_TEST_CASE(PipelineEventGroupUnittest, TestGetTagsHash)
 
 } // namespace logtail
 
@@ -0,0 +1,210 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Flags.h"
+#include "monitor/ResourceGovernor.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(resource_governor_escalate_num);
+DECLARE_FLAG_INT32(resource_governor_recover_num);
+DECLARE_FLAG_INT32(resource_governor_restart_num);
+DECLARE_FLAG_DOUBLE(resource_governor_recover_ratio);
+
+using namespace std;
+
+namespace logtail {
+
+class ResourceGovernorUnittest : public ::testing::Test {
+public:
+    void TestEscalate();
+    void TestRecover();
+    void TestHysteresis();
+    void TestRestartAsLastResort();
+    void TestActiveProcessThreadCount();
+    void TestSyntheticLoad();
+
+protected:
+    static void SetUpTestCase() {
+        INT32_FLAG(resource_governor_escalate_num) = 2;
+        INT32_FLAG(resource_governor_recover_num) = 3;
+        INT32_FLAG(resource_governor_restart_num) = 2;
+        DOUBLE_FLAG(resource_governor_recover_ratio) = 0.8;
+    }
+
+    void SetUp() override { sGovernor->Reset(); }
+
+    // cpu limit 1.0 core, memory limit 1000MB
+    bool OverCpu() { return sGovernor->Update(1.5, 1.0, 100, 1000); }
+    bool OverMem() { return sGovernor->Update(0.1, 1.0, 1500, 1000); }
+    bool Healthy() { return sGovernor->Update(0.1, 1.0, 100, 1000); }
+
+private:
+    static ResourceGovernor* sGovernor;
+};
+
+ResourceGovernor* ResourceGovernorUnittest::sGovernor = ResourceGovernor::GetInstance();
+
+void ResourceGovernorUnittest::TestEscalate() {
+    APSARA_TEST_FALSE(OverCpu());
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+    APSARA_TEST_FALSE(OverCpu());
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::THROTTLE_INPUT, sGovernor->GetLevel());
+    APSARA_TEST_TRUE(sGovernor->IsInputThrottled());
+    APSARA_TEST_FALSE(sGovernor->IsLowPriorityPaused());
+
+    // memory violation counts the same as cpu violation
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::REDUCE_PROCESS_THREAD, sGovernor->GetLevel());
+
+    APSARA_TEST_FALSE(OverCpu());
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::PAUSE_LOW_PRIORITY, sGovernor->GetLevel());
+    APSARA_TEST_TRUE(sGovernor->IsLowPriorityPaused());
+
+    // a single healthy check resets the violation count
+    sGovernor->Reset();
+    APSARA_TEST_FALSE(OverCpu());
+    APSARA_TEST_FALSE(Healthy());
+    APSARA_TEST_FALSE(OverCpu());
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+}
+
+void ResourceGovernorUnittest::TestRecover() {
+    for (int i = 0; i < 6; ++i) {
+        OverCpu();
+    }
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::PAUSE_LOW_PRIORITY, sGovernor->GetLevel());
+
+    Healthy();
+    Healthy();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::PAUSE_LOW_PRIORITY, sGovernor->GetLevel());
+    Healthy();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::REDUCE_PROCESS_THREAD, sGovernor->GetLevel());
+    for (int i = 0; i < 6; ++i) {
+        Healthy();
+    }
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+    APSARA_TEST_FALSE(sGovernor->IsInputThrottled());
+
+    // stays normal
+    Healthy();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+}
+
+void ResourceGovernorUnittest::TestHysteresis() {
+    OverCpu();
+    OverCpu();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::THROTTLE_INPUT, sGovernor->GetLevel());
+
+    // below limit but above limit * recover ratio, neither escalate nor recover
+    for (int i = 0; i < 10; ++i) {
+        APSARA_TEST_FALSE(sGovernor->Update(0.9, 1.0, 100, 1000));
+        APSARA_TEST_FALSE(sGovernor->Update(0.1, 1.0, 900, 1000));
+    }
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::THROTTLE_INPUT, sGovernor->GetLevel());
+
+    // healthy count is reset by a non-healthy check
+    Healthy();
+    Healthy();
+    sGovernor->Update(0.9, 1.0, 100, 1000);
+    Healthy();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::THROTTLE_INPUT, sGovernor->GetLevel());
+    Healthy();
+    Healthy();
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+}
+
+void ResourceGovernorUnittest::TestRestartAsLastResort() {
+    for (int i = 0; i < 6; ++i) {
+        APSARA_TEST_FALSE(OverMem());
+    }
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::PAUSE_LOW_PRIORITY, sGovernor->GetLevel());
+
+    // restart_num = 2, each counted after escalate_num violations
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_TRUE(OverMem());
+
+    // usage drops below limit at the highest level, restart is no longer needed
+    sGovernor->Reset();
+    for (int i = 0; i < 6; ++i) {
+        OverMem();
+    }
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(sGovernor->Update(0.9, 1.0, 900, 1000));
+    APSARA_TEST_FALSE(OverMem());
+    APSARA_TEST_FALSE(OverMem());
+}
+
+void ResourceGovernorUnittest::TestActiveProcessThreadCount() {
+    APSARA_TEST_EQUAL(8U, sGovernor->GetActiveProcessThreadCount(8));
+    OverCpu();
+    OverCpu();
+    APSARA_TEST_EQUAL(8U, sGovernor->GetActiveProcessThreadCount(8));
+    OverCpu();
+    OverCpu();
+    APSARA_TEST_EQUAL(4U, sGovernor->GetActiveProcessThreadCount(8));
+    APSARA_TEST_EQUAL(1U, sGovernor->GetActiveProcessThreadCount(1));
+    APSARA_TEST_TRUE(sGovernor->IsProcessThreadActive(3, 8));
+    APSARA_TEST_FALSE(sGovernor->IsProcessThreadActive(4, 8));
+    OverCpu();
+    OverCpu();
+    APSARA_TEST_EQUAL(1U, sGovernor->GetActiveProcessThreadCount(8));
+    // thread 0 is always active since it also flushes timeout batches
+    APSARA_TEST_TRUE(sGovernor->IsProcessThreadActive(0, 8));
+    APSARA_TEST_FALSE(sGovernor->IsProcessThreadActive(1, 8));
+}
+
+void ResourceGovernorUnittest::TestSyntheticLoad() {
+    // Simulate a workload whose cpu usage is proportional to the number of active process threads. The governor
+    // should settle at a level where usage falls under the limit, without asking for restart.
+    const uint32_t totalThreads = 8;
+    const double cpuPerThread = 0.3, cpuLimit = 1.2;
+    bool restarted = false;
+    for (int i = 0; i < 50; ++i) {
+        double cpu = cpuPerThread * sGovernor->GetActiveProcessThreadCount(totalThreads);
+        if (sGovernor->IsInputThrottled()) {
+            cpu *= 0.9;
+        }
+        restarted |= sGovernor->Update(cpu, cpuLimit, 100, 1000);
+    }
+    APSARA_TEST_FALSE(restarted);
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::REDUCE_PROCESS_THREAD, sGovernor->GetLevel());
+
+    // load disappears, governor goes back to normal
+    for (int i = 0; i < 20; ++i) {
+        sGovernor->Update(0.1, cpuLimit, 100, 1000);
+    }
+    APSARA_TEST_EQUAL(ResourceGovernorLevel::NORMAL, sGovernor->GetLevel());
+
+    // load which cannot be reduced by any degradation finally leads to restart
+    for (int i = 0; i < 20 && !restarted; ++i) {
+        restarted = sGovernor->Update(2.0, cpuLimit, 100, 1000);
+    }
+    APSARA_TEST_TRUE(restarted);
+}
+
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestEscalate)
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestRecover)
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestHysteresis)
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestRestartAsLastResort)
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestActiveProcessThreadCount)
+UNIT_TEST_CASE(ResourceGovernorUnittest, TestSyntheticLoad)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,129 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "common/Flags.h"
+#include "pipeline/limiter/MemoryAccountant.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT64(memory_budget_mb);
+DECLARE_FLAG_DOUBLE(memory_budget_borrow_ratio);
+
+using namespace std;
+
+namespace logtail {
+
+class MemoryAccountantUnittest : public testing::Test {
+public:
+    void TestGetAccount();
+    void TestChargeAndRelease();
+    void TestShare();
+
+protected:
+    static void SetUpTestCase() {
+        INT64_FLAG(memory_budget_mb) = 10;
+        DOUBLE_FLAG(memory_budget_borrow_ratio) = 0.8;
+    }
+
+    static void TearDownTestCase() { INT64_FLAG(memory_budget_mb) = 0; }
+
+    void TearDown() override { MemoryAccountant::GetInstance()->mAccounts.clear(); }
+
+private:
+    static constexpr int64_t sMB = 1024 * 1024;
+};
+
+void MemoryAccountantUnittest::TestGetAccount() {
+    auto accountant = MemoryAccountant::GetInstance();
+    APSARA_TEST_EQUAL(10 * sMB, accountant->GetBudget());
+
+    auto a1 = accountant->GetAccount("a");
+    auto a2 = accountant->GetAccount("a");
+    auto b = accountant->GetAccount("b");
+    APSARA_TEST_EQUAL(a1, a2);
+    APSARA_TEST_NOT_EQUAL(a1, b);
+    APSARA_TEST_EQUAL(2U, accountant->GetAccountCnt());
+
+    a1.reset();
+    a2.reset();
+    APSARA_TEST_EQUAL(1U, accountant->GetAccountCnt());
+    // a new account is created after the old one is gone
+    auto a3 = accountant->GetAccount("a");
+    APSARA_TEST_EQUAL(0, a3->GetUsedBytes());
+    APSARA_TEST_EQUAL(2U, accountant->GetAccountCnt());
+}
+
+void MemoryAccountantUnittest::TestChargeAndRelease() {
+    auto accountant = MemoryAccountant::GetInstance();
+    auto a = accountant->GetAccount("a");
+    auto b = accountant->GetAccount("b");
+
+    a->Charge(100);
+    b->Charge(50);
+    APSARA_TEST_EQUAL(100, a->GetUsedBytes());
+    APSARA_TEST_EQUAL(150, accountant->GetUsedBytes());
+    a->Release(60);
+    APSARA_TEST_EQUAL(40, a->GetUsedBytes());
+    APSARA_TEST_EQUAL(90, accountant->GetUsedBytes());
+
+    // bytes left in an account are returned to the global usage when the account is gone
+    b.reset();
+    APSARA_TEST_EQUAL(40, accountant->GetUsedBytes());
+    a->Release(40);
+    APSARA_TEST_EQUAL(0, accountant->GetUsedBytes());
+}
+
+void MemoryAccountantUnittest::TestShare() {
+    auto accountant = MemoryAccountant::GetInstance();
+    auto large = accountant->GetAccount("large");
+    auto small = accountant->GetAccount("small");
+    // share = 5MB, borrow watermark = 8MB
+
+    // empty account is always valid
+    large->Charge(20 * sMB);
+    APSARA_TEST_FALSE(large->IsValidToCharge());
+    APSARA_TEST_TRUE(small->IsValidToCharge());
+    small->Charge(1);
+    APSARA_TEST_FALSE(small->IsValidToCharge());
+    small->Release(1);
+    large->Release(20 * sMB);
+
+    // exceeding share is allowed while global usage is below borrow watermark
+    large->Charge(7 * sMB);
+    APSARA_TEST_TRUE(large->IsValidToCharge());
+    small->Charge(1 * sMB);
+    // global usage reaches borrow watermark, the account exceeding its share is throttled first
+    APSARA_TEST_FALSE(large->IsValidToCharge());
+    APSARA_TEST_TRUE(small->IsValidToCharge());
+
+    // budget exhausted
+    small->Charge(2 * sMB);
+    APSARA_TEST_FALSE(large->IsValidToCharge());
+    APSARA_TEST_FALSE(small->IsValidToCharge());
+
+    large->Release(7 * sMB);
+    small->Release(3 * sMB);
+    APSARA_TEST_TRUE(large->IsValidToCharge());
+    APSARA_TEST_TRUE(small->IsValidToCharge());
+}
+
+UNIT_TEST_CASE(MemoryAccountantUnittest, TestGetAccount)
+UNIT_TEST_CASE(MemoryAccountantUnittest, TestChargeAndRelease)
+UNIT_TEST_CASE(MemoryAccountantUnittest, TestShare)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -12,9 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <json/json.h>
+
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "config/PipelineConfig.h"
 #include "pipeline/Pipeline.h"
 #include "pipeline/PipelineManager.h"
+#include "pipeline/plugin/PluginRegistry.h"
+#include "plugin/input/InputFeedbackInterfaceRegistry.h"
 #include "unittest/Unittest.h"
+#include "unittest/plugin/PluginMock.h"
+
+DECLARE_FLAG_INT32(pipeline_build_thread_num);
 
 using namespace std;
 
@@ -23,6 +33,17 @@ namespace logtail {
 class PipelineManagerUnittest : public testing::Test {
 public:
     void TestPipelineManagement() const;
+    void TestBuildPipelines() const;
+    void TestUpdateProcessorsOnly() const;
+
+protected:
+    static void SetUpTestCase() {
+        PluginRegistry::GetInstance()->LoadPlugins();
+        LoadPluginMock();
+        InputFeedbackInterfaceRegistry::GetInstance()->LoadFeedbackInterfaces();
+    }
+
+    static void TearDownTestCase() { PluginRegistry::GetInstance()->UnloadPlugins(); }
 };
 
 void PipelineManagerUnittest::TestPipelineManagement() const {
@@ -34,7 +55,142 @@ void PipelineManagerUnittest::TestPipelineManagement() const {
     APSARA_TEST_EQUAL(nullptr, PipelineManager::GetInstance()->FindConfigByName("test3"));
 }
 
+void PipelineManagerUnittest::TestBuildPipelines() const {
+    const string validConfigStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )";
+    // Project is missing
+    const string invalidConfigStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_sls",
+                    "Logstore": "test_logstore",
+                    "Region": "test_region",
+                    "Endpoint": "test_endpoint"
+                }
+            ]
+        }
+    )";
+
+    INT32_FLAG(pipeline_build_thread_num) = 3;
+    vector<PipelineConfig> configs;
+    for (size_t i = 0; i < 10; ++i) {
+        string errorMsg;
+        unique_ptr<Json::Value> configJson(new Json::Value());
+        APSARA_TEST_TRUE(ParseJsonTable(i % 4 == 3 ? invalidConfigStr : validConfigStr, *configJson, errorMsg));
+        configs.emplace_back("test_config_" + ToString(i), std::move(configJson));
+        APSARA_TEST_TRUE(configs.back().Parse());
+    }
+    auto res = PipelineManager::GetInstance()->BuildPipelines(configs);
+    APSARA_TEST_EQUAL(configs.size(), res.size());
+    for (size_t i = 0; i < res.size(); ++i) {
+        if (i % 4 == 3) {
+            APSARA_TEST_EQUAL(nullptr, res[i]);
+        } else {
+            APSARA_TEST_NOT_EQUAL(nullptr, res[i]);
+            APSARA_TEST_EQUAL("test_config_" + ToString(i), res[i]->Name());
+        }
+        // names are kept for feedback
+        APSARA_TEST_EQUAL("test_config_" + ToString(i), configs[i].mName);
+    }
+    INT32_FLAG(pipeline_build_thread_num) = 4;
+}
+
+void PipelineManagerUnittest::TestUpdateProcessorsOnly() const {
+    const string configName = "test_config";
+    auto generateConfig = [&](const string& inputType, size_t processorCnt, const string& filePath = "/home/test.log") {
+        Json::Value detail;
+        detail["inputs"][0]["Type"] = inputType;
+        if (inputType == "input_file") {
+            detail["inputs"][0]["FilePaths"].append(filePath);
+        }
+        for (size_t i = 0; i < processorCnt; ++i) {
+            detail["processors"][static_cast<Json::ArrayIndex>(i)]["Type"] = "processor_mock";
+        }
+        detail["flushers"][0]["Type"] = "flusher_mock";
+        PipelineConfig config(configName, make_unique<Json::Value>(detail));
+        APSARA_TEST_TRUE(config.Parse());
+        return config;
+    };
+    auto manager = PipelineManager::GetInstance();
+    manager->mPipelineNameEntityMap.clear();
+    manager->mPluginCntMap.clear();
+    {
+        PipelineConfigDiff diff;
+        diff.mAdded.emplace_back(generateConfig("input_mock", 1));
+        manager->UpdatePipelines(diff);
+    }
+    auto pipeline = manager->FindConfigByName(configName);
+    APSARA_TEST_NOT_EQUAL(nullptr, pipeline);
+    auto input = pipeline->GetInputs()[0].get();
+    APSARA_TEST_EQUAL(1U, manager->mPluginCntMap["processors"]["processor_mock"]);
+
+    // the pipeline is kept with its processor line replaced, and plugin usage counts follow the new line
+    {
+        PipelineConfigDiff diff;
+        diff.mModified.emplace_back(generateConfig("input_mock", 2));
+        manager->UpdatePipelines(diff);
+    }
+    APSARA_TEST_EQUAL(pipeline, manager->FindConfigByName(configName));
+    APSARA_TEST_EQUAL(input, pipeline->GetInputs()[0].get());
+    APSARA_TEST_EQUAL(2U, pipeline->mProcessorLine.size());
+    APSARA_TEST_EQUAL(2U, manager->mPluginCntMap["processors"]["processor_mock"]);
+    APSARA_TEST_EQUAL(1U, manager->mPluginCntMap["inputs"]["input_mock"]);
+    APSARA_TEST_EQUAL(1U, manager->mPluginCntMap["flushers"]["flusher_mock"]);
+    {
+        PipelineConfigDiff diff;
+        diff.mModified.emplace_back(generateConfig("input_mock", 0));
+        manager->UpdatePipelines(diff);
+    }
+    APSARA_TEST_EQUAL(pipeline, manager->FindConfigByName(configName));
+    APSARA_TEST_EQUAL(0U, manager->mPluginCntMap["processors"]["processor_mock"]);
+    APSARA_TEST_EQUAL(1U, manager->mPluginCntMap["inputs"]["input_mock"]);
+    {
+        PipelineConfigDiff diff;
+        diff.mRemoved.emplace_back(configName);
+        manager->UpdatePipelines(diff);
+    }
+    APSARA_TEST_EQUAL(nullptr, manager->FindConfigByName(configName));
+
+    // the file server is not paused when only processors of a file config change
+    {
+        auto p = make_shared<Pipeline>();
+        APSARA_TEST_TRUE(p->Init(generateConfig("input_file", 1)));
+        manager->mPipelineNameEntityMap[configName] = p;
+        PipelineConfigDiff diff;
+        diff.mModified.emplace_back(generateConfig("input_file", 2));
+        APSARA_TEST_FALSE(manager->IsFileServerInputChanged(diff));
+        diff.mModified.clear();
+        diff.mModified.emplace_back(generateConfig("input_file", 2, "/home/test2.log"));
+        APSARA_TEST_TRUE(manager->IsFileServerInputChanged(diff));
+        diff.mModified.clear();
+        diff.mRemoved.emplace_back(configName);
+        APSARA_TEST_TRUE(manager->IsFileServerInputChanged(diff));
+    }
+    manager->mPipelineNameEntityMap.clear();
+    manager->mPluginCntMap.clear();
+}
+
 UNIT_TEST_CASE(PipelineManagerUnittest, TestPipelineManagement)
+UNIT_TEST_CASE(PipelineManagerUnittest, TestBuildPipelines)
+UNIT_TEST_CASE(PipelineManagerUnittest, TestUpdateProcessorsOnly)
 
 } // namespace logtail
 
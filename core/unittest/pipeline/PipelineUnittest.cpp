@@ -51,6 +51,8 @@ public:
     void TestFlushBatch() const;
     void TestInProcessingCount() const;
     void TestWaitAllItemsInProcessFinished() const;
+    void TestIsOnlyProcessorsChanged() const;
+    void TestUpdateProcessors() const;
 
 protected:
     static void SetUpTestCase() {
@@ -64,6 +66,7 @@ protected:
 
     void TearDown() override {
         TimeoutFlushManager::GetInstance()->mTimeoutRecords.clear();
+        TimeoutFlushManager::GetInstance()->mDeadlineBuckets.clear();
         QueueKeyManager::GetInstance()->Clear();
         ProcessQueueManager::GetInstance()->Clear();
     }
@@ -2821,6 +2824,72 @@ void PipelineUnittest::TestSend() const {
                 = true;
         }
     }
+    {
+        // with event level route
+        Pipeline pipeline;
+        pipeline.mPluginID.store(0);
+        PipelineContext ctx;
+        ctx.SetPipeline(pipeline);
+        Json::Value tmp;
+        {
+            auto flusher
+                = PluginRegistry::GetInstance()->CreateFlusher(FlusherMock::sName, pipeline.GenNextPluginMeta(false));
+            flusher->Init(Json::Value(), ctx, tmp);
+            pipeline.mFlushers.emplace_back(std::move(flusher));
+        }
+        {
+            auto flusher
+                = PluginRegistry::GetInstance()->CreateFlusher(FlusherMock::sName, pipeline.GenNextPluginMeta(false));
+            flusher->Init(Json::Value(), ctx, tmp);
+            pipeline.mFlushers.emplace_back(std::move(flusher));
+        }
+
+        Json::Value configJson;
+        string errorMsg;
+        string configStr = R"(
+            [
+                {
+                    "Type": "event_field",
+                    "Key": "level",
+                    "Value": "ERROR"
+                },
+                {
+                    "Type": "event_field",
+                    "Key": "level",
+                    "Value": "ERROR",
+                    "Negate": true
+                }
+            ]
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        vector<pair<size_t, const Json::Value*>> configs;
+        for (Json::Value::ArrayIndex i = 0; i < configJson.size(); ++i) {
+            configs.emplace_back(i, &configJson[i]);
+        }
+        pipeline.mRouter.Init(configs, ctx);
+
+        {
+            vector<PipelineEventGroup> group;
+            group.emplace_back(make_shared<SourceBuffer>());
+            group[0].AddLogEvent()->SetContent(string("level"), string("ERROR"));
+            group[0].AddLogEvent()->SetContent(string("level"), string("INFO"));
+            APSARA_TEST_TRUE(pipeline.Send(std::move(group)));
+        }
+        {
+            const_cast<FlusherMock*>(static_cast<const FlusherMock*>(pipeline.mFlushers[1]->GetPlugin()))->mIsValid
+                = false;
+            vector<PipelineEventGroup> group;
+            group.emplace_back(make_shared<SourceBuffer>());
+            group[0].AddLogEvent()->SetContent(string("level"), string("ERROR"));
+            APSARA_TEST_TRUE(pipeline.Send(std::move(group)));
+            group.clear();
+            group.emplace_back(make_shared<SourceBuffer>());
+            group[0].AddLogEvent()->SetContent(string("level"), string("INFO"));
+            APSARA_TEST_FALSE(pipeline.Send(std::move(group)));
+            const_cast<FlusherMock*>(static_cast<const FlusherMock*>(pipeline.mFlushers[1]->GetPlugin()))->mIsValid
+                = true;
+        }
+    }
 }
 
 void PipelineUnittest::TestFlushBatch() const {
@@ -2897,6 +2966,321 @@ void PipelineUnittest::TestWaitAllItemsInProcessFinished() const {
     APSARA_TEST_EQUAL(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
 }
 
+void PipelineUnittest::TestIsOnlyProcessorsChanged() const {
+    auto generateConfig = [this](const string& configStr) {
+        unique_ptr<Json::Value> configJson(new Json::Value());
+        string errorMsg;
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, *configJson, errorMsg));
+        auto config = make_unique<PipelineConfig>(configName, std::move(configJson));
+        APSARA_TEST_TRUE(config->Parse());
+        return config;
+    };
+    const string oldConfigStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )";
+
+    {
+        // native processors changed
+        Pipeline pipeline;
+        APSARA_TEST_TRUE(pipeline.Init(std::move(*generateConfig(oldConfigStr))));
+        auto config = generateConfig(R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_mock"
+                    }
+                ],
+                "processors": [
+                    {
+                        "Type": "processor_mock"
+                    },
+                    {
+                        "Type": "processor_mock"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )");
+        APSARA_TEST_TRUE(pipeline.IsOnlyProcessorsChanged(*config));
+    }
+    {
+        // processors removed
+        Pipeline pipeline;
+        APSARA_TEST_TRUE(pipeline.Init(std::move(*generateConfig(oldConfigStr))));
+        auto config = generateConfig(R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_mock"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )");
+        APSARA_TEST_TRUE(pipeline.IsOnlyProcessorsChanged(*config));
+    }
+    {
+        // flushers changed
+        Pipeline pipeline;
+        APSARA_TEST_TRUE(pipeline.Init(std::move(*generateConfig(oldConfigStr))));
+        auto config = generateConfig(R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_mock"
+                    }
+                ],
+                "processors": [
+                    {
+                        "Type": "processor_mock"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    },
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )");
+        APSARA_TEST_FALSE(pipeline.IsOnlyProcessorsChanged(*config));
+    }
+    {
+        // Go processors changed
+        const string goConfigStr = R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_file",
+                        "FilePaths": [
+                            "/home/test.log"
+                        ]
+                    }
+                ],
+                "processors": [
+                    {
+                        "Type": "processor_regex",
+                        "SourceKey": "content"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )";
+        Pipeline pipeline;
+        APSARA_TEST_TRUE(pipeline.Init(std::move(*generateConfig(goConfigStr))));
+        auto config = generateConfig(R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_file",
+                        "FilePaths": [
+                            "/home/test.log"
+                        ]
+                    }
+                ],
+                "processors": [
+                    {
+                        "Type": "processor_regex",
+                        "SourceKey": "key"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )");
+        APSARA_TEST_FALSE(pipeline.IsOnlyProcessorsChanged(*config));
+    }
+    {
+        // first processor becomes apsara parser, which affects inputs
+        Pipeline pipeline;
+        APSARA_TEST_TRUE(pipeline.Init(std::move(*generateConfig(oldConfigStr))));
+        auto config = generateConfig(R"(
+            {
+                "inputs": [
+                    {
+                        "Type": "input_mock"
+                    }
+                ],
+                "processors": [
+                    {
+                        "Type": "processor_parse_apsara_native",
+                        "SourceKey": "content"
+                    }
+                ],
+                "flushers": [
+                    {
+                        "Type": "flusher_mock"
+                    }
+                ]
+            }
+        )");
+        APSARA_TEST_FALSE(pipeline.IsOnlyProcessorsChanged(*config));
+    }
+}
+
+void PipelineUnittest::TestUpdateProcessors() const {
+    auto generateConfig = [this](const string& configStr) {
+        unique_ptr<Json::Value> configJson(new Json::Value());
+        string errorMsg;
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, *configJson, errorMsg));
+        auto config = make_unique<PipelineConfig>(configName, std::move(configJson));
+        APSARA_TEST_TRUE(config->Parse());
+        return config;
+    };
+    auto pipeline = make_shared<Pipeline>();
+    APSARA_TEST_TRUE(pipeline->Init(std::move(*generateConfig(R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )"))));
+    auto input = pipeline->mInputs[0].get();
+    auto flusher = pipeline->mFlushers[0].get();
+    auto key = pipeline->GetContext().GetProcessQueueKey();
+    ProcessQueueManager::GetInstance()->EnablePop(configName);
+
+    // keep the pipeline under load during update
+    const size_t totalCnt = 2000;
+    atomic_size_t pushedCnt = 0;
+    size_t processedCnt = 0;
+    int64_t maxGapMs = 0;
+    auto producer = async(launch::async, [&]() {
+        while (pushedCnt < totalCnt) {
+            if (ProcessQueueManager::GetInstance()->PushQueue(key, GenerateProcessItem(pipeline)) == 0) {
+                ++pushedCnt;
+            } else {
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+        }
+    });
+    auto consumer = async(launch::async, [&]() {
+        auto last = chrono::steady_clock::now();
+        while (processedCnt < totalCnt) {
+            unique_ptr<ProcessQueueItem> item;
+            string name;
+            if (!ProcessQueueManager::GetInstance()->PopItem(0, item, name)) {
+                this_thread::sleep_for(chrono::microseconds(100));
+                continue;
+            }
+            vector<PipelineEventGroup> groups;
+            groups.emplace_back(std::move(item->mEventGroup));
+            item->mPipeline->Process(groups, item->mInputIndex);
+            item->mPipeline->SubInProcessCnt();
+            ++processedCnt;
+            auto now = chrono::steady_clock::now();
+            auto gapMs = chrono::duration_cast<chrono::milliseconds>(now - last).count();
+            maxGapMs = max(maxGapMs, static_cast<int64_t>(gapMs));
+            last = now;
+        }
+    });
+
+    while (pushedCnt < totalCnt / 2) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    auto config = generateConfig(R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_mock"
+                },
+                {
+                    "Type": "processor_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )");
+    APSARA_TEST_TRUE(pipeline->IsOnlyProcessorsChanged(*config));
+    APSARA_TEST_TRUE(pipeline->UpdateProcessors(std::move(*config)));
+
+    APSARA_TEST_EQUAL(future_status::ready, producer.wait_for(chrono::seconds(10)));
+    APSARA_TEST_EQUAL(future_status::ready, consumer.wait_for(chrono::seconds(10)));
+    // no group is lost, and processing is paused only for the groups in flight
+    APSARA_TEST_EQUAL(totalCnt, processedCnt);
+    APSARA_TEST_TRUE(maxGapMs < 1000);
+    APSARA_TEST_EQUAL(0, pipeline->mInProcessCnt.load());
+
+    // inputs, flushers and queues are kept
+    APSARA_TEST_EQUAL(input, pipeline->mInputs[0].get());
+    APSARA_TEST_EQUAL(flusher, pipeline->mFlushers[0].get());
+    APSARA_TEST_EQUAL(key, pipeline->GetContext().GetProcessQueueKey());
+    APSARA_TEST_EQUAL(2U, pipeline->mProcessorLine.size());
+    APSARA_TEST_EQUAL(2U, pipeline->GetPluginStatistics().at("processors").at(ProcessorMock::sName));
+    APSARA_TEST_EQUAL(2U, pipeline->GetConfig()["processors"].size());
+    APSARA_TEST_FALSE(pipeline->IsOnlyProcessorsChanged(*generateConfig(R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_mock"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_mock"
+                },
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )")));
+}
+
 UNIT_TEST_CASE(PipelineUnittest, OnSuccessfulInit)
 UNIT_TEST_CASE(PipelineUnittest, OnFailedInit)
 UNIT_TEST_CASE(PipelineUnittest, TestProcessQueue)
@@ -2908,6 +3292,8 @@ UNIT_TEST_CASE(PipelineUnittest, TestSend)
 UNIT_TEST_CASE(PipelineUnittest, TestFlushBatch)
 UNIT_TEST_CASE(PipelineUnittest, TestInProcessingCount)
 UNIT_TEST_CASE(PipelineUnittest, TestWaitAllItemsInProcessFinished)
+UNIT_TEST_CASE(PipelineUnittest, TestIsOnlyProcessorsChanged)
+UNIT_TEST_CASE(PipelineUnittest, TestUpdateProcessors)
 
 } // namespace logtail
 
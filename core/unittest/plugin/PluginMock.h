@@ -23,6 +23,7 @@
 #include "pipeline/plugin/creator/StaticFlusherCreator.h"
 #include "pipeline/plugin/creator/StaticInputCreator.h"
 #include "pipeline/plugin/creator/StaticProcessorCreator.h"
+#include "pipeline/plugin/interface/FileFlusher.h"
 #include "pipeline/plugin/interface/Flusher.h"
 #include "pipeline/plugin/interface/HttpFlusher.h"
 #include "pipeline/plugin/interface/Input.h"
@@ -138,6 +139,27 @@ public:
 
 const std::string FlusherHttpMock::sName = "flusher_http_mock";
 
+class FlusherFileMock : public FileFlusher {
+public:
+    static const std::string sName;
+
+    const std::string& Name() const override { return sName; }
+    bool Init(const Json::Value& config, Json::Value& optionalGoPipeline) override {
+        GenerateQueueKey("mock");
+        SenderQueueManager::GetInstance()->CreateQueue(mQueueKey, mPluginID, *mContext);
+        return true;
+    }
+    bool Send(PipelineEventGroup&& g) override { return true; }
+    bool Flush(size_t key) override { return true; }
+    bool FlushAll() override { return true; }
+    std::unique_ptr<FileSinkRequest> BuildRequest(SenderQueueItem* item) const override {
+        return std::make_unique<FileSinkRequest>(item, nullptr, CompressType::NONE, RecordDataType::UNKNOWN);
+    }
+    void OnWriteDone(bool success, const std::string& errorMsg, SenderQueueItem* item) override {}
+};
+
+const std::string FlusherFileMock::sName = "flusher_file_mock";
+
 void LoadPluginMock() {
     PluginRegistry::GetInstance()->RegisterInputCreator(new StaticInputCreator<InputMock>());
     PluginRegistry::GetInstance()->RegisterProcessorCreator(new StaticProcessorCreator<ProcessorInnerMock>());
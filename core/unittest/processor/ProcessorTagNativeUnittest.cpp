@@ -15,9 +15,12 @@
 #include <cstdlib>
 
 #include "common/Constants.h"
+#include "common/JsonUtil.h"
 #include "config/PipelineConfig.h"
 #include "file_server/ConfigManager.h"
 #include "pipeline/Pipeline.h"
+#include "pipeline/plugin/PluginRegistry.h"
+#include "pipeline/queue/QueueKeyManager.h"
 #include "plugin/processor/inner/ProcessorTagNative.h"
 #include "unittest/Unittest.h"
 #ifdef __ENTERPRISE__
@@ -30,6 +33,8 @@ class ProcessorTagNativeUnittest : public ::testing::Test {
 public:
     void TestInit();
     void TestProcess();
+    void TestTagBlock();
+    void TestGoFlushingPipeline();
 
 protected:
     void SetUp() override {
@@ -111,8 +116,85 @@ void ProcessorTagNativeUnittest::TestProcess() {
     }
 }
 
+void ProcessorTagNativeUnittest::TestTagBlock() {
+    Json::Value config;
+    Pipeline pipeline;
+    mContext.SetPipeline(pipeline);
+    ProcessorTagNative processor;
+    processor.SetContext(mContext);
+    APSARA_TEST_TRUE_FATAL(processor.Init(config));
+
+    auto sourceBuffer = std::make_shared<logtail::SourceBuffer>();
+    PipelineEventGroup eventGroup1(sourceBuffer);
+    processor.Process(eventGroup1);
+    PipelineEventGroup eventGroup2(sourceBuffer);
+    processor.Process(eventGroup2);
+    // tags are not copied, and the block is shared by groups
+    auto block = std::atomic_load(&processor.mTagBlock);
+    APSARA_TEST_EQUAL(1U, eventGroup1.GetRetainedSourceBuffers().size());
+    APSARA_TEST_EQUAL(block->mSourceBuffer, eventGroup1.GetRetainedSourceBuffers()[0]);
+    APSARA_TEST_EQUAL(block->mSourceBuffer, eventGroup2.GetRetainedSourceBuffers()[0]);
+    APSARA_TEST_EQUAL(eventGroup1.GetTag(LOG_RESERVED_KEY_HOSTNAME).data(),
+                      eventGroup2.GetTag(LOG_RESERVED_KEY_HOSTNAME).data());
+
+    // block is rebuilt when source value changes
+    std::string hostname = LogFileProfiler::mHostname;
+    LogFileProfiler::mHostname = "new_hostname";
+    processor.mLastCheckTime = 0;
+    PipelineEventGroup eventGroup3(sourceBuffer);
+    processor.Process(eventGroup3);
+    APSARA_TEST_NOT_EQUAL(block, std::atomic_load(&processor.mTagBlock));
+    APSARA_TEST_EQUAL("new_hostname", eventGroup3.GetTag(LOG_RESERVED_KEY_HOSTNAME).to_string());
+    // previous block is still valid for groups referencing it
+    APSARA_TEST_EQUAL(hostname, eventGroup1.GetTag(LOG_RESERVED_KEY_HOSTNAME).to_string());
+    LogFileProfiler::mHostname = hostname;
+}
+
+void ProcessorTagNativeUnittest::TestGoFlushingPipeline() {
+    PluginRegistry::GetInstance()->LoadPlugins();
+    // the inner processors of the input are initialized before the go flusher is added to the pipeline
+    std::string configStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_file",
+                    "FilePaths": [
+                        "/home/test.log"
+                    ]
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_kafka_v2"
+                }
+            ]
+        }
+    )";
+    std::string errorMsg;
+    auto configJson = std::make_unique<Json::Value>();
+    APSARA_TEST_TRUE_FATAL(ParseJsonTable(configStr, *configJson, errorMsg));
+    PipelineConfig config("test_config", std::move(configJson));
+    APSARA_TEST_TRUE_FATAL(config.Parse());
+    Pipeline pipeline;
+    APSARA_TEST_TRUE_FATAL(pipeline.Init(std::move(config)));
+    APSARA_TEST_TRUE(pipeline.IsFlushingThroughGoPipeline());
+
+    std::vector<PipelineEventGroup> groups;
+    groups.emplace_back(std::make_shared<SourceBuffer>());
+    pipeline.Process(groups, 0);
+    APSARA_TEST_EQUAL(1U, groups.size());
+    APSARA_TEST_FALSE(groups[0].HasTag(LOG_RESERVED_KEY_HOSTNAME));
+    APSARA_TEST_FALSE(groups[0].HasTag(LOG_RESERVED_KEY_SOURCE));
+    APSARA_TEST_FALSE(groups[0].HasTag(LOG_RESERVED_KEY_MACHINE_UUID));
+
+    QueueKeyManager::GetInstance()->Clear();
+    PluginRegistry::GetInstance()->UnloadPlugins();
+}
+
 UNIT_TEST_CASE(ProcessorTagNativeUnittest, TestInit)
 UNIT_TEST_CASE(ProcessorTagNativeUnittest, TestProcess)
+UNIT_TEST_CASE(ProcessorTagNativeUnittest, TestTagBlock)
+UNIT_TEST_CASE(ProcessorTagNativeUnittest, TestGoFlushingPipeline)
 
 } // namespace logtail
 
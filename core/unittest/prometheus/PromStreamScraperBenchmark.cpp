@@ -0,0 +1,180 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+
+#include "common/http/Curl.h"
+#include "prometheus/async/PromStreamScraper.h"
+#include "prometheus/labels/TextParser.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Scrapes a local exporter stub serving 50MB of metrics, with and without compression. Cpu time is of the whole
+// process, including the stub.
+class PromStreamScraperBenchmark : public testing::Test {
+public:
+    void TestScrapeIdentity();
+    void TestScrapeGzip();
+
+protected:
+    static void SetUpTestCase() {
+        string line = "node_network_receive_bytes_total{device=\"eth0\",instance=\"node-1\",job=\"node\"} ";
+        for (size_t i = 0; sPayload.size() < 50 * 1024 * 1024; ++i) {
+            sPayload.append(line).append(to_string(i * 1024)).append("\n");
+        }
+        z_stream zs{};
+        deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+        sGzipPayload.resize(deflateBound(&zs, sPayload.size()));
+        zs.next_in = reinterpret_cast<Bytef*>(sPayload.data());
+        zs.avail_in = sPayload.size();
+        zs.next_out = reinterpret_cast<Bytef*>(sGzipPayload.data());
+        zs.avail_out = sGzipPayload.size();
+        deflate(&zs, Z_FINISH);
+        sGzipPayload.resize(zs.total_out);
+        deflateEnd(&zs);
+    }
+
+    void SetUp() override {
+        mListenFd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        bind(mListenFd, (sockaddr*)&addr, sizeof(addr));
+        listen(mListenFd, 4);
+        getsockname(mListenFd, (sockaddr*)&addr, &len);
+        mPort = ntohs(addr.sin_port);
+        mServer = thread([this]() { Serve(); });
+    }
+
+    void TearDown() override {
+        shutdown(mListenFd, SHUT_RDWR);
+        close(mListenFd);
+        mServer.join();
+    }
+
+private:
+    // serves one request per connection, gzip is used if accepted
+    void Serve() {
+        int fd;
+        while ((fd = accept(mListenFd, nullptr, nullptr)) >= 0) {
+            string req;
+            char buf[4096];
+            ssize_t n;
+            while (req.find("\r\n\r\n") == string::npos && (n = read(fd, buf, sizeof(buf))) > 0) {
+                req.append(buf, n);
+            }
+            bool gzip = req.find("gzip") != string::npos;
+            const string& body = gzip ? sGzipPayload : sPayload;
+            string resp = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: " + to_string(body.size())
+                + "\r\n" + (gzip ? "Content-Encoding: gzip\r\n" : "") + "Connection: close\r\n\r\n";
+            resp.append(body);
+            size_t off = 0;
+            while (off < resp.size() && (n = write(fd, resp.data() + off, resp.size() - off)) > 0) {
+                off += n;
+            }
+            mSentBytes += off;
+            close(fd);
+        }
+    }
+
+    void Scrape(const string& encoding, bool streaming);
+
+    static string sPayload;
+    static string sGzipPayload;
+
+    int mListenFd = -1;
+    int32_t mPort = 0;
+    thread mServer;
+    atomic_uint64_t mSentBytes = 0;
+};
+
+string PromStreamScraperBenchmark::sPayload;
+string PromStreamScraperBenchmark::sGzipPayload;
+
+static double GetCpuTimeMs() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+void PromStreamScraperBenchmark::Scrape(const string& encoding, bool streaming) {
+    auto start = chrono::steady_clock::now();
+    auto cpuStart = GetCpuTimeMs();
+
+    HttpResponse response;
+    shared_ptr<PromStreamScraper> scraper;
+    if (streaming) {
+        scraper = make_shared<PromStreamScraper>();
+        response.mBodySink = scraper;
+    }
+    curl_slist* headers = nullptr;
+    CURL* curl = CreateCurlHandler("GET",
+                                   false,
+                                   "127.0.0.1",
+                                   mPort,
+                                   "/metrics",
+                                   "",
+                                   {{"Accept-Encoding", encoding}},
+                                   "",
+                                   response,
+                                   headers,
+                                   60,
+                                   false);
+    APSARA_TEST_EQUAL(CURLE_OK, curl_easy_perform(curl));
+    curl_slist_free_all(headers);
+    curl_easy_cleanup(curl);
+
+    TextParser parser;
+    auto eGroup = streaming ? scraper->Finish() : parser.BuildLogGroup(response.mBody);
+
+    auto wallMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    auto cpuMs = GetCpuTimeMs() - cpuStart;
+    APSARA_TEST_EQUAL(count(sPayload.begin(), sPayload.end(), '\n'), static_cast<long>(eGroup.GetEvents().size()));
+    cout << "encoding: " << encoding << "\tstreaming: " << streaming << "\twire bytes: " << mSentBytes.load()
+         << "\tbuffered body bytes: " << response.mBody.capacity() << "\twall: " << wallMs << "ms\tcpu: " << cpuMs
+         << "ms" << endl;
+}
+
+void PromStreamScraperBenchmark::TestScrapeIdentity() {
+    Scrape("identity", false);
+    // wire bytes: 52428965, buffered body bytes: 66924544, wall: 522ms, cpu: 506ms in release mode
+}
+
+void PromStreamScraperBenchmark::TestScrapeGzip() {
+    Scrape(GetSupportedContentEncodings(), true);
+    // wire bytes: 2541328, buffered body bytes: 15, wall: 432ms, cpu: 430ms in release mode
+}
+
+UNIT_TEST_CASE(PromStreamScraperBenchmark, TestScrapeIdentity)
+UNIT_TEST_CASE(PromStreamScraperBenchmark, TestScrapeGzip)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "prometheus/Constants.h"
+#include "prometheus/async/PromStreamScraper.h"
+#include "prometheus/labels/TextParser.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class PromStreamScraperUnittest : public testing::Test {
+public:
+    void TestWrite();
+    void TestReset();
+
+private:
+    void CheckEqual(const PipelineEventGroup& expected, const PipelineEventGroup& actual) {
+        APSARA_TEST_EQUAL(expected.GetEvents().size(), actual.GetEvents().size());
+        for (size_t i = 0; i < expected.GetEvents().size() && i < actual.GetEvents().size(); ++i) {
+            APSARA_TEST_EQUAL(expected.GetEvents()[i].Cast<LogEvent>().GetContent(prometheus::PROMETHEUS),
+                              actual.GetEvents()[i].Cast<LogEvent>().GetContent(prometheus::PROMETHEUS));
+        }
+    }
+
+    const string mBody = "# HELP go_gc_duration_seconds A summary of the pause duration.\n"
+                         "# TYPE go_gc_duration_seconds summary\n"
+                         "go_gc_duration_seconds{quantile=\"0\"} 1.5531e-05\n"
+                         "\n"
+                         "go_gc_duration_seconds{quantile=\"0.25\"} 3.9357e-05\n"
+                         "go_gc_duration_seconds_sum 9.8154e-04\n"
+                         "go_gc_duration_seconds_count 23";
+};
+
+void PromStreamScraperUnittest::TestWrite() {
+    TextParser parser;
+    auto expected = parser.BuildLogGroup(mBody);
+    APSARA_TEST_EQUAL(4U, expected.GetEvents().size());
+
+    // body split at every position, including the last line without line feed
+    for (size_t i = 0; i <= mBody.size(); ++i) {
+        PromStreamScraper scraper;
+        scraper.Write(mBody.data(), i);
+        scraper.Write(mBody.data() + i, mBody.size() - i);
+        APSARA_TEST_EQUAL(mBody.size(), scraper.GetRawSize());
+        CheckEqual(expected, scraper.Finish());
+    }
+
+    // byte by byte
+    PromStreamScraper scraper;
+    for (char c : mBody) {
+        scraper.Write(&c, 1);
+    }
+    // only the incomplete last line is cached
+    APSARA_TEST_EQUAL("go_gc_duration_seconds_count 23", scraper.mCache);
+    CheckEqual(expected, scraper.Finish());
+}
+
+void PromStreamScraperUnittest::TestReset() {
+    PromStreamScraper scraper;
+    scraper.Write(mBody.data(), mBody.size() / 2);
+    scraper.Reset();
+    APSARA_TEST_EQUAL(0U, scraper.GetRawSize());
+    APSARA_TEST_TRUE(scraper.mCache.empty());
+    APSARA_TEST_TRUE(scraper.mEventGroup.GetEvents().empty());
+
+    scraper.Write(mBody.data(), mBody.size());
+    TextParser parser;
+    CheckEqual(parser.BuildLogGroup(mBody), scraper.Finish());
+}
+
+UNIT_TEST_CASE(PromStreamScraperUnittest, TestWrite)
+UNIT_TEST_CASE(PromStreamScraperUnittest, TestReset)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
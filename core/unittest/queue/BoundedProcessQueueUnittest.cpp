@@ -15,6 +15,7 @@
 #include <memory>
 
 #include "common/FeedbackInterface.h"
+#include "common/Flags.h"
 #include "models/PipelineEventGroup.h"
 #include "pipeline/PipelineManager.h"
 #include "pipeline/queue/BoundedProcessQueue.h"
@@ -22,6 +23,8 @@
 #include "unittest/Unittest.h"
 #include "unittest/queue/FeedbackInterfaceMock.h"
 
+DECLARE_FLAG_INT64(memory_budget_mb);
+
 using namespace std;
 
 namespace logtail {
@@ -32,6 +35,8 @@ public:
     void TestPop();
     void TestMetric();
     void TestSetPipeline();
+    void TestMemoryBudget();
+    void TestFeedbackOnMemoryReleasedBySenderQueue();
 
 protected:
     static void SetUpTestCase() { sCtx.SetConfigName("test_config"); }
@@ -164,10 +169,70 @@ void BoundedProcessQueueUnittest::TestSetPipeline() {
     APSARA_TEST_EQUAL(pipeline, p2->mPipeline);
 }
 
+void BoundedProcessQueueUnittest::TestMemoryBudget() {
+    INT64_FLAG(memory_budget_mb) = 1;
+    auto generateLargeItem = [this]() {
+        auto item = GenerateItem();
+        auto e = item->mEventGroup.AddLogEvent();
+        e->SetContent(string("key"), string(600 * 1024, 'a'));
+        return item;
+    };
+    auto dataSize = generateLargeItem()->mEventGroup.DataSize();
+
+    // account holding nothing is always admitted
+    APSARA_TEST_TRUE(mQueue->Push(generateLargeItem()));
+    APSARA_TEST_EQUAL(static_cast<int64_t>(dataSize), mQueue->mMemoryAccount->GetUsedBytes());
+    APSARA_TEST_TRUE(mQueue->Push(generateLargeItem()));
+    // budget is exhausted, though item count is below high watermark
+    APSARA_TEST_FALSE(mQueue->IsValidToPush());
+    APSARA_TEST_FALSE(mQueue->Push(generateLargeItem()));
+
+    // memory released, push is resumed and upstream is notified once no queue lock is held
+    unique_ptr<ProcessQueueItem> item;
+    APSARA_TEST_TRUE(mQueue->Pop(item));
+    APSARA_TEST_EQUAL(static_cast<int64_t>(dataSize), mQueue->mMemoryAccount->GetUsedBytes());
+    APSARA_TEST_FALSE(static_cast<FeedbackInterfaceMock*>(mFeedback1.get())->HasFeedback(sKey));
+    MemoryAccountant::GetInstance()->GiveFeedbackIfAdmitted();
+    APSARA_TEST_TRUE(static_cast<FeedbackInterfaceMock*>(mFeedback1.get())->HasFeedback(sKey));
+    APSARA_TEST_TRUE(static_cast<FeedbackInterfaceMock*>(mFeedback2.get())->HasFeedback(sKey));
+    APSARA_TEST_TRUE(mQueue->IsValidToPush());
+
+    // charged bytes are released when the queue is destructed
+    mQueue.reset();
+    APSARA_TEST_EQUAL(0, MemoryAccountant::GetInstance()->GetUsedBytes());
+    INT64_FLAG(memory_budget_mb) = 0;
+}
+
+void BoundedProcessQueueUnittest::TestFeedbackOnMemoryReleasedBySenderQueue() {
+    INT64_FLAG(memory_budget_mb) = 1;
+    auto senderItem = make_unique<SenderQueueItem>(string(600 * 1024, 'a'), 600 * 1024, nullptr, sKey);
+    auto p = senderItem.get();
+    mSenderQueue1->Push(std::move(senderItem));
+
+    auto item = GenerateItem();
+    item->mEventGroup.AddLogEvent()->SetContent(string("key"), string(600 * 1024, 'a'));
+    APSARA_TEST_TRUE(mQueue->Push(std::move(item)));
+    APSARA_TEST_FALSE(mQueue->IsValidToPush());
+    // checking does not register the upstreams, while a rejected push does
+    APSARA_TEST_TRUE(MemoryAccountant::GetInstance()->mRejectedQueues.empty());
+    APSARA_TEST_FALSE(mQueue->Push(GenerateItem()));
+    APSARA_TEST_EQUAL(1U, MemoryAccountant::GetInstance()->mRejectedQueues.size());
+
+    // memory is released by the sender queue of the pipeline, while the process queue is not popped
+    mSenderQueue1->Remove(p);
+    MemoryAccountant::GetInstance()->GiveFeedbackIfAdmitted();
+    APSARA_TEST_TRUE(static_cast<FeedbackInterfaceMock*>(mFeedback1.get())->HasFeedback(sKey));
+    APSARA_TEST_TRUE(static_cast<FeedbackInterfaceMock*>(mFeedback2.get())->HasFeedback(sKey));
+    APSARA_TEST_TRUE(mQueue->IsValidToPush());
+    INT64_FLAG(memory_budget_mb) = 0;
+}
+
 UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestPush)
 UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestPop)
 UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestMetric)
 UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestSetPipeline)
+UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestMemoryBudget)
+UNIT_TEST_CASE(BoundedProcessQueueUnittest, TestFeedbackOnMemoryReleasedBySenderQueue)
 
 } // namespace logtail
 
@@ -14,12 +14,16 @@
 
 #include <memory>
 
+#include "common/Flags.h"
 #include "models/PipelineEventGroup.h"
 #include "pipeline/PipelineManager.h"
+#include "pipeline/limiter/MemoryAccountant.h"
 #include "pipeline/queue/CircularProcessQueue.h"
 #include "pipeline/queue/SenderQueue.h"
 #include "unittest/Unittest.h"
 
+DECLARE_FLAG_INT64(memory_budget_mb);
+
 using namespace std;
 
 namespace logtail {
@@ -30,6 +34,7 @@ public:
     void TestReset();
     void TestMetric();
     void TestSetPipeline();
+    void TestMemoryBudget();
 
 protected:
     static void SetUpTestCase() { sCtx.SetConfigName("test_config"); }
@@ -201,11 +206,44 @@ void CircularProcessQueueUnittest::TestSetPipeline() {
     APSARA_TEST_EQUAL(pipeline, p2->mPipeline);
 }
 
+void CircularProcessQueueUnittest::TestMemoryBudget() {
+    INT64_FLAG(memory_budget_mb) = 1;
+    mQueue.reset(new CircularProcessQueue(10, sKey, 1, sCtx));
+    auto generateLargeItem = [this]() {
+        auto item = GenerateItem(0);
+        item->mEventGroup.AddLogEvent()->SetContent(string("key"), string(400 * 1024, 'a'));
+        return item;
+    };
+
+    // another pipeline exhausts the budget, and the share of each pipeline is half of the budget
+    auto other = MemoryAccountant::GetInstance()->GetAccount("other_config");
+    other->Charge(1024 * 1024);
+    APSARA_TEST_EQUAL(512 * 1024, MemoryAccountant::GetInstance()->GetShare());
+
+    // data of this pipeline within its share is kept
+    APSARA_TEST_TRUE(mQueue->Push(generateLargeItem()));
+    auto p = generateLargeItem();
+    auto second = p.get();
+    APSARA_TEST_TRUE(mQueue->Push(std::move(p)));
+    APSARA_TEST_EQUAL(2U, mQueue->Size());
+
+    // only data of this pipeline above its share is discarded
+    APSARA_TEST_TRUE(mQueue->Push(generateLargeItem()));
+    APSARA_TEST_EQUAL(2U, mQueue->Size());
+    unique_ptr<ProcessQueueItem> item;
+    APSARA_TEST_TRUE(mQueue->Pop(item));
+    APSARA_TEST_EQUAL(second, item.get());
+
+    other->Release(1024 * 1024);
+    INT64_FLAG(memory_budget_mb) = 0;
+}
+
 UNIT_TEST_CASE(CircularProcessQueueUnittest, TestPush)
 UNIT_TEST_CASE(CircularProcessQueueUnittest, TestPop)
 UNIT_TEST_CASE(CircularProcessQueueUnittest, TestReset)
 UNIT_TEST_CASE(CircularProcessQueueUnittest, TestMetric)
 UNIT_TEST_CASE(CircularProcessQueueUnittest, TestSetPipeline)
+UNIT_TEST_CASE(CircularProcessQueueUnittest, TestMemoryBudget)
 
 } // namespace logtail
 
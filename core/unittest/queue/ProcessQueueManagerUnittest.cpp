@@ -14,13 +14,18 @@
 
 #include <memory>
 
+#include "common/Flags.h"
 #include "models/PipelineEventGroup.h"
+#include "monitor/ResourceGovernor.h"
 #include "pipeline/PipelineManager.h"
 #include "pipeline/queue/ExactlyOnceQueueManager.h"
 #include "pipeline/queue/ProcessQueueManager.h"
 #include "pipeline/queue/QueueKeyManager.h"
 #include "pipeline/queue/QueueParam.h"
 #include "unittest/Unittest.h"
+#include "unittest/queue/FeedbackInterfaceMock.h"
+
+DECLARE_FLAG_INT64(memory_budget_mb);
 
 using namespace std;
 
@@ -34,6 +39,8 @@ public:
     void TestSetQueueUpstreamAndDownStream();
     void TestPushQueue();
     void TestPopItem();
+    void TestPopItemWhenLowPriorityPaused();
+    void TestFeedbackOnMemoryReleased();
     void TestIsAllQueueEmpty();
     void OnPipelineUpdate();
 
@@ -323,6 +330,71 @@ void ProcessQueueManagerUnittest::TestPopItem() {
     APSARA_TEST_TRUE(sProcessQueueManager->mCurrentQueueIndex.second == sProcessQueueManager->mQueues[key1].first);
 }
 
+void ProcessQueueManagerUnittest::TestPopItemWhenLowPriorityPaused() {
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+
+    PipelineContext ctx;
+    ctx.SetConfigName("test_config_1");
+    QueueKey key1 = QueueKeyManager::GetInstance()->GetKey("test_config_1");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key1, 0, ctx);
+    sProcessQueueManager->EnablePop("test_config_1");
+    ctx.SetConfigName("test_config_2");
+    QueueKey key2 = QueueKeyManager::GetInstance()->GetKey("test_config_2");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key2, ProcessQueueManager::sLowPriority, ctx);
+    sProcessQueueManager->EnablePop("test_config_2");
+    // default priority
+    ctx.SetConfigName("test_config_3");
+    QueueKey key3 = QueueKeyManager::GetInstance()->GetKey("test_config_3");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key3, ProcessQueueManager::sMaxPriority, ctx);
+    sProcessQueueManager->EnablePop("test_config_3");
+
+    ResourceGovernor::GetInstance()->mLevel = ResourceGovernorLevel::PAUSE_LOW_PRIORITY;
+    sProcessQueueManager->PushQueue(key1, GenerateItem());
+    sProcessQueueManager->PushQueue(key2, GenerateItem());
+    sProcessQueueManager->PushQueue(key3, GenerateItem());
+    sProcessQueueManager->PushQueue(key3, GenerateItem());
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_1", configName);
+    // queues with default priority keep being popped
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_3", configName);
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_3", configName);
+    APSARA_TEST_FALSE(sProcessQueueManager->PopItem(0, item, configName));
+
+    ResourceGovernor::GetInstance()->Reset();
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_2", configName);
+}
+
+void ProcessQueueManagerUnittest::TestFeedbackOnMemoryReleased() {
+    INT64_FLAG(memory_budget_mb) = 1;
+    PipelineContext ctx;
+    ctx.SetConfigName("test_config_1");
+    QueueKey key = QueueKeyManager::GetInstance()->GetKey("test_config_1");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key, 0, ctx);
+    sProcessQueueManager->EnablePop("test_config_1");
+    FeedbackInterfaceMock feedback;
+    sProcessQueueManager->SetFeedbackInterface(key, vector<FeedbackInterface*>{&feedback});
+
+    for (size_t i = 0; i < 2; ++i) {
+        auto item = GenerateItem();
+        item->mEventGroup.AddLogEvent()->SetContent(string("key"), string(600 * 1024, 'a'));
+        APSARA_TEST_EQUAL(0, sProcessQueueManager->PushQueue(key, std::move(item)));
+    }
+    // the upstream is told to wait
+    APSARA_TEST_FALSE(sProcessQueueManager->IsValidToPush(key));
+
+    // and notified once memory is released
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_TRUE(feedback.HasFeedback(key));
+    APSARA_TEST_TRUE(sProcessQueueManager->IsValidToPush(key));
+    INT64_FLAG(memory_budget_mb) = 0;
+}
+
 void ProcessQueueManagerUnittest::TestIsAllQueueEmpty() {
     PipelineContext ctx;
     ctx.SetConfigName("test_config_1");
@@ -475,6 +547,8 @@ UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestDeleteQueue)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestSetQueueUpstreamAndDownStream)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestPushQueue)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestPopItem)
+UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestPopItemWhenLowPriorityPaused)
+UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestFeedbackOnMemoryReleased)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestIsAllQueueEmpty)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, OnPipelineUpdate)
 
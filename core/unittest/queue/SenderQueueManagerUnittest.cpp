@@ -33,6 +33,7 @@ public:
     void TestGetQueue();
     void TestPushQueue();
     void TestGetAvailableItems();
+    void TestReadyQueues();
     void TestRemoveItem();
     void TestIsAllQueueEmpty();
 
@@ -229,6 +230,55 @@ void SenderQueueManagerUnittest::TestGetAvailableItems() {
     }
 }
 
+void SenderQueueManagerUnittest::TestReadyQueues() {
+    for (QueueKey key = 0; key < 3; ++key) {
+        sManager->CreateQueue(key, sFlusherId, sCtx, {{"region", sConcurrencyLimiter}}, sMaxRate);
+    }
+    APSARA_TEST_TRUE(sManager->mReadyQueues.empty());
+
+    sManager->PushQueue(2, GenerateItem());
+    sManager->PushQueue(0, GenerateItem());
+    sManager->PushQueue(2, GenerateItem());
+    APSARA_TEST_EQUAL(deque<QueueKey>({2, 0}), sManager->mReadyQueues);
+
+    vector<SenderQueueItem*> items;
+    {
+        // queues without idle items are removed from ready list
+        sManager->GetAvailableItems(items, 80);
+        APSARA_TEST_EQUAL(3U, items.size());
+        APSARA_TEST_TRUE(sManager->mReadyQueues.empty());
+        APSARA_TEST_TRUE(sManager->mReadyQueueKeys.empty());
+    }
+    {
+        // queue is ready again after an item is put back for retry
+        items[2]->mStatus.Set(SendingStatus::IDLE);
+        sManager->MarkQueueReady(0);
+        sManager->MarkQueueReady(0);
+        sManager->MarkQueueReady(3);
+        APSARA_TEST_EQUAL(deque<QueueKey>({0}), sManager->mReadyQueues);
+    }
+    {
+        // queue rejected by limiters is blocked
+        sConcurrencyLimiter->SetCurrentLimit(3);
+        vector<SenderQueueItem*> res;
+        sManager->GetAvailableItems(res, 80);
+        APSARA_TEST_TRUE(res.empty());
+        APSARA_TEST_TRUE(sManager->mReadyQueues.empty());
+        APSARA_TEST_EQUAL(1U, sManager->mBlockedQueueKeys.count(0));
+    }
+    {
+        // blocked queue is unblocked after some item is sent
+        sManager->DecreaseConcurrencyLimiterInSendingCnt(2);
+        APSARA_TEST_TRUE(sManager->mIsLimiterReleased);
+        vector<SenderQueueItem*> res;
+        sManager->GetAvailableItems(res, 80);
+        APSARA_TEST_EQUAL(1U, res.size());
+        APSARA_TEST_EQUAL(items[2], res[0]);
+        APSARA_TEST_TRUE(sManager->mBlockedQueueKeys.empty());
+        APSARA_TEST_TRUE(sManager->mReadyQueues.empty());
+    }
+}
+
 void SenderQueueManagerUnittest::TestRemoveItem() {
     sManager->CreateQueue(0, sFlusherId, sCtx, {{"region", sConcurrencyLimiter}}, sMaxRate);
     ExactlyOnceQueueManager::GetInstance()->CreateOrUpdateQueue(1, 0, sCtx, sCheckpoints);
@@ -298,6 +348,7 @@ UNIT_TEST_CASE(SenderQueueManagerUnittest, TestDeleteQueue)
 UNIT_TEST_CASE(SenderQueueManagerUnittest, TestGetQueue)
 UNIT_TEST_CASE(SenderQueueManagerUnittest, TestPushQueue)
 UNIT_TEST_CASE(SenderQueueManagerUnittest, TestGetAvailableItems)
+UNIT_TEST_CASE(SenderQueueManagerUnittest, TestReadyQueues)
 UNIT_TEST_CASE(SenderQueueManagerUnittest, TestRemoveItem)
 UNIT_TEST_CASE(SenderQueueManagerUnittest, TestIsAllQueueEmpty)
 
@@ -57,6 +57,20 @@ void ConditionUnittest::TestInit() {
         APSARA_TEST_TRUE(cond.Init(configJson, ctx));
         APSARA_TEST_EQUAL(Condition::Type::TAG, cond.mType);
     }
+    {
+        configStr = R"(
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        Condition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_EQUAL(Condition::Type::EVENT_FIELD, cond.mType);
+        APSARA_TEST_TRUE(cond.IsEventLevel());
+    }
     {
         configStr = R"(
             {
@@ -165,6 +179,25 @@ void ConditionUnittest::TestCheck() {
         g.SetTag(string("level"), string("INFO"));
         APSARA_TEST_TRUE(cond.Check(g));
     }
+    {
+        Json::Value configJson;
+        string configStr = R"(
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        Condition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+
+        PipelineEventGroup g(make_shared<SourceBuffer>());
+        g.AddLogEvent()->SetContent(string("level"), string("ERROR"));
+        // never matches a group as a whole
+        APSARA_TEST_FALSE(cond.Check(g));
+        APSARA_TEST_TRUE(cond.Check(g.GetEvents()[0]));
+    }
 }
 
 UNIT_TEST_CASE(ConditionUnittest, TestInit)
@@ -350,6 +383,185 @@ void TagConditionUnittest::TestCheck() {
 UNIT_TEST_CASE(TagConditionUnittest, TestInit)
 UNIT_TEST_CASE(TagConditionUnittest, TestCheck)
 
+class EventFieldConditionUnittest : public testing::Test {
+public:
+    void TestInit();
+    void TestCheck();
+
+private:
+    PipelineContext ctx;
+};
+
+void EventFieldConditionUnittest::TestInit() {
+    Json::Value configJson;
+    string configStr, errorMsg;
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_EQUAL("level", cond.mKey);
+        APSARA_TEST_EQUAL("ERROR", cond.mValue);
+        APSARA_TEST_EQUAL(EventFieldCondition::Operator::EQUAL, cond.mOperator);
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERR",
+                "Operator": "prefix"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_EQUAL(EventFieldCondition::Operator::PREFIX, cond.mOperator);
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "content",
+                "Value": ".*timeout.*",
+                "Operator": "regex"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_EQUAL(EventFieldCondition::Operator::REGEX, cond.mOperator);
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "content",
+                "Value": "(",
+                "Operator": "regex"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_FALSE(cond.Init(configJson, ctx));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERROR",
+                "Operator": "unknown"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_FALSE(cond.Init(configJson, ctx));
+    }
+    {
+        configStr = R"(
+            {
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_FALSE(cond.Init(configJson, ctx));
+    }
+}
+
+void EventFieldConditionUnittest::TestCheck() {
+    Json::Value configJson;
+    string configStr, errorMsg;
+    PipelineEventGroup g(make_shared<SourceBuffer>());
+    auto e = g.AddLogEvent();
+    e->SetContent(string("level"), string("ERROR"));
+    e->SetContent(string("content"), string("connection timeout after 3s"));
+    g.AddMetricEvent();
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_TRUE(cond.Check(g.GetEvents()[0]));
+        APSARA_TEST_FALSE(cond.Check(g.GetEvents()[1]));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERR",
+                "Operator": "prefix"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_TRUE(cond.Check(g.GetEvents()[0]));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "content",
+                "Value": ".*timeout.*",
+                "Operator": "regex"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_TRUE(cond.Check(g.GetEvents()[0]));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "unknown",
+                "Value": "ERROR"
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_FALSE(cond.Check(g.GetEvents()[0]));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "level",
+                "Value": "ERROR",
+                "Negate": true
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_FALSE(cond.Check(g.GetEvents()[0]));
+        APSARA_TEST_FALSE(cond.Check(g.GetEvents()[1]));
+    }
+    {
+        configStr = R"(
+            {
+                "Key": "unknown",
+                "Value": "ERROR",
+                "Negate": true
+            }
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        EventFieldCondition cond;
+        APSARA_TEST_TRUE(cond.Init(configJson, ctx));
+        APSARA_TEST_TRUE(cond.Check(g.GetEvents()[0]));
+    }
+}
+
+UNIT_TEST_CASE(EventFieldConditionUnittest, TestInit)
+UNIT_TEST_CASE(EventFieldConditionUnittest, TestCheck)
+
 } // namespace logtail
 
 UNIT_TEST_MAIN
@@ -0,0 +1,155 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "common/JsonUtil.h"
+#include "common/TimeUtil.h"
+#include "models/LogEvent.h"
+#include "models/PipelineEventGroup.h"
+#include "pipeline/route/Router.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Sending error logs to one flusher and the others to another one, either by two pipelines reading and parsing the
+// same data with a filter each, or by one pipeline routing events by level.
+class RouterBenchmark {
+public:
+    RouterBenchmark(size_t logCnt, size_t errorRatio) : mLogCnt(logCnt), mErrorRatio(errorRatio) {
+        ctx.SetConfigName("test_config");
+        for (size_t i = 0; i < mLogCnt; ++i) {
+            mRawData += "2024-01-01 00:00:00.000 [" + string(i % mErrorRatio == 0 ? "ERROR" : "INFO")
+                + "] request " + to_string(i) + " handled by worker, which is a little bit longer\n";
+        }
+    }
+
+    void TestTwoPipelines();
+    void TestEventLevelRoute();
+
+private:
+    // reading and parsing, which is done by each pipeline
+    PipelineEventGroup ReadAndParse() const;
+
+    static const size_t sGroupCnt = 1000;
+    PipelineContext ctx;
+    size_t mLogCnt;
+    size_t mErrorRatio;
+    string mRawData;
+};
+
+PipelineEventGroup RouterBenchmark::ReadAndParse() const {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    auto data = group.GetSourceBuffer()->CopyString(mRawData);
+    StringView raw(data.data, data.size);
+    size_t begin = 0;
+    while (begin < raw.size()) {
+        size_t end = raw.find('\n', begin);
+        auto line = raw.substr(begin, end - begin);
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1700000000);
+        size_t levelBegin = line.find('[') + 1;
+        e->SetContentNoCopy(StringView("level"), line.substr(levelBegin, line.find(']') - levelBegin));
+        e->SetContentNoCopy(StringView("content"), line);
+        begin = end + 1;
+    }
+    return group;
+}
+
+void RouterBenchmark::TestTwoPipelines() {
+    size_t errorCnt = 0, otherCnt = 0;
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    for (size_t i = 0; i < sGroupCnt; ++i) {
+        for (bool isError : {true, false}) {
+            auto group = ReadAndParse();
+            auto& events = group.MutableEvents();
+            size_t cnt = 0;
+            for (size_t j = 0; j < events.size(); ++j) {
+                if ((events[j].Cast<LogEvent>().GetContent("level") == "ERROR") == isError) {
+                    if (cnt != j) {
+                        events[cnt] = std::move(events[j]);
+                    }
+                    ++cnt;
+                }
+            }
+            events.resize(cnt);
+            (isError ? errorCnt : otherCnt) += cnt;
+        }
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMicroSeconds() - starttime;
+    printf("%s %zu logs costs %luus, %zu error logs, %zu other logs\n",
+           __func__,
+           mLogCnt,
+           timeelapsed,
+           errorCnt,
+           otherCnt);
+}
+
+void RouterBenchmark::TestEventLevelRoute() {
+    Json::Value configJson;
+    string errorMsg;
+    string configStr = R"(
+        [
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "ERROR"
+            },
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "ERROR",
+                "Negate": true
+            }
+        ]
+    )";
+    ParseJsonTable(configStr, configJson, errorMsg);
+    vector<pair<size_t, const Json::Value*>> configs;
+    for (Json::Value::ArrayIndex i = 0; i < configJson.size(); ++i) {
+        configs.emplace_back(i, &configJson[i]);
+    }
+    Router router;
+    router.Init(configs, ctx);
+
+    size_t errorCnt = 0, otherCnt = 0;
+    uint64_t starttime = GetCurrentTimeInMicroSeconds();
+    for (size_t i = 0; i < sGroupCnt; ++i) {
+        vector<pair<size_t, PipelineEventGroup>> res;
+        router.Route(ReadAndParse(), res);
+        for (const auto& item : res) {
+            (item.first == 0 ? errorCnt : otherCnt) += item.second.GetEvents().size();
+        }
+    }
+    uint64_t timeelapsed = GetCurrentTimeInMicroSeconds() - starttime;
+    printf("%s %zu logs costs %luus, %zu error logs, %zu other logs\n",
+           __func__,
+           mLogCnt,
+           timeelapsed,
+           errorCnt,
+           otherCnt);
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    for (auto size : std::vector<std::pair<size_t, size_t>>{{100, 10}, {1000, 10}, {1000, 100}}) {
+        logtail::RouterBenchmark benchmark(size.first, size.second);
+        benchmark.TestTwoPipelines();
+        benchmark.TestEventLevelRoute();
+    }
+    return 0;
+}
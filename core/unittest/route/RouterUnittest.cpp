@@ -26,6 +26,7 @@ class RouterUnittest : public testing::Test {
 public:
     void TestInit();
     void TestRoute();
+    void TestRouteEvents();
     void TestMetric();
 
 protected:
@@ -90,6 +91,28 @@ void RouterUnittest::TestInit() {
         Router router;
         APSARA_TEST_FALSE(router.Init(configs, ctx));
     }
+    {
+        // event level conditions would split the checkpoint of a group
+        string configStr = R"(
+            [
+                {
+                    "Type": "event_field",
+                    "Key": "level",
+                    "Value": "ERROR"
+                }
+            ]
+        )";
+        APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+        vector<pair<size_t, const Json::Value*>> configs;
+        for (Json::Value::ArrayIndex i = 0; i < configJson.size(); ++i) {
+            configs.emplace_back(i, &configJson[i]);
+        }
+
+        ctx.SetExactlyOnceFlag(true);
+        Router router;
+        APSARA_TEST_FALSE(router.Init(configs, ctx));
+        ctx.SetExactlyOnceFlag(false);
+    }
 }
 
 void RouterUnittest::TestRoute() {
@@ -129,6 +152,106 @@ void RouterUnittest::TestRoute() {
     }
 }
 
+void RouterUnittest::TestRouteEvents() {
+    Json::Value configJson;
+    string errorMsg;
+    string configStr = R"(
+        [
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "ERROR"
+            },
+            {
+                "Type": "event_field",
+                "Key": "level",
+                "Value": "WARNING"
+            },
+            {
+                "Type": "event_field",
+                "Key": "content",
+                "Value": "timeout",
+                "Operator": "prefix"
+            },
+            {
+                "Type": "tag",
+                "Key": "env",
+                "Value": "prod"
+            }
+        ]
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    vector<pair<size_t, const Json::Value*>> configs;
+    for (Json::Value::ArrayIndex i = 0; i < configJson.size(); ++i) {
+        configs.emplace_back(i, &configJson[i]);
+    }
+
+    Router router;
+    APSARA_TEST_TRUE(router.Init(configs, ctx));
+    APSARA_TEST_TRUE(router.HasEventLevelCondition());
+    APSARA_TEST_EQUAL(1U, router.mConditions.size());
+    APSARA_TEST_EQUAL(3U, router.mEventConditions.size());
+    APSARA_TEST_EQUAL(1U, router.mEqualityIndexes.size());
+    APSARA_TEST_EQUAL(2U, router.mEqualityIndexes[0].mValueToConditionIdx.size());
+    APSARA_TEST_EQUAL(1U, router.mScannedEventConditionIdx.size());
+
+    auto createGroup = [](const string& env) {
+        PipelineEventGroup g(make_shared<SourceBuffer>());
+        g.SetTag(string("env"), env);
+        auto e = g.AddLogEvent();
+        e->SetContent(string("level"), string("ERROR"));
+        e->SetContent(string("content"), string("timeout after 3s"));
+        e = g.AddLogEvent();
+        e->SetContent(string("level"), string("INFO"));
+        e->SetContent(string("content"), string("ok"));
+        e = g.AddLogEvent();
+        e->SetContent(string("level"), string("WARNING"));
+        e->SetContent(string("content"), string("slow"));
+        g.AddMetricEvent();
+        return g;
+    };
+    {
+        // no flusher needs the whole group, so matched events are moved and the rest are discarded
+        auto g = createGroup("test");
+        auto sourceBuffer = g.GetSourceBuffer();
+        vector<pair<size_t, PipelineEventGroup>> res;
+        router.Route(std::move(g), res);
+        APSARA_TEST_EQUAL(3U, res.size());
+        APSARA_TEST_EQUAL(0U, res[0].first);
+        APSARA_TEST_EQUAL(1U, res[0].second.GetEvents().size());
+        APSARA_TEST_EQUAL("ERROR", res[0].second.GetEvents()[0].Cast<LogEvent>().GetContent("level"));
+        APSARA_TEST_EQUAL(1U, res[1].first);
+        APSARA_TEST_EQUAL(1U, res[1].second.GetEvents().size());
+        APSARA_TEST_EQUAL("WARNING", res[1].second.GetEvents()[0].Cast<LogEvent>().GetContent("level"));
+        APSARA_TEST_EQUAL(2U, res[2].first);
+        APSARA_TEST_EQUAL(1U, res[2].second.GetEvents().size());
+        APSARA_TEST_EQUAL("ERROR", res[2].second.GetEvents()[0].Cast<LogEvent>().GetContent("level"));
+        for (auto& item : res) {
+            APSARA_TEST_EQUAL(sourceBuffer.get(), item.second.GetSourceBuffer().get());
+            APSARA_TEST_EQUAL("test", item.second.GetTag("env"));
+        }
+    }
+    {
+        // the whole group is still sent to the flusher matching the group
+        auto g = createGroup("prod");
+        vector<pair<size_t, PipelineEventGroup>> res;
+        router.Route(std::move(g), res);
+        APSARA_TEST_EQUAL(4U, res.size());
+        APSARA_TEST_EQUAL(3U, res[3].first);
+        APSARA_TEST_EQUAL(4U, res[3].second.GetEvents().size());
+        APSARA_TEST_EQUAL(1U, res[0].second.GetEvents().size());
+        APSARA_TEST_EQUAL(1U, res[1].second.GetEvents().size());
+        APSARA_TEST_EQUAL(1U, res[2].second.GetEvents().size());
+    }
+    {
+        // group level route is unaffected
+        auto g = createGroup("prod");
+        auto res = router.Route(g);
+        APSARA_TEST_EQUAL(1U, res.size());
+        APSARA_TEST_EQUAL(3U, res[0]);
+    }
+}
+
 void RouterUnittest::TestMetric() {
     Json::Value configJson;
     string errorMsg;
@@ -166,6 +289,7 @@ void RouterUnittest::TestMetric() {
 
 UNIT_TEST_CASE(RouterUnittest, TestInit)
 UNIT_TEST_CASE(RouterUnittest, TestRoute)
+UNIT_TEST_CASE(RouterUnittest, TestRouteEvents)
 UNIT_TEST_CASE(RouterUnittest, TestMetric)
 
 } // namespace logtail
@@ -15,6 +15,7 @@
 #include "pipeline/plugin/PluginRegistry.h"
 #include "pipeline/queue/SenderQueueManager.h"
 #include "runner/FlusherRunner.h"
+#include "runner/sink/file/FileSink.h"
 #include "runner/sink/http/HttpSink.h"
 #include "unittest/Unittest.h"
 #include "unittest/plugin/PluginMock.h"
@@ -48,6 +49,26 @@ void FlusherRunnerUnittest::TestDispatch() {
         APSARA_TEST_TRUE(HttpSink::GetInstance()->mQueue.TryPop(req));
         APSARA_TEST_NOT_EQUAL(nullptr, req);
     }
+    {
+        // file
+        auto flusher = make_unique<FlusherFileMock>();
+        Json::Value tmp;
+        PipelineContext ctx;
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef("name", "1");
+        flusher->Init(Json::Value(), tmp);
+
+        auto item = make_unique<SenderQueueItem>("content", 10, flusher.get(), flusher->GetQueueKey());
+        auto realItem = item.get();
+        flusher->PushToQueue(std::move(item));
+
+        FlusherRunner::GetInstance()->Dispatch(realItem);
+
+        unique_ptr<FileSinkRequest> req;
+        APSARA_TEST_TRUE(FileSink::GetInstance()->mQueue.TryPop(req));
+        APSARA_TEST_NOT_EQUAL(nullptr, req);
+        APSARA_TEST_EQUAL(realItem, req->mItem);
+    }
     {
         // unknown
         auto flusher = make_unique<FlusherMock>();
@@ -0,0 +1,346 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/FileSystemUtil.h"
+#include "common/RuntimeUtil.h"
+#include "common/StringTools.h"
+#include "runner/sink/file/RecordFile.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class RecordFileUnittest : public ::testing::Test {
+public:
+    void TestAppendAndRead();
+    void TestAlignedWrite();
+    void TestRotateBySize();
+    void TestRotateByTime();
+    void TestReadTruncatedFile();
+    void TestReadCorruptedFile();
+    void TestRecover();
+    void TestRollbackOnFailure();
+
+protected:
+    void SetUp() override {
+        mDir = (bfs::path(GetProcessExecutionDir()) / "RecordFileUnittest").string();
+        bfs::remove_all(mDir);
+    }
+
+    void TearDown() override { bfs::remove_all(mDir); }
+
+private:
+    vector<string> ListFiles() const {
+        vector<string> res;
+        if (!bfs::exists(mDir)) {
+            return res;
+        }
+        for (bfs::directory_iterator it(mDir); it != bfs::directory_iterator(); ++it) {
+            res.emplace_back(it->path().filename().string());
+        }
+        sort(res.begin(), res.end());
+        return res;
+    }
+
+    static string ReadFile(const string& path) {
+        ifstream in(path, ios::binary);
+        return string((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    }
+
+    static void WriteFile(const string& path, const string& content) {
+        ofstream out(path, ios::binary | ios::trunc);
+        out << content;
+    }
+
+    // writes records with payloads "record-0", "record-1", ... into one sealed file and returns its content
+    string PrepareFile(size_t cnt, vector<uint64_t>& boundaries) {
+        RecordFileWriter writer(mDir, "test", 1024 * 1024, 0);
+        string errorMsg;
+        boundaries.assign(1, 0);
+        for (size_t i = 0; i < cnt; ++i) {
+            string payload = "record-" + ToString(i);
+            EXPECT_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+            boundaries.push_back(boundaries.back() + 24 + payload.size());
+        }
+        EXPECT_TRUE(writer.Seal(errorMsg));
+        auto files = ListFiles();
+        EXPECT_EQ(1U, files.size());
+        return ReadFile(PathJoin(mDir, files[0]));
+    }
+
+    string mDir;
+};
+
+void RecordFileUnittest::TestAppendAndRead() {
+    string errorMsg;
+    string filePath;
+    {
+        RecordFileWriter writer(mDir, "test", 1024 * 1024, 3600);
+        APSARA_TEST_FALSE(writer.HasOpenFile());
+        APSARA_TEST_TRUE(writer.Append("hello", CompressType::NONE, RecordDataType::SLS_LOG_GROUP, 5, errorMsg));
+        APSARA_TEST_TRUE(writer.Append("compressed", CompressType::LZ4, RecordDataType::OTLP_METRICS, 100, errorMsg));
+        APSARA_TEST_TRUE(writer.Append("", CompressType::ZSTD, RecordDataType::UNKNOWN, 0, errorMsg));
+        APSARA_TEST_FALSE(writer.Append("snappy", CompressType::SNAPPY, RecordDataType::UNKNOWN, 6, errorMsg));
+        APSARA_TEST_TRUE(writer.HasOpenFile());
+        filePath = writer.GetFilePath();
+        APSARA_TEST_TRUE(EndWith(filePath, ".rec.writing"));
+        APSARA_TEST_TRUE(writer.Sync(errorMsg));
+        APSARA_TEST_EQUAL(3U * 24 + 15, bfs::file_size(filePath));
+    }
+    // sealed on destruction
+    auto files = ListFiles();
+    APSARA_TEST_EQUAL(1U, files.size());
+    APSARA_TEST_TRUE(StartWith(files[0], "test-"));
+    APSARA_TEST_TRUE(EndWith(files[0], ".rec"));
+    APSARA_TEST_EQUAL(filePath.substr(0, filePath.size() - 8), PathJoin(mDir, files[0]));
+
+    vector<Record> records;
+    uint64_t validSize = 0;
+    APSARA_TEST_TRUE(ReadRecordFile(PathJoin(mDir, files[0]), records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(3U * 24 + 15, validSize);
+    APSARA_TEST_EQUAL(3U, records.size());
+    APSARA_TEST_EQUAL(CompressType::NONE, records[0].mCompressType);
+    APSARA_TEST_EQUAL(RecordDataType::SLS_LOG_GROUP, records[0].mDataType);
+    APSARA_TEST_EQUAL(5U, records[0].mRawSize);
+    APSARA_TEST_EQUAL("hello", records[0].mData);
+    APSARA_TEST_EQUAL(CompressType::LZ4, records[1].mCompressType);
+    APSARA_TEST_EQUAL(RecordDataType::OTLP_METRICS, records[1].mDataType);
+    APSARA_TEST_EQUAL(100U, records[1].mRawSize);
+    APSARA_TEST_EQUAL("compressed", records[1].mData);
+    APSARA_TEST_EQUAL(CompressType::ZSTD, records[2].mCompressType);
+    APSARA_TEST_EQUAL(RecordDataType::UNKNOWN, records[2].mDataType);
+    APSARA_TEST_EQUAL("", records[2].mData);
+
+    APSARA_TEST_FALSE(ReadRecordFile(PathJoin(mDir, "not_exist"), records, validSize, errorMsg));
+}
+
+void RecordFileUnittest::TestAlignedWrite() {
+    RecordFileWriter writer(mDir, "test", 1024 * 1024 * 1024, 0);
+    string errorMsg;
+    string payload(700 * 1024, 'a');
+    for (size_t i = 0; i < 3; ++i) {
+        APSARA_TEST_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+        // only whole blocks are written before sync
+        APSARA_TEST_EQUAL(0U, writer.mWrittenSize % RecordFileWriter::kWriteBlockSize);
+        APSARA_TEST_EQUAL(writer.mWrittenSize, bfs::file_size(writer.GetFilePath()));
+    }
+    APSARA_TEST_EQUAL(2 * RecordFileWriter::kWriteBlockSize, writer.mWrittenSize);
+    APSARA_TEST_EQUAL(0U, writer.mSyncedSize);
+
+    APSARA_TEST_TRUE(writer.Sync(errorMsg));
+    APSARA_TEST_EQUAL(3 * (24 + payload.size()), writer.mSyncedSize);
+    APSARA_TEST_EQUAL(writer.mSyncedSize, bfs::file_size(writer.GetFilePath()));
+    APSARA_TEST_TRUE(writer.mBuffer.empty());
+
+    // the offset is aligned again by the next block write
+    APSARA_TEST_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+    APSARA_TEST_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+    APSARA_TEST_EQUAL(0U, writer.mWrittenSize % RecordFileWriter::kWriteBlockSize);
+    APSARA_TEST_TRUE(writer.Sync(errorMsg));
+
+    vector<Record> records;
+    uint64_t validSize = 0;
+    APSARA_TEST_TRUE(ReadRecordFile(writer.GetFilePath(), records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(5U, records.size());
+    APSARA_TEST_EQUAL(5 * (24 + payload.size()), validSize);
+}
+
+void RecordFileUnittest::TestRotateBySize() {
+    string errorMsg;
+    {
+        RecordFileWriter writer(mDir, "test", 1000, 0);
+        string payload(300, 'a');
+        // 3 records fit in a file
+        for (size_t i = 0; i < 4; ++i) {
+            APSARA_TEST_TRUE(
+                writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+        }
+        APSARA_TEST_EQUAL(2U, ListFiles().size());
+        // a record larger than the limit occupies a file on its own
+        APSARA_TEST_TRUE(writer.Append(string(2000, 'b'), CompressType::NONE, RecordDataType::UNKNOWN, 2000, errorMsg));
+        APSARA_TEST_TRUE(writer.Append(payload, CompressType::NONE, RecordDataType::UNKNOWN, payload.size(), errorMsg));
+    }
+    auto files = ListFiles();
+    APSARA_TEST_EQUAL(4U, files.size());
+    vector<size_t> cnts;
+    for (const auto& file : files) {
+        APSARA_TEST_TRUE(EndWith(file, ".rec"));
+        vector<Record> records;
+        uint64_t validSize = 0;
+        APSARA_TEST_TRUE(ReadRecordFile(PathJoin(mDir, file), records, validSize, errorMsg));
+        APSARA_TEST_EQUAL(validSize, bfs::file_size(PathJoin(mDir, file)));
+        cnts.push_back(records.size());
+    }
+    APSARA_TEST_EQUAL(vector<size_t>({3, 1, 1, 1}), cnts);
+}
+
+void RecordFileUnittest::TestRotateByTime() {
+    RecordFileWriter writer(mDir, "test", 1024 * 1024, 10);
+    string errorMsg;
+    APSARA_TEST_TRUE(writer.Append("a", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_TRUE(writer.SealIfExpired(time(nullptr), errorMsg));
+    APSARA_TEST_TRUE(writer.HasOpenFile());
+
+    writer.mFileOpenTime -= 10;
+    APSARA_TEST_TRUE(writer.SealIfExpired(time(nullptr), errorMsg));
+    APSARA_TEST_FALSE(writer.HasOpenFile());
+    APSARA_TEST_EQUAL(1U, ListFiles().size());
+
+    APSARA_TEST_TRUE(writer.Append("b", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    writer.mFileOpenTime -= 10;
+    // an expired file is also sealed by the next append
+    APSARA_TEST_TRUE(writer.Append("c", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_TRUE(writer.Seal(errorMsg));
+    APSARA_TEST_EQUAL(3U, ListFiles().size());
+}
+
+void RecordFileUnittest::TestReadTruncatedFile() {
+    vector<uint64_t> boundaries;
+    string content = PrepareFile(5, boundaries);
+    APSARA_TEST_EQUAL(boundaries.back(), content.size());
+
+    // a crash may cut the file at any byte
+    string path = PathJoin(mDir, "truncated");
+    for (size_t size = 0; size <= content.size(); ++size) {
+        WriteFile(path, content.substr(0, size));
+        vector<Record> records;
+        uint64_t validSize = 0;
+        string errorMsg;
+        APSARA_TEST_TRUE(ReadRecordFile(path, records, validSize, errorMsg));
+        size_t expectedCnt = upper_bound(boundaries.begin(), boundaries.end(), size) - boundaries.begin() - 1;
+        APSARA_TEST_EQUAL_FATAL(expectedCnt, records.size());
+        APSARA_TEST_EQUAL(boundaries[expectedCnt], validSize);
+        for (size_t i = 0; i < records.size(); ++i) {
+            APSARA_TEST_EQUAL("record-" + ToString(i), records[i].mData);
+        }
+    }
+}
+
+void RecordFileUnittest::TestReadCorruptedFile() {
+    vector<uint64_t> boundaries;
+    string content = PrepareFile(5, boundaries);
+    string path = PathJoin(mDir, "corrupted");
+    // offset in the third record: magic, payload size, header crc and payload
+    for (size_t offset : {0, 8, 20, 24}) {
+        string corrupted = content;
+        corrupted[boundaries[2] + offset] ^= 0x01;
+        WriteFile(path, corrupted);
+        vector<Record> records;
+        uint64_t validSize = 0;
+        string errorMsg;
+        APSARA_TEST_TRUE(ReadRecordFile(path, records, validSize, errorMsg));
+        APSARA_TEST_EQUAL(2U, records.size());
+        APSARA_TEST_EQUAL(boundaries[2], validSize);
+    }
+    // garbage appended by a torn write is ignored
+    WriteFile(path, content + string(100, '\0'));
+    vector<Record> records;
+    uint64_t validSize = 0;
+    string errorMsg;
+    APSARA_TEST_TRUE(ReadRecordFile(path, records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(5U, records.size());
+    APSARA_TEST_EQUAL(content.size(), validSize);
+}
+
+void RecordFileUnittest::TestRecover() {
+    vector<uint64_t> boundaries;
+    string content = PrepareFile(3, boundaries);
+    bfs::remove_all(mDir);
+    bfs::create_directories(mDir);
+
+    // left by a crash in the middle of the third record
+    WriteFile(PathJoin(mDir, "test-20240101000000-0.rec.writing"), content.substr(0, boundaries[2] + 10));
+    // left by a crash before any record is complete
+    WriteFile(PathJoin(mDir, "test-20240101000000-1.rec.writing"), content.substr(0, 10));
+    // not of the prefix or not unsealed
+    WriteFile(PathJoin(mDir, "other-20240101000000-0.rec.writing"), content.substr(0, 10));
+    WriteFile(PathJoin(mDir, "test-x-20240101000000-0.rec.writing"), content.substr(0, 10));
+    WriteFile(PathJoin(mDir, "test-20240101000000-2.rec"), content);
+
+    APSARA_TEST_EQUAL(1U, RecoverRecordFiles(mDir, "test"));
+    APSARA_TEST_EQUAL(vector<string>({"other-20240101000000-0.rec.writing",
+                                      "test-20240101000000-0.rec",
+                                      "test-20240101000000-2.rec",
+                                      "test-x-20240101000000-0.rec.writing"}),
+                      ListFiles());
+    string path = PathJoin(mDir, "test-20240101000000-0.rec");
+    APSARA_TEST_EQUAL(boundaries[2], bfs::file_size(path));
+    vector<Record> records;
+    uint64_t validSize = 0;
+    string errorMsg;
+    APSARA_TEST_TRUE(ReadRecordFile(path, records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(2U, records.size());
+
+    APSARA_TEST_EQUAL(0U, RecoverRecordFiles(mDir, "test"));
+    APSARA_TEST_EQUAL(0U, RecoverRecordFiles(PathJoin(mDir, "not_exist"), "test"));
+}
+
+void RecordFileUnittest::TestRollbackOnFailure() {
+    RecordFileWriter writer(mDir, "test", 1024 * 1024, 0);
+    string errorMsg;
+    APSARA_TEST_TRUE(writer.Append("a", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_TRUE(writer.Append("b", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_TRUE(writer.Sync(errorMsg));
+    APSARA_TEST_EQUAL(2U, writer.GetSyncedRecordCnt());
+    string firstFile = writer.GetFilePath();
+
+    // make the following write fail
+    APSARA_TEST_TRUE(writer.Append("c", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_EQUAL(3U, writer.GetAppendedRecordCnt());
+    APSARA_TEST_EQUAL(2U, writer.GetSyncedRecordCnt());
+    int fd = writer.mFd;
+    writer.mFd = open("/dev/null", O_RDONLY);
+    close(fd);
+    APSARA_TEST_FALSE(writer.Sync(errorMsg));
+    APSARA_TEST_FALSE(errorMsg.empty());
+    // the dropped record is numbered again
+    APSARA_TEST_EQUAL(2U, writer.GetAppendedRecordCnt());
+    // the file is abandoned with only the synced records
+    APSARA_TEST_FALSE(writer.HasOpenFile());
+    APSARA_TEST_TRUE(writer.mBuffer.empty());
+    string sealedFile = firstFile.substr(0, firstFile.size() - 8);
+    vector<Record> records;
+    uint64_t validSize = 0;
+    APSARA_TEST_TRUE(ReadRecordFile(sealedFile, records, validSize, errorMsg));
+    APSARA_TEST_EQUAL(2U, records.size());
+
+    // the data is written again to a new file
+    APSARA_TEST_TRUE(writer.Append("c", CompressType::NONE, RecordDataType::UNKNOWN, 1, errorMsg));
+    APSARA_TEST_NOT_EQUAL(firstFile, writer.GetFilePath());
+    APSARA_TEST_TRUE(writer.Seal(errorMsg));
+    APSARA_TEST_EQUAL(3U, writer.GetSyncedRecordCnt());
+    APSARA_TEST_EQUAL(2U, ListFiles().size());
+}
+
+UNIT_TEST_CASE(RecordFileUnittest, TestAppendAndRead)
+UNIT_TEST_CASE(RecordFileUnittest, TestAlignedWrite)
+UNIT_TEST_CASE(RecordFileUnittest, TestRotateBySize)
+UNIT_TEST_CASE(RecordFileUnittest, TestRotateByTime)
+UNIT_TEST_CASE(RecordFileUnittest, TestReadTruncatedFile)
+UNIT_TEST_CASE(RecordFileUnittest, TestReadCorruptedFile)
+UNIT_TEST_CASE(RecordFileUnittest, TestRecover)
+UNIT_TEST_CASE(RecordFileUnittest, TestRollbackOnFailure)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
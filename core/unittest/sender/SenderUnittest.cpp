@@ -1696,7 +1696,7 @@ public:
             char* des;
             int32_t srcLength = (int32_t)data.size();
             int32_t encryptionLength;
-            FileEncryption::GetInstance()->Encrypt(data.c_str(), srcLength, des, encryptionLength);
+            FileEncryption::GetInstance()->Encrypt(data.c_str(), srcLength, des, encryptionLength, 1);
             string encryption = string(des, encryptionLength);
             delete[] des;
             char* src = new char[srcLength];
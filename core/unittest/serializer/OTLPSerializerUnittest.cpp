@@ -0,0 +1,302 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/unknown_field_set.h>
+
+#include <cstring>
+#include <map>
+
+#include "pipeline/serializer/OTLPSerializer.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+using google::protobuf::UnknownField;
+using google::protobuf::UnknownFieldSet;
+
+namespace logtail {
+
+// OTLP messages are decoded as unknown fields, since the generated OTLP messages are not available
+static vector<string> GetMessages(const string& msg, int field) {
+    UnknownFieldSet set;
+    EXPECT_TRUE(set.ParseFromString(msg));
+    vector<string> res;
+    for (int i = 0; i < set.field_count(); ++i) {
+        if (set.field(i).number() == field && set.field(i).type() == UnknownField::TYPE_LENGTH_DELIMITED) {
+            res.emplace_back(set.field(i).length_delimited());
+        }
+    }
+    return res;
+}
+
+static string GetMessage(const string& msg, int field) {
+    auto res = GetMessages(msg, field);
+    return res.empty() ? "" : res[0];
+}
+
+static uint64_t GetNumber(const string& msg, int field) {
+    UnknownFieldSet set;
+    EXPECT_TRUE(set.ParseFromString(msg));
+    for (int i = 0; i < set.field_count(); ++i) {
+        if (set.field(i).number() == field) {
+            if (set.field(i).type() == UnknownField::TYPE_FIXED64) {
+                return set.field(i).fixed64();
+            }
+            if (set.field(i).type() == UnknownField::TYPE_VARINT) {
+                return set.field(i).varint();
+            }
+        }
+    }
+    return 0;
+}
+
+static map<string, string> GetAttributes(const string& msg, int field) {
+    map<string, string> res;
+    for (const auto& kv : GetMessages(msg, field)) {
+        res[GetMessage(kv, 1)] = GetMessage(GetMessage(kv, 2), 1);
+    }
+    return res;
+}
+
+class OTLPSerializerUnittest : public ::testing::Test {
+public:
+    void TestSerializeLogs();
+    void TestSerializeMetrics();
+    void TestSerializeSpans();
+    void TestSerializeLargeMessage();
+    void TestSerializeInvalidGroup();
+
+protected:
+    static void SetUpTestCase() { sFlusher = make_unique<FlusherOTLP>(); }
+
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        sFlusher->SetContext(mCtx);
+        sFlusher->SetMetricsRecordRef(FlusherOTLP::sName, "1");
+    }
+
+private:
+    static BatchedEvents ToBatchedEvents(PipelineEventGroup&& group) {
+        return BatchedEvents(std::move(group.MutableEvents()),
+                             std::move(group.GetSizedTags()),
+                             std::move(group.GetSourceBuffer()),
+                             group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                             std::move(group.GetExactlyOnceCheckpoint()));
+    }
+
+    static unique_ptr<FlusherOTLP> sFlusher;
+
+    PipelineContext mCtx;
+};
+
+unique_ptr<FlusherOTLP> OTLPSerializerUnittest::sFlusher;
+
+void OTLPSerializerUnittest::TestSerializeLogs() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("host.name"), string("host"));
+    auto e = group.AddLogEvent();
+    e->SetTimestamp(1234567890, 1);
+    e->SetContent(string("content"), string("hello"));
+    e->SetContent(string("level"), string("INFO"));
+    e = group.AddLogEvent();
+    e->SetTimestamp(1234567891);
+    e->SetContent(string("key"), string("value"));
+    auto batch = ToBatchedEvents(std::move(group));
+    APSARA_TEST_TRUE(OTLPSignal::LOGS == GetOTLPSignal(batch));
+
+    OTLPEventGroupSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+
+    auto resourceLogs = GetMessages(res, 1);
+    APSARA_TEST_EQUAL(1U, resourceLogs.size());
+    auto resourceAttrs = GetAttributes(GetMessage(resourceLogs[0], 1), 1);
+    APSARA_TEST_EQUAL(1U, resourceAttrs.size());
+    APSARA_TEST_EQUAL("host", resourceAttrs["host.name"]);
+    auto scopeLogs = GetMessages(resourceLogs[0], 2);
+    APSARA_TEST_EQUAL(1U, scopeLogs.size());
+    auto records = GetMessages(scopeLogs[0], 2);
+    APSARA_TEST_EQUAL(2U, records.size());
+
+    APSARA_TEST_EQUAL(1234567890000000001ULL, GetNumber(records[0], 1));
+    APSARA_TEST_EQUAL(1234567890000000001ULL, GetNumber(records[0], 11));
+    APSARA_TEST_EQUAL("hello", GetMessage(GetMessage(records[0], 5), 1));
+    auto attrs = GetAttributes(records[0], 6);
+    APSARA_TEST_EQUAL(1U, attrs.size());
+    APSARA_TEST_EQUAL("INFO", attrs["level"]);
+
+    APSARA_TEST_EQUAL(1234567891000000000ULL, GetNumber(records[1], 1));
+    APSARA_TEST_TRUE(GetMessages(records[1], 5).empty());
+    attrs = GetAttributes(records[1], 6);
+    APSARA_TEST_EQUAL(1U, attrs.size());
+    APSARA_TEST_EQUAL("value", attrs["key"]);
+}
+
+void OTLPSerializerUnittest::TestSerializeMetrics() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    auto e = group.AddMetricEvent();
+    e->SetName("cpu_usage");
+    e->SetTimestamp(1234567890);
+    e->SetValue(UntypedSingleValue{0.5});
+    e->SetTag(string("cpu"), string("0"));
+    // metric without value is skipped
+    e = group.AddMetricEvent();
+    e->SetName("empty");
+    e->SetTimestamp(1234567890);
+    auto batch = ToBatchedEvents(std::move(group));
+    APSARA_TEST_TRUE(OTLPSignal::METRICS == GetOTLPSignal(batch));
+
+    OTLPEventGroupSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+
+    auto resourceMetrics = GetMessages(res, 1);
+    APSARA_TEST_EQUAL(1U, resourceMetrics.size());
+    APSARA_TEST_TRUE(GetMessages(resourceMetrics[0], 1).empty());
+    auto metrics = GetMessages(GetMessage(resourceMetrics[0], 2), 2);
+    APSARA_TEST_EQUAL(1U, metrics.size());
+    APSARA_TEST_EQUAL("cpu_usage", GetMessage(metrics[0], 1));
+    auto points = GetMessages(GetMessage(metrics[0], 5), 1);
+    APSARA_TEST_EQUAL(1U, points.size());
+    APSARA_TEST_EQUAL(1234567890000000000ULL, GetNumber(points[0], 3));
+    uint64_t bits = GetNumber(points[0], 4);
+    double value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    APSARA_TEST_EQUAL(0.5, value);
+    auto attrs = GetAttributes(points[0], 7);
+    APSARA_TEST_EQUAL(1U, attrs.size());
+    APSARA_TEST_EQUAL("0", attrs["cpu"]);
+}
+
+void OTLPSerializerUnittest::TestSerializeSpans() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    for (size_t i = 0; i < 3; ++i) {
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+        e->SetSpanId("000000000000000" + ToString(i + 1));
+        e->SetName("span_" + ToString(i));
+        e->SetKind(SpanEvent::Kind::Server);
+        e->SetStartTimeNs(1000);
+        e->SetEndTimeNs(2000);
+        e->SetTag(string("http.method"), string("GET"));
+        e->SetScopeTag(SpanEvent::OTLP_SCOPE_NAME, i < 2 ? string("scope_a") : string("scope_b"));
+        e->SetScopeTag(SpanEvent::OTLP_SCOPE_VERSION, string("1.0"));
+        if (i == 0) {
+            e->SetParentSpanId("not-hex");
+            e->SetStatus(SpanEvent::StatusCode::Error);
+            auto inner = e->AddEvent();
+            inner->SetName("exception");
+            inner->SetTimestampNs(1500);
+            inner->SetTag(string("exception.type"), string("IOError"));
+            auto link = e->AddLink();
+            link->SetTraceId("1112131415161718191a1b1c1d1e1f20");
+            link->SetSpanId("0000000000000009");
+            link->SetTag(string("link_key"), string("link_value"));
+        }
+    }
+    auto batch = ToBatchedEvents(std::move(group));
+    APSARA_TEST_TRUE(OTLPSignal::TRACES == GetOTLPSignal(batch));
+
+    OTLPEventGroupSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+
+    auto resourceSpans = GetMessages(res, 1);
+    APSARA_TEST_EQUAL(1U, resourceSpans.size());
+    // a new scope starts whenever the scope tags change
+    auto scopeSpans = GetMessages(resourceSpans[0], 2);
+    APSARA_TEST_EQUAL(2U, scopeSpans.size());
+    auto scope = GetMessage(scopeSpans[0], 1);
+    APSARA_TEST_EQUAL("scope_a", GetMessage(scope, 1));
+    APSARA_TEST_EQUAL("1.0", GetMessage(scope, 2));
+    APSARA_TEST_EQUAL("scope_b", GetMessage(GetMessage(scopeSpans[1], 1), 1));
+    auto spans = GetMessages(scopeSpans[0], 2);
+    APSARA_TEST_EQUAL(2U, spans.size());
+    APSARA_TEST_EQUAL(1U, GetMessages(scopeSpans[1], 2).size());
+
+    const auto& span = spans[0];
+    APSARA_TEST_EQUAL(string("\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10", 16),
+                      GetMessage(span, 1));
+    APSARA_TEST_EQUAL(string("\x00\x00\x00\x00\x00\x00\x00\x01", 8), GetMessage(span, 2));
+    // non-hex ids are kept as they are
+    APSARA_TEST_EQUAL("not-hex", GetMessage(span, 4));
+    APSARA_TEST_EQUAL("span_0", GetMessage(span, 5));
+    APSARA_TEST_EQUAL(2U, GetNumber(span, 6));
+    APSARA_TEST_EQUAL(1000U, GetNumber(span, 7));
+    APSARA_TEST_EQUAL(2000U, GetNumber(span, 8));
+    APSARA_TEST_EQUAL("GET", GetAttributes(span, 9)["http.method"]);
+    auto events = GetMessages(span, 11);
+    APSARA_TEST_EQUAL(1U, events.size());
+    APSARA_TEST_EQUAL(1500U, GetNumber(events[0], 1));
+    APSARA_TEST_EQUAL("exception", GetMessage(events[0], 2));
+    APSARA_TEST_EQUAL("IOError", GetAttributes(events[0], 3)["exception.type"]);
+    auto links = GetMessages(span, 13);
+    APSARA_TEST_EQUAL(1U, links.size());
+    APSARA_TEST_EQUAL(16U, GetMessage(links[0], 1).size());
+    APSARA_TEST_EQUAL(string("\x00\x00\x00\x00\x00\x00\x00\x09", 8), GetMessage(links[0], 2));
+    APSARA_TEST_EQUAL("link_value", GetAttributes(links[0], 4)["link_key"]);
+    APSARA_TEST_EQUAL(2U, GetNumber(GetMessage(span, 15), 3));
+
+    APSARA_TEST_TRUE(GetMessages(spans[1], 4).empty());
+    APSARA_TEST_TRUE(GetMessages(spans[1], 15).empty());
+}
+
+void OTLPSerializerUnittest::TestSerializeLargeMessage() {
+    // lengths of nested messages need more than one byte
+    for (size_t size : {100U, 200U, 20000U, 3000000U}) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1234567890);
+        e->SetContent(string("content"), string(size, 'a'));
+        e->SetContent(string("key"), string("value"));
+        OTLPEventGroupSerializer serializer(sFlusher.get());
+        string res, errorMsg;
+        APSARA_TEST_TRUE(serializer.DoSerialize(ToBatchedEvents(std::move(group)), res, errorMsg));
+        auto record = GetMessage(GetMessage(GetMessage(res, 1), 2), 2);
+        APSARA_TEST_EQUAL(string(size, 'a'), GetMessage(GetMessage(record, 5), 1));
+        APSARA_TEST_EQUAL("value", GetAttributes(record, 6)["key"]);
+    }
+}
+
+void OTLPSerializerUnittest::TestSerializeInvalidGroup() {
+    OTLPEventGroupSerializer serializer(sFlusher.get());
+    {
+        // mixed event types
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.AddLogEvent()->SetContent(string("key"), string("value"));
+        group.AddMetricEvent()->SetName("name");
+        string res, errorMsg;
+        APSARA_TEST_FALSE(serializer.DoSerialize(ToBatchedEvents(std::move(group)), res, errorMsg));
+        APSARA_TEST_EQUAL("mixed event types in event group", errorMsg);
+    }
+    {
+        // empty group
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto batch = ToBatchedEvents(std::move(group));
+        APSARA_TEST_TRUE(OTLPSignal::UNKNOWN == GetOTLPSignal(batch));
+        string res, errorMsg;
+        APSARA_TEST_FALSE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+        APSARA_TEST_EQUAL("empty event group", errorMsg);
+    }
+}
+
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeLogs)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeMetrics)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeSpans)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeLargeMessage)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeInvalidGroup)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,325 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/unknown_field_set.h>
+
+#include <cstring>
+#include <map>
+
+#include "pipeline/serializer/PrometheusSerializer.h"
+#include "plugin/flusher/prometheus/FlusherPrometheus.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+using google::protobuf::UnknownField;
+using google::protobuf::UnknownFieldSet;
+
+namespace logtail {
+
+// WriteRequest is decoded as unknown fields, since the generated prompb messages are not available
+static vector<string> GetMessages(const string& msg, int field) {
+    UnknownFieldSet set;
+    EXPECT_TRUE(set.ParseFromString(msg));
+    vector<string> res;
+    for (int i = 0; i < set.field_count(); ++i) {
+        if (set.field(i).number() == field && set.field(i).type() == UnknownField::TYPE_LENGTH_DELIMITED) {
+            res.emplace_back(set.field(i).length_delimited());
+        }
+    }
+    return res;
+}
+
+static uint64_t GetNumber(const string& msg, int field) {
+    UnknownFieldSet set;
+    EXPECT_TRUE(set.ParseFromString(msg));
+    for (int i = 0; i < set.field_count(); ++i) {
+        if (set.field(i).number() == field) {
+            if (set.field(i).type() == UnknownField::TYPE_FIXED64) {
+                return set.field(i).fixed64();
+            }
+            if (set.field(i).type() == UnknownField::TYPE_VARINT) {
+                return set.field(i).varint();
+            }
+        }
+    }
+    return 0;
+}
+
+static double GetDouble(const string& msg, int field) {
+    uint64_t bits = GetNumber(msg, field);
+    double res = 0;
+    memcpy(&res, &bits, sizeof(res));
+    return res;
+}
+
+static vector<pair<string, string>> GetLabels(const string& series) {
+    vector<pair<string, string>> res;
+    for (const auto& label : GetMessages(series, 1)) {
+        auto name = GetMessages(label, 1);
+        auto value = GetMessages(label, 2);
+        res.emplace_back(name.empty() ? "" : name[0], value.empty() ? "" : value[0]);
+    }
+    return res;
+}
+
+class PrometheusSerializerUnittest : public ::testing::Test {
+public:
+    void TestGetSeriesLabels();
+    void TestGetSeriesHash();
+    void TestSerialize();
+    void TestMergeBatch();
+    void TestSplitBatch();
+    void TestSeriesHashCollision();
+    void TestSerializeEmptyBatch();
+
+protected:
+    static void SetUpTestCase() { sFlusher = make_unique<FlusherPrometheus>(); }
+
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        sFlusher->SetContext(mCtx);
+        sFlusher->SetMetricsRecordRef(FlusherPrometheus::sName, "1");
+    }
+
+private:
+    static void AddSample(RemoteWriteBatch& batch, const MetricEvent& e, const GroupTags& groupTags) {
+        SeriesLabels labels;
+        GetSeriesLabels(e, groupTags, labels);
+        batch.AddSample(GetSeriesHash(labels),
+                        labels,
+                        e.GetValue<UntypedSingleValue>()->mValue,
+                        static_cast<int64_t>(e.GetTimestamp()) * 1000);
+    }
+
+    static unique_ptr<FlusherPrometheus> sFlusher;
+
+    PipelineContext mCtx;
+};
+
+unique_ptr<FlusherPrometheus> PrometheusSerializerUnittest::sFlusher;
+
+void PrometheusSerializerUnittest::TestGetSeriesLabels() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("job"), string("group_job"));
+    group.SetTag(string("region"), string("cn"));
+    group.SetTag(string("empty"), string(""));
+    {
+        auto e = group.AddMetricEvent();
+        e->SetName("up");
+        e->SetTag(string("job"), string("event_job"));
+        e->SetTag(string("instance"), string("localhost:8080"));
+        e->SetTag(string("Zone"), string("a"));
+        SeriesLabels labels;
+        GetSeriesLabels(*e, group.GetTags(), labels);
+        APSARA_TEST_EQUAL(5U, labels.size());
+        APSARA_TEST_EQUAL("Zone", labels[0].first.to_string());
+        APSARA_TEST_EQUAL("__name__", labels[1].first.to_string());
+        APSARA_TEST_EQUAL("up", labels[1].second.to_string());
+        APSARA_TEST_EQUAL("instance", labels[2].first.to_string());
+        APSARA_TEST_EQUAL("job", labels[3].first.to_string());
+        APSARA_TEST_EQUAL("event_job", labels[3].second.to_string());
+        APSARA_TEST_EQUAL("region", labels[4].first.to_string());
+    }
+    {
+        // __name__ set as tag, as processor_prom_relabel_metric_native does
+        auto e = group.AddMetricEvent();
+        e->SetName("up");
+        e->SetTag(string("__name__"), string("up"));
+        SeriesLabels labels;
+        GetSeriesLabels(*e, GroupTags(), labels);
+        APSARA_TEST_EQUAL(1U, labels.size());
+        APSARA_TEST_EQUAL("__name__", labels[0].first.to_string());
+    }
+}
+
+void PrometheusSerializerUnittest::TestGetSeriesHash() {
+    SeriesLabels labels1{{"__name__", "up"}, {"job", "a"}};
+    SeriesLabels labels2{{"__name__", "up"}, {"job", "a"}};
+    SeriesLabels labels3{{"__name__", "up"}, {"job", "b"}};
+    SeriesLabels labels4{{"__name__", "upjob"}, {"", "a"}};
+    APSARA_TEST_EQUAL(GetSeriesHash(labels1), GetSeriesHash(labels2));
+    APSARA_TEST_NOT_EQUAL(GetSeriesHash(labels1), GetSeriesHash(labels3));
+    APSARA_TEST_NOT_EQUAL(GetSeriesHash(labels1), GetSeriesHash(labels4));
+}
+
+void PrometheusSerializerUnittest::TestSerialize() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("job"), string("test"));
+    RemoteWriteBatch batch;
+    for (size_t i = 0; i < 3; ++i) {
+        auto e = group.AddMetricEvent();
+        e->SetName(i == 1 ? "process_cpu_seconds_total" : "up");
+        e->SetTimestamp(1700000000 + i);
+        e->SetValue(UntypedSingleValue{static_cast<double>(i) + 0.5});
+        AddSample(batch, *e, group.GetTags());
+    }
+    APSARA_TEST_EQUAL(2U, batch.SeriesCnt());
+    APSARA_TEST_EQUAL(3U, batch.SampleCnt());
+
+    RemoteWriteSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+
+    auto series = GetMessages(res, 1);
+    APSARA_TEST_EQUAL(2U, series.size());
+    {
+        auto labels = GetLabels(series[0]);
+        APSARA_TEST_EQUAL(2U, labels.size());
+        APSARA_TEST_EQUAL("__name__", labels[0].first);
+        APSARA_TEST_EQUAL("up", labels[0].second);
+        APSARA_TEST_EQUAL("job", labels[1].first);
+        APSARA_TEST_EQUAL("test", labels[1].second);
+        auto samples = GetMessages(series[0], 2);
+        APSARA_TEST_EQUAL(2U, samples.size());
+        APSARA_TEST_EQUAL(0.5, GetDouble(samples[0], 1));
+        APSARA_TEST_EQUAL(1700000000000U, GetNumber(samples[0], 2));
+        APSARA_TEST_EQUAL(2.5, GetDouble(samples[1], 1));
+        APSARA_TEST_EQUAL(1700000002000U, GetNumber(samples[1], 2));
+    }
+    {
+        auto labels = GetLabels(series[1]);
+        APSARA_TEST_EQUAL("process_cpu_seconds_total", labels[0].second);
+        auto samples = GetMessages(series[1], 2);
+        APSARA_TEST_EQUAL(1U, samples.size());
+        APSARA_TEST_EQUAL(1.5, GetDouble(samples[0], 1));
+    }
+}
+
+void PrometheusSerializerUnittest::TestMergeBatch() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    RemoteWriteBatch batch1, batch2, expected;
+    for (size_t i = 0; i < 4; ++i) {
+        auto e = group.AddMetricEvent();
+        e->SetName(i % 2 == 0 ? "a" : "b");
+        e->SetTimestamp(1700000000 + i);
+        e->SetValue(UntypedSingleValue{1.0});
+        AddSample(i < 3 ? batch1 : batch2, *e, group.GetTags());
+        AddSample(expected, *e, group.GetTags());
+    }
+    {
+        auto e = group.AddMetricEvent();
+        e->SetName("c");
+        e->SetValue(UntypedSingleValue{1.0});
+        AddSample(batch2, *e, group.GetTags());
+        AddSample(expected, *e, group.GetTags());
+    }
+    batch1.Merge(std::move(batch2));
+    APSARA_TEST_TRUE(batch2.Empty());
+    APSARA_TEST_EQUAL(3U, batch1.SeriesCnt());
+    APSARA_TEST_EQUAL(5U, batch1.SampleCnt());
+    // labels of series b are counted only once
+    APSARA_TEST_EQUAL(expected.DataSize(), batch1.DataSize());
+
+    RemoteWriteSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch1), res, errorMsg));
+    auto series = GetMessages(res, 1);
+    APSARA_TEST_EQUAL(3U, series.size());
+    APSARA_TEST_EQUAL(2U, GetMessages(series[0], 2).size());
+    APSARA_TEST_EQUAL(2U, GetMessages(series[1], 2).size());
+    APSARA_TEST_EQUAL(1U, GetMessages(series[2], 2).size());
+}
+
+void PrometheusSerializerUnittest::TestSplitBatch() {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    RemoteWriteBatch batch;
+    // series a has 5 samples, and series b has 2
+    for (size_t i = 0; i < 7; ++i) {
+        auto e = group.AddMetricEvent();
+        e->SetName(i < 5 ? "a" : "b");
+        e->SetTimestamp(1700000000 + i);
+        e->SetValue(UntypedSingleValue{1.0});
+        AddSample(batch, *e, group.GetTags());
+    }
+    vector<RemoteWriteBatch> res;
+    batch.Split(3, res);
+    APSARA_TEST_TRUE(batch.Empty());
+    APSARA_TEST_EQUAL(3U, res.size());
+    APSARA_TEST_EQUAL(3U, res[0].SampleCnt());
+    APSARA_TEST_EQUAL(1U, res[0].SeriesCnt());
+    APSARA_TEST_EQUAL(3U, res[1].SampleCnt());
+    APSARA_TEST_EQUAL(2U, res[1].SeriesCnt());
+    APSARA_TEST_EQUAL(1U, res[2].SampleCnt());
+    APSARA_TEST_EQUAL(1U, res[2].SeriesCnt());
+
+    RemoteWriteSerializer serializer(sFlusher.get());
+    string data, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(res[1]), data, errorMsg));
+    auto series = GetMessages(data, 1);
+    APSARA_TEST_EQUAL(2U, series.size());
+    APSARA_TEST_EQUAL("a", GetLabels(series[0])[0].second);
+    APSARA_TEST_EQUAL(2U, GetMessages(series[0], 2).size());
+    APSARA_TEST_EQUAL("b", GetLabels(series[1])[0].second);
+    APSARA_TEST_EQUAL(1U, GetMessages(series[1], 2).size());
+
+    // small batch is kept as a whole
+    res.clear();
+    auto e = group.AddMetricEvent();
+    e->SetName("a");
+    e->SetValue(UntypedSingleValue{1.0});
+    AddSample(batch, *e, group.GetTags());
+    batch.Split(3, res);
+    APSARA_TEST_EQUAL(1U, res.size());
+    APSARA_TEST_EQUAL(1U, res[0].SampleCnt());
+}
+
+void PrometheusSerializerUnittest::TestSeriesHashCollision() {
+    // series a and b are given the same hash
+    SeriesLabels labelsA{{"__name__", "a"}}, labelsB{{"__name__", "b"}};
+    RemoteWriteBatch batch1, batch2;
+    batch1.AddSample(1, labelsA, 1.0, 1000);
+    batch1.AddSample(1, labelsB, 2.0, 1000);
+    batch1.AddSample(1, labelsA, 3.0, 2000);
+    APSARA_TEST_EQUAL(2U, batch1.SeriesCnt());
+    APSARA_TEST_EQUAL(3U, batch1.SampleCnt());
+
+    batch2.AddSample(1, labelsB, 4.0, 2000);
+    batch1.Merge(std::move(batch2));
+    APSARA_TEST_EQUAL(2U, batch1.SeriesCnt());
+    APSARA_TEST_EQUAL(4U, batch1.SampleCnt());
+
+    vector<RemoteWriteBatch> res;
+    batch1.Split(3, res);
+    APSARA_TEST_EQUAL(2U, res.size());
+    APSARA_TEST_EQUAL(2U, res[0].SeriesCnt());
+
+    RemoteWriteSerializer serializer(sFlusher.get());
+    string data, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(res[0]), data, errorMsg));
+    auto series = GetMessages(data, 1);
+    APSARA_TEST_EQUAL(2U, series.size());
+    APSARA_TEST_EQUAL("a", GetLabels(series[0])[0].second);
+    APSARA_TEST_EQUAL(2U, GetMessages(series[0], 2).size());
+    APSARA_TEST_EQUAL("b", GetLabels(series[1])[0].second);
+    APSARA_TEST_EQUAL(1U, GetMessages(series[1], 2).size());
+}
+
+void PrometheusSerializerUnittest::TestSerializeEmptyBatch() {
+    RemoteWriteSerializer serializer(sFlusher.get());
+    string res, errorMsg;
+    APSARA_TEST_FALSE(serializer.DoSerialize(RemoteWriteBatch(), res, errorMsg));
+    APSARA_TEST_EQUAL("empty batch", errorMsg);
+}
+
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestGetSeriesLabels)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestGetSeriesHash)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestSerialize)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestMergeBatch)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestSplitBatch)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestSeriesHashCollision)
+UNIT_TEST_CASE(PrometheusSerializerUnittest, TestSerializeEmptyBatch)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
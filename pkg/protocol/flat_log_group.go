@@ -0,0 +1,148 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package protocol
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+)
+
+// Flat log group is the format used by core to hand log groups over to the go pipeline,
+// see core/go_pipeline/FlatLogGroup.h for the layout. The two sides must be kept in sync.
+const (
+	flatLogGroupMagic      = "LFLG"
+	flatLogGroupVersion    = 1
+	flatLogGroupHeaderSize = 24
+	flatLogGroupFlagTimeNs = 1
+	flatLogGroupNoTimeNs   = 0xFFFFFFFF
+)
+
+var errFlatLogGroupCorrupted = errors.New("flat log group is corrupted")
+
+// UnmarshalFlatLogGroup decodes a flat log group.
+//
+// The string arena is copied into a single go string, which all keys and values are sliced from,
+// so data may point to memory not owned by go (e.g. passed by cgo) and can be released once this function returns.
+// Logs, contents and tags are allocated in bulk rather than one by one.
+func UnmarshalFlatLogGroup(data []byte) (*LogGroup, error) {
+	if len(data) < flatLogGroupHeaderSize || string(data[:4]) != flatLogGroupMagic {
+		return nil, errors.New("invalid flat log group header")
+	}
+	le := binary.LittleEndian
+	if version := le.Uint32(data[4:]); version != flatLogGroupVersion {
+		return nil, fmt.Errorf("unsupported flat log group version: %d", version)
+	}
+	logCnt := uint64(le.Uint32(data[8:]))
+	tagCnt := uint64(le.Uint32(data[12:]))
+	contentCnt := uint64(le.Uint32(data[16:]))
+	hasTimeNs := le.Uint32(data[20:])&flatLogGroupFlagTimeNs != 0
+	timeColCnt := uint64(2)
+	if hasTimeNs {
+		timeColCnt = 3
+	}
+	strCnt := 2 + 2*tagCnt + 2*contentCnt
+	columnsSize := 4 * (timeColCnt*logCnt + strCnt)
+	if uint64(len(data)-flatLogGroupHeaderSize) < columnsSize {
+		return nil, errors.New("flat log group is truncated")
+	}
+
+	timeCol := data[flatLogGroupHeaderSize:]
+	timeNsCol := timeCol[4*logCnt:]
+	contentCntCol := timeNsCol
+	if hasTimeNs {
+		contentCntCol = timeNsCol[4*logCnt:]
+	}
+	lenCol := contentCntCol[4*logCnt:]
+	arena := string(lenCol[4*strCnt:])
+	offset := uint64(0)
+	lenIdx := uint64(0)
+	nextString := func() (string, bool) {
+		l := uint64(le.Uint32(lenCol[4*lenIdx:]))
+		lenIdx++
+		if uint64(len(arena))-offset < l {
+			return "", false
+		}
+		s := arena[offset : offset+l]
+		offset += l
+		return s, true
+	}
+
+	logGroup := &LogGroup{}
+	var ok bool
+	if logGroup.Topic, ok = nextString(); !ok {
+		return nil, errFlatLogGroupCorrupted
+	}
+	if logGroup.Category, ok = nextString(); !ok {
+		return nil, errFlatLogGroupCorrupted
+	}
+	if tagCnt > 0 {
+		tags := make([]LogTag, tagCnt)
+		logGroup.LogTags = make([]*LogTag, tagCnt)
+		for i := range tags {
+			tag := &tags[i]
+			if tag.Key, ok = nextString(); !ok {
+				return nil, errFlatLogGroupCorrupted
+			}
+			if tag.Value, ok = nextString(); !ok {
+				return nil, errFlatLogGroupCorrupted
+			}
+			logGroup.LogTags[i] = tag
+		}
+	}
+	parsedContentCnt := uint64(0)
+	if logCnt > 0 {
+		logs := make([]Log, logCnt)
+		contents := make([]Log_Content, contentCnt)
+		contentPtrs := make([]*Log_Content, contentCnt)
+		var timeNs []uint32
+		if hasTimeNs {
+			timeNs = make([]uint32, logCnt)
+		}
+		logGroup.Logs = make([]*Log, logCnt)
+		for i := range logs {
+			log := &logs[i]
+			log.Time = le.Uint32(timeCol[4*i:])
+			if hasTimeNs {
+				if ns := le.Uint32(timeNsCol[4*i:]); ns != flatLogGroupNoTimeNs {
+					timeNs[i] = ns
+					log.TimeNs = &timeNs[i]
+				}
+			}
+			cnt := uint64(le.Uint32(contentCntCol[4*i:]))
+			if parsedContentCnt+cnt > contentCnt {
+				return nil, errFlatLogGroupCorrupted
+			}
+			// full slice expression, so that appending to one log never overwrites the next one
+			log.Contents = contentPtrs[parsedContentCnt : parsedContentCnt+cnt : parsedContentCnt+cnt]
+			for j := parsedContentCnt; j < parsedContentCnt+cnt; j++ {
+				content := &contents[j]
+				if content.Key, ok = nextString(); !ok {
+					return nil, errFlatLogGroupCorrupted
+				}
+				if content.Value, ok = nextString(); !ok {
+					return nil, errFlatLogGroupCorrupted
+				}
+				contentPtrs[j] = content
+			}
+			parsedContentCnt += cnt
+			logGroup.Logs[i] = log
+		}
+	}
+	if parsedContentCnt != contentCnt || offset != uint64(len(arena)) {
+		return nil, errFlatLogGroupCorrupted
+	}
+	return logGroup, nil
+}
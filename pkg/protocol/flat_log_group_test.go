@@ -0,0 +1,193 @@
+// Copyright 2024 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package protocol
+
+import (
+	"encoding/binary"
+	"fmt"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// marshalFlatLogGroup mirrors FlatLogGroup::Serialize in core.
+func marshalFlatLogGroup(logGroup *LogGroup, enableNanosecond bool) []byte {
+	le := binary.LittleEndian
+	contentCnt := 0
+	for _, log := range logGroup.Logs {
+		contentCnt += len(log.Contents)
+	}
+	strs := []string{logGroup.Topic, logGroup.Category}
+	for _, tag := range logGroup.LogTags {
+		strs = append(strs, tag.Key, tag.Value)
+	}
+	for _, log := range logGroup.Logs {
+		for _, content := range log.Contents {
+			strs = append(strs, content.Key, content.Value)
+		}
+	}
+	flags := uint32(0)
+	if enableNanosecond {
+		flags = flatLogGroupFlagTimeNs
+	}
+	res := []byte(flatLogGroupMagic)
+	for _, v := range []uint32{flatLogGroupVersion, uint32(len(logGroup.Logs)), uint32(len(logGroup.LogTags)),
+		uint32(contentCnt), flags} {
+		res = le.AppendUint32(res, v)
+	}
+	for _, log := range logGroup.Logs {
+		res = le.AppendUint32(res, log.Time)
+	}
+	if enableNanosecond {
+		for _, log := range logGroup.Logs {
+			if log.TimeNs != nil {
+				res = le.AppendUint32(res, *log.TimeNs)
+			} else {
+				res = le.AppendUint32(res, flatLogGroupNoTimeNs)
+			}
+		}
+	}
+	for _, log := range logGroup.Logs {
+		res = le.AppendUint32(res, uint32(len(log.Contents)))
+	}
+	for _, s := range strs {
+		res = le.AppendUint32(res, uint32(len(s)))
+	}
+	for _, s := range strs {
+		res = append(res, s...)
+	}
+	return res
+}
+
+func newTestLogGroup(logCnt, contentCnt int) *LogGroup {
+	logGroup := &LogGroup{
+		Topic:    "topic",
+		Category: "logstore",
+		LogTags:  []*LogTag{{Key: "__hostname__", Value: "host"}, {Key: "__path__", Value: "/var/log/a.log"}},
+	}
+	for i := 0; i < logCnt; i++ {
+		ns := uint32(i)
+		log := &Log{Time: 1700000000 + uint32(i), TimeNs: &ns}
+		for j := 0; j < contentCnt; j++ {
+			log.Contents = append(log.Contents, &Log_Content{
+				Key:   fmt.Sprintf("key_%d", j),
+				Value: fmt.Sprintf("value of log %d content %d, which is a little bit longer", i, j),
+			})
+		}
+		logGroup.Logs = append(logGroup.Logs, log)
+	}
+	return logGroup
+}
+
+func TestUnmarshalFlatLogGroup(t *testing.T) {
+	logGroup := newTestLogGroup(10, 5)
+	logGroup.Logs[3].TimeNs = nil
+	logGroup.Logs[4].Contents = nil
+	data := marshalFlatLogGroup(logGroup, true)
+	res, err := UnmarshalFlatLogGroup(data)
+	require.NoError(t, err)
+	assert.Equal(t, logGroup.String(), res.String())
+
+	// strings must not alias the input, which may be released by core after the call
+	for i := range data {
+		data[i] = 0
+	}
+	assert.Equal(t, "logstore", res.Category)
+	assert.Equal(t, "key_0", res.Logs[0].Contents[0].Key)
+
+	// without nanosecond
+	expected := newTestLogGroup(3, 2)
+	res, err = UnmarshalFlatLogGroup(marshalFlatLogGroup(expected, false))
+	require.NoError(t, err)
+	for _, log := range expected.Logs {
+		log.TimeNs = nil
+	}
+	assert.Equal(t, expected.String(), res.String())
+
+	// empty
+	res, err = UnmarshalFlatLogGroup(marshalFlatLogGroup(&LogGroup{}, true))
+	require.NoError(t, err)
+	assert.Empty(t, res.Logs)
+	assert.Empty(t, res.LogTags)
+}
+
+func TestUnmarshalFlatLogGroupInvalid(t *testing.T) {
+	data := marshalFlatLogGroup(newTestLogGroup(2, 2), true)
+
+	_, err := UnmarshalFlatLogGroup(data[:flatLogGroupHeaderSize-1])
+	assert.Error(t, err)
+
+	badMagic := append([]byte{}, data...)
+	badMagic[0] = 'X'
+	_, err = UnmarshalFlatLogGroup(badMagic)
+	assert.Error(t, err)
+
+	badVersion := append([]byte{}, data...)
+	binary.LittleEndian.PutUint32(badVersion[4:], 2)
+	_, err = UnmarshalFlatLogGroup(badVersion)
+	assert.Error(t, err)
+
+	_, err = UnmarshalFlatLogGroup(data[:flatLogGroupHeaderSize+8])
+	assert.Error(t, err)
+	_, err = UnmarshalFlatLogGroup(data[:len(data)-1])
+	assert.Error(t, err)
+	_, err = UnmarshalFlatLogGroup(append(append([]byte{}, data...), 'x'))
+	assert.Error(t, err)
+
+	// content cnt of logs does not match the total
+	badCnt := append([]byte{}, data...)
+	binary.LittleEndian.PutUint32(badCnt[flatLogGroupHeaderSize+16:], 3)
+	_, err = UnmarshalFlatLogGroup(badCnt)
+	assert.Error(t, err)
+}
+
+func TestUnmarshalFlatLogGroupAppend(t *testing.T) {
+	res, err := UnmarshalFlatLogGroup(marshalFlatLogGroup(newTestLogGroup(2, 2), true))
+	require.NoError(t, err)
+	res.Logs[0].Contents = append(res.Logs[0].Contents, &Log_Content{Key: "k", Value: "v"})
+	assert.Equal(t, "key_0", res.Logs[1].Contents[0].Key)
+	assert.Len(t, res.Logs[1].Contents, 2)
+}
+
+// BenchmarkUnmarshalLogGroup compares decoding the data passed by core in flat format and in protobuf.
+func BenchmarkUnmarshalLogGroup(b *testing.B) {
+	for _, size := range []struct{ logCnt, contentCnt int }{{10, 5}, {100, 10}, {1000, 10}} {
+		logGroup := newTestLogGroup(size.logCnt, size.contentCnt)
+		pbData, err := logGroup.Marshal()
+		require.NoError(b, err)
+		flatData := marshalFlatLogGroup(logGroup, true)
+
+		b.Run(fmt.Sprintf("protobuf_%dx%d", size.logCnt, size.contentCnt), func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(pbData)))
+			for i := 0; i < b.N; i++ {
+				res := &LogGroup{}
+				if err := res.Unmarshal(pbData); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(fmt.Sprintf("flat_%dx%d", size.logCnt, size.contentCnt), func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(flatData)))
+			for i := 0; i < b.N; i++ {
+				if _, err := UnmarshalFlatLogGroup(flatData); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
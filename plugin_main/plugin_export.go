@@ -175,6 +175,19 @@ func ProcessLog(configName string, logBytes []byte, packID string, topic string,
 	return config.ProcessLog(logBytes, util.StringDeepCopy(packID), util.StringDeepCopy(topic), tags)
 }
 
+// ProcessLogBatch is the same as ProcessLog, except that logsBytes is a log group holding multiple logs.
+//
+//export ProcessLogBatch
+func ProcessLogBatch(configName string, logsBytes []byte, packID string, topic string, tags []byte) int {
+	pluginmanager.LogtailConfigLock.RLock()
+	config, flag := pluginmanager.LogtailConfig[configName]
+	pluginmanager.LogtailConfigLock.RUnlock()
+	if !flag {
+		return -1
+	}
+	return config.ProcessLogBatch(logsBytes, util.StringDeepCopy(packID), util.StringDeepCopy(topic), tags)
+}
+
 //export ProcessLogGroup
 func ProcessLogGroup(configName string, logBytes []byte, packID string) int {
 	pluginmanager.LogtailConfigLock.RLock()
@@ -187,6 +200,20 @@ func ProcessLogGroup(configName string, logBytes []byte, packID string) int {
 	return config.ProcessLogGroup(logBytes, util.StringDeepCopy(packID))
 }
 
+// ProcessFlatLogGroup is the same as ProcessLogGroup, except that the log group is encoded in flat format.
+//
+//export ProcessFlatLogGroup
+func ProcessFlatLogGroup(configName string, logBytes []byte, packID string) int {
+	pluginmanager.LogtailConfigLock.RLock()
+	config, flag := pluginmanager.LogtailConfig[configName]
+	pluginmanager.LogtailConfigLock.RUnlock()
+	if !flag {
+		logger.Error(context.Background(), "PLUGIN_ALARM", "config not found", configName)
+		return -1
+	}
+	return config.ProcessFlatLogGroup(logBytes, util.StringDeepCopy(packID))
+}
+
 //export StopAllPipelines
 func StopAllPipelines(withInputFlag int) {
 	logger.Info(context.Background(), "Stop all", "start", "with input", withInputFlag)
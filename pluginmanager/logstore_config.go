@@ -282,6 +282,31 @@ func (lc *LogstoreConfig) ProcessLog(logByte []byte, packID string, topic string
 	return 0
 }
 
+// ProcessLogBatch is the same as calling ProcessLog for each log of the log group, only logs of the log group are used.
+func (lc *LogstoreConfig) ProcessLogBatch(logsByte []byte, packID string, topic string, tags []byte) int {
+	logGroup := &protocol.LogGroup{}
+	err := logGroup.Unmarshal(logsByte)
+	if err != nil {
+		logger.Error(lc.Context.GetRuntimeContext(), "WRONG_PROTOBUF_ALARM",
+			"cannot process logs passed by core, err", err)
+		return -1
+	}
+	for _, log := range logGroup.Logs {
+		if len(topic) > 0 {
+			log.Contents = append(log.Contents, &protocol.Log_Content{Key: "__log_topic__", Value: topic})
+		}
+		if !lc.GlobalConfig.UsingOldContentTag {
+			// tags are built for each log, since processors may modify the tags of one log in place
+			logTags := extractTagsToLogTags(tags)
+			lc.PluginRunner.ReceiveRawLog(&pipeline.LogWithContext{Log: log, Context: map[string]interface{}{"source": packID, "topic": topic, "tags": logTags}})
+		} else {
+			extractTags(tags, log)
+			lc.PluginRunner.ReceiveRawLog(&pipeline.LogWithContext{Log: log, Context: map[string]interface{}{"source": packID, "topic": topic}})
+		}
+	}
+	return 0
+}
+
 func (lc *LogstoreConfig) ProcessLogGroup(logByte []byte, packID string) int {
 	logGroup := &protocol.LogGroup{}
 	err := logGroup.Unmarshal(logByte)
@@ -297,6 +322,20 @@ func (lc *LogstoreConfig) ProcessLogGroup(logByte []byte, packID string) int {
 	return 0
 }
 
+func (lc *LogstoreConfig) ProcessFlatLogGroup(logByte []byte, packID string) int {
+	logGroup, err := protocol.UnmarshalFlatLogGroup(logByte)
+	if err != nil {
+		logger.Error(lc.Context.GetRuntimeContext(), "WRONG_PROTOBUF_ALARM",
+			"cannot process flat log group passed by core, err", err)
+		return -1
+	}
+	lc.PluginRunner.ReceiveLogGroup(pipeline.LogGroupWithContext{
+		LogGroup: logGroup,
+		Context:  map[string]interface{}{ctxKeySource: packID}},
+	)
+	return 0
+}
+
 func hasDockerStdoutInput(plugins map[string]interface{}) bool {
 	inputs, exists := plugins["inputs"]
 	if !exists {
@@ -526,6 +526,41 @@ func TestLogstoreConfig_ProcessRawLogV2(t *testing.T) {
 	}
 }
 
+func TestLogstoreConfig_ProcessLogBatch(t *testing.T) {
+	logGroup := &protocol.LogGroup{}
+	for i := 0; i < 2; i++ {
+		logGroup.Logs = append(logGroup.Logs, &protocol.Log{
+			Contents: []*protocol.Log_Content{{Key: "content", Value: strconv.Itoa(i)}},
+		})
+	}
+	logsByte, err := logGroup.Marshal()
+	require.NoError(t, err)
+
+	l := new(LogstoreConfig)
+	l.PluginRunner = &pluginv1Runner{
+		LogsChan: make(chan *pipeline.LogWithContext, 10),
+	}
+	l.GlobalConfig = &config.LoongcollectorGlobalConfig
+	l.GlobalConfig.UsingOldContentTag = false
+	assert.Equal(t, 0, l.ProcessLogBatch(logsByte, "", "topic", []byte("k1~=~v1")))
+	assert.Equal(t, 2, len(l.PluginRunner.(*pluginv1Runner).LogsChan))
+	log1 := <-l.PluginRunner.(*pluginv1Runner).LogsChan
+	log2 := <-l.PluginRunner.(*pluginv1Runner).LogsChan
+	assert.Equal(t, "0", log1.Log.Contents[0].GetValue())
+	assert.Equal(t, "1", log2.Log.Contents[0].GetValue())
+
+	// tags of each log are independent
+	tags1 := log1.Context["tags"].([]*protocol.LogTag)
+	tags2 := log2.Context["tags"].([]*protocol.LogTag)
+	tags1[0].Value = "modified"
+	tags1 = append(tags1, &protocol.LogTag{Key: "k2", Value: "v2"})
+	assert.Equal(t, 2, len(tags1))
+	assert.Equal(t, 1, len(tags2))
+	assert.Equal(t, "k1", tags2[0].Key)
+	assert.Equal(t, "v1", tags2[0].Value)
+	l.GlobalConfig.UsingOldContentTag = true
+}
+
 func Test_genPluginMeta(t *testing.T) {
 	l := new(LogstoreConfig)
 	{